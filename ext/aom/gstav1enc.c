@@ -142,7 +142,11 @@ enum
   PROP_OVERSHOOT_PCT,
   PROP_BUF_SZ,
   PROP_BUF_INITIAL_SZ,
-  PROP_BUF_OPTIMAL_SZ
+  PROP_BUF_OPTIMAL_SZ,
+  PROP_THREADS,
+  PROP_ROW_MT,
+  PROP_TILE_COLUMNS,
+  PROP_TILE_ROWS
 };
 
 /* From av1/av1_cx_iface.c */
@@ -169,6 +173,10 @@ enum
 #define DEFAULT_TIMEBASE_N                                      1
 #define DEFAULT_TIMEBASE_D                                     30
 #define DEFAULT_BIT_DEPTH                              AOM_BITS_8
+#define DEFAULT_THREADS                                         0
+#define DEFAULT_ROW_MT                                       TRUE
+#define DEFAULT_TILE_COLUMNS                                    0
+#define DEFAULT_TILE_ROWS                                       0
 
 static void gst_av1_enc_finalize (GObject * object);
 static void gst_av1_enc_set_property (GObject * object, guint prop_id,
@@ -362,6 +370,50 @@ gst_av1_enc_class_init (GstAV1EncClass * klass)
           "Decoder buffer optimal size, expressed in units of time (milliseconds)",
           0, G_MAXUINT, DEFAULT_BUF_OPTIMAL_SZ,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAV1Enc::threads:
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_THREADS,
+      g_param_spec_uint ("threads", "Max number of threads to use",
+          "Max number of threads to use encoding, set to 0 determine the "
+          "approximate number of threads that the system schedule",
+          0, 64, DEFAULT_THREADS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAV1Enc::row-mt:
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_ROW_MT,
+      g_param_spec_boolean ("row-mt", "Row based multi-threading",
+          "Enable row based multi-threading",
+          DEFAULT_ROW_MT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAV1Enc::tile-columns:
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_TILE_COLUMNS,
+      g_param_spec_uint ("tile-columns", "Number of tile columns",
+          "Partition into separate vertical tile columns from image frame which "
+          "can enable parallel encoding",
+          0, 6, DEFAULT_TILE_COLUMNS, G_PARAM_READWRITE |
+          G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAV1Enc::tile-rows:
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_TILE_ROWS,
+      g_param_spec_uint ("tile-rows", "Number of tile rows",
+          "Partition into separate horizontal tile rows from image frame which "
+          "can enable parallel encoding",
+          0, 2, DEFAULT_TILE_ROWS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 }
 
 static void
@@ -382,6 +434,10 @@ gst_av1_enc_init (GstAV1Enc * av1enc)
   av1enc->keyframe_dist = 30;
   av1enc->cpu_used = DEFAULT_CPU_USED;
   av1enc->format = AOM_IMG_FMT_I420;
+  av1enc->threads = DEFAULT_THREADS;
+  av1enc->row_mt = DEFAULT_ROW_MT;
+  av1enc->tile_columns = DEFAULT_TILE_COLUMNS;
+  av1enc->tile_rows = DEFAULT_TILE_ROWS;
 
   av1enc->aom_cfg.rc_dropframe_thresh = DEFAULT_DROP_FRAME;
   av1enc->aom_cfg.rc_resize_mode = DEFAULT_RESIZE_MODE;
@@ -637,6 +693,10 @@ gst_av1_enc_set_format (GstVideoEncoder * encoder, GstVideoCodecState * state)
   av1enc->aom_cfg.g_timebase.num = GST_VIDEO_INFO_FPS_D (info);
   av1enc->aom_cfg.g_timebase.den = GST_VIDEO_INFO_FPS_N (info);
   av1enc->aom_cfg.g_error_resilient = AOM_ERROR_RESILIENT_DEFAULT;
+  if (av1enc->threads == DEFAULT_THREADS)
+    av1enc->aom_cfg.g_threads = g_get_num_processors ();
+  else
+    av1enc->aom_cfg.g_threads = av1enc->threads;
   /* TODO: do more configuration including bit_depth config */
 
   av1enc->format =
@@ -662,6 +722,14 @@ gst_av1_enc_set_format (GstVideoEncoder * encoder, GstVideoCodecState * state)
   av1enc->encoder_inited = TRUE;
 
   GST_AV1_ENC_APPLY_CODEC_CONTROL (av1enc, AOME_SET_CPUUSED, av1enc->cpu_used);
+#ifdef AOM_CTRL_AV1E_SET_ROW_MT
+  GST_AV1_ENC_APPLY_CODEC_CONTROL (av1enc, AV1E_SET_ROW_MT,
+      (av1enc->row_mt ? 1 : 0));
+#endif
+  GST_AV1_ENC_APPLY_CODEC_CONTROL (av1enc, AV1E_SET_TILE_COLUMNS,
+      av1enc->tile_columns);
+  GST_AV1_ENC_APPLY_CODEC_CONTROL (av1enc, AV1E_SET_TILE_ROWS,
+      av1enc->tile_rows);
   g_mutex_unlock (&av1enc->encoder_lock);
 
   return TRUE;
@@ -732,16 +800,17 @@ gst_av1_enc_handle_frame (GstVideoEncoder * encoder, GstVideoCodecFrame * frame)
   GstFlowReturn ret = GST_FLOW_OK;
   GstVideoFrame vframe;
 
-  if (!aom_img_alloc (&raw, av1enc->format, av1enc->aom_cfg.g_w,
-          av1enc->aom_cfg.g_h, 1)) {
-    GST_ERROR_OBJECT (encoder, "Failed to initialize encoder");
-    return FALSE;
+  /* Wrap the video frame instead of allocating; gst_av1_enc_fill_image()
+   * points the image planes into the mapped frame anyway */
+  if (!aom_img_wrap (&raw, av1enc->format, av1enc->aom_cfg.g_w,
+          av1enc->aom_cfg.g_h, 1, (unsigned char *) 1)) {
+    GST_ERROR_OBJECT (encoder, "Failed to wrap input frame");
+    return GST_FLOW_ERROR;
   }
 
   gst_video_frame_map (&vframe, &av1enc->input_state->info,
       frame->input_buffer, GST_MAP_READ);
   gst_av1_enc_fill_image (av1enc, &vframe, &raw);
-  gst_video_frame_unmap (&vframe);
 
   if (av1enc->keyframe_dist >= 30) {
     av1enc->keyframe_dist = 0;
@@ -757,7 +826,7 @@ gst_av1_enc_handle_frame (GstVideoEncoder * encoder, GstVideoCodecFrame * frame)
   }
   g_mutex_unlock (&av1enc->encoder_lock);
 
-  aom_img_free (&raw);
+  gst_video_frame_unmap (&vframe);
   gst_video_codec_frame_unref (frame);
 
   if (ret == GST_FLOW_ERROR)
@@ -907,6 +976,31 @@ gst_av1_enc_set_property (GObject * object, guint prop_id,
       av1enc->aom_cfg.rc_buf_optimal_sz = g_value_get_uint (value);
       global = TRUE;
       break;
+    case PROP_THREADS:
+      av1enc->threads = g_value_get_uint (value);
+      if (av1enc->threads == DEFAULT_THREADS)
+        av1enc->aom_cfg.g_threads = g_get_num_processors ();
+      else
+        av1enc->aom_cfg.g_threads = av1enc->threads;
+      global = TRUE;
+      break;
+    case PROP_ROW_MT:
+      av1enc->row_mt = g_value_get_boolean (value);
+#ifdef AOM_CTRL_AV1E_SET_ROW_MT
+      GST_AV1_ENC_APPLY_CODEC_CONTROL (av1enc, AV1E_SET_ROW_MT,
+          (av1enc->row_mt ? 1 : 0));
+#endif
+      break;
+    case PROP_TILE_COLUMNS:
+      av1enc->tile_columns = g_value_get_uint (value);
+      GST_AV1_ENC_APPLY_CODEC_CONTROL (av1enc, AV1E_SET_TILE_COLUMNS,
+          av1enc->tile_columns);
+      break;
+    case PROP_TILE_ROWS:
+      av1enc->tile_rows = g_value_get_uint (value);
+      GST_AV1_ENC_APPLY_CODEC_CONTROL (av1enc, AV1E_SET_TILE_ROWS,
+          av1enc->tile_rows);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -988,6 +1082,18 @@ gst_av1_enc_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_BUF_OPTIMAL_SZ:
       g_value_set_uint (value, av1enc->aom_cfg.rc_buf_optimal_sz);
       break;
+    case PROP_THREADS:
+      g_value_set_uint (value, av1enc->threads);
+      break;
+    case PROP_ROW_MT:
+      g_value_set_boolean (value, av1enc->row_mt);
+      break;
+    case PROP_TILE_COLUMNS:
+      g_value_set_uint (value, av1enc->tile_columns);
+      break;
+    case PROP_TILE_ROWS:
+      g_value_set_uint (value, av1enc->tile_rows);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
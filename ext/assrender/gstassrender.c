@@ -687,6 +687,11 @@ blit_bgra_premultiplied (GstAssRender * render, ASS_Image * ass_image,
     dst_x = ass_image->dst_x + x_off;
     dst_y = ass_image->dst_y + y_off;
 
+    /* images outside the destination rectangle belong to another overlay
+     * rectangle and are blitted by a separate call */
+    if (dst_x < 0 || dst_y < 0)
+      goto next;
+
     w = MIN (ass_image->w, width - dst_x);
     h = MIN (ass_image->h, height - dst_y);
     if (w <= 0 || h <= 0)
@@ -1054,75 +1059,143 @@ gst_ass_render_process_text (GstAssRender * render, GstBuffer * buffer,
   gst_buffer_unmap (buffer, &map);
 }
 
+typedef struct
+{
+  gint x0, y0;
+  gint x1, y1;
+} GstAssRenderBBox;
+
+static gboolean
+gst_ass_render_bbox_overlaps (const GstAssRenderBBox * a,
+    const GstAssRenderBBox * b)
+{
+  return a->x0 < b->x1 && b->x0 < a->x1 && a->y0 < b->y1 && b->y0 < a->y1;
+}
+
+static void
+gst_ass_render_bbox_union (GstAssRenderBBox * a, const GstAssRenderBBox * b)
+{
+  a->x0 = MIN (a->x0, b->x0);
+  a->y0 = MIN (a->y0, b->y0);
+  a->x1 = MAX (a->x1, b->x1);
+  a->y1 = MAX (a->y1, b->y1);
+}
+
 static GstVideoOverlayComposition *
 gst_ass_render_composite_overlay (GstAssRender * render, ASS_Image * images)
 {
-  GstVideoOverlayComposition *composition;
-  GstVideoOverlayRectangle *rectangle;
-  GstVideoMeta *vmeta;
-  GstMapInfo map;
-  GstBuffer *buffer;
+  GstVideoOverlayComposition *composition = NULL;
+  GArray *bboxes;
   ASS_Image *image;
-  gint min_x, min_y;
-  gint max_x, max_y;
-  gint width, height;
-  gint stride;
   gdouble hscale, vscale;
-  gpointer data;
+  gboolean merged;
+  guint i, j;
 
-  min_x = G_MAXINT;
-  min_y = G_MAXINT;
-  max_x = 0;
-  max_y = 0;
+  /* group the images into clusters of overlapping bounding boxes and
+   * create one overlay rectangle per cluster; this keeps the blended
+   * area proportional to what the images actually cover instead of the
+   * union box, which spans almost the whole frame when e.g. top and
+   * bottom captions are on screen at the same time */
+  bboxes = g_array_new (FALSE, FALSE, sizeof (GstAssRenderBBox));
 
-  /* find bounding box of all images, to limit the overlay rectangle size */
   for (image = images; image; image = image->next) {
-    if (min_x > image->dst_x)
-      min_x = image->dst_x;
-    if (min_y > image->dst_y)
-      min_y = image->dst_y;
-    if (max_x < image->dst_x + image->w)
-      max_x = image->dst_x + image->w;
-    if (max_y < image->dst_y + image->h)
-      max_y = image->dst_y + image->h;
-  }
-
-  width = MIN (max_x - min_x, render->ass_frame_width);
-  height = MIN (max_y - min_y, render->ass_frame_height);
+    GstAssRenderBBox bbox;
 
-  GST_DEBUG_OBJECT (render, "render overlay rectangle %dx%d%+d%+d",
-      width, height, min_x, min_y);
+    bbox.x0 = image->dst_x;
+    bbox.y0 = image->dst_y;
+    bbox.x1 = image->dst_x + image->w;
+    bbox.y1 = image->dst_y + image->h;
 
-  buffer = gst_buffer_new_and_alloc (4 * width * height);
-  if (!buffer) {
-    GST_ERROR_OBJECT (render, "Failed to allocate overlay buffer");
-    return NULL;
-  }
-
-  vmeta = gst_buffer_add_video_meta (buffer, GST_VIDEO_FRAME_FLAG_NONE,
-      GST_VIDEO_OVERLAY_COMPOSITION_FORMAT_RGB, width, height);
+    merged = FALSE;
+    for (i = 0; i < bboxes->len; i++) {
+      GstAssRenderBBox *cluster =
+          &g_array_index (bboxes, GstAssRenderBBox, i);
 
-  if (!gst_video_meta_map (vmeta, 0, &map, &data, &stride, GST_MAP_READWRITE)) {
-    GST_ERROR_OBJECT (render, "Failed to map overlay buffer");
-    gst_buffer_unref (buffer);
-    return NULL;
+      if (gst_ass_render_bbox_overlaps (cluster, &bbox)) {
+        gst_ass_render_bbox_union (cluster, &bbox);
+        merged = TRUE;
+        break;
+      }
+    }
+    if (!merged)
+      g_array_append_val (bboxes, bbox);
   }
 
-  blit_bgra_premultiplied (render, images, data, width, height, stride,
-      -min_x, -min_y);
-  gst_video_meta_unmap (vmeta, 0, &map);
+  /* growing a cluster may have made it overlap another one; fold those
+   * together until all clusters are disjoint */
+  do {
+    merged = FALSE;
+    for (i = 0; i < bboxes->len && !merged; i++) {
+      GstAssRenderBBox *a = &g_array_index (bboxes, GstAssRenderBBox, i);
+
+      for (j = i + 1; j < bboxes->len; j++) {
+        GstAssRenderBBox *b = &g_array_index (bboxes, GstAssRenderBBox, j);
+
+        if (gst_ass_render_bbox_overlaps (a, b)) {
+          gst_ass_render_bbox_union (a, b);
+          g_array_remove_index_fast (bboxes, j);
+          merged = TRUE;
+          break;
+        }
+      }
+    }
+  } while (merged);
 
   hscale = (gdouble) render->info.width / (gdouble) render->ass_frame_width;
   vscale = (gdouble) render->info.height / (gdouble) render->ass_frame_height;
 
-  rectangle = gst_video_overlay_rectangle_new_raw (buffer,
-      hscale * min_x, vscale * min_y, hscale * width, vscale * height,
-      GST_VIDEO_OVERLAY_FORMAT_FLAG_PREMULTIPLIED_ALPHA);
+  for (i = 0; i < bboxes->len; i++) {
+    GstAssRenderBBox *bbox = &g_array_index (bboxes, GstAssRenderBBox, i);
+    GstVideoOverlayRectangle *rectangle;
+    GstVideoMeta *vmeta;
+    GstMapInfo map;
+    GstBuffer *buffer;
+    gint width, height;
+    gint stride;
+    gpointer data;
+
+    width = MIN (bbox->x1 - bbox->x0, render->ass_frame_width);
+    height = MIN (bbox->y1 - bbox->y0, render->ass_frame_height);
 
-  gst_buffer_unref (buffer);
+    GST_DEBUG_OBJECT (render, "render overlay rectangle %dx%d%+d%+d",
+        width, height, bbox->x0, bbox->y0);
+
+    buffer = gst_buffer_new_and_alloc (4 * width * height);
+    if (!buffer) {
+      GST_ERROR_OBJECT (render, "Failed to allocate overlay buffer");
+      continue;
+    }
+
+    vmeta = gst_buffer_add_video_meta (buffer, GST_VIDEO_FRAME_FLAG_NONE,
+        GST_VIDEO_OVERLAY_COMPOSITION_FORMAT_RGB, width, height);
+
+    if (!gst_video_meta_map (vmeta, 0, &map, &data, &stride,
+            GST_MAP_READWRITE)) {
+      GST_ERROR_OBJECT (render, "Failed to map overlay buffer");
+      gst_buffer_unref (buffer);
+      continue;
+    }
+
+    /* images from other clusters fall outside this rectangle and are
+     * skipped by the blit */
+    blit_bgra_premultiplied (render, images, data, width, height, stride,
+        -bbox->x0, -bbox->y0);
+    gst_video_meta_unmap (vmeta, 0, &map);
+
+    rectangle = gst_video_overlay_rectangle_new_raw (buffer,
+        hscale * bbox->x0, vscale * bbox->y0, hscale * width, vscale * height,
+        GST_VIDEO_OVERLAY_FORMAT_FLAG_PREMULTIPLIED_ALPHA);
+
+    gst_buffer_unref (buffer);
+
+    if (composition == NULL)
+      composition = gst_video_overlay_composition_new (rectangle);
+    else
+      gst_video_overlay_composition_add_rectangle (composition, rectangle);
+    gst_video_overlay_rectangle_unref (rectangle);
+  }
 
-  composition = gst_video_overlay_composition_new (rectangle);
-  gst_video_overlay_rectangle_unref (rectangle);
+  g_array_free (bboxes, TRUE);
 
   return composition;
 }
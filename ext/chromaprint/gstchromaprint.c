@@ -35,6 +35,13 @@
  * gst-launch-1.0 -m uridecodebin uri=file:///path/to/song.ogg ! audioconvert ! chromaprint ! fakesink
  * ]|
  *
+ * By default, one fingerprint is computed from the first #GstChromaprint:duration
+ * seconds of audio and sent as a tag. For live monitoring of continuous streams,
+ * set #GstChromaprint:fingerprint-interval to a number of seconds; the element
+ * then recycles its Chromaprint context and posts a "chromaprint" element
+ * message on the bus for every interval of audio, with the fields "fingerprint"
+ * (string), "timestamp" (the running time of the start of the window) and
+ * "duration" (the amount of audio the fingerprint covers).
  */
 
 #ifdef HAVE_CONFIG_H
@@ -44,6 +51,7 @@
 #include "gstchromaprint.h"
 
 #define DEFAULT_MAX_DURATION 120
+#define DEFAULT_INTERVAL 0
 
 #define PAD_CAPS \
 	"audio/x-raw, " \
@@ -58,7 +66,8 @@ enum
 {
   PROP_0,
   PROP_FINGERPRINT,
-  PROP_MAX_DURATION
+  PROP_MAX_DURATION,
+  PROP_INTERVAL
 };
 
 #define parent_class gst_chromaprint_parent_class
@@ -97,6 +106,24 @@ gst_chromaprint_class_init (GstChromaprintClass * klass)
           0, G_MAXUINT, DEFAULT_MAX_DURATION,
           G_PARAM_READABLE | G_PARAM_WRITABLE));
 
+  /**
+   * GstChromaprint:fingerprint-interval:
+   *
+   * Post a rolling fingerprint for every n seconds of audio as a
+   * "chromaprint" element message, instead of fingerprinting only the
+   * beginning of the stream. 0 disables this and restores the classic
+   * one-shot behaviour. Windows of 3 seconds or less of audio (for
+   * example, a short remainder at EOS) are skipped.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_INTERVAL,
+      g_param_spec_uint ("fingerprint-interval", "Fingerprint interval",
+          "Post a fingerprint message for every n seconds of audio "
+          "(0 = fingerprint only the first \"duration\" seconds)",
+          0, G_MAXUINT, DEFAULT_INTERVAL,
+          G_PARAM_READABLE | G_PARAM_WRITABLE));
+
   gobject_class->finalize = GST_DEBUG_FUNCPTR (gst_chromaprint_finalize);
 
   gstbasetrans_class->transform_ip =
@@ -127,6 +154,7 @@ gst_chromaprint_reset (GstChromaprint * chromaprint)
 
   chromaprint->nsamples = 0;
   chromaprint->duration = 0;
+  chromaprint->window_start = GST_CLOCK_TIME_NONE;
   chromaprint->record = TRUE;
 }
 
@@ -155,6 +183,52 @@ gst_chromaprint_create_fingerprint (GstChromaprint * chromaprint)
       gst_event_new_tag (tags));
 }
 
+/* Finish the current fingerprint window, post it as an element message and
+ * recycle the context so that the next buffer starts a new window. Used in
+ * the rolling fingerprint mode (fingerprint-interval > 0). */
+static void
+gst_chromaprint_post_fingerprint (GstChromaprint * chromaprint)
+{
+  GstAudioFilter *filter = GST_AUDIO_FILTER (chromaprint);
+  GstStructure *s;
+  GstClockTime duration;
+  gint rate;
+
+  rate = GST_AUDIO_INFO_RATE (&filter->info);
+
+  if (chromaprint->duration <= 3 || rate <= 0)
+    return;
+
+  GST_DEBUG_OBJECT (chromaprint,
+      "Posting fingerprint for window of %d seconds starting at %"
+      GST_TIME_FORMAT, chromaprint->duration,
+      GST_TIME_ARGS (chromaprint->window_start));
+
+  chromaprint_finish (chromaprint->context);
+  if (chromaprint->fingerprint) {
+    chromaprint_dealloc (chromaprint->fingerprint);
+    chromaprint->fingerprint = NULL;
+  }
+  chromaprint_get_fingerprint (chromaprint->context, &chromaprint->fingerprint);
+
+  duration =
+      gst_util_uint64_scale_int (chromaprint->nsamples, GST_SECOND, rate);
+
+  s = gst_structure_new ("chromaprint",
+      "timestamp", GST_TYPE_CLOCK_TIME, chromaprint->window_start,
+      "duration", GST_TYPE_CLOCK_TIME, duration,
+      "fingerprint", G_TYPE_STRING, chromaprint->fingerprint, NULL);
+  gst_element_post_message (GST_ELEMENT (chromaprint),
+      gst_message_new_element (GST_OBJECT (chromaprint), s));
+
+  g_object_notify ((GObject *) chromaprint, "fingerprint");
+
+  /* the next buffer restarts the context for the next window */
+  chromaprint->nsamples = 0;
+  chromaprint->duration = 0;
+  chromaprint->window_start = GST_CLOCK_TIME_NONE;
+}
+
 static void
 gst_chromaprint_init (GstChromaprint * chromaprint)
 {
@@ -163,6 +237,7 @@ gst_chromaprint_init (GstChromaprint * chromaprint)
   chromaprint->context = chromaprint_new (CHROMAPRINT_ALGORITHM_DEFAULT);
   chromaprint->fingerprint = NULL;
   chromaprint->max_duration = DEFAULT_MAX_DURATION;
+  chromaprint->interval = DEFAULT_INTERVAL;
   gst_chromaprint_reset (chromaprint);
 }
 
@@ -214,6 +289,9 @@ gst_chromaprint_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
 
   if (chromaprint->nsamples == 0) {
     chromaprint_start (chromaprint->context, rate, channels);
+    chromaprint->window_start =
+        gst_segment_to_running_time (&trans->segment, GST_FORMAT_TIME,
+        GST_BUFFER_PTS (buf));
   }
   chromaprint->nsamples += nsamples;
   chromaprint->duration = chromaprint->nsamples / rate;
@@ -221,7 +299,11 @@ gst_chromaprint_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
   chromaprint_feed (chromaprint->context, (gint16 *) map_info.data,
       map_info.size / sizeof (guint16));
 
-  if (chromaprint->duration >= chromaprint->max_duration
+  if (chromaprint->interval > 0) {
+    /* rolling mode; window boundaries are aligned to buffer boundaries */
+    if (chromaprint->duration >= chromaprint->interval)
+      gst_chromaprint_post_fingerprint (chromaprint);
+  } else if (chromaprint->duration >= chromaprint->max_duration
       && !chromaprint->fingerprint) {
     gst_chromaprint_create_fingerprint (chromaprint);
   }
@@ -245,7 +327,10 @@ gst_chromaprint_sink_event (GstBaseTransform * trans, GstEvent * event)
       gst_chromaprint_reset (chromaprint);
       break;
     case GST_EVENT_EOS:
-      if (!chromaprint->fingerprint) {
+      if (chromaprint->interval > 0) {
+        /* post whatever remains of the current window */
+        gst_chromaprint_post_fingerprint (chromaprint);
+      } else if (!chromaprint->fingerprint) {
         gst_chromaprint_create_fingerprint (chromaprint);
       }
       break;
@@ -266,6 +351,9 @@ gst_chromaprint_set_property (GObject * object, guint prop_id,
     case PROP_MAX_DURATION:
       chromaprint->max_duration = g_value_get_uint (value);
       break;
+    case PROP_INTERVAL:
+      chromaprint->interval = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -285,6 +373,9 @@ gst_chromaprint_get_property (GObject * object, guint prop_id,
     case PROP_MAX_DURATION:
       g_value_set_uint (value, chromaprint->max_duration);
       break;
+    case PROP_INTERVAL:
+      g_value_set_uint (value, chromaprint->interval);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -63,6 +63,8 @@ struct _GstChromaprint
   guint64              nsamples;
   guint                duration;
   guint                max_duration;
+  guint                interval;
+  GstClockTime         window_start;
 };
 
 struct _GstChromaprintClass
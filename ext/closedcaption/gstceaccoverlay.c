@@ -1422,7 +1422,6 @@ gst_cea_cc_overlay_process_packet (GstCeaCcOverlay * overlay, guint8 cc_type)
 {
   gint16 *index = NULL;
   guint8 *buffer = NULL;
-  guint8 *dtvcc_buffer = NULL;
   gboolean need_render = FALSE;
 
   switch (cc_type) {
@@ -1449,12 +1448,13 @@ gst_cea_cc_overlay_process_packet (GstCeaCcOverlay * overlay, guint8 cc_type)
       GST_LOG_OBJECT (overlay,
           "called - buf[%" G_GINT16_FORMAT "] = %02X:%02X:%02X:%02X", *index,
           buffer[0], buffer[1], buffer[2], buffer[3]);
-      dtvcc_buffer = g_malloc0 (*index + 1);
-      memcpy (dtvcc_buffer, buffer, *index);
+      /* process the packet in place; the accumulation buffer has a spare
+       * byte for the zero guard the decoder's lookahead relies on, so no
+       * per-packet copy is needed */
+      buffer[*index] = 0;
       need_render =
-          gst_cea708dec_process_dtvcc_packet (overlay->decoder, dtvcc_buffer,
+          gst_cea708dec_process_dtvcc_packet (overlay->decoder, buffer,
           *index);
-      g_free (dtvcc_buffer);
       if (need_render)
         gst_cea_cc_overlay_create_and_push_buffer (overlay);
     }
@@ -83,7 +83,9 @@ struct _GstCeaCcOverlay
   gint16 cea608_index[NUM_608_CCTYPES];
   gint16 cea708_index;
   guint8 cea608_buffer[NUM_608_CCTYPES][DTVCC_LENGTH];
-  guint8 cea708_buffer[DTVCC_LENGTH];
+  /* one spare byte so a zero guard can be placed after the accumulated
+   * packet for the decoder's one-byte lookahead (EXT1) */
+  guint8 cea708_buffer[DTVCC_LENGTH + 1];
 
   /* TRUE if input is CDP, FALSE if cc_data triplet */
   gboolean is_cdp;
@@ -154,6 +154,7 @@ static void gst_lcms_get_ready (GstLcms * lcms);
 static void gst_lcms_create_transform (GstLcms * lcms);
 static void gst_lcms_cleanup_cms (GstLcms * lcms);
 static void gst_lcms_init_lookup_table (GstLcms * lcms);
+static void gst_lcms_release_lut (GstLcms * lcms);
 static void gst_lcms_process_rgb (GstLcms * lcms, GstVideoFrame * inframe,
     GstVideoFrame * outframe);
 
@@ -231,6 +232,7 @@ static void
 gst_lcms_init (GstLcms * lcms)
 {
   lcms->color_lut = NULL;
+  lcms->color_lut_key = NULL;
   lcms->cms_inp_profile = NULL;
   lcms->cms_dst_profile = NULL;
   lcms->cms_transform = NULL;
@@ -240,8 +242,7 @@ static void
 gst_lcms_finalize (GObject * object)
 {
   GstLcms *lcms = GST_LCMS (object);
-  if (lcms->color_lut)
-    g_free (lcms->color_lut);
+  gst_lcms_release_lut (lcms);
   g_free (lcms->inp_profile_filename);
   g_free (lcms->dst_profile_filename);
   G_OBJECT_CLASS (gst_lcms_parent_class)->finalize (object);
@@ -497,25 +498,100 @@ gst_lcms_cleanup_cms (GstLcms * lcms)
   }
 }
 
+/* Process-wide cache of precalculated lookup tables, keyed by profile
+ * pair, rendering intent and preserve-black. Only tables built from
+ * profile files (or the sRGB fallback) are shared; embedded profiles
+ * cannot be identified across instances and keep a private table. */
+typedef struct
+{
+  guint32 *color_lut;
+  gint refcount;
+} GstLcmsLutCacheEntry;
+
+static GHashTable *lut_cache;   /* gchar * -> GstLcmsLutCacheEntry */
+G_LOCK_DEFINE_STATIC (lut_cache);
+
 static void
-gst_lcms_init_lookup_table (GstLcms * lcms)
+gst_lcms_lut_cache_entry_free (gpointer data)
 {
-  guint32 p;
-  const guint32 color_max = 0x01000000;
+  GstLcmsLutCacheEntry *entry = data;
 
-  if (lcms->color_lut)
-    g_free (lcms->color_lut);
+  g_free (entry->color_lut);
+  g_free (entry);
+}
 
-  lcms->color_lut = g_new (guint32, color_max);
+static gchar *
+gst_lcms_lut_cache_key (GstLcms * lcms)
+{
+  /* An opened profile without a filename comes from an embedded
+   * attachment and cannot be identified across instances. */
+  if (lcms->cms_inp_profile && !lcms->inp_profile_filename)
+    return NULL;
+
+  return g_strdup_printf ("%s|%s|%d|%d",
+      lcms->inp_profile_filename ? lcms->inp_profile_filename : "(sRGB)",
+      lcms->dst_profile_filename ? lcms->dst_profile_filename : "(sRGB)",
+      lcms->intent, lcms->preserve_black);
+}
 
-  if (lcms->color_lut == NULL) {
-    GST_ELEMENT_ERROR (lcms, RESOURCE, FAILED, ("LUT alloc failed"),
-        ("Unable to open allocate memory for lookup table!"));
+static void
+gst_lcms_release_lut (GstLcms * lcms)
+{
+  if (lcms->color_lut == NULL)
     return;
+
+  if (lcms->color_lut_key) {
+    GstLcmsLutCacheEntry *entry;
+
+    G_LOCK (lut_cache);
+    entry = g_hash_table_lookup (lut_cache, lcms->color_lut_key);
+    if (entry && --entry->refcount == 0)
+      g_hash_table_remove (lut_cache, lcms->color_lut_key);
+    G_UNLOCK (lut_cache);
+
+    g_free (lcms->color_lut_key);
+    lcms->color_lut_key = NULL;
+  } else {
+    g_free (lcms->color_lut);
   }
+  lcms->color_lut = NULL;
+}
+
+static void
+gst_lcms_init_lookup_table (GstLcms * lcms)
+{
+  guint32 p;
+  const guint32 color_max = 0x01000000;
+  gchar *key = NULL;
+
+  gst_lcms_release_lut (lcms);
 
   if (lcms->lookup_method == GST_LCMS_LOOKUP_METHOD_PRECALCULATED) {
     cmsHTRANSFORM hTransform;
+    GstLcmsLutCacheEntry *entry;
+
+    key = gst_lcms_lut_cache_key (lcms);
+    if (key) {
+      G_LOCK (lut_cache);
+      if (!lut_cache)
+        lut_cache = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+            gst_lcms_lut_cache_entry_free);
+      entry = g_hash_table_lookup (lut_cache, key);
+      if (entry) {
+        entry->refcount++;
+        lcms->color_lut = entry->color_lut;
+        lcms->color_lut_key = key;
+        G_UNLOCK (lut_cache);
+        GST_DEBUG_OBJECT (lcms, "reusing shared lookup table '%s'", key);
+        return;
+      }
+      G_UNLOCK (lut_cache);
+    }
+
+    lcms->color_lut = g_new (guint32, color_max);
+    if (lcms->color_lut == NULL)
+      goto alloc_failed;
+
     hTransform =
         cmsCreateTransform (lcms->cms_inp_profile, TYPE_RGB_8,
         lcms->cms_dst_profile, TYPE_RGB_8, lcms->intent, 0);
@@ -524,13 +600,47 @@ gst_lcms_init_lookup_table (GstLcms * lcms)
       cmsDoTransform (hTransform, (const cmsUInt32Number *) &p,
           &lcms->color_lut[p], 1);
     cmsDeleteTransform (hTransform);
+    if (lcms->preserve_black)
+      lcms->color_lut[0] = 0x000000;
     GST_DEBUG_OBJECT (lcms, "writing lookup table finished");
+
+    if (key) {
+      G_LOCK (lut_cache);
+      entry = g_hash_table_lookup (lut_cache, key);
+      if (entry) {
+        /* lost a race against another instance, use its table */
+        entry->refcount++;
+        g_free (lcms->color_lut);
+        lcms->color_lut = entry->color_lut;
+      } else {
+        entry = g_new (GstLcmsLutCacheEntry, 1);
+        entry->color_lut = lcms->color_lut;
+        entry->refcount = 1;
+        g_hash_table_insert (lut_cache, g_strdup (key), entry);
+      }
+      G_UNLOCK (lut_cache);
+      lcms->color_lut_key = key;
+      key = NULL;
+    }
   } else if (lcms->lookup_method == GST_LCMS_LOOKUP_METHOD_CACHED) {
+    lcms->color_lut = g_new (guint32, color_max);
+    if (lcms->color_lut == NULL)
+      goto alloc_failed;
+
     memset (lcms->color_lut, 0xAA, color_max * sizeof (guint32));
     GST_DEBUG_OBJECT (lcms, "initialized empty lookup table for caching");
+    if (lcms->preserve_black)
+      lcms->color_lut[0] = 0x000000;
+  }
+  return;
+
+alloc_failed:
+  {
+    g_free (key);
+    GST_ELEMENT_ERROR (lcms, RESOURCE, FAILED, ("LUT alloc failed"),
+        ("Unable to open allocate memory for lookup table!"));
+    return;
   }
-  if (lcms->preserve_black)
-    lcms->color_lut[0] = 0x000000;
 }
 
 static cmsUInt32Number
@@ -83,6 +83,8 @@ struct _GstLcms
   gchar *dst_profile_filename;
 
   guint32 *color_lut;
+  /* non-NULL when color_lut is shared through the process-wide cache */
+  gchar *color_lut_key;
 
   gboolean preserve_black;
 
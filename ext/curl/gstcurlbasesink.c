@@ -140,6 +140,8 @@ static void gst_curl_base_sink_new_file_notify_unlocked
 static void gst_curl_base_sink_wait_for_transfer_thread_to_send_unlocked
     (GstCurlBaseSink * sink);
 static void gst_curl_base_sink_data_sent_notify (GstCurlBaseSink * sink);
+static void gst_curl_base_sink_release_transfer_buf_unlocked
+    (GstCurlBaseSink * sink);
 static void gst_curl_base_sink_wait_for_response (GstCurlBaseSink * sink);
 static void gst_curl_base_sink_got_response_notify (GstCurlBaseSink * sink);
 
@@ -241,6 +243,7 @@ static void
 gst_curl_base_sink_init (GstCurlBaseSink * sink)
 {
   sink->transfer_buf = g_malloc (sizeof (TransferBuffer));
+  sink->transfer_buf->gstbuf = NULL;
   sink->transfer_cond = g_malloc (sizeof (TransferCondition));
   g_cond_init (&sink->transfer_cond->cond);
   sink->transfer_cond->data_sent = FALSE;
@@ -363,8 +366,6 @@ gst_curl_base_sink_render (GstBaseSink * bsink, GstBuffer * buf)
     goto done;
   }
 
-  g_assert (sink->transfer_cond->data_available == FALSE);
-
   /* if there is no transfer thread created, lets create one */
   if (sink->transfer_thread == NULL) {
     if (!gst_curl_base_sink_transfer_start_unlocked (sink)) {
@@ -373,16 +374,33 @@ gst_curl_base_sink_render (GstBaseSink * bsink, GstBuffer * buf)
     }
   }
 
-  /* make data available for the transfer thread and notify */
+  /* wait until the transfer thread has passed the previous buffer to libcurl.
+   * That upload then overlaps with upstream producing this buffer, so the
+   * streaming thread is only blocked here when it outruns the network. This
+   * will be notified either when the transfer is completed by the curl read
+   * callback or by the thread function if an error has occurred. */
+  gst_curl_base_sink_wait_for_transfer_thread_to_send_unlocked (sink);
+
+  if (sink->flow_ret != GST_FLOW_OK) {
+    goto done;
+  }
+
+  /* hand the buffer over to the transfer thread, which unmaps and unrefs it
+   * once libcurl has consumed all of it, and return without waiting for the
+   * upload to complete */
+  sink->transfer_buf->gstbuf = gst_buffer_ref (buf);
+  sink->transfer_buf->map = map;
   sink->transfer_buf->ptr = data;
   sink->transfer_buf->len = size;
   sink->transfer_buf->offset = 0;
   gst_curl_base_sink_transfer_thread_notify_unlocked (sink);
 
-  /* wait for the transfer thread to send the data. This will be notified
-   * either when transfer is completed by the curl read callback or by
-   * the thread function if an error has occurred. */
-  gst_curl_base_sink_wait_for_transfer_thread_to_send_unlocked (sink);
+  ret = sink->flow_ret;
+  GST_OBJECT_UNLOCK (sink);
+
+  GST_LOG ("exit render");
+
+  return ret;
 
 done:
   gst_buffer_unmap (buf, &map);
@@ -1220,6 +1238,9 @@ gst_curl_base_sink_transfer_thread_func (gpointer data)
 done:
   gst_curl_base_sink_transfer_cleanup (sink);
 
+  /* drop a buffer that was still in flight when the thread terminated */
+  gst_curl_base_sink_release_transfer_buf_unlocked (sink);
+
   /* extract the error code so the lock does not have to be
    * taken when calling the functions below that take the lock
    * on their own */
@@ -1301,13 +1322,16 @@ gst_curl_base_sink_wait_for_data_unlocked (GstCurlBaseSink * sink)
     g_cond_wait (&sink->transfer_cond->cond, GST_OBJECT_GET_LOCK (sink));
   }
 
-  if (sink->transfer_thread_close) {
-    GST_LOG ("wait for data aborted due to thread close");
-  } else if (sink->new_file) {
-    GST_LOG ("wait for data aborted due to new file name");
-  } else {
+  /* drain a buffer that is already in flight before honouring the close or
+   * new-file flags, so that data handed over by the render function is not
+   * lost when EOS arrives while an upload is still pending */
+  if (sink->transfer_cond->data_available) {
     GST_LOG ("wait for data completed");
     data_available = TRUE;
+  } else if (sink->transfer_thread_close) {
+    GST_LOG ("wait for data aborted due to thread close");
+  } else {
+    GST_LOG ("wait for data aborted due to new file name");
   }
 
   return data_available;
@@ -1325,16 +1349,16 @@ static void
     gst_curl_base_sink_wait_for_transfer_thread_to_send_unlocked
     (GstCurlBaseSink * sink)
 {
-  GST_LOG ("waiting for buffer send to complete");
+  GST_LOG ("waiting for previous buffer send to complete");
 
   /* this function should not check if the transfer thread is set to be closed
    * since that flag only can be set by the EOS event (by the pipeline thread).
    * This can therefore never happen while this function is running since this
    * function also is called by the pipeline thread (in the render function) */
-  while (!sink->transfer_cond->data_sent) {
+  while (sink->transfer_cond->data_available && sink->flow_ret == GST_FLOW_OK) {
     g_cond_wait (&sink->transfer_cond->cond, GST_OBJECT_GET_LOCK (sink));
   }
-  GST_LOG ("buffer send completed");
+  GST_LOG ("previous buffer send completed");
 }
 
 static void
@@ -1342,12 +1366,28 @@ gst_curl_base_sink_data_sent_notify (GstCurlBaseSink * sink)
 {
   GST_LOG ("transfer completed");
   GST_OBJECT_LOCK (sink);
+  gst_curl_base_sink_release_transfer_buf_unlocked (sink);
   sink->transfer_cond->data_available = FALSE;
   sink->transfer_cond->data_sent = TRUE;
   g_cond_signal (&sink->transfer_cond->cond);
   GST_OBJECT_UNLOCK (sink);
 }
 
+static void
+gst_curl_base_sink_release_transfer_buf_unlocked (GstCurlBaseSink * sink)
+{
+  TransferBuffer *buffer = sink->transfer_buf;
+
+  if (buffer->gstbuf != NULL) {
+    gst_buffer_unmap (buffer->gstbuf, &buffer->map);
+    gst_buffer_unref (buffer->gstbuf);
+    buffer->gstbuf = NULL;
+  }
+  buffer->ptr = NULL;
+  buffer->len = 0;
+  buffer->offset = 0;
+}
+
 static void
 gst_curl_base_sink_wait_for_response (GstCurlBaseSink * sink)
 {
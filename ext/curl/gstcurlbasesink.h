@@ -48,6 +48,10 @@ struct _TransferBuffer
   guint8 *ptr;
   size_t len;
   size_t offset;
+  /* buffer handed over by the render function, kept mapped and reffed until
+   * the transfer thread has passed all of it to libcurl */
+  GstBuffer *gstbuf;
+  GstMapInfo map;
 };
 
 struct _TransferCondition
@@ -752,8 +752,15 @@ gst_curl_http_src_ref_multi (GstCurlHttpSrc * src)
     /* set up curl */
     klass->multi_task_context.multi_handle = curl_multi_init ();
 
+#ifdef CURLPIPE_MULTIPLEX
+    /* multiplex transfers to the same origin over a single HTTP/2
+     * connection instead of opening one connection per transfer */
+    curl_multi_setopt (klass->multi_task_context.multi_handle,
+        CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#else
     curl_multi_setopt (klass->multi_task_context.multi_handle,
         CURLMOPT_PIPELINING, 1);
+#endif
 #ifdef CURLMOPT_MAX_HOST_CONNECTIONS
     curl_multi_setopt (klass->multi_task_context.multi_handle,
         CURLMOPT_MAX_HOST_CONNECTIONS, 1);
@@ -1145,6 +1152,11 @@ gst_curl_http_src_create_easy_handle (GstCurlHttpSrc * s)
           GST_INFO_OBJECT (s, "HTTP/2 unsupported by libcurl at this time");
         }
       }
+#ifdef CURLPIPE_MULTIPLEX
+      /* prefer waiting for an existing connection to the origin to become
+       * multiplexable over opening another connection */
+      curl_easy_setopt (handle, CURLOPT_PIPEWAIT, 1L);
+#endif
       break;
 #endif
     default:
@@ -2397,6 +2397,17 @@ gst_dash_demux_update_manifest_data (GstAdaptiveDemux * demux,
 
   GST_DEBUG_OBJECT (demux, "Updating manifest file from URL");
 
+  gst_buffer_map (buffer, &mapinfo, GST_MAP_READ);
+  if (gst_mpd_client_manifest_unchanged (dashdemux->client,
+          (gchar *) mapinfo.data, mapinfo.size)) {
+    /* No content change, keep the parsed presentation (and all its
+     * segment lists and timelines) alive as-is */
+    GST_DEBUG_OBJECT (demux, "Manifest content unchanged, skipping update");
+    gst_buffer_unmap (buffer, &mapinfo);
+    return GST_FLOW_OK;
+  }
+  gst_buffer_unmap (buffer, &mapinfo);
+
   /* parse the manifest file */
   new_client = gst_mpd_client_new ();
   gst_mpd_client_set_uri_downloader (new_client, demux->downloader);
@@ -1485,6 +1485,7 @@ gst_mpdparser_parse_seg_base_type_ext (GstSegmentBaseType ** pointer,
   guint intval;
   guint64 int64val;
   gboolean boolval;
+  gdouble doubleval;
   GstRange *rangeval;
 
   gst_mpdparser_free_seg_base_type_ext (*pointer);
@@ -1498,6 +1499,7 @@ gst_mpdparser_parse_seg_base_type_ext (GstSegmentBaseType ** pointer,
   if (parent) {
     seg_base_type->timescale = parent->timescale;
     seg_base_type->presentationTimeOffset = parent->presentationTimeOffset;
+    seg_base_type->availabilityTimeOffset = parent->availabilityTimeOffset;
     seg_base_type->indexRange = gst_mpdparser_clone_range (parent->indexRange);
     seg_base_type->indexRangeExact = parent->indexRangeExact;
     seg_base_type->Initialization =
@@ -1517,6 +1519,10 @@ gst_mpdparser_parse_seg_base_type_ext (GstSegmentBaseType ** pointer,
           "presentationTimeOffset", 0, &int64val)) {
     seg_base_type->presentationTimeOffset = int64val;
   }
+  if (gst_mpdparser_get_xml_prop_double (a_node, "availabilityTimeOffset",
+          &doubleval)) {
+    seg_base_type->availabilityTimeOffset = doubleval;
+  }
   if (gst_mpdparser_get_xml_prop_range (a_node, "indexRange", &rangeval)) {
     if (seg_base_type->indexRange) {
       g_slice_free (GstRange, seg_base_type->indexRange);
@@ -3648,6 +3654,8 @@ gst_mpd_client_free (GstMpdClient * client)
 
   gst_active_streams_free (client);
 
+  g_free (client->mpd_checksum);
+  client->mpd_checksum = NULL;
   g_free (client->mpd_uri);
   client->mpd_uri = NULL;
   g_free (client->mpd_base_uri);
@@ -3864,12 +3872,49 @@ gst_mpd_parse (GstMpdClient * client, const gchar * data, gint size)
     if (ret) {
       gst_mpd_client_check_profiles (client);
       gst_mpd_client_fetch_on_load_external_resources (client);
+
+      g_free (client->mpd_checksum);
+      client->mpd_checksum =
+          g_compute_checksum_for_data (G_CHECKSUM_SHA1, (const guchar *) data,
+          size);
     }
   }
 
   return ret;
 }
 
+/**
+ * gst_mpd_client_manifest_unchanged:
+ * @client: a #GstMpdClient with a parsed manifest
+ * @data: the body of a freshly downloaded manifest
+ * @size: size of @data in bytes
+ *
+ * Checks whether @data is byte-identical to the manifest @client was
+ * parsed from. Live servers frequently return the same MPD between
+ * actual updates when minimumUpdatePeriod is short, in which case the
+ * caller can skip re-parsing and rebuilding the presentation entirely.
+ *
+ * Returns: %TRUE if the manifest content is unchanged
+ */
+gboolean
+gst_mpd_client_manifest_unchanged (GstMpdClient * client, const gchar * data,
+    gint size)
+{
+  gchar *checksum;
+  gboolean unchanged;
+
+  if (client == NULL || client->mpd_checksum == NULL || data == NULL)
+    return FALSE;
+
+  checksum =
+      g_compute_checksum_for_data (G_CHECKSUM_SHA1, (const guchar *) data,
+      size);
+  unchanged = g_strcmp0 (checksum, client->mpd_checksum) == 0;
+  g_free (checksum);
+
+  return unchanged;
+}
+
 const gchar *
 gst_mpdparser_get_baseURL (GstMpdClient * client, guint indexStream)
 {
@@ -3953,12 +3998,21 @@ gst_mpd_client_stream_update_presentation_time_offset (GstMpdClient * client,
     stream->presentationTimeOffset =
         gst_util_uint64_scale (segbase->presentationTimeOffset, GST_SECOND,
         segbase->timescale);
+    /* availabilityTimeOffset is in seconds, not timescale units */
+    if (segbase->availabilityTimeOffset > 0)
+      stream->availabilityTimeOffset =
+          segbase->availabilityTimeOffset * GST_SECOND;
+    else
+      stream->availabilityTimeOffset = 0;
   } else {
     stream->presentationTimeOffset = 0;
+    stream->availabilityTimeOffset = 0;
   }
 
-  GST_LOG ("Setting stream's presentation time offset to %" GST_TIME_FORMAT,
-      GST_TIME_ARGS (stream->presentationTimeOffset));
+  GST_LOG ("Setting stream's presentation time offset to %" GST_TIME_FORMAT
+      ", availability time offset to %" GST_TIME_FORMAT,
+      GST_TIME_ARGS (stream->presentationTimeOffset),
+      GST_TIME_ARGS (stream->availabilityTimeOffset));
 }
 
 gboolean
@@ -4821,17 +4875,21 @@ gst_mpd_client_stream_seek (GstMpdClient * client, GstActiveStream * stream,
   g_return_val_if_fail (stream != NULL, 0);
 
   if (stream->segments) {
-    for (index = 0; index < stream->segments->len; index++) {
-      gboolean in_segment = FALSE;
-      GstMediaSegment *segment = g_ptr_array_index (stream->segments, index);
+    gint low = 0, high = (gint) stream->segments->len - 1;
+
+    /* The segment list is sorted by start time, so instead of walking
+     * the whole list (which can hold tens of thousands of entries for
+     * long DVR windows), binary-search the first segment that ends
+     * after the target timestamp */
+    while (low <= high) {
+      gint mid = low + (high - low) / 2;
+      GstMediaSegment *segment = g_ptr_array_index (stream->segments, mid);
       GstClockTime end_time;
-
-      GST_DEBUG ("Looking at fragment sequence chunk %d / %d", index,
-          stream->segments->len);
+      gboolean in_segment;
 
       end_time =
           gst_mpdparser_get_segment_end_time (client, stream->segments,
-          segment, index);
+          segment, mid);
 
       /* avoid downloading another fragment just for 1ns in reverse mode */
       if (forward)
@@ -4839,49 +4897,58 @@ gst_mpd_client_stream_seek (GstMpdClient * client, GstActiveStream * stream,
       else
         in_segment = ts <= end_time;
 
-      if (in_segment) {
-        GstClockTime chunk_time;
+      if (in_segment)
+        high = mid - 1;
+      else
+        low = mid + 1;
+    }
 
-        selectedChunk = segment;
-        repeat_index = (ts - segment->start) / segment->duration;
+    index = low;
+    GST_DEBUG ("Looking at fragment sequence chunk %d / %d", index,
+        stream->segments->len);
 
-        chunk_time = segment->start + segment->duration * repeat_index;
+    if (index < stream->segments->len) {
+      GstMediaSegment *segment = g_ptr_array_index (stream->segments, index);
+      GstClockTime chunk_time;
 
-        /* At the end of a segment in reverse mode, start from the previous fragment */
-        if (!forward && repeat_index > 0
-            && ((ts - segment->start) % segment->duration == 0))
-          repeat_index--;
+      selectedChunk = segment;
+      repeat_index = (ts - segment->start) / segment->duration;
 
-        if ((flags & GST_SEEK_FLAG_SNAP_NEAREST) == GST_SEEK_FLAG_SNAP_NEAREST) {
-          if (repeat_index + 1 < segment->repeat) {
-            if (ts - chunk_time > chunk_time + segment->duration - ts)
-              repeat_index++;
-          } else if (index + 1 < stream->segments->len) {
-            GstMediaSegment *next_segment =
-                g_ptr_array_index (stream->segments, index + 1);
+      chunk_time = segment->start + segment->duration * repeat_index;
 
-            if (ts - chunk_time > next_segment->start - ts) {
-              repeat_index = 0;
-              selectedChunk = next_segment;
-              index++;
-            }
-          }
-        } else if (((forward && flags & GST_SEEK_FLAG_SNAP_AFTER) ||
-                (!forward && flags & GST_SEEK_FLAG_SNAP_BEFORE)) &&
-            ts != chunk_time) {
+      /* At the end of a segment in reverse mode, start from the previous fragment */
+      if (!forward && repeat_index > 0
+          && ((ts - segment->start) % segment->duration == 0))
+        repeat_index--;
 
-          if (repeat_index + 1 < segment->repeat) {
+      if ((flags & GST_SEEK_FLAG_SNAP_NEAREST) == GST_SEEK_FLAG_SNAP_NEAREST) {
+        if (repeat_index + 1 < segment->repeat) {
+          if (ts - chunk_time > chunk_time + segment->duration - ts)
             repeat_index++;
-          } else {
+        } else if (index + 1 < stream->segments->len) {
+          GstMediaSegment *next_segment =
+              g_ptr_array_index (stream->segments, index + 1);
+
+          if (ts - chunk_time > next_segment->start - ts) {
             repeat_index = 0;
-            if (index + 1 >= stream->segments->len) {
-              selectedChunk = NULL;
-            } else {
-              selectedChunk = g_ptr_array_index (stream->segments, ++index);
-            }
+            selectedChunk = next_segment;
+            index++;
+          }
+        }
+      } else if (((forward && flags & GST_SEEK_FLAG_SNAP_AFTER) ||
+              (!forward && flags & GST_SEEK_FLAG_SNAP_BEFORE)) &&
+          ts != chunk_time) {
+
+        if (repeat_index + 1 < segment->repeat) {
+          repeat_index++;
+        } else {
+          repeat_index = 0;
+          if (index + 1 >= stream->segments->len) {
+            selectedChunk = NULL;
+          } else {
+            selectedChunk = g_ptr_array_index (stream->segments, ++index);
           }
         }
-        break;
       }
     }
 
@@ -6032,6 +6099,15 @@ gst_mpd_client_get_next_segment_availability_start_time (GstMpdClient * client,
     }
   }
 
+  /* availabilityTimeOffset makes segments available for (chunked) download
+   * before they are complete on the server */
+  if (stream->availabilityTimeOffset) {
+    if (stream->availabilityTimeOffset < segmentEndTime)
+      segmentEndTime -= stream->availabilityTimeOffset;
+    else
+      segmentEndTime = 0;
+  }
+
   rv = gst_mpd_client_add_time_difference (availability_start_time,
       segmentEndTime / GST_USECOND);
   gst_date_time_unref (availability_start_time);
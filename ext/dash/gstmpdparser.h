@@ -167,6 +167,7 @@ struct _GstSegmentBaseType
 {
   guint timescale;
   guint64 presentationTimeOffset;
+  gdouble availabilityTimeOffset;  /* in seconds */
   GstRange *indexRange;
   gboolean indexRangeExact;
   /* Initialization node */
@@ -500,6 +501,8 @@ struct _GstActiveStream
   guint segment_repeat_index;                 /* index of the repeat count of a segment */
   GPtrArray *segments;                        /* array of GstMediaSegment */
   GstClockTime presentationTimeOffset;        /* presentation time offset of the current segment */
+  GstClockTime availabilityTimeOffset;        /* how much earlier than its nominal availability
+                                               * start time a segment may be requested */
 };
 
 struct _GstMpdClient
@@ -512,6 +515,7 @@ struct _GstMpdClient
   GList *active_streams;                      /* list of GstActiveStream */
 
   guint update_failed_count;
+  gchar *mpd_checksum;                        /* checksum of the last parsed manifest body */
   gchar *mpd_uri;                             /* manifest file URI */
   gchar *mpd_base_uri;                        /* base URI for resolving relative URIs.
                                                * this will be different for redirects */
@@ -532,6 +536,7 @@ void gst_mpd_client_set_uri_downloader (GstMpdClient * client, GstUriDownloader
 
 /* MPD file parsing */
 gboolean gst_mpd_parse (GstMpdClient *client, const gchar *data, gint size);
+gboolean gst_mpd_client_manifest_unchanged (GstMpdClient *client, const gchar *data, gint size);
 
 /* Streaming management */
 gboolean gst_mpd_client_setup_media_presentation (GstMpdClient *client, GstClockTime time, gint period_index, const gchar *period_id);
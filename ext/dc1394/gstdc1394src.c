@@ -93,6 +93,7 @@ static void gst_dc1394_src_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
 static void gst_dc1394_src_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
+static void gst_dc1394_src_finalize (GObject * object);
 static gboolean gst_dc1394_src_start (GstBaseSrc * bsrc);
 static gboolean gst_dc1394_src_stop (GstBaseSrc * bsrc);
 static gboolean gst_dc1394_src_set_caps (GstBaseSrc * bsrc, GstCaps * caps);
@@ -142,6 +143,7 @@ gst_dc1394_src_class_init (GstDC1394SrcClass * klass)
 
   gobject_class->set_property = gst_dc1394_src_set_property;
   gobject_class->get_property = gst_dc1394_src_get_property;
+  gobject_class->finalize = gst_dc1394_src_finalize;
   g_object_class_install_property (gobject_class, PROP_CAMERA_GUID,
       g_param_spec_string ("guid", "Camera GUID",
           "The hexadecimal representation of the GUID of the camera"
@@ -195,6 +197,10 @@ gst_dc1394_src_init (GstDC1394Src * src)
   src->dc1394 = NULL;
   src->camera = NULL;
   src->caps = NULL;
+  g_mutex_init (&src->frame_lock);
+  g_cond_init (&src->frame_cond);
+  src->outstanding_frames = 0;
+  src->capture_active = FALSE;
 
   gst_base_src_set_live (GST_BASE_SRC (src), TRUE);
   gst_base_src_set_format (GST_BASE_SRC (src), GST_FORMAT_TIME);
@@ -202,6 +208,18 @@ gst_dc1394_src_init (GstDC1394Src * src)
 }
 
 
+static void
+gst_dc1394_src_finalize (GObject * object)
+{
+  GstDC1394Src *src = GST_DC1394_SRC (object);
+
+  g_mutex_clear (&src->frame_lock);
+  g_cond_clear (&src->frame_cond);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+
 static void
 gst_dc1394_src_get_property (GObject * object, guint prop_id, GValue * value,
     GParamSpec * pspec)
@@ -313,6 +331,36 @@ gst_dc1394_src_set_caps (GstBaseSrc * bsrc, GstCaps * caps)
 }
 
 
+typedef struct
+{
+  GstDC1394Src *src;
+  dc1394video_frame_t *frame;
+} GstDC1394SrcFrame;
+
+
+static void
+gst_dc1394_src_frame_release (GstDC1394SrcFrame * wrap)
+{
+  GstDC1394Src *src = wrap->src;
+  dc1394error_t ret;
+
+  g_mutex_lock (&src->frame_lock);
+  if (src->capture_active) {
+    ret = dc1394_capture_enqueue (src->camera, wrap->frame);
+    if (ret != DC1394_SUCCESS) {
+      GST_WARNING_OBJECT (src, "Could not enqueue frame: %s.",
+          dc1394_error_get_string (ret));
+    }
+  }
+  src->outstanding_frames--;
+  g_cond_signal (&src->frame_cond);
+  g_mutex_unlock (&src->frame_lock);
+
+  gst_object_unref (src);
+  g_slice_free (GstDC1394SrcFrame, wrap);
+}
+
+
 static GstFlowReturn
 gst_dc1394_src_create (GstPushSrc * psrc, GstBuffer ** obuf)
 {
@@ -320,6 +368,7 @@ gst_dc1394_src_create (GstPushSrc * psrc, GstBuffer ** obuf)
   GstBuffer *buffer = NULL;
   dc1394video_frame_t *frame;
   dc1394error_t ret;
+  GstDC1394SrcFrame *wrap;
 
   src = GST_DC1394_SRC (psrc);
   ret = dc1394_capture_dequeue (src->camera, DC1394_CAPTURE_POLICY_WAIT,
@@ -330,24 +379,27 @@ gst_dc1394_src_create (GstPushSrc * psrc, GstBuffer ** obuf)
     return GST_FLOW_ERROR;
   }
   /*
-   * TODO: We could create the buffer by wrapping the image bytes in the frame
-   * (enqueing the frame in the notify function) to save the copy operation.
-   * It will only work if all the buffers are disposed before closing the camera
-   * when state changes from PAUSED to READY.
+   * Wrap the image bytes of the DMA frame directly; the destroy notify
+   * enqueues the frame back into the ring once the buffer is disposed.
+   * gst_dc1394_src_stop_cam () waits for all outstanding frames before
+   * the capture is cleared, so the ring stays mapped while buffers are
+   * in flight.
    */
-  buffer = gst_buffer_new_allocate (NULL, frame->image_bytes, NULL);
-  gst_buffer_fill (buffer, 0, frame->image, frame->image_bytes);
+  wrap = g_slice_new (GstDC1394SrcFrame);
+  wrap->src = gst_object_ref (src);
+  wrap->frame = frame;
+  g_mutex_lock (&src->frame_lock);
+  src->outstanding_frames++;
+  g_mutex_unlock (&src->frame_lock);
+  buffer = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+      frame->image, frame->image_bytes, 0, frame->image_bytes, wrap,
+      (GDestroyNotify) gst_dc1394_src_frame_release);
   /*
    * TODO: There is a field timestamp in the frame structure,
    * It is not sure if it could be used as PTS or DTS:
    * we are not sure if it comes from a monotonic clock,
    * and it seems to be left undefined under MS Windows.
    */
-  ret = dc1394_capture_enqueue (src->camera, frame);
-  if (ret != DC1394_SUCCESS) {
-    GST_ELEMENT_WARNING (src, RESOURCE, READ, (NULL),
-        ("Could not enqueue frame: %s.", dc1394_error_get_string (ret)));
-  }
   *obuf = buffer;
   return GST_FLOW_OK;
 }
@@ -634,6 +686,10 @@ gst_dc1394_src_start_cam (GstDC1394Src * src)
     goto error_transmission;
   }
 
+  g_mutex_lock (&src->frame_lock);
+  src->capture_active = TRUE;
+  g_mutex_unlock (&src->frame_lock);
+
   GST_DEBUG_OBJECT (src, "Capture successfully started.");
   return TRUE;
 
@@ -684,6 +740,29 @@ gst_dc1394_src_stop_cam (GstDC1394Src * src)
         dc1394_error_get_string (ret));
   }
 
+  /*
+   * Wait for buffers wrapping DMA frames to come back from downstream
+   * before the capture is cleared and the ring unmapped. By the time we
+   * get here the pads have been flushed, so this normally returns right
+   * away; the wait is bounded in case an application still holds a ref.
+   */
+  g_mutex_lock (&src->frame_lock);
+  if (src->outstanding_frames > 0) {
+    gint64 deadline = g_get_monotonic_time () + G_TIME_SPAN_SECOND;
+
+    while (src->outstanding_frames > 0) {
+      if (!g_cond_wait_until (&src->frame_cond, &src->frame_lock, deadline))
+        break;
+    }
+    if (src->outstanding_frames > 0) {
+      GST_WARNING_OBJECT (src,
+          "%u DMA frames still held downstream, clearing capture anyway.",
+          src->outstanding_frames);
+    }
+  }
+  src->capture_active = FALSE;
+  g_mutex_unlock (&src->frame_lock);
+
   GST_DEBUG_OBJECT (src, "Clear capture resources.");
   ret = dc1394_capture_stop (src->camera);
   if (ret != DC1394_SUCCESS && ret != DC1394_CAPTURE_IS_NOT_SET) {
@@ -47,6 +47,13 @@ struct _GstDC1394Src {
   uint32_t dma_buffer_size;
   dc1394camera_t * camera;
   dc1394_t * dc1394;
+
+  /* DMA frames wrapped in buffers still held downstream,
+   * protected by frame_lock */
+  GMutex frame_lock;
+  GCond frame_cond;
+  guint outstanding_frames;
+  gboolean capture_active;
 };
 
 struct _GstDC1394SrcClass {
@@ -76,7 +76,11 @@ static GParamSpec *properties[NUM_PROPERTIES];
 
 static int connection_ex_index;
 
-static void handle_timeout (gpointer data, gpointer user_data);
+static void handle_thread_pool_work (gpointer data, gpointer user_data);
+
+/* work items for the connection thread pool */
+#define TIMEOUT_WORK   GINT_TO_POINTER (0xc0ffee)
+#define HANDSHAKE_WORK GINT_TO_POINTER (0x5a1ad)
 
 struct _GstDtlsConnectionPrivate
 {
@@ -96,6 +100,7 @@ struct _GstDtlsConnectionPrivate
   GClosure *send_closure;
 
   gboolean timeout_pending;
+  gboolean poll_pending;
   GThreadPool *thread_pool;
 };
 
@@ -186,12 +191,14 @@ gst_dtls_connection_init (GstDtlsConnection * self)
   g_mutex_init (&priv->mutex);
   g_cond_init (&priv->condition);
 
-  /* Thread pool for handling timeouts, we only need one thread for that
-   * really and share threads with all other thread pools around there as
-   * this is not going to happen very often */
-  priv->thread_pool = g_thread_pool_new (handle_timeout, self, 1, FALSE, NULL);
+  /* Thread pool for handling timeouts and deferred handshake work, we only
+   * need one thread for that really and share threads with all other thread
+   * pools around there as this is not going to happen very often */
+  priv->thread_pool =
+      g_thread_pool_new (handle_thread_pool_work, self, 1, FALSE, NULL);
   g_assert (priv->thread_pool);
   priv->timeout_pending = FALSE;
+  priv->poll_pending = FALSE;
 }
 
 static void
@@ -327,7 +334,7 @@ gst_dtls_connection_start (GstDtlsConnection * self, gboolean is_client)
 }
 
 static void
-handle_timeout (gpointer data, gpointer user_data)
+handle_thread_pool_work (gpointer data, gpointer user_data)
 {
   GstDtlsConnection *self = user_data;
   GstDtlsConnectionPrivate *priv;
@@ -336,6 +343,18 @@ handle_timeout (gpointer data, gpointer user_data)
   priv = self->priv;
 
   g_mutex_lock (&priv->mutex);
+
+  if (data == HANDSHAKE_WORK) {
+    priv->poll_pending = FALSE;
+    if (priv->is_alive) {
+      log_state (self, "deferred handshake before poll");
+      openssl_poll (self);
+      log_state (self, "deferred handshake after poll");
+    }
+    g_mutex_unlock (&priv->mutex);
+    return;
+  }
+
   priv->timeout_pending = FALSE;
   if (priv->is_alive) {
     ret = DTLSv1_handle_timeout (priv->ssl);
@@ -365,8 +384,7 @@ schedule_timeout_handling (GstClock * clock, GstClockTime time, GstClockID id,
     self->priv->timeout_pending = TRUE;
 
     GST_TRACE_OBJECT (self, "Schedule timeout now");
-    g_thread_pool_push (self->priv->thread_pool, GINT_TO_POINTER (0xc0ffee),
-        NULL);
+    g_thread_pool_push (self->priv->thread_pool, TIMEOUT_WORK, NULL);
   }
   g_mutex_unlock (&self->priv->mutex);
 
@@ -413,8 +431,7 @@ gst_dtls_connection_check_timeout_locked (GstDtlsConnection * self)
         self->priv->timeout_pending = TRUE;
         GST_TRACE_OBJECT (self, "Schedule timeout now");
 
-        g_thread_pool_push (self->priv->thread_pool, GINT_TO_POINTER (0xc0ffee),
-            NULL);
+        g_thread_pool_push (self->priv->thread_pool, TIMEOUT_WORK, NULL);
       }
     }
   } else {
@@ -544,7 +561,24 @@ gst_dtls_connection_process (GstDtlsConnection * self, gpointer data, gint len)
 
   log_state (self, "process after read");
 
-  openssl_poll (self);
+  if (SSL_is_init_finished (priv->ssl) && priv->keys_exported
+      && !SSL_want_write (priv->ssl)) {
+    /* Steady state, the handshake state machine has nothing to do: skip
+     * polling so application data doesn't pay for SSL_do_handshake() on
+     * every packet */
+    GST_TRACE_OBJECT (self, "handshake idle, skipping poll");
+  } else if (priv->keys_exported && SSL_in_init (priv->ssl)) {
+    /* Renegotiation in progress: drive the handshake from the thread pool
+     * so the streaming thread isn't stalled on handshake crypto while
+     * rekeying. The retransmission timers cover any lost flights */
+    if (!priv->poll_pending) {
+      priv->poll_pending = TRUE;
+      GST_TRACE_OBJECT (self, "deferring handshake poll to thread pool");
+      g_thread_pool_push (priv->thread_pool, HANDSHAKE_WORK, NULL);
+    }
+  } else {
+    openssl_poll (self);
+  }
 
   log_state (self, "process after poll");
 
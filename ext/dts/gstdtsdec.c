@@ -622,12 +622,17 @@ gst_dtsdec_handle_frame (GstAudioDecoder * bdec, GstBuffer * buffer)
       } else {
         gint n, c;
         gint *reorder_map = dts->channel_reorder_map;
+        sample_t *out = (sample_t *) ptr;
 
-        for (n = 0; n < 256; n++) {
-          for (c = 0; c < chans; c++) {
-            ((sample_t *) ptr)[n * chans + reorder_map[c]] =
-                dts->samples[c * 256 + n];
-          }
+        /* interleave one channel at a time; the decoded block is read
+         * linearly and the output stride is constant, which the
+         * compiler can vectorize (and collapse to a memcpy for mono) */
+        for (c = 0; c < chans; c++) {
+          const sample_t *in = dts->samples + c * 256;
+          sample_t *o = out + reorder_map[c];
+
+          for (n = 0; n < 256; n++)
+            o[n * chans] = in[n];
         }
       }
       ptr += 256 * chans * (SAMPLE_WIDTH / 8);
@@ -486,7 +486,10 @@ gst_fdkaacenc_set_format (GstAudioEncoder * enc, GstAudioInfo * info)
 
   gst_audio_encoder_set_frame_max (enc, 1);
   gst_audio_encoder_set_frame_samples_min (enc, enc_info.frameLength);
-  gst_audio_encoder_set_frame_samples_max (enc, enc_info.frameLength);
+  /* Have the base class hand over all queued samples at once and encode
+   * them frame by frame in handle_frame, instead of being called again
+   * for every frameLength samples */
+  gst_audio_encoder_set_frame_samples_max (enc, 0);
   gst_audio_encoder_set_hard_min (enc, FALSE);
   self->outbuf_size = enc_info.maxOutBufBytes;
   self->samples_per_frame = enc_info.frameLength;
@@ -531,7 +534,9 @@ gst_fdkaacenc_handle_frame (GstAudioEncoder * enc, GstBuffer * inbuf)
   GstFlowReturn ret = GST_FLOW_OK;
   GstAudioInfo *info;
   GstMapInfo imap, omap;
-  GstBuffer *outbuf;
+  GstBuffer *outbuf = NULL;
+  guint8 *in_data = NULL, *out_data = NULL;
+  gint in_remaining = 0;
   AACENC_BufDesc in_desc = { 0 };
   AACENC_BufDesc out_desc = { 0 };
   AACENC_InArgs in_args = { 0 };
@@ -554,63 +559,84 @@ gst_fdkaacenc_handle_frame (GstAudioEncoder * enc, GstBuffer * inbuf)
       gst_buffer_map (inbuf, &imap, GST_MAP_READ);
     }
 
-    in_args.numInSamples = imap.size / GST_AUDIO_INFO_BPS (info);
-
-    in_sizes = imap.size;
-    in_el_sizes = GST_AUDIO_INFO_BPS (info);
-    in_desc.numBufs = 1;
-  } else {
-    in_args.numInSamples = -1;
-
-    in_sizes = 0;
-    in_el_sizes = 0;
-    in_desc.numBufs = 0;
+    in_data = imap.data;
+    in_remaining = imap.size;
   }
 
+  /* The descriptors are set up once and stay valid for all the frames
+   * in the buffer, only the input pointer and sizes advance below */
   in_desc.bufferIdentifiers = &in_id;
-  in_desc.bufs = (void *) &imap.data;
+  in_desc.bufs = (void *) &in_data;
   in_desc.bufSizes = &in_sizes;
   in_desc.bufElSizes = &in_el_sizes;
 
-  outbuf = gst_audio_encoder_allocate_output_buffer (enc, self->outbuf_size);
-  if (!outbuf) {
-    ret = GST_FLOW_ERROR;
-    goto out;
-  }
-
-  gst_buffer_map (outbuf, &omap, GST_MAP_WRITE);
-  out_sizes = omap.size;
-  out_el_sizes = 1;
   out_desc.bufferIdentifiers = &out_id;
   out_desc.numBufs = 1;
-  out_desc.bufs = (void *) &omap.data;
+  out_desc.bufs = (void *) &out_data;
   out_desc.bufSizes = &out_sizes;
   out_desc.bufElSizes = &out_el_sizes;
 
-  err = aacEncEncode (self->enc, &in_desc, &out_desc, &in_args, &out_args);
-  if (err == AACENC_ENCODE_EOF && !inbuf)
-    goto out;
-  else if (err != AACENC_OK) {
-    GST_ERROR_OBJECT (self, "Failed to encode data: %d", err);
-    ret = GST_FLOW_ERROR;
-    goto out;
-  }
+  do {
+    if (inbuf) {
+      in_args.numInSamples = in_remaining / GST_AUDIO_INFO_BPS (info);
+      in_sizes = in_remaining;
+      in_el_sizes = GST_AUDIO_INFO_BPS (info);
+      in_desc.numBufs = 1;
+    } else {
+      in_args.numInSamples = -1;
+      in_sizes = 0;
+      in_el_sizes = 0;
+      in_desc.numBufs = 0;
+    }
 
-  if (inbuf) {
-    gst_buffer_unmap (inbuf, &imap);
-    if (self->need_reorder)
-      gst_buffer_unref (inbuf);
-    inbuf = NULL;
-  }
+    /* An output buffer is kept around until the encoder actually
+     * produced a frame for it */
+    if (!outbuf) {
+      outbuf =
+          gst_audio_encoder_allocate_output_buffer (enc, self->outbuf_size);
+      if (!outbuf) {
+        ret = GST_FLOW_ERROR;
+        goto out;
+      }
+
+      gst_buffer_map (outbuf, &omap, GST_MAP_WRITE);
+      out_data = omap.data;
+      out_sizes = omap.size;
+      out_el_sizes = 1;
+    }
 
-  if (!out_args.numOutBytes)
-    goto out;
+    err = aacEncEncode (self->enc, &in_desc, &out_desc, &in_args, &out_args);
+    if (err == AACENC_ENCODE_EOF && !inbuf)
+      goto out;
+    else if (err != AACENC_OK) {
+      GST_ERROR_OBJECT (self, "Failed to encode data: %d", err);
+      ret = GST_FLOW_ERROR;
+      goto out;
+    }
 
-  gst_buffer_unmap (outbuf, &omap);
-  gst_buffer_set_size (outbuf, out_args.numOutBytes);
+    if (inbuf) {
+      gint consumed = out_args.numInSamples * GST_AUDIO_INFO_BPS (info);
 
-  ret = gst_audio_encoder_finish_frame (enc, outbuf, self->samples_per_frame);
-  outbuf = NULL;
+      /* avoid spinning if the encoder neither took nor produced data */
+      if (consumed <= 0 && !out_args.numOutBytes)
+        break;
+
+      in_data += consumed;
+      in_remaining -= consumed;
+    }
+
+    if (out_args.numOutBytes) {
+      gst_buffer_unmap (outbuf, &omap);
+      gst_buffer_set_size (outbuf, out_args.numOutBytes);
+
+      ret =
+          gst_audio_encoder_finish_frame (enc, outbuf,
+          self->samples_per_frame);
+      outbuf = NULL;
+      if (ret != GST_FLOW_OK)
+        goto out;
+    }
+  } while (inbuf && in_remaining > 0);
 
 out:
   if (outbuf) {
@@ -42,6 +42,8 @@
 
 #define FLUID_DEC_RATE 44100
 #define FLUID_DEC_BPS  (4 * 2)
+/* largest number of samples rendered into a single output buffer */
+#define FLUID_DEC_MAX_CHUNK (FLUID_DEC_RATE / 4)
 
 #include <gst/gst.h>
 #include <string.h>
@@ -351,9 +353,8 @@ static GstFlowReturn
 produce_samples (GstFluidDec * fluiddec, GstClockTime pts, guint64 sample)
 {
   GstClockTime duration, timestamp;
-  guint64 samples, offset;
-  GstMapInfo info;
-  GstBuffer *outbuf;
+  guint64 samples, offset, produced;
+  GstFlowReturn ret = GST_FLOW_OK;
 
   samples = sample - fluiddec->last_sample;
   duration = pts - fluiddec->last_pts;
@@ -369,25 +370,47 @@ produce_samples (GstFluidDec * fluiddec, GstClockTime pts, guint64 sample)
   GST_DEBUG_OBJECT (fluiddec, "duration %" GST_TIME_FORMAT
       ", samples %" G_GUINT64_FORMAT, GST_TIME_ARGS (duration), samples);
 
-  outbuf = gst_buffer_new_allocate (NULL, samples * FLUID_DEC_BPS, NULL);
-
-  gst_buffer_map (outbuf, &info, GST_MAP_WRITE);
-  fluid_synth_write_float (fluiddec->synth, samples, info.data, 0, 2,
-      info.data, 1, 2);
-  gst_buffer_unmap (outbuf, &info);
+  /* Cap the size of each rendered buffer so that a long gap between events
+   * neither allocates an unbounded buffer nor spends the whole gap's worth
+   * of synthesis in a single call; downstream can start draining the first
+   * chunk while the rest is still being rendered */
+  produced = 0;
+  while (produced < samples) {
+    guint64 chunk = MIN (samples - produced, FLUID_DEC_MAX_CHUNK);
+    GstClockTime chunk_ts, chunk_end;
+    GstMapInfo info;
+    GstBuffer *outbuf;
+
+    chunk_ts = timestamp + gst_util_uint64_scale (produced, duration, samples);
+    chunk_end = timestamp + gst_util_uint64_scale (produced + chunk,
+        duration, samples);
+
+    outbuf = gst_buffer_new_allocate (NULL, chunk * FLUID_DEC_BPS, NULL);
+
+    gst_buffer_map (outbuf, &info, GST_MAP_WRITE);
+    fluid_synth_write_float (fluiddec->synth, chunk, info.data, 0, 2,
+        info.data, 1, 2);
+    gst_buffer_unmap (outbuf, &info);
+
+    GST_BUFFER_DTS (outbuf) = chunk_ts;
+    GST_BUFFER_PTS (outbuf) = chunk_ts;
+    GST_BUFFER_DURATION (outbuf) = chunk_end - chunk_ts;
+    GST_BUFFER_OFFSET (outbuf) = offset + produced;
+    GST_BUFFER_OFFSET_END (outbuf) = offset + produced + chunk;
+
+    if (fluiddec->discont) {
+      GST_BUFFER_FLAG_SET (outbuf, GST_BUFFER_FLAG_DISCONT);
+      fluiddec->discont = FALSE;
+    }
 
-  GST_BUFFER_DTS (outbuf) = timestamp;
-  GST_BUFFER_PTS (outbuf) = timestamp;
-  GST_BUFFER_DURATION (outbuf) = duration;
-  GST_BUFFER_OFFSET (outbuf) = offset;
-  GST_BUFFER_OFFSET_END (outbuf) = offset + samples;
+    ret = gst_pad_push (fluiddec->srcpad, outbuf);
+    if (ret != GST_FLOW_OK)
+      break;
 
-  if (fluiddec->discont) {
-    GST_BUFFER_FLAG_SET (outbuf, GST_BUFFER_FLAG_DISCONT);
-    fluiddec->discont = FALSE;
+    produced += chunk;
   }
 
-  return gst_pad_push (fluiddec->srcpad, outbuf);
+  return ret;
 }
 
 static void
@@ -210,11 +210,21 @@ gst_gsmdec_parse (GstAudioDecoder * dec, GstAdapter * adapter,
     return GST_FLOW_EOS;
 
   *offset = 0;
-  *length = gsmdec->needed;
 
   /* WAV49 requires alternating 33 and 32 bytes of input */
   if (gsmdec->use_wav49) {
-    gsmdec->needed = (gsmdec->needed == 33 ? 32 : 33);
+    if (gsmdec->needed == 33 && size >= 33 + 32) {
+      /* hand over as many complete 65 byte frame pairs as are queued;
+       * this keeps the 33/32 phase intact and lets handle_frame decode
+       * the whole run in a single pass */
+      *length = (size / (33 + 32)) * (33 + 32);
+    } else {
+      *length = gsmdec->needed;
+      gsmdec->needed = (gsmdec->needed == 33 ? 32 : 33);
+    }
+  } else {
+    /* all complete frames at once */
+    *length = size - (size % gsmdec->needed);
   }
 
   return GST_FLOW_OK;
@@ -260,7 +270,11 @@ gst_gsmdec_handle_frame (GstAudioDecoder * dec, GstBuffer * buffer)
 
   /* always the same amount of output samples (20ms worth per frame) */
   outsize = ENCODED_SAMPLES * frames * sizeof (gsm_signal);
-  outbuf = gst_buffer_new_and_alloc (outsize);
+  outbuf = gst_audio_decoder_allocate_output_buffer (dec, outsize);
+  if (G_UNLIKELY (outbuf == NULL)) {
+    gst_buffer_unmap (buffer, &map);
+    return GST_FLOW_OK;
+  }
 
   gst_buffer_map (outbuf, &omap, GST_MAP_WRITE);
   out_data = (gsm_signal *) omap.data;
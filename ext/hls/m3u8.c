@@ -108,6 +108,7 @@ gst_m3u8_unref (GstM3U8 * self)
     g_list_free (self->files);
 
     g_free (self->last_data);
+    g_free (self->last_key);
     g_mutex_clear (&self->lock);
     g_free (self);
   }
@@ -458,6 +459,9 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
   gint64 mediasequence;
   GList *previous_files = NULL;
   gboolean have_mediasequence = FALSE;
+  gboolean delta_update = FALSE;
+  gsize prefix_len = 0;
+  gchar *input_data = data;
 
   g_return_val_if_fail (self != NULL, FALSE);
   g_return_val_if_fail (data != NULL, FALSE);
@@ -481,27 +485,57 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
 
   if (g_strrstr (data, "\n#EXT-X-STREAM-INF:") != NULL) {
     GST_WARNING ("Not a media playlist, but a master playlist!");
+    g_free (data);
     GST_M3U8_UNLOCK (self);
     return FALSE;
   }
 
   GST_TRACE ("data:\n%s", data);
 
+  /* If the new playlist is the old one with entries only appended, as is
+   * common for live/event playlists, skip re-parsing the unchanged prefix
+   * and only tokenize the appended lines */
+  if (self->last_data && !self->endlist && self->files != NULL
+      && (prefix_len = strlen (self->last_data)) > 0
+      && strncmp (data, self->last_data, prefix_len) == 0
+      && (self->last_data[prefix_len - 1] == '\n'
+          || data[prefix_len] == '\n' || data[prefix_len] == '\r')) {
+    GST_DEBUG ("Delta update of playlist, only parsing %" G_GSIZE_FORMAT
+        " appended bytes", strlen (data) - prefix_len);
+    delta_update = TRUE;
+  }
+
+  /* store data before we modify it for parsing */
   g_free (self->last_data);
-  self->last_data = data;
+  self->last_data = g_strdup (data);
 
   self->current_file = NULL;
-  previous_files = self->files;
-  self->files = NULL;
-  self->duration = GST_CLOCK_TIME_NONE;
-  mediasequence = 0;
+  if (delta_update) {
+    /* restore the tokenizer state from the end of the previous parse and
+     * keep the existing file list (in prepend order) so that the new
+     * entries chain onto it */
+    self->files = g_list_reverse (self->files);
+    mediasequence = self->last_mediasequence;
+    have_mediasequence = self->last_have_mediasequence;
+    current_key = g_strdup (self->last_key);
+    have_iv = self->last_have_iv;
+    memcpy (iv, self->last_iv, sizeof (iv));
+  } else {
+    previous_files = self->files;
+    self->files = NULL;
+    mediasequence = 0;
 
-  /* By default, allow caching */
-  self->allowcache = TRUE;
+    /* By default, allow caching */
+    self->allowcache = TRUE;
+  }
+  self->duration = GST_CLOCK_TIME_NONE;
 
   duration = 0;
   title = NULL;
-  data += 7;
+  if (delta_update)
+    data += prefix_len;
+  else
+    data += 7;
   while (TRUE) {
     gchar *r;
 
@@ -685,8 +719,17 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
     data = g_utf8_next_char (end);      /* skip \n */
   }
 
-  g_free (current_key);
+  g_free (input_data);
+
+  /* remember the tokenizer state so that the next update can be parsed as
+   * a delta of this one */
+  g_free (self->last_key);
+  self->last_key = current_key;
   current_key = NULL;
+  self->last_have_iv = have_iv;
+  memcpy (self->last_iv, iv, sizeof (iv));
+  self->last_mediasequence = mediasequence;
+  self->last_have_mediasequence = have_mediasequence;
 
   self->files = g_list_reverse (self->files);
 
@@ -705,6 +748,8 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
 
     /* error was reported above already */
     if (!consistent) {
+      g_free (self->last_data);
+      self->last_data = NULL;
       GST_M3U8_UNLOCK (self);
       return FALSE;
     }
@@ -712,6 +757,8 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
 
   if (self->files == NULL) {
     GST_ERROR ("Invalid media playlist, it does not contain any media files");
+    g_free (self->last_data);
+    self->last_data = NULL;
     GST_M3U8_UNLOCK (self);
     return FALSE;
   }
@@ -731,6 +778,8 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
         mediasequence = file->sequence;
       } else if (mediasequence >= file->sequence) {
         GST_ERROR ("Non-increasing media sequence");
+        g_free (self->last_data);
+        self->last_data = NULL;
         GST_M3U8_UNLOCK (self);
         return FALSE;
       } else {
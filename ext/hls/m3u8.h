@@ -78,6 +78,15 @@ struct _GstM3U8
 
   /*< private > */
   gchar *last_data;
+
+  /* tokenizer state at the end of the last parse, so that updates which
+   * only append entries can be parsed as a delta of the previous one */
+  gchar *last_key;
+  gboolean last_have_iv;
+  guint8 last_iv[16];
+  gint64 last_mediasequence;
+  gboolean last_have_mediasequence;
+
   GMutex lock;
 
   gint ref_count;               /* ATOMIC */
@@ -33,10 +33,13 @@
  * For each reference frame, IQA will post a message containing
  * a structure named IQA.
  *
- * The only metric supported for now is "dssim", which will be available
- * if https://github.com/pornel/dssim was installed on the system
+ * The "dssim" metric will be available if
+ * https://github.com/pornel/dssim was installed on the system
  * at the time that plugin was compiled.
  *
+ * The "mse" and "psnr" metrics are always available; they are computed
+ * together in a single pass over the frames when do-psnr is set.
+ *
  * For each metric activated, this structure will contain another
  * structure, named after the metric.
  *
@@ -61,6 +64,8 @@
 #include "config.h"
 #endif
 
+#include <math.h>
+
 #include "iqa.h"
 
 #ifdef HAVE_DSSIM
@@ -88,6 +93,7 @@ enum
   PROP_0,
   PROP_DO_SSIM,
   PROP_SSIM_ERROR_THRESHOLD,
+  PROP_DO_PSNR,
   PROP_LAST,
 };
 
@@ -231,6 +237,80 @@ do_dssim (GstIqa * self, GstVideoFrame * ref, GstVideoFrame * cmp,
 }
 #endif
 
+/* Computes MSE and PSNR together in a single pass over both frames,
+ * so the compared data is only read once for the two metrics. */
+static gboolean
+do_psnr (GstIqa * self, GstVideoFrame * ref, GstVideoFrame * cmp,
+    GstStructure * msg_structure, gchar * padname)
+{
+  guint64 sse = 0;
+  gint x, y;
+  gint width, height;
+  const guint8 *ref_data, *cmp_data;
+  gint ref_stride, cmp_stride;
+  gdouble mse, psnr;
+  GstStructure *mse_structure, *psnr_structure;
+
+  if (ref->info.width != cmp->info.width ||
+      ref->info.height != cmp->info.height) {
+    GST_OBJECT_UNLOCK (self);
+
+    GST_ELEMENT_ERROR (self, STREAM, FAILED,
+        ("Video streams do not have the same sizes (add videoscale"
+            " and force the sizes to be equal on all sink pads.)"),
+        ("Reference width %d - compared width: %d. "
+            "Reference height %d - compared height: %d",
+            ref->info.width, cmp->info.width, ref->info.height,
+            cmp->info.height));
+
+    GST_OBJECT_LOCK (self);
+    return FALSE;
+  }
+
+  width = ref->info.width;
+  height = ref->info.height;
+  ref_data = GST_VIDEO_FRAME_PLANE_DATA (ref, 0);
+  cmp_data = GST_VIDEO_FRAME_PLANE_DATA (cmp, 0);
+  ref_stride = GST_VIDEO_FRAME_PLANE_STRIDE (ref, 0);
+  cmp_stride = GST_VIDEO_FRAME_PLANE_STRIDE (cmp, 0);
+
+  for (y = 0; y < height; y++) {
+    const guint8 *r = ref_data + y * ref_stride;
+    const guint8 *c = cmp_data + y * cmp_stride;
+
+    /* Alpha is skipped, the converted frames always carry it */
+    for (x = 0; x < width * 4; x += 4) {
+      gint d0 = (gint) r[x] - (gint) c[x];
+      gint d1 = (gint) r[x + 1] - (gint) c[x + 1];
+      gint d2 = (gint) r[x + 2] - (gint) c[x + 2];
+
+      sse += d0 * d0 + d1 * d1 + d2 * d2;
+    }
+  }
+
+  mse = (gdouble) sse / ((gdouble) width * height * 3);
+  if (mse > 0.0)
+    psnr = 10.0 * log10 (255.0 * 255.0 / mse);
+  else
+    psnr = G_MAXDOUBLE;
+
+  gst_structure_get (msg_structure, "mse", GST_TYPE_STRUCTURE,
+      &mse_structure, NULL);
+  gst_structure_set (mse_structure, padname, G_TYPE_DOUBLE, mse, NULL);
+  gst_structure_set (msg_structure, "mse", GST_TYPE_STRUCTURE,
+      mse_structure, NULL);
+  gst_structure_free (mse_structure);
+
+  gst_structure_get (msg_structure, "psnr", GST_TYPE_STRUCTURE,
+      &psnr_structure, NULL);
+  gst_structure_set (psnr_structure, padname, G_TYPE_DOUBLE, psnr, NULL);
+  gst_structure_set (msg_structure, "psnr", GST_TYPE_STRUCTURE,
+      psnr_structure, NULL);
+  gst_structure_free (psnr_structure);
+
+  return TRUE;
+}
+
 static gboolean
 compare_frames (GstIqa * self, GstVideoFrame * ref, GstVideoFrame * cmp,
     GstBuffer * outbuf, GstStructure * msg_structure, gchar * padname)
@@ -242,6 +322,11 @@ compare_frames (GstIqa * self, GstVideoFrame * ref, GstVideoFrame * cmp,
   }
 #endif
 
+  if (self->do_psnr) {
+    if (!do_psnr (self, ref, cmp, msg_structure, padname))
+      return FALSE;
+  }
+
   return TRUE;
 }
 
@@ -261,6 +346,13 @@ gst_iqa_aggregate_frames (GstVideoAggregator * vagg, GstBuffer * outbuf)
     self->max_dssim = 0.0;
   }
 
+  if (self->do_psnr) {
+    gst_structure_set (msg_structure, "mse", GST_TYPE_STRUCTURE,
+        gst_structure_new_empty ("mse"), NULL);
+    gst_structure_set (msg_structure, "psnr", GST_TYPE_STRUCTURE,
+        gst_structure_new_empty ("psnr"), NULL);
+  }
+
   GST_OBJECT_LOCK (vagg);
   for (l = GST_ELEMENT (vagg)->sinkpads; l; l = l->next) {
     GstVideoAggregatorPad *pad = l->data;
@@ -318,6 +410,11 @@ _set_property (GObject * object, guint prop_id, const GValue * value,
       self->ssim_threshold = g_value_get_double (value);
       GST_OBJECT_UNLOCK (self);
       break;
+    case PROP_DO_PSNR:
+      GST_OBJECT_LOCK (self);
+      self->do_psnr = g_value_get_boolean (value);
+      GST_OBJECT_UNLOCK (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -341,6 +438,11 @@ _get_property (GObject * object,
       g_value_set_double (value, self->ssim_threshold);
       GST_OBJECT_UNLOCK (self);
       break;
+    case PROP_DO_PSNR:
+      GST_OBJECT_LOCK (self);
+      g_value_set_boolean (value, self->do_psnr);
+      GST_OBJECT_UNLOCK (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -378,6 +480,18 @@ gst_iqa_class_init (GstIqaClass * klass)
           -1.0, G_MAXDOUBLE, DEFAULT_DSSIM_ERROR_THRESHOLD, G_PARAM_READWRITE));
 #endif
 
+  /**
+   * iqa:do-psnr:
+   *
+   * Run MSE and PSNR checks. Both metrics are computed together in a
+   * single pass over the compared frames.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_DO_PSNR,
+      g_param_spec_boolean ("do-psnr", "do-psnr",
+          "Run MSE and PSNR checks", FALSE, G_PARAM_READWRITE));
+
   gst_element_class_set_static_metadata (gstelement_class, "Iqa",
       "Filter/Analyzer/Video",
       "Provides various Image Quality Assessment metrics",
@@ -49,6 +49,7 @@ struct _GstIqa
   GstVideoAggregator videoaggregator;
 
   gboolean do_dssim;
+  gboolean do_psnr;
   gdouble ssim_threshold;
   gdouble max_dssim;
 };
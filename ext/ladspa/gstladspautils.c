@@ -145,10 +145,31 @@ gboolean
 gst_ladspa_transform (GstLADSPA * ladspa, guint8 * outdata, guint samples,
     guint8 * indata)
 {
+  const guint audio_in = ladspa->klass->count.audio.in;
+  const guint audio_out = ladspa->klass->count.audio.out;
   LADSPA_Data *in, *out;
 
-  in = g_new0 (LADSPA_Data, samples * ladspa->klass->count.audio.in);
-  out = g_new0 (LADSPA_Data, samples * ladspa->klass->count.audio.out);
+  if (audio_in == 1 && audio_out == 1) {
+    /* Mono data needs no de-interleaving: connect the plugin straight to
+     * the buffers. With the in-place transform both pointers are the
+     * same and the plugin runs in place. */
+    gst_ladspa_connect_audio_in (ladspa, samples, (LADSPA_Data *) indata);
+    gst_ladspa_connect_audio_out (ladspa, samples, (LADSPA_Data *) outdata);
+
+    gst_ladspa_run (ladspa, samples);
+
+    return TRUE;
+  }
+
+  /* de-interleave via the per-element arena instead of allocating
+   * port buffers on every cycle */
+  if (ladspa->scratch_samples < samples) {
+    ladspa->scratch = g_renew (LADSPA_Data, ladspa->scratch,
+        samples * (audio_in + audio_out));
+    ladspa->scratch_samples = samples;
+  }
+  in = ladspa->scratch;
+  out = ladspa->scratch + samples * audio_in;
 
   gst_ladspa_ladspa_deinterleave_data (ladspa, in, samples, indata);
 
@@ -159,9 +180,6 @@ gst_ladspa_transform (GstLADSPA * ladspa, guint8 * outdata, guint samples,
 
   gst_ladspa_interleave_ladspa_data (ladspa, outdata, samples, out);
 
-  g_free (out);
-  g_free (in);
-
   return TRUE;
 }
 
@@ -734,6 +752,9 @@ gst_ladspa_init (GstLADSPA * ladspa, GstLADSPAClass * ladspa_class)
       g_new0 (LADSPA_Data, ladspa_class->count.control.in);
   ladspa->ports.control.out =
       g_new0 (LADSPA_Data, ladspa_class->count.control.out);
+
+  ladspa->scratch = NULL;
+  ladspa->scratch_samples = 0;
 }
 
 void
@@ -741,6 +762,10 @@ gst_ladspa_finalize (GstLADSPA * ladspa)
 {
   GST_DEBUG ("LADSPA finalizing component");
 
+  g_free (ladspa->scratch);
+  ladspa->scratch = NULL;
+  ladspa->scratch_samples = 0;
+
   g_free (ladspa->ports.control.out);
   ladspa->ports.control.out = NULL;
   g_free (ladspa->ports.control.in);
@@ -59,6 +59,10 @@ struct _GstLADSPA
       LADSPA_Data **out;
     } audio;
   } ports;
+
+  /* scratch arena for de-interleaved audio port data, grown on demand */
+  LADSPA_Data *scratch;
+  guint scratch_samples;
 };
 
 struct _GstLADSPAClass
@@ -742,6 +742,11 @@ _gst_libde265_return_image (GstVideoDecoder * decoder,
     uint8_t *dest = GST_VIDEO_FRAME_COMP_DATA (&outframe, plane);
     if (srcstride == width && dststride == width) {
       memcpy (dest, src, height * width);
+    } else if (srcstride == dststride) {
+      /* same padding on both sides, copy the plane in one go; the
+       * last row is copied without the padding in case the output
+       * buffer ends right after the visible data */
+      memcpy (dest, src, (height - 1) * srcstride + width);
     } else {
       while (height--) {
         memcpy (dest, src, width);
@@ -382,7 +382,8 @@ gst_lv2_filter_transform_data (GstLV2Filter * self,
   GstLV2Group *lv2_group;
   GstLV2Port *lv2_port;
   guint j, k, l, nframes, samples, out_samples;
-  gfloat *in = NULL, *out = NULL, *cv = NULL, *mem;
+  guint needed;
+  gfloat *in = NULL, *out = NULL, *cv = NULL, *mem, *scratch;
   gfloat val;
 
   nframes = in_map->size / sizeof (float);
@@ -393,9 +394,22 @@ gst_lv2_filter_transform_data (GstLV2Filter * self,
   GST_LOG_OBJECT (self, "in : samples=%u, nframes=%u, ports=%d", samples,
       nframes, lv2_group->ports->len);
 
+  /* carve de-interleaved and cv port buffers out of the per-element
+   * arena instead of allocating them on every cycle */
+  needed = samples * lv2_class->num_cv_in;
+  if (lv2_group->ports->len > 1)
+    needed += nframes + samples * lv2_group->ports->len;
+
+  if (self->lv2.scratch_size < needed) {
+    self->lv2.scratch = g_renew (gfloat, self->lv2.scratch, needed);
+    self->lv2.scratch_size = needed;
+  }
+  scratch = self->lv2.scratch;
+
   if (lv2_group->ports->len > 1) {
-    in = g_new0 (gfloat, nframes);
-    out = g_new0 (gfloat, samples * lv2_group->ports->len);
+    in = scratch;
+    out = scratch + nframes;
+    scratch = out + samples * lv2_group->ports->len;
     gst_lv2_filter_deinterleave_data (lv2_group->ports->len, in,
         samples, (gfloat *) in_map->data);
   } else {
@@ -422,7 +436,7 @@ gst_lv2_filter_transform_data (GstLV2Filter * self,
   }
 
   /* cv ports */
-  cv = g_new (gfloat, samples * lv2_class->num_cv_in);
+  cv = scratch;
   for (j = k = 0; j < lv2_class->control_in_ports->len; j++) {
     lv2_port = &g_array_index (lv2_class->control_in_ports, GstLV2Port, j);
     if (lv2_port->type != GST_LV2_PORT_CV)
@@ -442,10 +456,7 @@ gst_lv2_filter_transform_data (GstLV2Filter * self,
   if (lv2_group->ports->len > 1) {
     gst_lv2_filter_interleave_data (lv2_group->ports->len,
         (gfloat *) out_map->data, out_samples, out);
-    g_free (out);
-    g_free (in);
   }
-  g_free (cv);
 
   return GST_FLOW_OK;
 }
@@ -393,6 +393,9 @@ gst_lv2_init (GstLV2 * lv2, GstLV2Class * lv2_class)
 
   lv2->ports.control.in = g_new0 (gfloat, lv2_class->control_in_ports->len);
   lv2->ports.control.out = g_new0 (gfloat, lv2_class->control_out_ports->len);
+
+  lv2->scratch = NULL;
+  lv2->scratch_size = 0;
 }
 
 void
@@ -403,6 +406,9 @@ gst_lv2_finalize (GstLV2 * lv2)
   }
   g_free (lv2->ports.control.in);
   g_free (lv2->ports.control.out);
+  g_free (lv2->scratch);
+  lv2->scratch = NULL;
+  lv2->scratch_size = 0;
 }
 
 gboolean
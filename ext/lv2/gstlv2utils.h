@@ -82,6 +82,11 @@ struct _GstLV2
       gfloat *out;
     } control;
   } ports;
+
+  /* scratch arena for de-interleaved audio and cv port data, grown on
+   * demand */
+  gfloat *scratch;
+  guint scratch_size;
 };
 
 struct _GstLV2Class
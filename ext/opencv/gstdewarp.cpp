@@ -163,6 +163,8 @@ gst_dewarp_finalize (GObject * obj)
 
   filter->map_x.release ();
   filter->map_y.release ();
+  filter->map_fixed.release ();
+  filter->map_interp.release ();
 
   G_OBJECT_CLASS (gst_dewarp_parent_class)->finalize (obj);
 }
@@ -466,6 +468,14 @@ gst_dewarp_update_map (GstDewarp * filter)
     }
   }
 
+  /* Precompute the packed fixed-point representation of the maps: the
+   * integer source coordinates interleaved in one plane plus the
+   * interpolation weight table indices in another. remap takes a much
+   * faster code path with these than with the two float planes, at no
+   * visible quality cost for nearest and bilinear sampling */
+  cv::convertMaps (filter->map_x, filter->map_y, filter->map_fixed,
+      filter->map_interp, CV_16SC2);
+
   filter->need_map_update = FALSE;
 
   GST_DEBUG_OBJECT (filter, "update map done");
@@ -626,6 +636,7 @@ gst_dewarp_transform_frame (GstOpencvVideoFilter * btrans, GstBuffer * buffer,
       && outimg.size ().width == filter->out_width
       && outimg.size ().height == filter->out_height) {
     cv::Mat fisheye_image, dewarped_image;
+    const cv::Mat *map1, *map2;
     int inter_mode;
 
     if (filter->need_map_update) {
@@ -651,12 +662,21 @@ gst_dewarp_transform_frame (GstOpencvVideoFilter * btrans, GstBuffer * buffer,
         break;
     }
 
+    /* The packed fixed-point maps only carry bilinear interpolation
+     * weights, the larger kernels need the float coordinates */
+    if (inter_mode == cv::INTER_NEAREST || inter_mode == cv::INTER_LINEAR) {
+      map1 = &filter->map_fixed;
+      map2 = &filter->map_interp;
+    } else {
+      map1 = &filter->map_x;
+      map2 = &filter->map_y;
+    }
+
     fisheye_image = img;
     dewarped_image = outimg;
 
     if (filter->display_mode == GST_DEWARP_DISPLAY_PANORAMA) {
-      cv::remap (fisheye_image, dewarped_image, filter->map_x, filter->map_y,
-          inter_mode);
+      cv::remap (fisheye_image, dewarped_image, *map1, *map2, inter_mode);
     } else if (filter->display_mode == GST_DEWARP_DISPLAY_DOUBLE_PANORAMA) {
       cv::Mat view1, view2, panorama_image, concatenated;
       gint panorama_width, panorama_height;
@@ -664,8 +684,7 @@ gst_dewarp_transform_frame (GstOpencvVideoFilter * btrans, GstBuffer * buffer,
       panorama_height = filter->out_height / 2;
       cv::Size panoramaSize (panorama_width, panorama_height);
       panorama_image.create (panoramaSize, fisheye_image.type ());
-      cv::remap (fisheye_image, panorama_image, filter->map_x, filter->map_y,
-          inter_mode);
+      cv::remap (fisheye_image, panorama_image, *map1, *map2, inter_mode);
       view1 =
           panorama_image (cv::Rect (0, 0, filter->out_width, panorama_height));
       view2 =
@@ -684,8 +703,7 @@ gst_dewarp_transform_frame (GstOpencvVideoFilter * btrans, GstBuffer * buffer,
       view_height = filter->out_height / 2;
       cv::Size panoramaSize (panorama_width, panorama_height);
       panorama_image.create (panoramaSize, fisheye_image.type ());
-      cv::remap (fisheye_image, panorama_image, filter->map_x, filter->map_y,
-          inter_mode);
+      cv::remap (fisheye_image, panorama_image, *map1, *map2, inter_mode);
       view1 = panorama_image (cv::Rect (0, 0, view_width, view_height));
       view2 =
           panorama_image (cv::Rect (view_width, 0, view_width, view_height));
@@ -82,6 +82,10 @@ struct _GstDewarp
   GstOpencvVideoFilter element;
   cv::Mat map_x;
   cv::Mat map_y;
+  /* fixed-point packed version of the maps, used for the nearest and
+   * bilinear interpolation modes */
+  cv::Mat map_fixed;
+  cv::Mat map_interp;
   gdouble x_center;
   gdouble y_center;
   gdouble inner_radius;
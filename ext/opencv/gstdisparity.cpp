@@ -136,6 +136,7 @@ enum
 {
   PROP_0,
   PROP_METHOD,
+  PROP_N_THREADS,
 };
 
 typedef enum
@@ -145,6 +146,14 @@ typedef enum
 } GstDisparityMethod;
 
 #define DEFAULT_METHOD METHOD_SGBM
+#define DEFAULT_N_THREADS 0
+
+/* Vertical overlap between the strips processed by the workers. It
+ * generously covers the SAD window and the reach of the SGBM smoothness
+ * term across the seam; the overlapping rows are discarded at stitch. */
+#define STRIP_MARGIN 32
+/* Strips smaller than this aren't worth a worker */
+#define MIN_STRIP_HEIGHT 64
 
 #define GST_TYPE_DISPARITY_METHOD (gst_disparity_method_get_type ())
 static GType
@@ -200,6 +209,8 @@ static void initialise_disparity (GstDisparity * fs, int width, int height,
 static int initialise_sbm (GstDisparity * filter);
 static int run_sbm_iteration (GstDisparity * filter);
 static int run_sgbm_iteration (GstDisparity * filter);
+static void run_disparity_strip (gpointer data, gpointer user_data);
+static void run_disparity_tiled (GstDisparity * filter);
 
 /* initialize the disparity's class */
 static void
@@ -222,6 +233,22 @@ gst_disparity_class_init (GstDisparityClass * klass)
           GST_TYPE_DISPARITY_METHOD, DEFAULT_METHOD,
           (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 
+  /**
+   * GstDisparity:n-threads:
+   *
+   * Number of worker threads used to compute the disparity map. The
+   * frames are split into horizontal strips with overlapping seams that
+   * are matched independently and stitched back together.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads",
+          "Matching threads",
+          "Number of worker threads for the stereo matching "
+          "(0 = automatic)", 0, 16, DEFAULT_N_THREADS,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
   element_class->change_state = gst_disparity_change_state;
 
   gst_element_class_set_static_metadata (element_class,
@@ -270,8 +297,13 @@ gst_disparity_init (GstDisparity * filter)
 
   g_mutex_init (&filter->lock);
   g_cond_init (&filter->cond);
+  g_mutex_init (&filter->pool_lock);
+  g_cond_init (&filter->pool_cond);
 
   filter->method = DEFAULT_METHOD;
+  filter->n_threads = DEFAULT_N_THREADS;
+  filter->actual_threads = 1;
+  filter->pool = NULL;
 }
 
 static void
@@ -283,6 +315,9 @@ gst_disparity_set_property (GObject * object, guint prop_id,
     case PROP_METHOD:
       filter->method = g_value_get_enum (value);
       break;
+    case PROP_N_THREADS:
+      filter->n_threads = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -299,6 +334,9 @@ gst_disparity_get_property (GObject * object, guint prop_id,
     case PROP_METHOD:
       g_value_set_enum (value, filter->method);
       break;
+    case PROP_N_THREADS:
+      g_value_set_uint (value, filter->n_threads);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -451,8 +489,18 @@ gst_disparity_finalize (GObject * object)
   filter->sbm.release ();
   filter->sgbm.release ();
 
+  if (filter->pool) {
+    g_thread_pool_free (filter->pool, FALSE, TRUE);
+    filter->pool = NULL;
+  }
+  filter->sbm_workers.clear ();
+  filter->sgbm_workers.clear ();
+  filter->strip_outputs.clear ();
+
   gst_caps_replace (&filter->caps, NULL);
 
+  g_cond_clear (&filter->pool_cond);
+  g_mutex_clear (&filter->pool_lock);
   g_cond_clear (&filter->cond);
   g_mutex_clear (&filter->lock);
   G_OBJECT_CLASS (gst_disparity_parent_class)->finalize (object);
@@ -550,22 +598,11 @@ gst_disparity_chain_right (GstPad * pad, GstObject * parent, GstBuffer * buffer)
      ( CV_STEREO_BM_XSOBEL type) and post-filtering (uniqueness check, quadratic
      interpolation and speckle filtering) ""
    */
-  if (METHOD_SGBM == fs->method) {
+  if (METHOD_SGBM == fs->method || METHOD_SBM == fs->method) {
     cvtColor (fs->cvRGB_left, fs->cvGray_left, COLOR_RGB2GRAY);
     cvtColor (fs->cvRGB_right, fs->cvGray_right, COLOR_RGB2GRAY);
-    run_sgbm_iteration (fs);
-    normalize (fs->cvGray_depth_map1, fs->cvGray_depth_map2, 0, 255,
-        NORM_MINMAX, fs->cvGray_depth_map2.type ());
-    cvtColor (fs->cvGray_depth_map2, fs->cvRGB_right, COLOR_GRAY2RGB);
-  }
-  /* Algorithm 1 is the OpenCV Stereo Block Matching, similar to the one
-     developed by Kurt Konolige [A] and that works by using small Sum-of-absolute-
-     differences (SAD) window. See the comments on top of the file.
-   */
-  else if (METHOD_SBM == fs->method) {
-    cvtColor (fs->cvRGB_left, fs->cvGray_left, COLOR_RGB2GRAY);
-    cvtColor (fs->cvRGB_right, fs->cvGray_right, COLOR_RGB2GRAY);
-    run_sbm_iteration (fs);
+    fs->current_method = fs->method;
+    run_disparity_tiled (fs);
     normalize (fs->cvGray_depth_map1, fs->cvGray_depth_map2, 0, 255,
         NORM_MINMAX, fs->cvGray_depth_map2.type ());
     cvtColor (fs->cvGray_depth_map2, fs->cvRGB_right, COLOR_GRAY2RGB);
@@ -625,42 +662,92 @@ initialise_disparity (GstDisparity * fs, int width, int height, int nchannels)
   fs->cvGray_depth_map2.create (fs->imgSize, CV_8UC1);
   fs->cvGray_depth_map1_2.create (fs->imgSize, CV_16SC1);
 
+  /* One worker per strip, bounded by what the frame height allows */
+  fs->actual_threads =
+      fs->n_threads ? fs->n_threads : g_get_num_processors ();
+  fs->actual_threads =
+      CLAMP (fs->actual_threads, 1, MAX (1, height / MIN_STRIP_HEIGHT));
+
+  if (fs->pool) {
+    g_thread_pool_free (fs->pool, FALSE, TRUE);
+    fs->pool = NULL;
+  }
+  if (fs->actual_threads > 1) {
+    fs->pool = g_thread_pool_new (run_disparity_strip, fs,
+        fs->actual_threads, FALSE, NULL);
+    if (!fs->pool) {
+      GST_WARNING_OBJECT (fs, "Failed to create thread pool, "
+          "falling back to single-threaded matching");
+      fs->actual_threads = 1;
+    }
+  }
+  GST_INFO_OBJECT (fs, "Using %u matching threads", fs->actual_threads);
+
   /* Stereo Block Matching methods */
   initialise_sbm (fs);
 }
 
+static Ptr < StereoBM >
+create_sbm_matcher (void)
+{
+  Ptr < StereoBM > sbm = StereoBM::create ();
+
+  sbm->setBlockSize (9);
+  sbm->setNumDisparities (32);
+  sbm->setPreFilterSize (9);
+  sbm->setPreFilterCap (32);
+  sbm->setMinDisparity (0);
+  sbm->setTextureThreshold (0);
+  sbm->setUniquenessRatio (0);
+  sbm->setSpeckleWindowSize (0);
+  sbm->setSpeckleRange (0);
+  sbm->setDisp12MaxDiff (0);
+
+  return sbm;
+}
+
+static Ptr < StereoSGBM >
+create_sgbm_matcher (void)
+{
+  Ptr < StereoSGBM > sgbm = StereoSGBM::create (1, 64, 3);
+
+  sgbm->setMinDisparity (1);
+  sgbm->setNumDisparities (64);
+  sgbm->setBlockSize (3);
+  sgbm->setP1 (200);
+  sgbm->setP2 (255);
+  sgbm->setDisp12MaxDiff (0);
+  sgbm->setPreFilterCap (0);
+  sgbm->setUniquenessRatio (0);
+  sgbm->setSpeckleWindowSize (0);
+  sgbm->setSpeckleRange (0);
+  sgbm->setMode (StereoSGBM::MODE_HH);
+
+  return sgbm;
+}
+
 int
 initialise_sbm (GstDisparity * filter)
 {
+  guint i;
+
   filter->img_right_as_cvMat_gray = Mat (filter->cvGray_right);
   filter->img_left_as_cvMat_gray = Mat (filter->cvGray_left);
   filter->depth_map_as_cvMat = Mat (filter->cvGray_depth_map1);
 
-  filter->sbm = StereoBM::create ();
-  filter->sgbm = StereoSGBM::create (1, 64, 3);
-
-  filter->sbm->setBlockSize (9);
-  filter->sbm->setNumDisparities (32);
-  filter->sbm->setPreFilterSize (9);
-  filter->sbm->setPreFilterCap (32);
-  filter->sbm->setMinDisparity (0);
-  filter->sbm->setTextureThreshold (0);
-  filter->sbm->setUniquenessRatio (0);
-  filter->sbm->setSpeckleWindowSize (0);
-  filter->sbm->setSpeckleRange (0);
-  filter->sbm->setDisp12MaxDiff (0);
-
-  filter->sgbm->setMinDisparity (1);
-  filter->sgbm->setNumDisparities (64);
-  filter->sgbm->setBlockSize (3);
-  filter->sgbm->setP1 (200);
-  filter->sgbm->setP2 (255);
-  filter->sgbm->setDisp12MaxDiff (0);
-  filter->sgbm->setPreFilterCap (0);
-  filter->sgbm->setUniquenessRatio (0);
-  filter->sgbm->setSpeckleWindowSize (0);
-  filter->sgbm->setSpeckleRange (0);
-  filter->sgbm->setMode (StereoSGBM::MODE_HH);
+  filter->sbm = create_sbm_matcher ();
+  filter->sgbm = create_sgbm_matcher ();
+
+  /* The matchers keep internal buffers and are not safe to run concurrently,
+   * so each worker gets its own instance and scratch output */
+  filter->sbm_workers.clear ();
+  filter->sgbm_workers.clear ();
+  filter->strip_outputs.clear ();
+  for (i = 0; i < filter->actual_threads; i++) {
+    filter->sbm_workers.push_back (create_sbm_matcher ());
+    filter->sgbm_workers.push_back (create_sgbm_matcher ());
+    filter->strip_outputs.push_back (Mat ());
+  }
 
   return (0);
 }
@@ -682,3 +769,70 @@ run_sgbm_iteration (GstDisparity * filter)
 
   return (0);
 }
+
+/* Computes the disparity of one horizontal strip of the frame. The strip is
+ * extended by STRIP_MARGIN rows on each side so the matcher sees enough
+ * context around the seams; the overlapping rows are dropped when copying
+ * the result into the shared depth map, so each worker writes a disjoint
+ * row range. Runs on a pool thread, must not take filter->lock (held by the
+ * chain function while the workers run). */
+static void
+run_disparity_strip (gpointer data, gpointer user_data)
+{
+  GstDisparity *filter = GST_DISPARITY (user_data);
+  guint idx = GPOINTER_TO_UINT (data) - 1;
+  int strip_height, top, bottom, ext_top, ext_bottom;
+
+  strip_height = (filter->height + filter->actual_threads - 1) /
+      filter->actual_threads;
+  top = idx * strip_height;
+  bottom = MIN (top + strip_height, filter->height);
+  ext_top = MAX (top - STRIP_MARGIN, 0);
+  ext_bottom = MIN (bottom + STRIP_MARGIN, filter->height);
+
+  if (METHOD_SBM == filter->current_method) {
+    filter->sbm_workers[idx]->compute (filter->
+        img_left_as_cvMat_gray.rowRange (ext_top, ext_bottom),
+        filter->img_right_as_cvMat_gray.rowRange (ext_top, ext_bottom),
+        filter->strip_outputs[idx]);
+  } else {
+    filter->sgbm_workers[idx]->compute (filter->
+        img_left_as_cvMat_gray.rowRange (ext_top, ext_bottom),
+        filter->img_right_as_cvMat_gray.rowRange (ext_top, ext_bottom),
+        filter->strip_outputs[idx]);
+  }
+
+  filter->strip_outputs[idx].rowRange (top - ext_top,
+      top - ext_top + (bottom - top)).copyTo (filter->
+      depth_map_as_cvMat.rowRange (top, bottom));
+
+  g_mutex_lock (&filter->pool_lock);
+  filter->pending_strips--;
+  if (filter->pending_strips == 0)
+    g_cond_signal (&filter->pool_cond);
+  g_mutex_unlock (&filter->pool_lock);
+}
+
+/* Fans the current frame pair out to the workers as horizontal strips and
+ * waits for all of them to land in the depth map */
+static void
+run_disparity_tiled (GstDisparity * filter)
+{
+  guint i;
+
+  if (filter->actual_threads <= 1 || filter->pool == NULL) {
+    if (METHOD_SBM == filter->current_method)
+      run_sbm_iteration (filter);
+    else
+      run_sgbm_iteration (filter);
+    return;
+  }
+
+  g_mutex_lock (&filter->pool_lock);
+  filter->pending_strips = filter->actual_threads;
+  for (i = 0; i < filter->actual_threads; i++)
+    g_thread_pool_push (filter->pool, GUINT_TO_POINTER (i + 1), NULL);
+  while (filter->pending_strips > 0)
+    g_cond_wait (&filter->pool_cond, &filter->pool_lock);
+  g_mutex_unlock (&filter->pool_lock);
+}
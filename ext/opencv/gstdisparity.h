@@ -47,6 +47,8 @@
 #include <gst/gst.h>
 #include <gst/video/video.h>
 
+#include <vector>
+
 #include <opencv2/core.hpp>
 #include <opencv2/calib3d.hpp>
 
@@ -99,6 +101,18 @@ struct _GstDisparity
 
   cv::Ptr<cv::StereoBM> sbm;                    /* cv::StereoBM */
   cv::Ptr<cv::StereoSGBM> sgbm;                /* cv::StereoSGBM */
+
+  /* Tiled multithreaded matching */
+  guint n_threads;            /* property, 0 = automatic */
+  guint actual_threads;
+  gint current_method;
+  GThreadPool *pool;
+  GMutex pool_lock;
+  GCond pool_cond;
+  guint pending_strips;
+  std::vector<cv::Ptr<cv::StereoBM> > sbm_workers;
+  std::vector<cv::Ptr<cv::StereoSGBM> > sgbm_workers;
+  std::vector<cv::Mat> strip_outputs;
 };
 
 struct _GstDisparityClass
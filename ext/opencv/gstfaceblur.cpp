@@ -80,6 +80,8 @@ GST_DEBUG_CATEGORY_STATIC (gst_face_blur_debug);
 #define DEFAULT_MIN_NEIGHBORS 3
 #define DEFAULT_MIN_SIZE_WIDTH 30
 #define DEFAULT_MIN_SIZE_HEIGHT 30
+#define DEFAULT_DETECT_INTERVAL 1
+#define DEFAULT_DETECT_SCALE 1.0
 
 using namespace cv;
 using namespace std;
@@ -91,7 +93,9 @@ enum
   PROP_MIN_NEIGHBORS,
   PROP_FLAGS,
   PROP_MIN_SIZE_WIDTH,
-  PROP_MIN_SIZE_HEIGHT
+  PROP_MIN_SIZE_HEIGHT,
+  PROP_DETECT_INTERVAL,
+  PROP_DETECT_SCALE
 };
 
 /**
@@ -167,6 +171,7 @@ gst_face_blur_finalize (GObject * obj)
   GstFaceBlur *filter = GST_FACE_BLUR (obj);
 
   filter->cvGray.release ();
+  filter->cvScaled.release ();
 
   if (filter->cvCascade)
     delete filter->cvCascade;
@@ -222,6 +227,36 @@ gst_face_blur_class_init (GstFaceBlurClass * klass)
       g_param_spec_int ("min-size-height", "Minimum size height",
           "Minimum window height size", 0, G_MAXINT, DEFAULT_MIN_SIZE_HEIGHT,
           (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+  /**
+   * GstFaceBlur:detect-interval:
+   *
+   * Only run the cascade classifier on every n-th frame and keep blurring
+   * the previously detected regions in between. Detection is by far the
+   * most expensive part of this element, a small interval greatly reduces
+   * CPU usage at the cost of slightly delayed reaction to moving faces.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_DETECT_INTERVAL,
+      g_param_spec_uint ("detect-interval", "Detection interval",
+          "Run the face detector only every n-th frame and reuse the "
+          "previously detected regions in between", 1, G_MAXUINT,
+          DEFAULT_DETECT_INTERVAL,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+  /**
+   * GstFaceBlur:detect-scale:
+   *
+   * Downscale the grayscale image by this factor before running the
+   * cascade classifier, and scale the detected regions back up. Smaller
+   * factors are considerably faster but can miss small faces.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_DETECT_SCALE,
+      g_param_spec_double ("detect-scale", "Detection scale",
+          "Downscale factor applied to the image before face detection "
+          "(1.0 = full resolution)", 0.1, 1.0, DEFAULT_DETECT_SCALE,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 
   gst_element_class_set_static_metadata (element_class,
       "faceblur",
@@ -249,6 +284,9 @@ gst_face_blur_init (GstFaceBlur * filter)
   filter->flags = DEFAULT_FLAGS;
   filter->min_size_width = DEFAULT_MIN_SIZE_WIDTH;
   filter->min_size_height = DEFAULT_MIN_SIZE_HEIGHT;
+  filter->detect_interval = DEFAULT_DETECT_INTERVAL;
+  filter->detect_scale = DEFAULT_DETECT_SCALE;
+  filter->frames_since_detect = 0;
 
   gst_opencv_video_filter_set_in_place (GST_OPENCV_VIDEO_FILTER_CAST (filter),
       TRUE);
@@ -284,6 +322,12 @@ gst_face_blur_set_property (GObject * object, guint prop_id,
     case PROP_FLAGS:
       filter->flags = g_value_get_flags (value);
       break;
+    case PROP_DETECT_INTERVAL:
+      filter->detect_interval = g_value_get_uint (value);
+      break;
+    case PROP_DETECT_SCALE:
+      filter->detect_scale = g_value_get_double (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -315,6 +359,12 @@ gst_face_blur_get_property (GObject * object, guint prop_id,
     case PROP_FLAGS:
       g_value_set_flags (value, filter->flags);
       break;
+    case PROP_DETECT_INTERVAL:
+      g_value_set_uint (value, filter->detect_interval);
+      break;
+    case PROP_DETECT_SCALE:
+      g_value_set_double (value, filter->detect_scale);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -329,6 +379,8 @@ gst_face_blur_set_caps (GstOpencvVideoFilter * transform,
   GstFaceBlur *filter = GST_FACE_BLUR (transform);
 
   filter->cvGray.create (Size (in_width, in_height), CV_8UC1);
+  filter->faces.clear ();
+  filter->frames_since_detect = 0;
 
   return TRUE;
 }
@@ -338,7 +390,6 @@ gst_face_blur_transform_ip (GstOpencvVideoFilter * transform,
     GstBuffer * buffer, Mat img)
 {
   GstFaceBlur *filter = GST_FACE_BLUR (transform);
-  vector < Rect > faces;
   unsigned int i;
 
   if (!filter->cvCascade) {
@@ -352,16 +403,48 @@ gst_face_blur_transform_ip (GstOpencvVideoFilter * transform,
     return GST_FLOW_OK;
   }
 
-  cvtColor (img, filter->cvGray, COLOR_RGB2GRAY);
+  if (filter->frames_since_detect == 0) {
+    gdouble scale = filter->detect_scale;
+
+    cvtColor (img, filter->cvGray, COLOR_RGB2GRAY);
+
+    if (scale < 1.0) {
+      resize (filter->cvGray, filter->cvScaled, Size (), scale, scale,
+          INTER_LINEAR);
+
+      filter->cvCascade->detectMultiScale (filter->cvScaled, filter->faces,
+          filter->scale_factor, filter->min_neighbors, filter->flags,
+          Size (filter->min_size_width * scale,
+              filter->min_size_height * scale), Size (0, 0));
+
+      /* Scale the detected regions back to full resolution */
+      for (i = 0; i < filter->faces.size (); ++i) {
+        Rect *r = &filter->faces[i];
+
+        r->x = r->x / scale;
+        r->y = r->y / scale;
+        r->width = r->width / scale;
+        r->height = r->height / scale;
+        *r &= Rect (0, 0, img.cols, img.rows);
+      }
+    } else {
+      filter->cvCascade->detectMultiScale (filter->cvGray, filter->faces,
+          filter->scale_factor, filter->min_neighbors, filter->flags,
+          Size (filter->min_size_width, filter->min_size_height), Size (0, 0));
+    }
+  }
+
+  if (++filter->frames_since_detect >= filter->detect_interval)
+    filter->frames_since_detect = 0;
+
+  if (!filter->faces.empty ()) {
 
-  filter->cvCascade->detectMultiScale (filter->cvGray, faces,
-      filter->scale_factor, filter->min_neighbors, filter->flags,
-      Size (filter->min_size_width, filter->min_size_height), Size (0, 0));
+    for (i = 0; i < filter->faces.size (); ++i) {
+      Rect *r = &filter->faces[i];
 
-  if (!faces.empty ()) {
+      if (r->width <= 0 || r->height <= 0)
+        continue;
 
-    for (i = 0; i < faces.size (); ++i) {
-      Rect *r = &faces[i];
       Mat roi (img, Rect (r->x, r->y, r->width, r->height));
       blur (roi, roi, Size (11, 11));
       GaussianBlur (roi, roi, Size (11, 11), 0, 0);
@@ -50,6 +50,8 @@
 #include <gst/gst.h>
 #include <gst/opencv/gstopencvvideofilter.h>
 
+#include <vector>
+
 #include <opencv2/core.hpp>
 #include <opencv2/objdetect.hpp>
 
@@ -81,9 +83,15 @@ struct _GstFaceBlur
   gint flags;
   gint min_size_width;
   gint min_size_height;
+  guint detect_interval;
+  gdouble detect_scale;
 
   cv::Mat cvGray;
+  cv::Mat cvScaled;
   cv::CascadeClassifier *cvCascade;
+
+  guint frames_since_detect;
+  std::vector < cv::Rect > faces;
 };
 
 struct _GstFaceBlurClass
@@ -109,7 +109,9 @@ enum
   PROP_0,
   PROP_TEST_MODE,
   PROP_METHOD,
-  PROP_LEARNING_RATE
+  PROP_LEARNING_RATE,
+  PROP_ROI_MODE,
+  PROP_FULL_PASS_INTERVAL
 };
 typedef enum
 {
@@ -121,6 +123,10 @@ typedef enum
 #define DEFAULT_TEST_MODE FALSE
 #define DEFAULT_METHOD  METHOD_MOG2
 #define DEFAULT_LEARNING_RATE  0.01
+#define DEFAULT_ROI_MODE FALSE
+#define DEFAULT_FULL_PASS_INTERVAL 30
+/* Tile edge length for the region-of-change grid */
+#define SEGMENTATION_TILE_SIZE 64
 
 #define GST_TYPE_SEGMENTATION_METHOD (gst_segmentation_method_get_type ())
 static GType
@@ -179,6 +185,7 @@ static void find_connected_components (Mat mask, int poly1_hull0,
 /* MOG (Mixture-of-Gaussians functions */
 static int run_mog_iteration (GstSegmentation * filter);
 static int run_mog2_iteration (GstSegmentation * filter);
+static int run_tiled_bg_iteration (GstSegmentation * filter);
 
 /* initialize the segmentation's class */
 static void
@@ -217,6 +224,39 @@ gst_segmentation_class_init (GstSegmentationClass * klass)
           "Speed with which a motionless foreground pixel would become background (inverse of number of frames)",
           0, 1, DEFAULT_LEARNING_RATE, (GParamFlags) (G_PARAM_READWRITE)));
 
+  /**
+   * GstSegmentation:roi-mode:
+   *
+   * Only update the background model in the tiles where the previous
+   * frame's foreground mask showed activity, with a periodic full pass
+   * over the whole frame. Greatly reduces the CPU load on mostly-static
+   * scenes. Only effective for the mog and mog2 methods.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_ROI_MODE,
+      g_param_spec_boolean ("roi-mode", "roi-mode",
+          "Restrict background model updates to the tiles that showed "
+          "foreground activity in the previous frame (mog/mog2 only)",
+          DEFAULT_ROI_MODE,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
+  /**
+   * GstSegmentation:full-pass-interval:
+   *
+   * How often (in frames) roi-mode runs the background model over the
+   * whole frame instead of only the active tiles. New motion in a tile
+   * that was static so far is picked up on the next full pass, so this
+   * bounds the detection latency in those regions.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_FULL_PASS_INTERVAL,
+      g_param_spec_uint ("full-pass-interval", "full-pass-interval",
+          "Number of frames between full-frame passes in roi-mode",
+          1, G_MAXUINT, DEFAULT_FULL_PASS_INTERVAL,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
   gst_element_class_set_static_metadata (element_class,
       "Foreground/background video sequence segmentation",
       "Filter/Effect/Video",
@@ -240,6 +280,9 @@ gst_segmentation_init (GstSegmentation * filter)
   filter->test_mode = DEFAULT_TEST_MODE;
   filter->framecount = 0;
   filter->learning_rate = DEFAULT_LEARNING_RATE;
+  filter->roi_mode = DEFAULT_ROI_MODE;
+  filter->full_pass_interval = DEFAULT_FULL_PASS_INTERVAL;
+  filter->roi_method = -1;
   gst_opencv_video_filter_set_in_place (GST_OPENCV_VIDEO_FILTER (filter), TRUE);
 }
 
@@ -259,6 +302,12 @@ gst_segmentation_set_property (GObject * object, guint prop_id,
     case PROP_LEARNING_RATE:
       filter->learning_rate = g_value_get_float (value);
       break;
+    case PROP_ROI_MODE:
+      filter->roi_mode = g_value_get_boolean (value);
+      break;
+    case PROP_FULL_PASS_INTERVAL:
+      filter->full_pass_interval = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -281,6 +330,12 @@ gst_segmentation_get_property (GObject * object, guint prop_id,
     case PROP_LEARNING_RATE:
       g_value_set_float (value, filter->learning_rate);
       break;
+    case PROP_ROI_MODE:
+      g_value_set_boolean (value, filter->roi_mode);
+      break;
+    case PROP_FULL_PASS_INTERVAL:
+      g_value_set_uint (value, filter->full_pass_interval);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -322,6 +377,16 @@ gst_segmentation_set_caps (GstOpencvVideoFilter * filter, gint in_width,
   segmentation->mog = bgsegm::createBackgroundSubtractorMOG ();
   segmentation->mog2 = createBackgroundSubtractorMOG2 ();
 
+  /* Region-of-change grid; the per-tile subtractors are (re)built lazily
+   * on the first frame that uses them */
+  segmentation->grid_cols =
+      (in_width + SEGMENTATION_TILE_SIZE - 1) / SEGMENTATION_TILE_SIZE;
+  segmentation->grid_rows =
+      (in_height + SEGMENTATION_TILE_SIZE - 1) / SEGMENTATION_TILE_SIZE;
+  segmentation->roi_method = -1;
+  segmentation->tile_bgsub.clear ();
+  segmentation->tile_active.clear ();
+
   return TRUE;
 }
 
@@ -339,6 +404,8 @@ gst_segmentation_finalize (GObject * object)
   filter->ch3.release ();
   filter->mog.release ();
   filter->mog2.release ();
+  filter->tile_bgsub.clear ();
+  filter->tile_active.clear ();
   g_free (filter->TcodeBook);
 
   G_OBJECT_CLASS (gst_segmentation_parent_class)->finalize (object);
@@ -414,7 +481,10 @@ gst_segmentation_transform_ip (GstOpencvVideoFilter * cvfilter,
    * European Workshop on Advanced Video-Based Surveillance Systems, 2001
    */
   else if (METHOD_MOG == filter->method) {
-    run_mog_iteration (filter);
+    if (filter->roi_mode)
+      run_tiled_bg_iteration (filter);
+    else
+      run_mog_iteration (filter);
   }
   /* Create the foreground and background masks using BackgroundSubtractorMOG2
    * [1], Gaussian Mixture-based Background/Foreground segmentation algorithm.
@@ -427,7 +497,10 @@ gst_segmentation_transform_ip (GstOpencvVideoFilter * cvfilter,
    * per Image Pixel for the Task of Background Subtraction", Pattern
    * Recognition Letters, vol. 27, no. 7, pages 773-780, 2006.   */
   else if (METHOD_MOG2 == filter->method) {
-    run_mog2_iteration (filter);
+    if (filter->roi_mode)
+      run_tiled_bg_iteration (filter);
+    else
+      run_mog2_iteration (filter);
   }
 
   /*  if we want to test_mode, just overwrite the output */
@@ -781,3 +854,90 @@ run_mog2_iteration (GstSegmentation * filter)
 
   return (0);
 }
+
+/* Region-of-change variant of the MOG/MOG2 iterations. The frame is split
+ * into a grid of tiles, each with its own background subtractor; since the
+ * mixture models are purely per-pixel this produces the same mask as the
+ * whole-frame subtractor. On most frames only the tiles that showed
+ * foreground in the previous frame (and their neighbours, to follow motion
+ * across tile borders) are updated, the rest of the mask is left at
+ * background; every full-pass-interval frames all tiles are run so the
+ * model keeps adapting everywhere and new motion in so-far static tiles is
+ * picked up. */
+int
+run_tiled_bg_iteration (GstSegmentation * filter)
+{
+  int r, c, i;
+  int n_tiles = filter->grid_rows * filter->grid_cols;
+  bool full_pass;
+
+  /* (Re)build the tile grid when it doesn't exist yet or the method was
+   * switched; the models start learning from scratch then, as they do for
+   * the whole-frame subtractors on a caps change */
+  if (filter->roi_method != filter->method
+      || (int) filter->tile_bgsub.size () != n_tiles) {
+    filter->tile_bgsub.clear ();
+    for (i = 0; i < n_tiles; i++) {
+      if (METHOD_MOG == filter->method)
+        filter->tile_bgsub.push_back (bgsegm::createBackgroundSubtractorMOG
+            ());
+      else
+        filter->tile_bgsub.push_back (createBackgroundSubtractorMOG2 ());
+    }
+    filter->tile_active.assign (n_tiles, false);
+    filter->roi_method = filter->method;
+    /* Force a full pass so every tile gets a model right away */
+    full_pass = true;
+  } else {
+    full_pass = (filter->framecount % filter->full_pass_interval) == 0;
+  }
+
+  for (r = 0; r < filter->grid_rows; r++) {
+    for (c = 0; c < filter->grid_cols; c++) {
+      Rect rect (c * SEGMENTATION_TILE_SIZE, r * SEGMENTATION_TILE_SIZE,
+          MIN (SEGMENTATION_TILE_SIZE,
+              filter->width - c * SEGMENTATION_TILE_SIZE),
+          MIN (SEGMENTATION_TILE_SIZE,
+              filter->height - r * SEGMENTATION_TILE_SIZE));
+
+      i = r * filter->grid_cols + c;
+      if (full_pass || filter->tile_active[i]) {
+        Mat fg_tile = filter->cvFG (rect);
+
+        filter->tile_bgsub[i]->apply (filter->cvYUV (rect), fg_tile,
+            filter->learning_rate);
+      } else {
+        /* The previous mask had no foreground here and the model is not
+         * updated, so the tile stays background */
+        filter->cvFG (rect).setTo (Scalar::all (0));
+      }
+    }
+  }
+
+  /* Mark the tiles to update next frame: every tile with foreground in the
+   * mask we just computed, expanded to its 8 neighbours so objects moving
+   * into an adjacent tile keep being tracked */
+  std::vector < bool > active (n_tiles, false);
+  for (r = 0; r < filter->grid_rows; r++) {
+    for (c = 0; c < filter->grid_cols; c++) {
+      Rect rect (c * SEGMENTATION_TILE_SIZE, r * SEGMENTATION_TILE_SIZE,
+          MIN (SEGMENTATION_TILE_SIZE,
+              filter->width - c * SEGMENTATION_TILE_SIZE),
+          MIN (SEGMENTATION_TILE_SIZE,
+              filter->height - r * SEGMENTATION_TILE_SIZE));
+
+      if (countNonZero (filter->cvFG (rect)) > 0) {
+        int rr, cc;
+
+        for (rr = MAX (r - 1, 0); rr <= MIN (r + 1, filter->grid_rows - 1);
+            rr++)
+          for (cc = MAX (c - 1, 0); cc <= MIN (c + 1, filter->grid_cols - 1);
+              cc++)
+            active[rr * filter->grid_cols + cc] = true;
+      }
+    }
+  }
+  filter->tile_active = active;
+
+  return (0);
+}
@@ -47,6 +47,8 @@
 #include <gst/gst.h>
 #include <gst/opencv/gstopencvvideofilter.h>
 
+#include <vector>
+
 #include <opencv2/video.hpp>
 #include <opencv2/core.hpp>
 #include <opencv2/bgsegm.hpp>
@@ -109,6 +111,15 @@ struct _GstSegmentation
   cv::Ptr<cv::BackgroundSubtractorMOG2> mog2;                   /* cv::BackgroundSubtractorMOG2 */
 
   double learning_rate;
+
+  /* region-of-change mode: per-tile subtractors, updated only where the
+   * previous frame's foreground mask showed activity */
+  gboolean roi_mode;
+  guint full_pass_interval;
+  gint grid_cols, grid_rows;
+  gint roi_method;              /* method the tile grid was built for */
+  std::vector<cv::Ptr<cv::BackgroundSubtractor> > tile_bgsub;
+  std::vector<bool> tile_active;
 };
 
 struct _GstSegmentationClass
@@ -29,6 +29,7 @@
 
 #include <ImfRgbaFile.h>
 #include <ImfIO.h>
+#include <ImfThreading.h>
 using namespace Imf;
 using namespace Imath;
 
@@ -154,13 +155,28 @@ gst_openexr_dec_init (GstOpenEXRDec * self)
   GST_PAD_SET_ACCEPT_TEMPLATE (GST_VIDEO_DECODER_SINK_PAD (self));
 }
 
+static gpointer
+gst_openexr_dec_setup_thread_pool (gpointer data)
+{
+  /* The IlmThread worker pool is process-global and shared by all
+   * decoder instances; reading scanlines uses it implicitly once a
+   * thread count is set */
+  if (globalThreadCount () == 0)
+    setGlobalThreadCount (g_get_num_processors ());
+
+  return NULL;
+}
+
 static gboolean
 gst_openexr_dec_start (GstVideoDecoder * decoder)
 {
   GstOpenEXRDec *self = GST_OPENEXR_DEC (decoder);
+  static GOnce thread_pool_once = G_ONCE_INIT;
 
   GST_DEBUG_OBJECT (self, "Starting");
 
+  g_once (&thread_pool_once, gst_openexr_dec_setup_thread_pool, NULL);
+
   return TRUE;
 }
 
@@ -181,6 +197,10 @@ gst_openexr_dec_stop (GstVideoDecoder * video_decoder)
     self->input_state = NULL;
   }
 
+  g_free (self->framebuffer);
+  self->framebuffer = NULL;
+  self->framebuffer_size = 0;
+
   GST_DEBUG_OBJECT (self, "Stopped");
 
   return TRUE;
@@ -401,13 +421,19 @@ gst_openexr_dec_handle_frame (GstVideoDecoder * decoder,
   Box2i dw = file->dataWindow ();
   int width = dw.max.x - dw.min.x + 1;
   int height = dw.max.y - dw.min.y + 1;
-  Rgba *fb = new Rgba[width * height];
+  gsize fb_size = (gsize) width * height * sizeof (Rgba);
+
+  if (self->framebuffer_size < fb_size) {
+    g_free (self->framebuffer);
+    self->framebuffer = g_malloc (fb_size);
+    self->framebuffer_size = fb_size;
+  }
+  Rgba *fb = (Rgba *) self->framebuffer;
 
   try {
     file->setFrameBuffer (fb - dw.min.x - dw.min.y * width, 1, width);
     file->readPixels (dw.min.y, dw.max.y);
   } catch (Iex::BaseExc& e) {
-    delete[](fb);
     delete file;
     delete istr;
     gst_buffer_unmap (frame->input_buffer, &map);
@@ -427,17 +453,18 @@ gst_openexr_dec_handle_frame (GstVideoDecoder * decoder,
    * and add a conversion filter element that can change exposure and
    * other things */
   for (i = 0; i < height; i++) {
+    const Rgba *in = ptr + (gsize) i * width;
+    guint16 *out = dest;
+
     for (j = 0; j < width; j++) {
-      dest[4 * j + 0] = CLAMP (((float) ptr->a) * 65536, 0, 65535);
-      dest[4 * j + 1] = CLAMP (((float) ptr->r) * 65536, 0, 65535);
-      dest[4 * j + 2] = CLAMP (((float) ptr->g) * 65536, 0, 65535);
-      dest[4 * j + 3] = CLAMP (((float) ptr->b) * 65536, 0, 65535);
-      ptr++;
+      out[4 * j + 0] = CLAMP (((float) in[j].a) * 65536, 0, 65535);
+      out[4 * j + 1] = CLAMP (((float) in[j].r) * 65536, 0, 65535);
+      out[4 * j + 2] = CLAMP (((float) in[j].g) * 65536, 0, 65535);
+      out[4 * j + 3] = CLAMP (((float) in[j].b) * 65536, 0, 65535);
     }
     dest += dstride / 2;
   }
 
-  delete[](fb);
   delete file;
   delete istr;
   gst_buffer_unmap (frame->input_buffer, &map);
@@ -49,6 +49,10 @@ struct _GstOpenEXRDec
   /* < private > */
   GstVideoCodecState *input_state;
   GstVideoCodecState *output_state;
+
+  /* cached intermediate framebuffer, grown on demand */
+  gpointer framebuffer;
+  gsize framebuffer_size;
 };
 
 struct _GstOpenEXRDecClass
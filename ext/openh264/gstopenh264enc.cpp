@@ -963,24 +963,34 @@ gst_openh264enc_handle_frame (GstVideoEncoder * encoder,
     GST_VIDEO_CODEC_FRAME_UNSET_SYNC_POINT (frame);
   }
 
+  gsize layer_sizes[MAX_LAYER_NUM_OF_FRAME];
+  gboolean contiguous = TRUE;
+
   for (i = 0; i < frame_info.iLayerNum; i++) {
+    layer_sizes[i] = 0;
     for (j = 0; j < frame_info.sLayerInfo[i].iNalCount; j++) {
-      buf_length += frame_info.sLayerInfo[i].pNalLengthInByte[j];
+      layer_sizes[i] += frame_info.sLayerInfo[i].pNalLengthInByte[j];
     }
+    buf_length += layer_sizes[i];
+    /* layers normally point into one contiguous bitstream buffer */
+    if (i > 0 && frame_info.sLayerInfo[i].pBsBuf !=
+        frame_info.sLayerInfo[i - 1].pBsBuf + layer_sizes[i - 1])
+      contiguous = FALSE;
   }
 
   frame->output_buffer =
       gst_video_encoder_allocate_output_buffer (encoder, buf_length);
   gst_buffer_map (frame->output_buffer, &map, GST_MAP_WRITE);
 
-  buf_length = 0;
-  for (i = 0; i < frame_info.iLayerNum; i++) {
-    gsize layer_size = 0;
-    for (j = 0; j < frame_info.sLayerInfo[i].iNalCount; j++) {
-      layer_size += frame_info.sLayerInfo[i].pNalLengthInByte[j];
+  if (contiguous && frame_info.iLayerNum > 0) {
+    memcpy (map.data, frame_info.sLayerInfo[0].pBsBuf, buf_length);
+  } else {
+    buf_length = 0;
+    for (i = 0; i < frame_info.iLayerNum; i++) {
+      memcpy (map.data + buf_length, frame_info.sLayerInfo[i].pBsBuf,
+          layer_sizes[i]);
+      buf_length += layer_sizes[i];
     }
-    memcpy (map.data + buf_length, frame_info.sLayerInfo[i].pBsBuf, layer_size);
-    buf_length += layer_size;
   }
 
   gst_buffer_unmap (frame->output_buffer, &map);
@@ -32,6 +32,24 @@
 GST_DEBUG_CATEGORY_STATIC (gst_openjpeg_dec_debug);
 #define GST_CAT_DEFAULT gst_openjpeg_dec_debug
 
+/* multi-threaded decoding needs libopenjp2 >= 2.2 */
+#if !defined(HAVE_OPENJPEG_1) && defined(OPJ_VERSION_MAJOR) && \
+    (OPJ_VERSION_MAJOR > 2 || (OPJ_VERSION_MAJOR == 2 && OPJ_VERSION_MINOR >= 2))
+#define HAVE_OPENJPEG_THREADS 1
+#endif
+
+enum
+{
+  PROP_0,
+  PROP_MAX_THREADS
+};
+
+#define DEFAULT_MAX_THREADS 0
+
+static void gst_openjpeg_dec_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_openjpeg_dec_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
 static gboolean gst_openjpeg_dec_start (GstVideoDecoder * decoder);
 static gboolean gst_openjpeg_dec_stop (GstVideoDecoder * decoder);
 static gboolean gst_openjpeg_dec_set_format (GstVideoDecoder * decoder,
@@ -73,12 +91,32 @@ G_DEFINE_TYPE (GstOpenJPEGDec, gst_openjpeg_dec, GST_TYPE_VIDEO_DECODER);
 static void
 gst_openjpeg_dec_class_init (GstOpenJPEGDecClass * klass)
 {
+  GObjectClass *gobject_class;
   GstElementClass *element_class;
   GstVideoDecoderClass *video_decoder_class;
 
+  gobject_class = (GObjectClass *) klass;
   element_class = (GstElementClass *) klass;
   video_decoder_class = (GstVideoDecoderClass *) klass;
 
+  gobject_class->set_property = gst_openjpeg_dec_set_property;
+  gobject_class->get_property = gst_openjpeg_dec_get_property;
+
+  /**
+   * GstOpenJPEGDec:max-threads:
+   *
+   * Maximum number of worker threads to spawn used by the OpenJPEG library
+   * to decode the tiles and codeblocks of a codestream in parallel, when
+   * libopenjp2 was built with thread support. (0 = one per core)
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_THREADS,
+      g_param_spec_int ("max-threads", "Maximum decode threads",
+          "Maximum number of worker threads to spawn. (0 = auto)",
+          0, G_MAXINT, DEFAULT_MAX_THREADS,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
   gst_element_class_add_static_pad_template (element_class,
       &gst_openjpeg_dec_src_template);
   gst_element_class_add_static_pad_template (element_class,
@@ -112,6 +150,7 @@ gst_openjpeg_dec_init (GstOpenJPEGDec * self)
   gst_video_decoder_set_use_default_pad_acceptcaps (GST_VIDEO_DECODER_CAST
       (self), TRUE);
   GST_PAD_SET_ACCEPT_TEMPLATE (GST_VIDEO_DECODER_SINK_PAD (self));
+  self->max_threads = DEFAULT_MAX_THREADS;
   opj_set_default_decoder_parameters (&self->params);
 #ifdef HAVE_OPENJPEG_1
   self->params.cp_limit_decoding = NO_LIMITATION;
@@ -119,6 +158,38 @@ gst_openjpeg_dec_init (GstOpenJPEGDec * self)
   self->sampling = GST_JPEG2000_SAMPLING_NONE;
 }
 
+static void
+gst_openjpeg_dec_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstOpenJPEGDec *self = GST_OPENJPEG_DEC (object);
+
+  switch (prop_id) {
+    case PROP_MAX_THREADS:
+      self->max_threads = g_value_get_int (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_openjpeg_dec_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstOpenJPEGDec *self = GST_OPENJPEG_DEC (object);
+
+  switch (prop_id) {
+    case PROP_MAX_THREADS:
+      g_value_set_int (value, self->max_threads);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
 static gboolean
 gst_openjpeg_dec_start (GstVideoDecoder * decoder)
 {
@@ -1110,6 +1181,21 @@ gst_openjpeg_dec_handle_frame (GstVideoDecoder * decoder,
     params.jpwl_exp_comps = self->ncomps;
   opj_setup_decoder (dec, &params);
 
+#ifdef HAVE_OPENJPEG_THREADS
+  /* Have the library decode tiles and codeblocks in parallel on its
+   * worker pool; the converted planes are written into the mapped
+   * output frame by the fill functions below as before */
+  if (opj_has_thread_support ()) {
+    gint threads = self->max_threads;
+
+    if (threads == 0)
+      threads = g_get_num_processors ();
+    if (threads > 1 && !opj_codec_set_threads (dec, threads))
+      GST_WARNING_OBJECT (self, "Failed to enable %d decoding threads",
+          threads);
+  }
+#endif
+
   if (!gst_buffer_map (frame->input_buffer, &map, GST_MAP_READ))
     goto map_read_error;
 
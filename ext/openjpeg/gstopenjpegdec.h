@@ -49,6 +49,8 @@ struct _GstOpenJPEGDec
   GstVideoDecoder parent;
 
   /* < private > */
+  gint max_threads;
+
   GstVideoCodecState *input_state;
   GstVideoCodecState *output_state;
 
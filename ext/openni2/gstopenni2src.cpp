@@ -100,7 +100,9 @@ static gboolean gst_openni2src_decide_allocation (GstBaseSrc * bsrc,
 static GstStateChangeReturn gst_openni2_src_change_state (GstElement * element,
     GstStateChange transition);
 
-/* pushsrc method */
+/* pushsrc methods */
+static GstFlowReturn gst_openni2src_create (GstPushSrc * src,
+    GstBuffer ** buf);
 static GstFlowReturn gst_openni2src_fill (GstPushSrc * src, GstBuffer * buf);
 
 /* OpenNI2 interaction methods */
@@ -108,6 +110,8 @@ static gboolean openni2_initialise_library ();
 static gboolean openni2_initialise_devices (GstOpenni2Src * src);
 static GstFlowReturn openni2_read_gstbuffer (GstOpenni2Src * src,
     GstBuffer * buf);
+static GstFlowReturn openni2_read_wrapped_gstbuffer (GstOpenni2Src * src,
+    GstBuffer ** buf);
 
 #define parent_class gst_openni2_src_parent_class
 G_DEFINE_TYPE (GstOpenni2Src, gst_openni2_src, GST_TYPE_PUSH_SRC);
@@ -157,6 +161,7 @@ gst_openni2_src_class_init (GstOpenni2SrcClass * klass)
 
   element_class->change_state = gst_openni2_src_change_state;
 
+  pushsrc_class->create = GST_DEBUG_FUNCPTR (gst_openni2src_create);
   pushsrc_class->fill = GST_DEBUG_FUNCPTR (gst_openni2src_fill);
 
   GST_DEBUG_CATEGORY_INIT (openni2src_debug, "openni2src", 0,
@@ -453,6 +458,20 @@ gst_openni2_src_change_state (GstElement * element, GstStateChange transition)
 }
 
 
+static GstFlowReturn
+gst_openni2src_create (GstPushSrc * psrc, GstBuffer ** buf)
+{
+  GstOpenni2Src *ni2src = GST_OPENNI2_SRC (psrc);
+
+  /* The combined depth+color format interleaves both readings into one
+   * buffer and needs the fill path; single-stream output can wrap the
+   * OpenNI frame memory directly. */
+  if (ni2src->sourcetype == SOURCETYPE_BOTH)
+    return GST_PUSH_SRC_CLASS (parent_class)->create (psrc, buf);
+
+  return openni2_read_wrapped_gstbuffer (ni2src, buf);
+}
+
 static GstFlowReturn
 gst_openni2src_fill (GstPushSrc * src, GstBuffer * buf)
 {
@@ -582,6 +601,15 @@ openni2_initialise_devices (GstOpenni2Src * src)
     return FALSE;
   }
 
+  /** Pair depth and color frames in hardware when both streams run **/
+  if (src->depth->isValid () && src->color->isValid ()) {
+    rc = src->device->setDepthColorSyncEnabled (true);
+    if (rc != openni::STATUS_OK) {
+      GST_WARNING_OBJECT (src, "Couldn't enable depth/color sync: %s",
+          openni::OpenNI::getExtendedError ());
+    }
+  }
+
   /** Get resolution and make sure is valid **/
   if (src->depth->isValid () && src->color->isValid ()) {
     src->depthVideoMode = src->depth->getVideoMode ();
@@ -755,3 +783,80 @@ openni2_read_gstbuffer (GstOpenni2Src * src, GstBuffer * buf)
 
   return GST_FLOW_OK;
 }
+
+static void
+openni2_frame_release (openni::VideoFrameRef * frame)
+{
+  /* deleting the ref releases the shared frame buffer back to OpenNI */
+  delete frame;
+}
+
+static GstFlowReturn
+openni2_read_wrapped_gstbuffer (GstOpenni2Src * src, GstBuffer ** buf)
+{
+  openni::Status rc = openni::STATUS_OK;
+  openni::VideoStream * pStream = src->depth;
+  int changedStreamDummy;
+  openni::VideoFrameRef *frame;
+  gsize offset[GST_VIDEO_MAX_PLANES] = { 0, };
+  gint stride[GST_VIDEO_MAX_PLANES] = { 0, };
+  uint64_t oni_ts;
+
+  /* Block until we get some data */
+  rc = openni::OpenNI::waitForAnyStream (&pStream, 1, &changedStreamDummy,
+      SAMPLE_READ_WAIT_TIMEOUT);
+  if (rc != openni::STATUS_OK) {
+    GST_ERROR_OBJECT (src, "Frame read timeout: %s",
+        openni::OpenNI::getExtendedError ());
+    return GST_FLOW_ERROR;
+  }
+
+  if (src->depth->isValid () && src->sourcetype == SOURCETYPE_DEPTH) {
+    rc = src->depth->readFrame (src->depthFrame);
+    if (rc != openni::STATUS_OK) {
+      GST_ERROR_OBJECT (src, "Frame read error: %s",
+          openni::OpenNI::getExtendedError ());
+      return GST_FLOW_ERROR;
+    }
+    frame = new openni::VideoFrameRef (*src->depthFrame);
+  } else if (src->color->isValid () && src->sourcetype == SOURCETYPE_COLOR) {
+    rc = src->color->readFrame (src->colorFrame);
+    if (rc != openni::STATUS_OK) {
+      GST_ERROR_OBJECT (src, "Frame read error: %s",
+          openni::OpenNI::getExtendedError ());
+      return GST_FLOW_ERROR;
+    }
+    frame = new openni::VideoFrameRef (*src->colorFrame);
+  } else {
+    g_return_val_if_reached (GST_FLOW_ERROR);
+    return GST_FLOW_ERROR;
+  }
+
+  /* The VideoFrameRef copy shares ownership of the driver's frame buffer,
+   * so the data stays valid until the destroy notify releases it. The
+   * driver stride is advertised through a video meta instead of repacking
+   * the rows. */
+  *buf = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+      (gpointer) frame->getData (), frame->getDataSize (), 0,
+      frame->getDataSize (), frame,
+      (GDestroyNotify) openni2_frame_release);
+  stride[0] = frame->getStrideInBytes ();
+  gst_buffer_add_video_meta_full (*buf, GST_VIDEO_FRAME_FLAG_NONE,
+      GST_VIDEO_INFO_FORMAT (&src->info), frame->getWidth (),
+      frame->getHeight (), 1, offset, stride);
+
+  GST_LOG_OBJECT (src, "sending wrapped buffer (%dx%d)=%dB",
+      frame->getWidth (), frame->getHeight (), frame->getDataSize ());
+
+  oni_ts = frame->getTimestamp () * 1000;
+
+  if (G_UNLIKELY (src->oni_start_ts == GST_CLOCK_TIME_NONE))
+    src->oni_start_ts = oni_ts;
+
+  GST_BUFFER_PTS (*buf) = oni_ts - src->oni_start_ts;
+
+  GST_LOG_OBJECT (src, "Calculated PTS as %" GST_TIME_FORMAT,
+      GST_TIME_ARGS (GST_BUFFER_PTS (*buf)));
+
+  return GST_FLOW_OK;
+}
@@ -126,6 +126,57 @@ G_DEFINE_TYPE (GstRsvgOverlay, gst_rsvg_overlay, GST_TYPE_VIDEO_FILTER);
 
 static void gst_rsvg_overlay_finalize (GObject * object);
 
+static void
+gst_rsvg_overlay_clear_cache (GstRsvgOverlay * overlay)
+{
+  if (overlay->cached_surface) {
+    cairo_surface_destroy (overlay->cached_surface);
+    overlay->cached_surface = NULL;
+  }
+  overlay->cached_width = 0;
+  overlay->cached_height = 0;
+}
+
+/* Renders the SVG at the given size into a new cached surface. Called
+ * with the rsvg lock held. */
+static gboolean
+gst_rsvg_overlay_update_cache (GstRsvgOverlay * overlay, int width, int height)
+{
+  cairo_surface_t *surface;
+  cairo_t *cr;
+
+  surface = cairo_image_surface_create (CAIRO_FORMAT_ARGB32, width, height);
+  if (G_UNLIKELY (cairo_surface_status (surface) != CAIRO_STATUS_SUCCESS)) {
+    cairo_surface_destroy (surface);
+    return FALSE;
+  }
+
+  cr = cairo_create (surface);
+  if (G_UNLIKELY (cairo_status (cr) != CAIRO_STATUS_SUCCESS)) {
+    cairo_destroy (cr);
+    cairo_surface_destroy (surface);
+    return FALSE;
+  }
+
+  if ((width != overlay->svg_width || height != overlay->svg_height)
+      && overlay->svg_width && overlay->svg_height) {
+    cairo_scale (cr, (double) width / overlay->svg_width,
+        (double) height / overlay->svg_height);
+  }
+  rsvg_handle_render_cairo (overlay->handle, cr);
+  cairo_destroy (cr);
+  cairo_surface_flush (surface);
+
+  gst_rsvg_overlay_clear_cache (overlay);
+  overlay->cached_surface = surface;
+  overlay->cached_width = width;
+  overlay->cached_height = height;
+
+  GST_DEBUG_OBJECT (overlay, "re-rendered SVG cache at %d x %d", width, height);
+
+  return TRUE;
+}
+
 static void
 gst_rsvg_overlay_set_svg_data (GstRsvgOverlay * overlay, const gchar * data,
     gboolean consider_as_filename)
@@ -134,6 +185,8 @@ gst_rsvg_overlay_set_svg_data (GstRsvgOverlay * overlay, const gchar * data,
   gsize size;
   GError *error = NULL;
 
+  gst_rsvg_overlay_clear_cache (overlay);
+
   if (overlay->handle) {
     g_object_unref (overlay->handle);
     overlay->handle = NULL;
@@ -402,10 +455,6 @@ gst_rsvg_overlay_transform_frame_ip (GstVideoFilter * vfilter,
         (int) (overlay->height_relative * GST_VIDEO_FRAME_HEIGHT (frame));
   }
 
-  if (applied_x_offset || applied_y_offset) {
-    cairo_translate (cr, applied_x_offset, applied_y_offset);
-  }
-
   /* Scale when necessary, i.e. an absolute or relative dimension has been specified. */
   if ((applied_width || applied_height) && overlay->svg_width
       && overlay->svg_height) {
@@ -415,11 +464,46 @@ gst_rsvg_overlay_transform_frame_ip (GstVideoFilter * vfilter,
       applied_width = overlay->svg_width;
     if (!applied_height)
       applied_height = overlay->svg_height;
+  } else {
+    applied_width = overlay->svg_width;
+    applied_height = overlay->svg_height;
+  }
+
+  if (applied_width > 0 && applied_height > 0 &&
+      (overlay->cached_surface != NULL ||
+          gst_rsvg_overlay_update_cache (overlay, applied_width,
+              applied_height))) {
+    /* The SVG only needs to be re-rasterized when its data or its
+       applied size changed; otherwise the cached (premultiplied ARGB)
+       surface is blended onto the frame directly. */
+    if (overlay->cached_width != applied_width ||
+        overlay->cached_height != applied_height) {
+      if (!gst_rsvg_overlay_update_cache (overlay, applied_width,
+              applied_height))
+        goto render_direct;
+    }
+
+    cairo_set_source_surface (cr, overlay->cached_surface, applied_x_offset,
+        applied_y_offset);
+    cairo_paint (cr);
+    goto done;
+  }
 
+render_direct:
+  /* Fall back to rendering straight onto the frame, e.g. when the SVG
+     dimensions are unknown. */
+  if (applied_x_offset || applied_y_offset) {
+    cairo_translate (cr, applied_x_offset, applied_y_offset);
+  }
+  if ((applied_width != overlay->svg_width
+          || applied_height != overlay->svg_height) && overlay->svg_width
+      && overlay->svg_height) {
     cairo_scale (cr, (double) applied_width / overlay->svg_width,
         (double) applied_height / overlay->svg_height);
   }
   rsvg_handle_render_cairo (overlay->handle, cr);
+
+done:
   GST_RSVG_UNLOCK (overlay);
 
   cairo_destroy (cr);
@@ -438,6 +522,7 @@ gst_rsvg_overlay_stop (GstBaseTransform * btrans)
     overlay->handle = NULL;
   }
 
+  gst_rsvg_overlay_clear_cache (overlay);
   gst_adapter_clear (overlay->adapter);
 
   return TRUE;
@@ -545,6 +630,7 @@ gst_rsvg_overlay_finalize (GObject * object)
 {
   GstRsvgOverlay *overlay = GST_RSVG_OVERLAY (object);
 
+  gst_rsvg_overlay_clear_cache (overlay);
   g_object_unref (overlay->adapter);
 
   G_OBJECT_CLASS (gst_rsvg_overlay_parent_class)->finalize (object);
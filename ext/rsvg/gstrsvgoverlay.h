@@ -65,6 +65,11 @@ struct _GstRsvgOverlay
 
   GstPad *data_sinkpad;
   GstAdapter *adapter;
+
+  /* cached rasterization of the SVG at the currently applied size */
+  cairo_surface_t *cached_surface;
+  int cached_width;
+  int cached_height;
 };
 
 struct _GstRsvgOverlayClass
@@ -78,6 +78,8 @@ static gboolean gst_rtmp_sink_start (GstBaseSink * sink);
 static gboolean gst_rtmp_sink_event (GstBaseSink * sink, GstEvent * event);
 static gboolean gst_rtmp_sink_setcaps (GstBaseSink * sink, GstCaps * caps);
 static GstFlowReturn gst_rtmp_sink_render (GstBaseSink * sink, GstBuffer * buf);
+static GstFlowReturn gst_rtmp_sink_render_list (GstBaseSink * sink,
+    GstBufferList * list);
 
 #define gst_rtmp_sink_parent_class parent_class
 G_DEFINE_TYPE_WITH_CODE (GstRTMPSink, gst_rtmp_sink, GST_TYPE_BASE_SINK,
@@ -114,6 +116,7 @@ gst_rtmp_sink_class_init (GstRTMPSinkClass * klass)
   gstbasesink_class->start = GST_DEBUG_FUNCPTR (gst_rtmp_sink_start);
   gstbasesink_class->stop = GST_DEBUG_FUNCPTR (gst_rtmp_sink_stop);
   gstbasesink_class->render = GST_DEBUG_FUNCPTR (gst_rtmp_sink_render);
+  gstbasesink_class->render_list = GST_DEBUG_FUNCPTR (gst_rtmp_sink_render_list);
   gstbasesink_class->set_caps = GST_DEBUG_FUNCPTR (gst_rtmp_sink_setcaps);
   gstbasesink_class->event = GST_DEBUG_FUNCPTR (gst_rtmp_sink_event);
 
@@ -219,47 +222,10 @@ gst_rtmp_sink_stop (GstBaseSink * basesink)
 }
 
 static GstFlowReturn
-gst_rtmp_sink_render (GstBaseSink * bsink, GstBuffer * buf)
+gst_rtmp_sink_send_buffer (GstRTMPSink * sink, GstBuffer * buf)
 {
-  GstRTMPSink *sink = GST_RTMP_SINK (bsink);
-  gboolean need_unref = FALSE;
   GstMapInfo map = GST_MAP_INFO_INIT;
 
-  if (sink->rtmp == NULL) {
-    /* Do not crash */
-    GST_ELEMENT_ERROR (sink, RESOURCE, WRITE, (NULL), ("Failed to write data"));
-    return GST_FLOW_ERROR;
-  }
-
-  /* Ignore buffers that are in the stream headers (caps) */
-  if (GST_BUFFER_FLAG_IS_SET (buf, GST_BUFFER_FLAG_HEADER)) {
-    return GST_FLOW_OK;
-  }
-
-  if (sink->first) {
-    /* open the connection */
-    if (!RTMP_IsConnected (sink->rtmp)) {
-      if (!RTMP_Connect (sink->rtmp, NULL))
-        goto connection_failed;
-
-      if (!RTMP_ConnectStream (sink->rtmp, 0)) {
-        RTMP_Close (sink->rtmp);
-        goto connection_failed;
-      }
-
-      GST_DEBUG_OBJECT (sink, "Opened connection to %s", sink->rtmp_uri);
-    }
-
-    /* Prepend the header from the caps to the first non header buffer */
-    if (sink->header) {
-      buf = gst_buffer_append (gst_buffer_ref (sink->header),
-          gst_buffer_ref (buf));
-      need_unref = TRUE;
-    }
-
-    sink->first = FALSE;
-  }
-
   if (sink->have_write_error)
     goto write_failed;
 
@@ -272,8 +238,6 @@ gst_rtmp_sink_render (GstBaseSink * bsink, GstBuffer * buf)
     goto write_failed;
 
   gst_buffer_unmap (buf, &map);
-  if (need_unref)
-    gst_buffer_unref (buf);
 
   return GST_FLOW_OK;
 
@@ -281,13 +245,44 @@ gst_rtmp_sink_render (GstBaseSink * bsink, GstBuffer * buf)
 write_failed:
   {
     GST_ELEMENT_ERROR (sink, RESOURCE, WRITE, (NULL), ("Failed to write data"));
-    gst_buffer_unmap (buf, &map);
-    if (need_unref)
-      gst_buffer_unref (buf);
+    if (map.memory != NULL)
+      gst_buffer_unmap (buf, &map);
     sink->have_write_error = TRUE;
     return GST_FLOW_ERROR;
   }
+}
+
+/* opens the connection on the first buffer and sends the FLV header from the
+ * caps in a write of its own. librtmp keeps its FLV parsing state between
+ * RTMP_Write calls, so the header does not have to be merged into one
+ * contiguous buffer with the first tag */
+static GstFlowReturn
+gst_rtmp_sink_start_stream (GstRTMPSink * sink)
+{
+  if (!sink->first)
+    return GST_FLOW_OK;
+
+  /* open the connection */
+  if (!RTMP_IsConnected (sink->rtmp)) {
+    if (!RTMP_Connect (sink->rtmp, NULL))
+      goto connection_failed;
+
+    if (!RTMP_ConnectStream (sink->rtmp, 0)) {
+      RTMP_Close (sink->rtmp);
+      goto connection_failed;
+    }
 
+    GST_DEBUG_OBJECT (sink, "Opened connection to %s", sink->rtmp_uri);
+  }
+
+  sink->first = FALSE;
+
+  if (sink->header)
+    return gst_rtmp_sink_send_buffer (sink, sink->header);
+
+  return GST_FLOW_OK;
+
+  /* ERRORS */
 connection_failed:
   {
     GST_ELEMENT_ERROR (sink, RESOURCE, OPEN_WRITE, (NULL),
@@ -302,6 +297,67 @@ connection_failed:
   }
 }
 
+static GstFlowReturn
+gst_rtmp_sink_render (GstBaseSink * bsink, GstBuffer * buf)
+{
+  GstRTMPSink *sink = GST_RTMP_SINK (bsink);
+  GstFlowReturn ret;
+
+  if (sink->rtmp == NULL) {
+    /* Do not crash */
+    GST_ELEMENT_ERROR (sink, RESOURCE, WRITE, (NULL), ("Failed to write data"));
+    return GST_FLOW_ERROR;
+  }
+
+  /* Ignore buffers that are in the stream headers (caps) */
+  if (GST_BUFFER_FLAG_IS_SET (buf, GST_BUFFER_FLAG_HEADER)) {
+    return GST_FLOW_OK;
+  }
+
+  ret = gst_rtmp_sink_start_stream (sink);
+  if (ret != GST_FLOW_OK)
+    return ret;
+
+  return gst_rtmp_sink_send_buffer (sink, buf);
+}
+
+/* sends all the tags of a buffer list in one go, without going through the
+ * per-buffer fallback in basesink */
+static GstFlowReturn
+gst_rtmp_sink_render_list (GstBaseSink * bsink, GstBufferList * list)
+{
+  GstRTMPSink *sink = GST_RTMP_SINK (bsink);
+  GstFlowReturn ret = GST_FLOW_OK;
+  guint i, len;
+
+  if (sink->rtmp == NULL) {
+    /* Do not crash */
+    GST_ELEMENT_ERROR (sink, RESOURCE, WRITE, (NULL), ("Failed to write data"));
+    return GST_FLOW_ERROR;
+  }
+
+  len = gst_buffer_list_length (list);
+  GST_LOG_OBJECT (sink, "Rendering list of %u buffers", len);
+
+  for (i = 0; i < len; i++) {
+    GstBuffer *buf = gst_buffer_list_get (list, i);
+
+    /* Ignore buffers that are in the stream headers (caps) */
+    if (GST_BUFFER_FLAG_IS_SET (buf, GST_BUFFER_FLAG_HEADER))
+      continue;
+
+    ret = gst_rtmp_sink_start_stream (sink);
+    if (ret != GST_FLOW_OK)
+      break;
+
+    ret = gst_rtmp_sink_send_buffer (sink, buf);
+    if (ret != GST_FLOW_OK)
+      break;
+  }
+
+  return ret;
+}
+
 /*
  * URI interface support.
  */
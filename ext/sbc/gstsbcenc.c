@@ -156,10 +156,11 @@ gst_sbc_enc_set_format (GstAudioEncoder * audio_enc, GstAudioInfo * info)
   }
 
   /* we want to be handed all available samples in handle_frame, but always
-   * enough to encode a frame */
+   * enough to encode a frame; with max set to 0 the base class hands over
+   * whatever is queued and handle_frame encodes it all in one go */
   sampleframes_per_frame = enc->blocks * enc->subbands;
   gst_audio_encoder_set_frame_samples_min (audio_enc, sampleframes_per_frame);
-  gst_audio_encoder_set_frame_samples_max (audio_enc, sampleframes_per_frame);
+  gst_audio_encoder_set_frame_samples_max (audio_enc, 0);
   gst_audio_encoder_set_frame_max (audio_enc, 0);
 
   /* FIXME: what to do with left-over samples at the end? can we encode them? */
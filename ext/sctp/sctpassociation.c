@@ -571,6 +571,46 @@ create_sctp_socket (GstSctpAssociation * self)
     g_warning ("Could not set SCTP_NODELAY");
     goto error;
   }
+#if defined (SCTP_PLUGGABLE_SS) && defined (SCTP_SS_FAIR_BANDWIDTH)
+  {
+    struct sctp_assoc_value av;
+
+    /* Fair-bandwidth stream scheduler instead of first-come-first-served,
+     * so one bulk stream cannot monopolize the send queue and starve
+     * low-rate control streams. This is sender-local and needs no support
+     * from the peer. Not fatal if the usrsctp build doesn't take it */
+    memset (&av, 0, sizeof (av));
+    av.assoc_id = SCTP_ALL_ASSOC;
+    av.assoc_value = SCTP_SS_FAIR_BANDWIDTH;
+    if (usrsctp_setsockopt (sock, IPPROTO_SCTP, SCTP_PLUGGABLE_SS, &av,
+            sizeof (av))) {
+      g_warning ("Could not set the fair-bandwidth stream scheduler");
+    }
+  }
+#endif
+#if defined (SCTP_INTERLEAVING_SUPPORTED)
+  {
+    struct sctp_assoc_value av;
+    int level = 2;
+
+    if (usrsctp_setsockopt (sock, IPPROTO_SCTP, SCTP_FRAGMENT_INTERLEAVE,
+            &level, sizeof (int))) {
+      g_warning ("Could not set the fragment interleave level");
+    }
+
+    /* User message interleaving (RFC 8260): fragments of a large message
+     * may be interleaved with messages of other streams on the wire, so a
+     * big send no longer head-of-line blocks every other stream. Only
+     * used when the peer negotiates support for it */
+    memset (&av, 0, sizeof (av));
+    av.assoc_id = SCTP_ALL_ASSOC;
+    av.assoc_value = 1;
+    if (usrsctp_setsockopt (sock, IPPROTO_SCTP, SCTP_INTERLEAVING_SUPPORTED,
+            &av, sizeof (av))) {
+      g_warning ("Could not enable user message interleaving");
+    }
+  }
+#endif
 
   memset (&stream_reset, 0, sizeof (stream_reset));
   stream_reset.assoc_id = SCTP_ALL_ASSOC;
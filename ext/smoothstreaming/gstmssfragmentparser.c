@@ -43,6 +43,161 @@ gst_mss_fragment_parser_clear (GstMssFragmentParser * parser)
     gst_isoff_moof_box_free (parser->moof);
   parser->moof = NULL;
   parser->current_fourcc = 0;
+  parser->tfxd_offset = 0;
+  parser->tfrf_offset = 0;
+  parser->mdat_offset = 0;
+}
+
+/* records the offsets of the traf uuid boxes and of the mdat so the next
+ * fragment can be checked against this layout */
+static void
+gst_mss_fragment_parser_record_layout (GstMssFragmentParser * parser,
+    const guint8 * data, gsize size)
+{
+  GstByteReader reader;
+  guint32 fourcc;
+  guint header_size;
+  guint64 box_size;
+
+  parser->tfxd_offset = 0;
+  parser->tfrf_offset = 0;
+  parser->mdat_offset = 0;
+
+  gst_byte_reader_init (&reader, data, size);
+
+  while (gst_isoff_parse_box_header (&reader, &fourcc, NULL, &header_size,
+          &box_size)) {
+    if (fourcc == GST_ISOFF_FOURCC_MOOF) {
+      guint moof_end =
+          gst_byte_reader_get_pos (&reader) + box_size - header_size;
+      guint traf_end = 0;
+
+      /* find the first traf inside the moof */
+      while (gst_byte_reader_get_pos (&reader) < moof_end &&
+          gst_isoff_parse_box_header (&reader, &fourcc, NULL, &header_size,
+              &box_size)) {
+        if (fourcc == GST_ISOFF_FOURCC_TRAF) {
+          traf_end = gst_byte_reader_get_pos (&reader) + box_size - header_size;
+          break;
+        }
+        if (!gst_byte_reader_skip (&reader, box_size - header_size))
+          return;
+      }
+      if (traf_end == 0)
+        return;
+
+      /* record the smooth-streaming uuid boxes inside the traf */
+      while (gst_byte_reader_get_pos (&reader) < traf_end) {
+        gsize box_offset = gst_byte_reader_get_pos (&reader);
+        guint8 extended_type[16] = { 0, };
+
+        if (!gst_isoff_parse_box_header (&reader, &fourcc, extended_type,
+                &header_size, &box_size))
+          return;
+        if (fourcc == GST_ISOFF_FOURCC_UUID) {
+          if (memcmp (extended_type, gst_isoff_tfxd_uuid, 16) == 0) {
+            parser->tfxd_offset = box_offset;
+            parser->tfxd_size = box_size;
+          } else if (memcmp (extended_type, gst_isoff_tfrf_uuid, 16) == 0) {
+            parser->tfrf_offset = box_offset;
+            parser->tfrf_size = box_size;
+          }
+        }
+        if (!gst_byte_reader_skip (&reader, box_size - header_size))
+          return;
+      }
+
+      if (!gst_byte_reader_set_pos (&reader, moof_end))
+        return;
+    } else if (fourcc == GST_ISOFF_FOURCC_MDAT) {
+      parser->mdat_offset = gst_byte_reader_get_pos (&reader) - header_size;
+      break;
+    } else {
+      if (!gst_byte_reader_skip (&reader, box_size - header_size))
+        return;
+    }
+  }
+
+  if (parser->tfxd_offset == 0 || parser->tfrf_offset == 0 ||
+      parser->mdat_offset == 0) {
+    parser->tfxd_offset = 0;
+    parser->tfrf_offset = 0;
+    parser->mdat_offset = 0;
+  } else {
+    GST_LOG ("cached fragment layout: tfxd @ %" G_GSIZE_FORMAT ", tfrf @ %"
+        G_GSIZE_FORMAT ", mdat @ %" G_GSIZE_FORMAT, parser->tfxd_offset,
+        parser->tfrf_offset, parser->mdat_offset);
+  }
+}
+
+/* checks that the box found at the cached offset still matches the cached
+ * header and hands back a reader for its payload */
+static gboolean
+gst_mss_fragment_parser_reuse_box (GstByteReader * reader, gsize offset,
+    guint64 cached_size, const guint8 * uuid, GstByteReader * payload)
+{
+  guint32 fourcc;
+  guint header_size;
+  guint64 box_size;
+  guint8 extended_type[16] = { 0, };
+
+  if (!gst_byte_reader_set_pos (reader, offset))
+    return FALSE;
+  if (!gst_isoff_parse_box_header (reader, &fourcc, extended_type,
+          &header_size, &box_size))
+    return FALSE;
+  if (fourcc != GST_ISOFF_FOURCC_UUID || box_size != cached_size ||
+      memcmp (extended_type, uuid, 16) != 0)
+    return FALSE;
+
+  return gst_byte_reader_get_sub_reader (reader, payload,
+      box_size - header_size);
+}
+
+/* fast path: when the fragment still has the layout recorded from the
+ * previous one, only re-read the tfxd and tfrf payloads into the already
+ * parsed moof instead of parsing all the boxes again. The other moof
+ * members are left as parsed from the first fragment; only the
+ * smooth-streaming specific boxes are consumed from here. */
+static gboolean
+gst_mss_fragment_parser_parse_cached (GstMssFragmentParser * parser,
+    GstByteReader * reader)
+{
+  GstTrafBox *traf;
+  GstByteReader sub_reader;
+  guint32 fourcc;
+  guint header_size;
+  guint64 box_size;
+
+  if (parser->tfxd_offset == 0)
+    return FALSE;
+
+  /* the mdat offset only moves when the moof layout changed; its size
+   * varies with the payload so just the fourcc is checked */
+  if (!gst_byte_reader_set_pos (reader, parser->mdat_offset))
+    return FALSE;
+  if (!gst_isoff_parse_box_header (reader, &fourcc, NULL, &header_size,
+          &box_size) || fourcc != GST_ISOFF_FOURCC_MDAT)
+    return FALSE;
+
+  traf = &g_array_index (parser->moof->traf, GstTrafBox, 0);
+
+  if (!gst_mss_fragment_parser_reuse_box (reader, parser->tfxd_offset,
+          parser->tfxd_size, gst_isoff_tfxd_uuid, &sub_reader))
+    return FALSE;
+  if (!gst_isoff_tfxd_box_parse (traf->tfxd, &sub_reader))
+    return FALSE;
+
+  if (!gst_mss_fragment_parser_reuse_box (reader, parser->tfrf_offset,
+          parser->tfrf_size, gst_isoff_tfrf_uuid, &sub_reader))
+    return FALSE;
+  if (traf->tfrf->entries)
+    g_array_free (traf->tfrf->entries, TRUE);
+  if (!gst_isoff_tfrf_box_parse (traf->tfrf, &sub_reader))
+    return FALSE;
+
+  parser->current_fourcc = GST_ISOFF_FOURCC_MDAT;
+  return TRUE;
 }
 
 gboolean
@@ -63,6 +218,19 @@ gst_mss_fragment_parser_add_buffer (GstMssFragmentParser * parser,
   gst_byte_reader_init (&reader, info.data, info.size);
   GST_TRACE ("Total buffer size: %u", gst_byte_reader_get_size (&reader));
 
+  if (parser->moof != NULL) {
+    if (gst_mss_fragment_parser_parse_cached (parser, &reader)) {
+      GST_LOG ("Fragment matches cached layout, skipped full moof parse");
+      parser->status = GST_MSS_FRAGMENT_HEADER_PARSER_FINISHED;
+      gst_buffer_unmap (buffer, &info);
+      return TRUE;
+    }
+
+    /* layout changed, fall back to a full parse */
+    gst_mss_fragment_parser_clear (parser);
+    gst_byte_reader_set_pos (&reader, 0);
+  }
+
   do {
     parser->current_fourcc = 0;
 
@@ -113,8 +281,10 @@ beach:
     }
   }
 
-  if (!error)
+  if (!error) {
     parser->status = GST_MSS_FRAGMENT_HEADER_PARSER_FINISHED;
+    gst_mss_fragment_parser_record_layout (parser, info.data, info.size);
+  }
 
   GST_LOG ("Fragment parsing successful: %s", error ? "no" : "yes");
   gst_buffer_unmap (buffer, &info);
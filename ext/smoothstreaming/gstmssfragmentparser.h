@@ -42,6 +42,17 @@ typedef struct _GstMssFragmentParser
   GstFragmentHeaderParserStatus status;
   GstMoofBox *moof;
   guint32 current_fourcc;
+
+  /* cached box layout of the previous fragment. Most encoders emit the same
+   * layout for every fragment of a stream, so when the boxes show up
+   * unchanged at the cached offsets only the tfxd and tfrf payloads are
+   * re-read and the full moof parse is skipped. An offset of 0 means there
+   * is no valid cached layout. */
+  gsize tfxd_offset;
+  guint64 tfxd_size;
+  gsize tfrf_offset;
+  guint64 tfrf_size;
+  gsize mdat_offset;
 } GstMssFragmentParser;
 
 void gst_mss_fragment_parser_init (GstMssFragmentParser * parser);
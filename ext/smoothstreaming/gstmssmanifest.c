@@ -1153,7 +1153,9 @@ gst_mss_stream_advance_fragment (GstMssStream * stream)
     return GST_FLOW_EOS;
 
 beach:
-  gst_mss_fragment_parser_clear (&stream->fragment_parser);
+  /* only rearm the parser for the next fragment; the parsed moof and the
+   * cached box layout are kept so the next fragment can skip the full
+   * parse when its layout is unchanged */
   gst_mss_fragment_parser_init (&stream->fragment_parser);
   return GST_FLOW_OK;
 }
@@ -49,6 +49,11 @@ struct _GstPitchPrivate
 
   GstEvent *pending_segment;
 
+  /* output is taken from SoundTouch in fixed-size chunks backed by this
+   * pool, so steady-state streaming does not allocate */
+  GstBufferPool *pool;
+  guint pool_samples;
+
     soundtouch::SoundTouch * st;
 };
 
@@ -222,6 +227,12 @@ gst_pitch_dispose (GObject * object)
     pitch->priv->st = NULL;
   }
 
+  if (pitch->priv->pool) {
+    gst_buffer_pool_set_active (pitch->priv->pool, FALSE);
+    gst_object_unref (pitch->priv->pool);
+    pitch->priv->pool = NULL;
+  }
+
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
@@ -306,14 +317,34 @@ static gboolean
 gst_pitch_setcaps (GstPitch * pitch, GstCaps * caps)
 {
   GstPitchPrivate *priv;
+  GstBufferPool *pool;
+  GstStructure *config;
+  guint samples;
 
   priv = GST_PITCH_GET_PRIVATE (pitch);
 
   if (!gst_audio_info_from_caps (&pitch->info, caps))
     return FALSE;
 
+  /* one chunk is about one SoundTouch processing sequence (~100ms), so
+   * a drained FIFO typically yields a single pooled buffer */
+  samples = MAX (pitch->info.rate / 10, 1);
+  pool = gst_buffer_pool_new ();
+  config = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (config, caps,
+      samples * pitch->info.bpf, 0, 0);
+  gst_buffer_pool_set_config (pool, config);
+  gst_buffer_pool_set_active (pool, TRUE);
+
   GST_OBJECT_LOCK (pitch);
 
+  if (priv->pool) {
+    gst_buffer_pool_set_active (priv->pool, FALSE);
+    gst_object_unref (priv->pool);
+  }
+  priv->pool = pool;
+  priv->pool_samples = samples;
+
   /* notify the soundtouch instance of this change */
   priv->st->setSampleRate (pitch->info.rate);
   priv->st->setChannels (pitch->info.channels);
@@ -361,7 +392,16 @@ gst_pitch_prepare_buffer (GstPitch * pitch)
   if (samples == 0)
     return NULL;
 
-  buffer = gst_buffer_new_and_alloc (samples * pitch->info.bpf);
+  if (priv->pool) {
+    samples = MIN (samples, priv->pool_samples);
+    if (gst_buffer_pool_acquire_buffer (priv->pool, &buffer, NULL) !=
+        GST_FLOW_OK)
+      buffer = gst_buffer_new_and_alloc (samples * pitch->info.bpf);
+    else
+      gst_buffer_resize (buffer, 0, samples * pitch->info.bpf);
+  } else {
+    buffer = gst_buffer_new_and_alloc (samples * pitch->info.bpf);
+  }
 
   gst_buffer_map (buffer, &info, (GstMapFlags) GST_MAP_READWRITE);
   samples = priv->st->receiveSamples ((soundtouch::SAMPLETYPE *) info.data, samples);
@@ -396,12 +436,15 @@ gst_pitch_flush_buffer (GstPitch * pitch, gboolean send)
   if (!send)
     return GST_FLOW_OK;
 
-  buffer = gst_pitch_prepare_buffer (pitch);
+  /* output now comes in pool-sized chunks, drain them all */
+  while ((buffer = gst_pitch_prepare_buffer (pitch))) {
+    GstFlowReturn ret = gst_pitch_forward_buffer (pitch, buffer);
 
-  if (!buffer)
-    return GST_FLOW_OK;
+    if (ret != GST_FLOW_OK)
+      return ret;
+  }
 
-  return gst_pitch_forward_buffer (pitch, buffer);
+  return GST_FLOW_OK;
 }
 
 static gboolean
@@ -885,11 +928,14 @@ gst_pitch_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
   gst_pitch_update_latency (pitch, timestamp);
   /* and try to extract some samples from the soundtouch buffer */
   if (!priv->st->isEmpty ()) {
+    GstFlowReturn ret = GST_FLOW_OK;
     GstBuffer *out_buffer;
 
-    out_buffer = gst_pitch_prepare_buffer (pitch);
-    if (out_buffer)
-      return gst_pitch_forward_buffer (pitch, out_buffer);
+    while (ret == GST_FLOW_OK &&
+        (out_buffer = gst_pitch_prepare_buffer (pitch)))
+      ret = gst_pitch_forward_buffer (pitch, out_buffer);
+
+    return ret;
   }
 
   return GST_FLOW_OK;
@@ -55,6 +55,14 @@ struct _GstDtmfDetect
   GstBaseTransform parent;
 
   dtmf_rx_state_t *dtmf_state;
+
+  /* properties */
+  guint batch_samples;
+
+  /* sample accumulator for batched detection */
+  gint16 *batch_data;
+  guint batch_len;
+  guint batch_alloc;
 };
 
 struct _GstDtmfDetectClass
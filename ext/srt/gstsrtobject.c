@@ -1440,6 +1440,131 @@ gst_srt_object_write (GstSRTObject * srtobject,
   return len;
 }
 
+static gssize
+gst_srt_object_write_list_to_callers (GstSRTObject * srtobject,
+    GstBufferList * headers, const GstMapInfo * mapinfos, guint num,
+    GCancellable * cancellable, GError ** error)
+{
+  GList *callers;
+  gssize total = 0;
+  guint i;
+
+  for (i = 0; i < num; i++)
+    total += mapinfos[i].size;
+
+  GST_OBJECT_LOCK (srtobject->element);
+  callers = srtobject->callers;
+  while (callers != NULL) {
+    SRTCaller *caller = callers->data;
+    callers = callers->next;
+
+    if (g_cancellable_is_cancelled (cancellable)) {
+      GST_OBJECT_UNLOCK (srtobject->element);
+      return -1;
+    }
+
+    if (!caller->sent_headers) {
+      if (!gst_srt_object_send_headers (srtobject, caller->sock, -1,
+              -1, headers, cancellable)) {
+        goto err;
+      }
+      caller->sent_headers = TRUE;
+    }
+
+    /* burst the whole list to this caller before moving to the next one */
+    for (i = 0; i < num; i++) {
+      const guint8 *msg = mapinfos[i].data;
+      gssize len = 0;
+
+      while (len < mapinfos[i].size) {
+        gint rest = mapinfos[i].size - len;
+        gint sent = srt_sendmsg2 (caller->sock, (char *) (msg + len), rest, 0);
+        if (sent < 0) {
+          goto err;
+        }
+        len += sent;
+      }
+    }
+
+    continue;
+
+  err:
+    srtobject->callers = g_list_remove (srtobject->callers, caller);
+    srt_caller_invoke_removed_closure (caller, srtobject);
+    GST_OBJECT_UNLOCK (srtobject->element);
+    srt_caller_free (caller);
+    GST_OBJECT_LOCK (srtobject->element);
+  }
+
+  GST_OBJECT_UNLOCK (srtobject->element);
+
+  return total;
+}
+
+gssize
+gst_srt_object_write_list (GstSRTObject * srtobject,
+    GstBufferList * headers, GstBufferList * buffers,
+    GCancellable * cancellable, GError ** error)
+{
+  gssize len = 0;
+  GstSRTConnectionMode connection_mode = GST_SRT_CONNECTION_MODE_NONE;
+  GstMapInfo *mapinfos;
+  guint i, num;
+
+  /* Only sink element can write data */
+  g_return_val_if_fail (gst_uri_handler_get_uri_type (GST_URI_HANDLER
+          (srtobject->element)) == GST_URI_SINK, -1);
+
+  num = gst_buffer_list_length (buffers);
+  if (num == 0)
+    return 0;
+
+  /* map everything up front so each buffer is mapped once, no matter how
+   * many callers it is sent to */
+  mapinfos = g_new (GstMapInfo, num);
+  for (i = 0; i < num; i++) {
+    if (!gst_buffer_map (gst_buffer_list_get (buffers, i), &mapinfos[i],
+            GST_MAP_READ)) {
+      GST_ELEMENT_ERROR (srtobject->element, RESOURCE, READ,
+          ("Could not map the input stream"), (NULL));
+      while (i > 0) {
+        i--;
+        gst_buffer_unmap (gst_buffer_list_get (buffers, i), &mapinfos[i]);
+      }
+      g_free (mapinfos);
+      return -1;
+    }
+  }
+
+  gst_structure_get_enum (srtobject->parameters, "mode",
+      GST_TYPE_SRT_CONNECTION_MODE, (gint *) & connection_mode);
+
+  if (connection_mode == GST_SRT_CONNECTION_MODE_LISTENER) {
+    if (!gst_srt_object_wait_caller (srtobject, cancellable, error)) {
+      len = -1;
+    } else {
+      len = gst_srt_object_write_list_to_callers (srtobject, headers, mapinfos,
+          num, cancellable, error);
+    }
+  } else {
+    for (i = 0; i < num; i++) {
+      gssize sent = gst_srt_object_write_one (srtobject, headers, &mapinfos[i],
+          cancellable, error);
+      if (sent < 0) {
+        len = -1;
+        break;
+      }
+      len += sent;
+    }
+  }
+
+  for (i = 0; i < num; i++)
+    gst_buffer_unmap (gst_buffer_list_get (buffers, i), &mapinfos[i]);
+  g_free (mapinfos);
+
+  return len;
+}
+
 GstStructure *
 gst_srt_object_get_stats (GstSRTObject * srtobject)
 {
@@ -118,6 +118,12 @@ gssize          gst_srt_object_write    (GstSRTObject * srtobject,
                                          GCancellable *cancellable,
                                          GError **err);
 
+gssize          gst_srt_object_write_list (GstSRTObject * srtobject,
+                                         GstBufferList * headers,
+                                         GstBufferList * buffers,
+                                         GCancellable *cancellable,
+                                         GError **err);
+
 void            gst_srt_object_wakeup   (GstSRTObject * srtobject,
                                          GCancellable *cancellable);
 
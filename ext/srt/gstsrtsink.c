@@ -217,6 +217,52 @@ gst_srt_sink_render (GstBaseSink * sink, GstBuffer * buffer)
   return ret;
 }
 
+static GstFlowReturn
+gst_srt_sink_render_list (GstBaseSink * sink, GstBufferList * list)
+{
+  GstSRTSink *self = GST_SRT_SINK (sink);
+  GError *error = NULL;
+  guint i, num;
+
+  num = gst_buffer_list_length (list);
+  if (num == 0)
+    return GST_FLOW_OK;
+
+  if (g_cancellable_is_cancelled (self->cancellable)) {
+    return GST_FLOW_FLUSHING;
+  }
+
+  if (self->headers) {
+    /* header buffers in the list must be skipped individually, fall back
+     * to buffer-at-a-time rendering if there are any */
+    for (i = 0; i < num; i++) {
+      if (GST_BUFFER_FLAG_IS_SET (gst_buffer_list_get (list, i),
+              GST_BUFFER_FLAG_HEADER))
+        break;
+    }
+
+    if (i < num) {
+      GstFlowReturn ret = GST_FLOW_OK;
+
+      for (i = 0; i < num; i++) {
+        ret = gst_srt_sink_render (sink, gst_buffer_list_get (list, i));
+        if (ret != GST_FLOW_OK)
+          break;
+      }
+      return ret;
+    }
+  }
+
+  GST_TRACE_OBJECT (self, "sending buffer list %p with %u buffers", list, num);
+
+  if (gst_srt_object_write_list (self->srtobject, self->headers, list,
+          self->cancellable, &error) < 0) {
+    return GST_FLOW_ERROR;
+  }
+
+  return GST_FLOW_OK;
+}
+
 static gboolean
 gst_srt_sink_unlock (GstBaseSink * bsink)
 {
@@ -337,6 +383,7 @@ gst_srt_sink_class_init (GstSRTSinkClass * klass)
   gstbasesink_class->start = GST_DEBUG_FUNCPTR (gst_srt_sink_start);
   gstbasesink_class->stop = GST_DEBUG_FUNCPTR (gst_srt_sink_stop);
   gstbasesink_class->render = GST_DEBUG_FUNCPTR (gst_srt_sink_render);
+  gstbasesink_class->render_list = GST_DEBUG_FUNCPTR (gst_srt_sink_render_list);
   gstbasesink_class->unlock = GST_DEBUG_FUNCPTR (gst_srt_sink_unlock);
   gstbasesink_class->unlock_stop = GST_DEBUG_FUNCPTR (gst_srt_sink_unlock_stop);
   gstbasesink_class->set_caps = GST_DEBUG_FUNCPTR (gst_srt_sink_set_caps);
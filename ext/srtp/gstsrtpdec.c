@@ -203,6 +203,10 @@ static GstIterator *gst_srtp_dec_iterate_internal_links_rtp (GstPad * pad,
 static GstIterator *gst_srtp_dec_iterate_internal_links_rtcp (GstPad * pad,
     GstObject * parent);
 
+static GstFlowReturn gst_srtp_dec_chain_list_rtp (GstPad * pad,
+    GstObject * parent, GstBufferList * list);
+static GstFlowReturn gst_srtp_dec_chain_list_rtcp (GstPad * pad,
+    GstObject * parent, GstBufferList * list);
 static GstFlowReturn gst_srtp_dec_chain_rtp (GstPad * pad,
     GstObject * parent, GstBuffer * buf);
 static GstFlowReturn gst_srtp_dec_chain_rtcp (GstPad * pad,
@@ -379,6 +383,8 @@ gst_srtp_dec_init (GstSrtpDec * filter)
       GST_DEBUG_FUNCPTR (gst_srtp_dec_iterate_internal_links_rtp));
   gst_pad_set_chain_function (filter->rtp_sinkpad,
       GST_DEBUG_FUNCPTR (gst_srtp_dec_chain_rtp));
+  gst_pad_set_chain_list_function (filter->rtp_sinkpad,
+      GST_DEBUG_FUNCPTR (gst_srtp_dec_chain_list_rtp));
 
   filter->rtp_srcpad =
       gst_pad_new_from_static_template (&rtp_src_template, "rtp_src");
@@ -402,6 +408,8 @@ gst_srtp_dec_init (GstSrtpDec * filter)
       GST_DEBUG_FUNCPTR (gst_srtp_dec_iterate_internal_links_rtcp));
   gst_pad_set_chain_function (filter->rtcp_sinkpad,
       GST_DEBUG_FUNCPTR (gst_srtp_dec_chain_rtcp));
+  gst_pad_set_chain_list_function (filter->rtcp_sinkpad,
+      GST_DEBUG_FUNCPTR (gst_srtp_dec_chain_list_rtcp));
 
   filter->rtcp_srcpad =
       gst_pad_new_from_static_template (&rtcp_src_template, "rtcp_src");
@@ -1513,6 +1521,104 @@ gst_srtp_dec_chain_rtcp (GstPad * pad, GstObject * parent, GstBuffer * buf)
   return gst_srtp_dec_chain (pad, parent, buf, TRUE);
 }
 
+/* Batch variant of gst_srtp_dec_chain: the filter lock is taken once for
+ * the whole list instead of per packet and the decoded packets go
+ * downstream in a single gst_pad_push_list. Mirrors the per-buffer flow
+ * otherwise, including rtp/rtcp demultiplexing by validate_buffer */
+static GstFlowReturn
+gst_srtp_dec_chain_list (GstPad * pad, GstObject * parent,
+    GstBufferList * list, gboolean is_rtcp)
+{
+  GstSrtpDec *filter = GST_SRTP_DEC (parent);
+  GstBufferList *rtp_out = NULL, *rtcp_out = NULL;
+  GstFlowReturn ret = GST_FLOW_OK;
+  gboolean soft_limit = FALSE;
+  guint32 soft_limit_ssrc = 0;
+  guint32 ssrc = 0;
+
+  list = gst_buffer_list_make_writable (list);
+
+  GST_OBJECT_LOCK (filter);
+
+  while (gst_buffer_list_length (list) > 0) {
+    GstBuffer *buf = gst_buffer_ref (gst_buffer_list_get (list, 0));
+    GstSrtpDecSsrcStream *stream;
+    gboolean buf_is_rtcp = is_rtcp;
+
+    /* drop the list's ref so the buffer is writable for decoding */
+    gst_buffer_list_remove (list, 0, 1);
+
+    if (!(stream = validate_buffer (filter, buf, &ssrc, &buf_is_rtcp))) {
+      GST_WARNING_OBJECT (filter, "Invalid buffer, dropping");
+      gst_buffer_unref (buf);
+      continue;
+    }
+
+    if (STREAM_HAS_CRYPTO (stream)) {
+      if (!gst_srtp_dec_decode_buffer (filter, pad, buf, buf_is_rtcp, ssrc)) {
+        gst_buffer_unref (buf);
+        continue;
+      }
+
+      if (gst_srtp_get_soft_limit_reached ()) {
+        soft_limit = TRUE;
+        soft_limit_ssrc = ssrc;
+      }
+    }
+
+    if (buf_is_rtcp) {
+      if (!rtcp_out)
+        rtcp_out = gst_buffer_list_new ();
+      gst_buffer_list_add (rtcp_out, buf);
+    } else {
+      if (!rtp_out)
+        rtp_out = gst_buffer_list_new ();
+      gst_buffer_list_add (rtp_out, buf);
+    }
+  }
+
+  GST_OBJECT_UNLOCK (filter);
+
+  gst_buffer_list_unref (list);
+
+  if (soft_limit)
+    request_key_with_signal (filter, soft_limit_ssrc, SIGNAL_SOFT_LIMIT);
+
+  if (rtp_out) {
+    if (!filter->rtp_has_segment)
+      gst_srtp_dec_push_early_events (filter, filter->rtp_srcpad,
+          filter->rtcp_srcpad, FALSE);
+    ret = gst_pad_push_list (filter->rtp_srcpad, rtp_out);
+  }
+
+  if (rtcp_out) {
+    GstFlowReturn rtcp_ret;
+
+    if (!filter->rtcp_has_segment)
+      gst_srtp_dec_push_early_events (filter, filter->rtcp_srcpad,
+          filter->rtp_srcpad, TRUE);
+    rtcp_ret = gst_pad_push_list (filter->rtcp_srcpad, rtcp_out);
+    if (ret == GST_FLOW_OK)
+      ret = rtcp_ret;
+  }
+
+  return ret;
+}
+
+static GstFlowReturn
+gst_srtp_dec_chain_list_rtp (GstPad * pad, GstObject * parent,
+    GstBufferList * list)
+{
+  return gst_srtp_dec_chain_list (pad, parent, list, FALSE);
+}
+
+static GstFlowReturn
+gst_srtp_dec_chain_list_rtcp (GstPad * pad, GstObject * parent,
+    GstBufferList * list)
+{
+  return gst_srtp_dec_chain_list (pad, parent, list, TRUE);
+}
+
 static GstStateChangeReturn
 gst_srtp_dec_change_state (GstElement * element, GstStateChange transition)
 {
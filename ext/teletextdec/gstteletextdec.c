@@ -330,6 +330,12 @@ gst_teletextdec_zvbi_clear (GstTeletextDec * teletext)
     teletext->frame = NULL;
   }
 
+  if (teletext->last_page_text != NULL) {
+    g_free (teletext->last_page_text);
+    teletext->last_page_text = NULL;
+    teletext->last_page_size = 0;
+  }
+
   g_mutex_lock (&teletext->queue_lock);
   if (teletext->queue != NULL) {
     g_queue_free (teletext->queue);
@@ -342,6 +348,20 @@ gst_teletextdec_zvbi_clear (GstTeletextDec * teletext)
   teletext->pageno = 0x100;
   teletext->subno = -1;
   teletext->last_ts = 0;
+  teletext->last_page_text = NULL;
+  teletext->last_page_size = 0;
+}
+
+/* Drop the copy of the last pushed page, so the next received page is
+ * always rendered; called when the subscribed page changes */
+static void
+gst_teletextdec_reset_last_page (GstTeletextDec * teletext)
+{
+  g_mutex_lock (&teletext->queue_lock);
+  g_free (teletext->last_page_text);
+  teletext->last_page_text = NULL;
+  teletext->last_page_size = 0;
+  g_mutex_unlock (&teletext->queue_lock);
 }
 
 static void
@@ -353,9 +373,11 @@ gst_teletextdec_set_property (GObject * object, guint prop_id,
   switch (prop_id) {
     case PROP_PAGENO:
       teletext->pageno = (gint) vbi_bin2bcd (g_value_get_int (value));
+      gst_teletextdec_reset_last_page (teletext);
       break;
     case PROP_SUBNO:
       teletext->subno = g_value_get_int (value);
+      gst_teletextdec_reset_last_page (teletext);
       break;
     case PROP_SUBTITLES_MODE:
       teletext->subtitles_mode = g_value_get_boolean (value);
@@ -764,6 +786,7 @@ gst_teletextdec_push_page (GstTeletextDec * teletext)
   gint pgno, subno;
   gboolean success;
   guint width, height;
+  gsize page_size;
 
   pi = g_queue_pop_head (teletext->queue);
   pgno = vbi_bcd2dec (pi->pgno);
@@ -777,6 +800,26 @@ gst_teletextdec_push_page (GstTeletextDec * teletext)
   if (G_UNLIKELY (!success))
     goto fetch_page_failed;
 
+  /* teletext pages are retransmitted cyclically whether or not they
+   * changed; only render and push when the content differs from what we
+   * pushed last */
+  page_size = (gsize) page.columns * page.rows * sizeof (vbi_char);
+  if (teletext->last_page_text != NULL
+      && page_size == teletext->last_page_size
+      && memcmp (teletext->last_page_text, page.text, page_size) == 0) {
+    GST_DEBUG_OBJECT (teletext, "Page %03d.%02d is unchanged, not pushing",
+        pgno, subno);
+    vbi_unref_page (&page);
+    return GST_FLOW_OK;
+  }
+
+  if (page_size != teletext->last_page_size) {
+    g_free (teletext->last_page_text);
+    teletext->last_page_text = g_malloc (page_size);
+    teletext->last_page_size = page_size;
+  }
+  memcpy (teletext->last_page_text, page.text, page_size);
+
   width = COLUMNS_TO_WIDTH (page.columns);
   height = ROWS_TO_HEIGHT (page.rows);
 
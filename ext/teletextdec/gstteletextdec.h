@@ -74,6 +74,11 @@ struct _GstTeletextDec
 
   GstTeletextExportFunc export_func;
 
+  /* copy of the last pushed page's characters, to skip re-rendering
+   * cyclic retransmissions of an unchanged page */
+  vbi_char *last_page_text;
+  gsize last_page_size;
+
   /* negotiated size of the output image in RGBA mode. */
   guint width;
   guint height;
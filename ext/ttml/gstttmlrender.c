@@ -350,6 +350,7 @@ gst_ttml_render_init (GstTtmlRender * render, GstTtmlRenderClass * klass)
 
   render->wait_text = TRUE;
   render->need_render = TRUE;
+  render->scene_hash = 0;
   render->text_buffer = NULL;
   render->text_linked = FALSE;
 
@@ -1088,6 +1089,88 @@ gst_ttml_render_pop_text (GstTtmlRender * render)
   GST_TTML_RENDER_BROADCAST (render);
 }
 
+static guint
+gst_ttml_render_hash_bytes (guint hash, gconstpointer data, gsize size)
+{
+  const guint8 *bytes = data;
+  gsize i;
+
+  for (i = 0; i < size; ++i)
+    hash = (hash << 5) + hash + bytes[i];
+
+  return hash;
+}
+
+static guint
+gst_ttml_render_hash_style_set (guint hash, const GstSubtitleStyleSet * style)
+{
+  /* style sets are allocated zeroed, so any padding bytes inside the ranges
+   * hashed below are deterministic; the font_family pointer itself is
+   * skipped and its string hashed instead */
+  hash = gst_ttml_render_hash_bytes (hash, &style->text_direction,
+      sizeof (style->text_direction));
+  if (style->font_family)
+    hash = gst_ttml_render_hash_bytes (hash, style->font_family,
+        strlen (style->font_family));
+  hash = gst_ttml_render_hash_bytes (hash, &style->font_size,
+      G_STRUCT_OFFSET (GstSubtitleStyleSet, fill_line_gap)
+      + sizeof (style->fill_line_gap)
+      - G_STRUCT_OFFSET (GstSubtitleStyleSet, font_size));
+
+  return hash;
+}
+
+/* Hashes the active cue set of @buffer: all region, block and element
+ * styling plus the text each element refers to. Two text buffers with equal
+ * hashes describe the same rendered scene, which lets us reuse the overlay
+ * compositions composed for the previous buffer instead of re-running
+ * Pango layout and blending for every re-sent cue. */
+static guint
+gst_ttml_render_scene_hash (GstBuffer * buffer)
+{
+  GstSubtitleMeta *subtitle_meta;
+  guint hash = 5381;
+  guint i, j, k;
+
+  subtitle_meta = gst_buffer_get_subtitle_meta (buffer);
+  if (!subtitle_meta)
+    return 0;
+
+  for (i = 0; i < subtitle_meta->regions->len; ++i) {
+    GstSubtitleRegion *region =
+        g_ptr_array_index (subtitle_meta->regions, i);
+
+    hash = gst_ttml_render_hash_style_set (hash, region->style_set);
+
+    for (j = 0; j < gst_subtitle_region_get_block_count (region); ++j) {
+      const GstSubtitleBlock *block = gst_subtitle_region_get_block (region,
+          j);
+
+      hash = gst_ttml_render_hash_style_set (hash, block->style_set);
+
+      for (k = 0; k < gst_subtitle_block_get_element_count (block); ++k) {
+        GstSubtitleElement *element = gst_subtitle_block_get_element (block,
+            k);
+        GstMemory *mem;
+        GstMapInfo map;
+
+        hash = gst_ttml_render_hash_style_set (hash, element->style_set);
+        hash = gst_ttml_render_hash_bytes (hash,
+            &element->suppress_whitespace,
+            sizeof (element->suppress_whitespace));
+
+        mem = gst_buffer_peek_memory (buffer, element->text_index);
+        if (!mem || !gst_memory_map (mem, &map, GST_MAP_READ))
+          return 0;
+        hash = gst_ttml_render_hash_bytes (hash, map.data, map.size);
+        gst_memory_unmap (mem, &map);
+      }
+    }
+  }
+
+  return hash;
+}
+
 /* We receive text buffers here. If they are out of segment we just ignore them.
    If the buffer is in our segment we keep it internally except if another one
    is already waiting here, in that case we wait that it gets kicked out */
@@ -1099,6 +1182,7 @@ gst_ttml_render_text_chain (GstPad * pad, GstObject * parent,
   GstTtmlRender *render = NULL;
   gboolean in_seg = FALSE;
   guint64 clip_start = 0, clip_stop = 0;
+  guint scene_hash;
 
   render = GST_TTML_RENDER (parent);
 
@@ -1161,8 +1245,19 @@ gst_ttml_render_text_chain (GstPad * pad, GstObject * parent,
       render->text_segment.position = clip_start;
 
     render->text_buffer = buffer;
-    /* That's a new text buffer we need to render */
-    render->need_render = TRUE;
+
+    /* Re-render only if the buffer describes a different scene than the
+     * compositions we already have; streams that repeat their cues at
+     * regular intervals then reuse the previous render */
+    scene_hash = gst_ttml_render_scene_hash (buffer);
+    if (scene_hash == 0 || scene_hash != render->scene_hash
+        || !render->compositions) {
+      render->need_render = TRUE;
+      render->scene_hash = scene_hash;
+    } else {
+      GST_LOG_OBJECT (render, "unchanged cue set and styling, reusing "
+          "rendered compositions");
+    }
 
     /* in case the video chain is waiting for a text buffer, wake it up */
     GST_TTML_RENDER_BROADCAST (render);
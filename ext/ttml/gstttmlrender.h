@@ -90,6 +90,9 @@ struct _GstTtmlRender {
     gboolean                 wait_text;
 
     gboolean                 need_render;
+    guint                    scene_hash; /* hash of the cue set and styling
+                                          * that @compositions was rendered
+                                          * from */
 
     PangoLayout             *layout;
     GList * compositions;
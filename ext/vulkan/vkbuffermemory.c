@@ -186,6 +186,99 @@ error:
   }
 }
 
+static GstVulkanBufferMemory *
+_vk_buffer_mem_new_suballoc (GstAllocator * allocator, GstVulkanDevice * device,
+    VkFormat format, gsize size, VkBufferUsageFlags usage,
+    GstVulkanMemory * group, gsize * offset)
+{
+  GstVulkanBufferMemory *mem = NULL;
+  GstAllocationParams params = { 0, };
+  VkBufferCreateInfo buffer_info;
+  GError *error = NULL;
+  gsize aligned;
+  VkBuffer buffer;
+  VkResult err;
+
+  if (!_create_info_from_args (&buffer_info, size, usage)) {
+    GST_CAT_ERROR (GST_CAT_VULKAN_BUFFER_MEMORY, "Incorrect buffer parameters");
+    return NULL;
+  }
+
+  err = vkCreateBuffer (device->device, &buffer_info, NULL, &buffer);
+  if (gst_vulkan_error_to_g_error (err, &error, "vkCreateBuffer") < 0)
+    goto vk_error;
+
+  mem = g_new0 (GstVulkanBufferMemory, 1);
+  vkGetBufferMemoryRequirements (device->device, buffer, &mem->requirements);
+
+  /* XXX: assumes alignment is a power of 2 */
+  aligned = (*offset + mem->requirements.alignment - 1) &
+      ~(mem->requirements.alignment - 1);
+
+  if ((mem->requirements.memoryTypeBits &
+          (1 << group->alloc_info.memoryTypeIndex)) == 0
+      || aligned + mem->requirements.size > group->mem.size) {
+    GST_CAT_DEBUG (GST_CAT_VULKAN_BUFFER_MEMORY,
+        "memory %p does not fit buffer of size %" G_GSIZE_FORMAT
+        " at offset %" G_GSIZE_FORMAT, group,
+        (gsize) mem->requirements.size, aligned);
+    vkDestroyBuffer (device->device, buffer, NULL);
+    g_free (mem);
+    return NULL;
+  }
+
+  params.align = mem->requirements.alignment - 1;
+  _vk_buffer_mem_init (mem, allocator, NULL, device, usage, &params,
+      mem->requirements.size, NULL, NULL);
+  mem->buffer = buffer;
+
+  mem->vk_mem = (GstVulkanMemory *)
+      gst_memory_share (GST_MEMORY_CAST (group), aligned,
+      mem->requirements.size);
+  if (!mem->vk_mem)
+    goto error;
+
+  err = vkBindBufferMemory (device->device, buffer, mem->vk_mem->mem_ptr,
+      mem->vk_mem->vk_offset);
+  if (gst_vulkan_error_to_g_error (err, &error, "vkBindBufferMemory") < 0)
+    goto vk_error;
+
+  *offset = aligned + mem->requirements.size;
+
+  if (usage & (VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
+          VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT |
+          VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+          VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+          VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
+          VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+          VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT)) {
+    VkBufferViewCreateInfo view_info;
+
+    _create_view_from_args (&view_info, mem->buffer, format, 0,
+        mem->requirements.size);
+    err = vkCreateBufferView (device->device, &view_info, NULL, &mem->view);
+    if (gst_vulkan_error_to_g_error (err, &error, "vkCreateBufferView") < 0)
+      goto vk_error;
+  }
+
+  return mem;
+
+vk_error:
+  {
+    GST_CAT_ERROR (GST_CAT_VULKAN_BUFFER_MEMORY,
+        "Failed to allocate buffer memory %s", error->message);
+    g_clear_error (&error);
+    goto error;
+  }
+
+error:
+  {
+    if (mem)
+      gst_memory_unref ((GstMemory *) mem);
+    return NULL;
+  }
+}
+
 static GstVulkanBufferMemory *
 _vk_buffer_mem_new_wrapped (GstAllocator * allocator, GstMemory * parent,
     GstVulkanDevice * device, VkBuffer buffer, VkFormat format,
@@ -352,6 +445,38 @@ gst_vulkan_buffer_memory_alloc (GstVulkanDevice * device, VkFormat format,
   return (GstMemory *) mem;
 }
 
+/**
+ * gst_vulkan_buffer_memory_alloc_suballocated:
+ * @device: a #GstVulkanDevice
+ * @format: the #VkFormat for the buffer
+ * @size: the size to allocate
+ * @usage: the buffer usage flags
+ * @group: a #GstVulkanMemory to suballocate from
+ * @offset: (inout): first unused byte in @group, updated past the new
+ *          allocation on success
+ *
+ * Allocates a new #GstVulkanBufferMemory bound to a range of @group instead
+ * of a dedicated #VkDeviceMemory.  @offset is aligned up as required by the
+ * buffer.  Fails without side effects if the remaining space in @group is
+ * too small or @group was allocated from a memory type the buffer cannot be
+ * bound to, so callers can retry with a new #GstVulkanMemory or fall back
+ * to gst_vulkan_buffer_memory_alloc().
+ *
+ * Returns: (nullable): a #GstMemory object suballocated from @group
+ */
+GstMemory *
+gst_vulkan_buffer_memory_alloc_suballocated (GstVulkanDevice * device,
+    VkFormat format, gsize size, VkBufferUsageFlags usage,
+    GstVulkanMemory * group, gsize * offset)
+{
+  GstVulkanBufferMemory *mem;
+
+  mem = _vk_buffer_mem_new_suballoc (_vulkan_buffer_memory_allocator, device,
+      format, size, usage, group, offset);
+
+  return (GstMemory *) mem;
+}
+
 GstMemory *
 gst_vulkan_buffer_memory_wrapped (GstVulkanDevice * device, VkBuffer buffer,
     VkFormat format, VkBufferUsageFlags usage, gpointer user_data,
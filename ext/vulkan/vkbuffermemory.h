@@ -90,6 +90,13 @@ GstMemory *     gst_vulkan_buffer_memory_alloc           (GstVulkanDevice * devi
                                                          VkBufferUsageFlags usage,
                                                          VkMemoryPropertyFlags mem_prop_flags);
 
+GstMemory *     gst_vulkan_buffer_memory_alloc_suballocated (GstVulkanDevice * device,
+                                                         VkFormat format,
+                                                         gsize size,
+                                                         VkBufferUsageFlags usage,
+                                                         GstVulkanMemory * group,
+                                                         gsize * offset);
+
 GstMemory *     gst_vulkan_buffer_memory_wrapped         (GstVulkanDevice * device,
                                                          VkBuffer buffer,
                                                          VkFormat format,
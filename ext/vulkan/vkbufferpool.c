@@ -38,6 +38,9 @@
  * #GST_BUFFER_POOL_OPTION_VIDEO_META
  */
 
+/* how many buffers an arena is sized for at least */
+#define ARENA_MIN_BUFFERS 4
+
 /* bufferpool */
 struct _GstVulkanBufferPoolPrivate
 {
@@ -45,6 +48,15 @@ struct _GstVulkanBufferPoolPrivate
   GstVideoInfo v_info;
   gboolean add_videometa;
   gsize alloc_sizes[GST_VIDEO_MAX_PLANES];
+
+  /* slab the buffer memories are suballocated from. Buffers keep the
+   * arenas they were allocated out of alive, the pool only holds the one
+   * that still has free space */
+  GstVulkanMemory *arena;
+  gsize arena_offset;
+  gsize arena_size;
+  guint32 arena_type_idx;
+  gboolean can_suballocate;
 };
 
 static void gst_vulkan_buffer_pool_finalize (GObject * object);
@@ -116,6 +128,44 @@ gst_vulkan_buffer_pool_set_config (GstBufferPool * pool, GstStructure * config)
     gst_memory_unref (GST_MEMORY_CAST (img_mem));
   }
 
+  /* probe the buffer memory requirements the same way to size and type the
+   * arenas the actual buffers are suballocated from */
+  {
+    GstVulkanBufferMemory *buf_mem;
+
+    if (priv->arena) {
+      gst_memory_unref (GST_MEMORY_CAST (priv->arena));
+      priv->arena = NULL;
+    }
+    priv->arena_offset = 0;
+    priv->can_suballocate = FALSE;
+
+    buf_mem = (GstVulkanBufferMemory *)
+        gst_vulkan_buffer_memory_alloc (vk_pool->device,
+        gst_vulkan_format_from_video_format (GST_VIDEO_INFO_FORMAT
+            (&priv->v_info), 0), priv->alloc_sizes[0],
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+    if (buf_mem) {
+      if (gst_vulkan_memory_find_memory_type_index_with_type_properties
+          (vk_pool->device, buf_mem->requirements.memoryTypeBits,
+              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, &priv->arena_type_idx)) {
+        gsize per_buffer = 0;
+
+        for (i = 0; i < GST_VIDEO_INFO_N_PLANES (&priv->v_info); i++) {
+          /* one alignment of slack per plane */
+          per_buffer += priv->alloc_sizes[i] + buf_mem->requirements.alignment;
+        }
+        priv->arena_size = per_buffer * MAX (min_buffers, ARENA_MIN_BUFFERS);
+        priv->can_suballocate = TRUE;
+
+        GST_LOG_OBJECT (pool, "using arenas of %" G_GSIZE_FORMAT " bytes, "
+            "memory type %u", priv->arena_size, priv->arena_type_idx);
+      }
+      gst_memory_unref (GST_MEMORY_CAST (buf_mem));
+    }
+  }
+
   priv->add_videometa = gst_buffer_pool_config_has_option (config,
       GST_BUFFER_POOL_OPTION_VIDEO_META);
 
@@ -143,6 +193,50 @@ wrong_caps:
   }
 }
 
+static GstMemory *
+gst_vulkan_buffer_pool_alloc_memory (GstVulkanBufferPool * vk_pool,
+    VkFormat vk_format, gsize size)
+{
+  GstVulkanBufferPoolPrivate *priv = vk_pool->priv;
+  GstMemory *mem;
+
+  if (priv->can_suballocate) {
+    if (priv->arena) {
+      mem = gst_vulkan_buffer_memory_alloc_suballocated (vk_pool->device,
+          vk_format, size,
+          VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+          priv->arena, &priv->arena_offset);
+      if (mem)
+        return mem;
+      /* arena exhausted; buffers allocated from it keep it alive */
+      gst_memory_unref (GST_MEMORY_CAST (priv->arena));
+      priv->arena = NULL;
+    }
+
+    priv->arena = (GstVulkanMemory *) gst_vulkan_memory_alloc (vk_pool->device,
+        priv->arena_type_idx, NULL, priv->arena_size,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+    priv->arena_offset = 0;
+    if (priv->arena) {
+      GST_LOG_OBJECT (vk_pool, "allocated new arena of size %" G_GSIZE_FORMAT,
+          priv->arena_size);
+      mem = gst_vulkan_buffer_memory_alloc_suballocated (vk_pool->device,
+          vk_format, size,
+          VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+          priv->arena, &priv->arena_offset);
+      if (mem)
+        return mem;
+    }
+
+    GST_DEBUG_OBJECT (vk_pool,
+        "suballocation failed, falling back to a dedicated allocation");
+  }
+
+  return gst_vulkan_buffer_memory_alloc (vk_pool->device, vk_format, size,
+      VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+}
+
 /* This function handles GstBuffer creation */
 static GstFlowReturn
 gst_vulkan_buffer_pool_alloc (GstBufferPool * pool, GstBuffer ** buffer,
@@ -164,10 +258,8 @@ gst_vulkan_buffer_pool_alloc (GstBufferPool * pool, GstBuffer ** buffer,
 
     vk_format = gst_vulkan_format_from_video_format (v_format, i);
 
-    mem = gst_vulkan_buffer_memory_alloc (vk_pool->device,
-        vk_format, priv->alloc_sizes[i],
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+    mem = gst_vulkan_buffer_pool_alloc_memory (vk_pool, vk_format,
+        priv->alloc_sizes[i]);
     if (!mem) {
       gst_buffer_unref (buf);
       goto mem_create_failed;
@@ -244,6 +336,11 @@ gst_vulkan_buffer_pool_finalize (GObject * object)
   if (priv->caps)
     gst_caps_unref (priv->caps);
 
+  if (priv->arena) {
+    gst_memory_unref (GST_MEMORY_CAST (priv->arena));
+    priv->arena = NULL;
+  }
+
   G_OBJECT_CLASS (gst_vulkan_buffer_pool_parent_class)->finalize (object);
 
   /* only release the context once all our memory have been deleted */
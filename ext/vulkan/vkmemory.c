@@ -153,9 +153,21 @@ _vk_mem_new (GstAllocator * allocator, GstMemory * parent,
   return mem;
 }
 
+static GstVulkanMemory *
+_vk_mem_get_root (GstVulkanMemory * mem)
+{
+  GstVulkanMemory *root = mem;
+
+  while (GST_MEMORY_CAST (root)->parent)
+    root = (GstVulkanMemory *) GST_MEMORY_CAST (root)->parent;
+
+  return root;
+}
+
 static gpointer
 _vk_mem_map_full (GstVulkanMemory * mem, GstMapInfo * info, gsize size)
 {
+  GstVulkanMemory *root = _vk_mem_get_root (mem);
   gpointer data;
   VkResult err;
   GError *error = NULL;
@@ -165,14 +177,26 @@ _vk_mem_map_full (GstVulkanMemory * mem, GstMapInfo * info, gsize size)
     return NULL;
   }
 
-  err = vkMapMemory (mem->device->device, mem->mem_ptr, mem->vk_offset,
-      size, 0, &data);
-  if (gst_vulkan_error_to_g_error (err, &error, "vkMapMemory") < 0) {
-    GST_CAT_ERROR (GST_CAT_VULKAN_MEMORY, "Failed to map device memory %s",
-        error->message);
-    g_clear_error (&error);
-    return NULL;
+  /* The root memory is mapped in its entirety on the first map and stays
+   * mapped until it is freed.  Apart from making repeated maps cheap this
+   * is required for suballocation: a VkDeviceMemory can only be mapped
+   * once, but multiple memories suballocated from the same root may be
+   * mapped concurrently */
+  g_mutex_lock (&root->lock);
+  if (!root->mapping) {
+    err = vkMapMemory (root->device->device, root->mem_ptr, 0,
+        root->mem.maxsize, 0, &root->mapping);
+    if (gst_vulkan_error_to_g_error (err, &error, "vkMapMemory") < 0) {
+      g_mutex_unlock (&root->lock);
+      GST_CAT_ERROR (GST_CAT_VULKAN_MEMORY, "Failed to map device memory %s",
+          error->message);
+      g_clear_error (&error);
+      return NULL;
+    }
   }
+  root->map_count++;
+  data = (guint8 *) root->mapping + mem->vk_offset;
+  g_mutex_unlock (&root->lock);
 
   return data;
 }
@@ -180,7 +204,11 @@ _vk_mem_map_full (GstVulkanMemory * mem, GstMapInfo * info, gsize size)
 static void
 _vk_mem_unmap_full (GstVulkanMemory * mem, GstMapInfo * info)
 {
-  vkUnmapMemory (mem->device->device, mem->mem_ptr);
+  GstVulkanMemory *root = _vk_mem_get_root (mem);
+
+  g_mutex_lock (&root->lock);
+  root->map_count--;
+  g_mutex_unlock (&root->lock);
 }
 
 static GstMemory *
@@ -201,7 +229,7 @@ _vk_mem_share (GstVulkanMemory * mem, gssize offset, gsize size)
 
   g_return_val_if_fail (size > 0, NULL);
 
-  while ((parent = (GstVulkanMemory *) (GST_MEMORY_CAST (parent)->parent)));
+  parent = _vk_mem_get_root (mem);
 
   params.flags = GST_MEMORY_FLAGS (mem);
   params.align = GST_MEMORY_CAST (parent)->align;
@@ -244,8 +272,11 @@ _vk_mem_free (GstAllocator * allocator, GstMemory * memory)
   if (mem->notify)
     mem->notify (mem->user_data);
 
-  if (mem->mem_ptr && !mem->wrapped)
+  if (mem->mem_ptr && !mem->wrapped) {
+    if (mem->mapping)
+      vkUnmapMemory (mem->device->device, mem->mem_ptr);
     vkFreeMemory (mem->device->device, mem->mem_ptr, NULL);
+  }
 
   gst_object_unref (mem->device);
 }
@@ -52,6 +52,7 @@ struct _GstVulkanMemory
   /* <protected> */
   GMutex                    lock;
   guint                     map_count;
+  gpointer                  mapping;
 
   /* <private> */
   GDestroyNotify            notify;
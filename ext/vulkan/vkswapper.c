@@ -33,11 +33,18 @@ GST_DEBUG_CATEGORY (GST_CAT_DEFAULT);
 #define RENDER_LOCK(o) g_mutex_lock (RENDER_GET_LOCK(o));
 #define RENDER_UNLOCK(o) g_mutex_unlock (RENDER_GET_LOCK(o));
 
+/* number of frames that may be queued on the GPU before we wait for the
+ * oldest one to complete */
+#define MAX_FRAMES_IN_FLIGHT 3
+
 struct _GstVulkanSwapperPrivate
 {
   GMutex render_lock;
 
   GList *trash_list;
+
+  /* fences of the most recently submitted frames, oldest first */
+  GQueue frames_in_flight;
 };
 
 #define gst_vulkan_swapper_parent_class parent_class
@@ -334,6 +341,7 @@ static void
 gst_vulkan_swapper_finalize (GObject * object)
 {
   GstVulkanSwapper *swapper = GST_VULKAN_SWAPPER (object);
+  GstVulkanFence *fence;
   int i;
 
   if (!gst_vulkan_trash_list_wait (swapper->priv->trash_list, -1))
@@ -341,6 +349,9 @@ gst_vulkan_swapper_finalize (GObject * object)
         "before shutting down");
   swapper->priv->trash_list = NULL;
 
+  while ((fence = g_queue_pop_head (&swapper->priv->frames_in_flight)))
+    gst_vulkan_fence_unref (fence);
+
   if (swapper->swap_chain_images) {
     for (i = 0; i < swapper->n_swap_chain_images; i++) {
       gst_memory_unref ((GstMemory *) swapper->swap_chain_images[i]);
@@ -393,6 +404,7 @@ gst_vulkan_swapper_init (GstVulkanSwapper * swapper)
   swapper->priv = gst_vulkan_swapper_get_instance_private (swapper);
 
   g_mutex_init (&swapper->priv->render_lock);
+  g_queue_init (&swapper->priv->frames_in_flight);
 }
 
 static void
@@ -873,6 +885,28 @@ _build_render_buffer_cmd (GstVulkanSwapper * swapper, guint32 swap_idx,
   return TRUE;
 }
 
+/* with RENDER_LOCK.  Blocks until fewer than MAX_FRAMES_IN_FLIGHT previously
+ * submitted frames are still executing on the GPU so that we never record
+ * unboundedly far ahead of presentation. */
+static gboolean
+_swapper_wait_for_frame_slot (GstVulkanSwapper * swapper, GError ** error)
+{
+  while (g_queue_get_length (&swapper->priv->frames_in_flight) >=
+      MAX_FRAMES_IN_FLIGHT) {
+    GstVulkanFence *fence =
+        g_queue_pop_head (&swapper->priv->frames_in_flight);
+    VkResult err;
+
+    err = vkWaitForFences (swapper->device->device, 1, &fence->fence, TRUE,
+        -1);
+    gst_vulkan_fence_unref (fence);
+    if (gst_vulkan_error_to_g_error (err, error, "vkWaitForFences") < 0)
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
 static gboolean
 _render_buffer_unlocked (GstVulkanSwapper * swapper,
     GstBuffer * buffer, GError ** error)
@@ -907,6 +941,9 @@ _render_buffer_unlocked (GstVulkanSwapper * swapper,
 
   gst_buffer_replace (&swapper->current_buffer, buffer);
 
+  if (!_swapper_wait_for_frame_slot (swapper, error))
+    goto error;
+
 reacquire:
   err = vkCreateSemaphore (swapper->device->device, &semaphore_info,
       NULL, &acquire_semaphore);
@@ -961,6 +998,9 @@ reacquire:
     if (gst_vulkan_error_to_g_error (err, error, "vkQueueSubmit") < 0)
       goto error;
 
+    g_queue_push_tail (&swapper->priv->frames_in_flight,
+        gst_vulkan_fence_ref (fence));
+
     swapper->priv->trash_list = g_list_prepend (swapper->priv->trash_list,
         gst_vulkan_trash_new_free_command_buffer (gst_vulkan_fence_ref (fence),
             cmd));
@@ -79,12 +79,29 @@ gst_vulkan_trash_new (GstVulkanFence * fence, GstVulkanTrashNotify notify,
 GList *
 gst_vulkan_trash_list_gc (GList * trash_list)
 {
+  GstVulkanFence *pending_fence = NULL;
+  gboolean rest_signaled = FALSE;
   GList *l = trash_list;
 
+  /* Callers prepend new entries so the list runs newest to oldest, and all
+   * entries were submitted to the same queue, where fences signal in
+   * submission order.  The first signalled fence found therefore means every
+   * older entry has also completed and the remaining tail can be reaped
+   * without querying the driver again; entries sharing a still-pending fence
+   * are only checked once.  This keeps the scan cost proportional to the
+   * number of distinct pending fences plus the items actually freed, rather
+   * than the length of the whole list. */
   while (l) {
     GstVulkanTrash *trash = l->data;
 
-    if (gst_vulkan_fence_is_signaled (trash->fence)) {
+    if (!rest_signaled && trash->fence != pending_fence) {
+      if (gst_vulkan_fence_is_signaled (trash->fence))
+        rest_signaled = TRUE;
+      else
+        pending_fence = trash->fence;
+    }
+
+    if (rest_signaled) {
       GList *next = g_list_next (l);
       GST_TRACE ("fence %" GST_PTR_FORMAT " has been signalled, notifying",
           trash->fence);
@@ -115,18 +132,25 @@ gst_vulkan_trash_list_wait (GList * trash_list, guint64 timeout)
     GstVulkanDevice *device = NULL;
     GList *l = NULL;
 
+    GstVulkanFence *last_fence = NULL;
+
     fences = g_new0 (VkFence, n);
-    for (i = 0, l = trash_list; i < n; i++, l = g_list_next (l)) {
+    for (i = 0, l = trash_list; l; l = g_list_next (l)) {
       GstVulkanTrash *trash = l->data;
 
       if (device == NULL)
         device = trash->fence->device;
 
-      fences[i] = trash->fence->fence;
+      /* entries sharing a fence only need a single wait */
+      if (trash->fence != last_fence) {
+        fences[i++] = trash->fence->fence;
+        last_fence = trash->fence;
+      }
 
       /* only support waiting on fences from the same device */
       g_assert (device == trash->fence->device);
     }
+    n = i;
 
     GST_TRACE ("Waiting on %d fences with timeout %" GST_TIME_FORMAT, n,
         GST_TIME_ARGS (timeout));
@@ -305,6 +305,7 @@ _raw_to_buffer_perform (gpointer impl, GstBuffer * inbuf, GstBuffer ** outbuf)
   for (i = 0; i < GST_VIDEO_INFO_N_PLANES (&raw->out_info); i++) {
     GstMapInfo map_info;
     gsize plane_size;
+    gint in_stride, out_stride;
     GstMemory *mem;
 
     mem = gst_buffer_peek_memory (*outbuf, i);
@@ -317,11 +318,28 @@ _raw_to_buffer_perform (gpointer impl, GstBuffer * inbuf, GstBuffer ** outbuf)
       goto out;
     }
 
+    in_stride = GST_VIDEO_FRAME_PLANE_STRIDE (&v_frame, i);
+    out_stride = GST_VIDEO_INFO_PLANE_STRIDE (&raw->out_info, i);
     plane_size =
-        GST_VIDEO_INFO_PLANE_STRIDE (&raw->out_info,
-        i) * GST_VIDEO_INFO_COMP_HEIGHT (&raw->out_info, i);
+        out_stride * GST_VIDEO_INFO_COMP_HEIGHT (&raw->out_info, i);
     g_assert (plane_size < map_info.size);
-    memcpy (map_info.data, v_frame.data[i], plane_size);
+
+    if (in_stride == out_stride) {
+      memcpy (map_info.data, v_frame.data[i], plane_size);
+    } else {
+      /* input rows may be padded differently than we lay them out */
+      guint8 *dst = map_info.data;
+      guint8 *src = v_frame.data[i];
+      gint row_size = MIN (in_stride, out_stride);
+      guint height = GST_VIDEO_INFO_COMP_HEIGHT (&raw->out_info, i);
+      guint j;
+
+      for (j = 0; j < height; j++) {
+        memcpy (dst, src, row_size);
+        dst += out_stride;
+        src += in_stride;
+      }
+    }
 
     gst_memory_unmap (GST_MEMORY_CAST (mem), &map_info);
   }
@@ -215,6 +215,7 @@ gst_wayland_sink_init (GstWaylandSink * sink)
 {
   g_mutex_init (&sink->display_lock);
   g_mutex_init (&sink->render_lock);
+  g_cond_init (&sink->redraw_wait);
 }
 
 static void
@@ -295,6 +296,7 @@ gst_wayland_sink_finalize (GObject * object)
 
   g_mutex_clear (&sink->display_lock);
   g_mutex_clear (&sink->render_lock);
+  g_cond_clear (&sink->redraw_wait);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -418,6 +420,7 @@ gst_wayland_sink_change_state (GstElement * element, GstStateChange transition)
         g_clear_object (&sink->display);
         g_mutex_lock (&sink->render_lock);
         sink->redraw_pending = FALSE;
+        g_cond_signal (&sink->redraw_wait);
         g_mutex_unlock (&sink->render_lock);
       }
       g_mutex_unlock (&sink->display_lock);
@@ -627,6 +630,7 @@ frame_redraw_callback (void *data, struct wl_callback *callback, uint32_t time)
 
   g_mutex_lock (&sink->render_lock);
   sink->redraw_pending = FALSE;
+  g_cond_signal (&sink->redraw_wait);
   g_mutex_unlock (&sink->render_lock);
 
   wl_callback_destroy (callback);
@@ -703,10 +707,24 @@ gst_wayland_sink_show_frame (GstVideoSink * vsink, GstBuffer * buffer)
     }
   }
 
-  /* drop buffers until we get a frame callback */
+  /* Wait for the previous frame callback before rendering. The callback
+   * arrives on the display event thread, normally within one vblank, so
+   * waiting here instead of dropping keeps a 60 fps stream at 60 fps on a
+   * 60 Hz compositor. The wait is bounded so that a compositor that stops
+   * sending callbacks (e.g. for an occluded surface) degrades back to
+   * dropping rather than stalling the streaming thread. */
   if (sink->redraw_pending) {
-    GST_LOG_OBJECT (sink, "buffer %p dropped (redraw pending)", buffer);
-    goto done;
+    gint64 deadline = g_get_monotonic_time () + 100 * G_TIME_SPAN_MILLISECOND;
+
+    while (sink->redraw_pending) {
+      if (!g_cond_wait_until (&sink->redraw_wait, &sink->render_lock, deadline))
+        break;
+    }
+
+    if (sink->redraw_pending) {
+      GST_LOG_OBJECT (sink, "buffer %p dropped (redraw pending)", buffer);
+      goto done;
+    }
   }
 
   /* make sure that the application has called set_render_rectangle() */
@@ -66,6 +66,7 @@ struct _GstWaylandSink
 
   gboolean redraw_pending;
   GMutex render_lock;
+  GCond redraw_wait;
   GstBuffer *last_buffer;
 };
 
@@ -37,13 +37,15 @@ enum
   PROP_LOSSLESS,
   PROP_QUALITY,
   PROP_SPEED,
-  PROP_PRESET
+  PROP_PRESET,
+  PROP_USE_THREADS
 };
 
 #define DEFAULT_LOSSLESS FALSE
 #define DEFAULT_QUALITY 90
 #define DEFAULT_SPEED 4
 #define DEFAULT_PRESET WEBP_PRESET_PHOTO
+#define DEFAULT_USE_THREADS FALSE
 
 static void gst_webp_enc_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
@@ -155,6 +157,18 @@ gst_webp_enc_class_init (GstWebpEncClass * klass)
           GST_WEBP_ENC_PRESET_TYPE, DEFAULT_PRESET,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstWebpEnc:use-threads:
+   *
+   * When enabled, use multi-threaded encoding
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_USE_THREADS,
+      g_param_spec_boolean ("use-threads", "Use Threads",
+          "When enabled, use multi-threaded encoding", DEFAULT_USE_THREADS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   GST_DEBUG_CATEGORY_INIT (webpenc_debug, "webpenc", 0,
       "WEBP encoding element");
 }
@@ -168,6 +182,7 @@ gst_webp_enc_init (GstWebpEnc * webpenc)
   webpenc->quality = DEFAULT_QUALITY;
   webpenc->speed = DEFAULT_SPEED;
   webpenc->preset = DEFAULT_PRESET;
+  webpenc->use_threads = DEFAULT_USE_THREADS;
 
   webpenc->use_argb = FALSE;
   webpenc->rgb_format = GST_VIDEO_FORMAT_UNKNOWN;
@@ -289,15 +304,10 @@ gst_webp_enc_handle_frame (GstVideoEncoder * encoder,
   if (WebPEncode (&enc->webp_config, &enc->webp_picture)) {
     WebPPictureFree (&enc->webp_picture);
 
-    out_buffer = gst_buffer_new_allocate (NULL, enc->webp_writer.size, NULL);
-    if (!out_buffer) {
-      GST_ERROR_OBJECT (enc, "Failed to create output buffer");
-      gst_video_frame_unmap (&vframe);
-      return GST_FLOW_ERROR;
-    }
-    gst_buffer_fill (out_buffer, 0, enc->webp_writer.mem,
-        enc->webp_writer.size);
-    free (enc->webp_writer.mem);
+    /* hand the writer's memory over to the buffer instead of copying it */
+    out_buffer = gst_buffer_new_wrapped_full (0, enc->webp_writer.mem,
+        enc->webp_writer.size, 0, enc->webp_writer.size, enc->webp_writer.mem,
+        (GDestroyNotify) free);
   } else {
     GST_ERROR_OBJECT (enc, "Failed to encode WebPPicture");
     gst_video_frame_unmap (&vframe);
@@ -337,6 +347,9 @@ gst_webp_enc_set_property (GObject * object, guint prop_id,
     case PROP_PRESET:
       webpenc->preset = g_value_get_enum (value);
       break;
+    case PROP_USE_THREADS:
+      webpenc->use_threads = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -363,6 +376,9 @@ gst_webp_enc_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_PRESET:
       g_value_set_enum (value, webpenc->preset);
       break;
+    case PROP_USE_THREADS:
+      g_value_set_boolean (value, webpenc->use_threads);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -381,6 +397,7 @@ gst_webp_enc_start (GstVideoEncoder * benc)
 
   enc->webp_config.lossless = enc->lossless;
   enc->webp_config.method = enc->speed;
+  enc->webp_config.thread_level = enc->use_threads ? 1 : 0;
   if (!WebPValidateConfig (&enc->webp_config)) {
     GST_ERROR_OBJECT (enc, "Failed to Validate the WebPConfig");
     return FALSE;
@@ -54,6 +54,7 @@ struct _GstWebpEnc
   gfloat quality;
   guint speed;
   gint preset;
+  gboolean use_threads;
 
   gboolean use_argb;
   GstVideoFormat rgb_format;
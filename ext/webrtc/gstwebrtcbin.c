@@ -354,6 +354,8 @@ enum
   PROP_TURN_SERVER,
   PROP_BUNDLE_POLICY,
   PROP_ICE_TRANSPORT_POLICY,
+  PROP_STATS_HISTORY,
+  PROP_PREALLOCATE_TRANSPORTS,
 };
 
 static guint gst_webrtc_bin_signals[LAST_SIGNAL] = { 0 };
@@ -735,6 +737,14 @@ _execute_op (GstWebRTCBinTask * op)
     goto out;
   }
 
+  if (op->no_lock) {
+    /* the op doesn't touch pc state, don't make it serialize with (or
+     * deadlock against) API calls performed from within its callbacks */
+    PC_UNLOCK (op->webrtc);
+    op->op (op->webrtc, op->data);
+    return G_SOURCE_REMOVE;
+  }
+
   op->op (op->webrtc, op->data);
 
 out:
@@ -750,9 +760,9 @@ _free_op (GstWebRTCBinTask * op)
   g_free (op);
 }
 
-void
-gst_webrtc_bin_enqueue_task (GstWebRTCBin * webrtc, GstWebRTCBinFunc func,
-    gpointer data, GDestroyNotify notify)
+static void
+_enqueue_task (GstWebRTCBin * webrtc, GstWebRTCBinFunc func,
+    gpointer data, GDestroyNotify notify, gboolean no_lock)
 {
   GstWebRTCBinTask *op;
   GSource *source;
@@ -770,6 +780,7 @@ gst_webrtc_bin_enqueue_task (GstWebRTCBin * webrtc, GstWebRTCBinFunc func,
   op->op = func;
   op->data = data;
   op->notify = notify;
+  op->no_lock = no_lock;
 
   source = g_idle_source_new ();
   g_source_set_priority (source, G_PRIORITY_DEFAULT);
@@ -779,6 +790,25 @@ gst_webrtc_bin_enqueue_task (GstWebRTCBin * webrtc, GstWebRTCBinFunc func,
   g_source_unref (source);
 }
 
+void
+gst_webrtc_bin_enqueue_task (GstWebRTCBin * webrtc, GstWebRTCBinFunc func,
+    gpointer data, GDestroyNotify notify)
+{
+  _enqueue_task (webrtc, func, data, notify, FALSE);
+}
+
+/* Like gst_webrtc_bin_enqueue_task, but the task is run without holding
+ * PC_LOCK. Only for tasks that deliver data to the application and do not
+ * look at pc state themselves, e.g. data channel messages. Ordering with
+ * respect to other tasks is preserved, since everything still runs on the
+ * pc thread in enqueue order */
+void
+gst_webrtc_bin_enqueue_delivery (GstWebRTCBin * webrtc, GstWebRTCBinFunc func,
+    gpointer data, GDestroyNotify notify)
+{
+  _enqueue_task (webrtc, func, data, notify, TRUE);
+}
+
 /* https://www.w3.org/TR/webrtc/#dom-rtciceconnectionstate */
 static GstWebRTCICEConnectionState
 _collate_ice_connection_states (GstWebRTCBin * webrtc)
@@ -5147,6 +5177,18 @@ _create_rtpbin (GstWebRTCBin * webrtc)
   return rtpbin;
 }
 
+/* Build the transport elements for the first session ahead of negotiation.
+ * _get_or_create_transport_stream is keyed on the session id, so whatever
+ * description is applied later finds and reuses the pre-built stream (with
+ * max-bundle every media does) instead of constructing the DTLS/SRTP
+ * chain while the remote end is waiting for an answer */
+static void
+_preallocate_transports_task (GstWebRTCBin * webrtc, gpointer data)
+{
+  GST_DEBUG_OBJECT (webrtc, "pre-allocating transports for session 0");
+  _get_or_create_transport_stream (webrtc, 0, FALSE);
+}
+
 static GstStateChangeReturn
 gst_webrtc_bin_change_state (GstElement * element, GstStateChange transition)
 {
@@ -5169,6 +5211,9 @@ gst_webrtc_bin_change_state (GstElement * element, GstStateChange transition)
     }
     case GST_STATE_CHANGE_READY_TO_PAUSED:
       webrtc->priv->running = TRUE;
+      if (webrtc->priv->preallocate_transports)
+        gst_webrtc_bin_enqueue_task (webrtc,
+            (GstWebRTCBinFunc) _preallocate_transports_task, NULL, NULL);
       break;
     default:
       break;
@@ -5294,6 +5339,9 @@ gst_webrtc_bin_set_property (GObject * object, guint prop_id,
           webrtc->ice_transport_policy ==
           GST_WEBRTC_ICE_TRANSPORT_POLICY_RELAY ? TRUE : FALSE, NULL);
       break;
+    case PROP_PREALLOCATE_TRANSPORTS:
+      webrtc->priv->preallocate_transports = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -5358,6 +5406,31 @@ gst_webrtc_bin_get_property (GObject * object, guint prop_id,
     case PROP_ICE_TRANSPORT_POLICY:
       g_value_set_enum (value, webrtc->ice_transport_policy);
       break;
+    case PROP_PREALLOCATE_TRANSPORTS:
+      g_value_set_boolean (value, webrtc->priv->preallocate_transports);
+      break;
+    case PROP_STATS_HISTORY:{
+      GstStructure *history =
+          gst_structure_new_empty ("application/x-webrtc-stats-history");
+      guint i, n = 0;
+
+      for (i = 0; i < GST_WEBRTC_BIN_STATS_HISTORY_LEN; i++) {
+        guint pos = (webrtc->priv->stats_history_pos + i) %
+            GST_WEBRTC_BIN_STATS_HISTORY_LEN;
+        gchar *field;
+
+        if (!webrtc->priv->stats_history[pos])
+          continue;
+
+        /* oldest first, the current report is not included */
+        field = g_strdup_printf ("report-%u", n++);
+        gst_structure_set (history, field, GST_TYPE_STRUCTURE,
+            webrtc->priv->stats_history[pos], NULL);
+        g_free (field);
+      }
+      g_value_take_boxed (value, history);
+      break;
+    }
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -5446,6 +5519,16 @@ gst_webrtc_bin_finalize (GObject * object)
     gst_structure_free (webrtc->priv->stats);
   webrtc->priv->stats = NULL;
 
+  {
+    guint i;
+
+    for (i = 0; i < GST_WEBRTC_BIN_STATS_HISTORY_LEN; i++) {
+      if (webrtc->priv->stats_history[i])
+        gst_structure_free (webrtc->priv->stats_history[i]);
+      webrtc->priv->stats_history[i] = NULL;
+    }
+  }
+
   g_mutex_clear (PC_GET_LOCK (webrtc));
   g_cond_clear (PC_GET_COND (webrtc));
 
@@ -5593,6 +5676,41 @@ gst_webrtc_bin_class_init (GstWebRTCBinClass * klass)
           GST_WEBRTC_ICE_TRANSPORT_POLICY_ALL,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstWebRTCBin:stats-history:
+   *
+   * The last few stats reports produced by the get-stats signal, oldest
+   * first, as sub-structures named report-0, report-1, ... The current
+   * report is not included. Lets applications compute rates over the
+   * recent past without having to poll get-stats at a higher frequency.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class,
+      PROP_STATS_HISTORY,
+      g_param_spec_boxed ("stats-history", "Stats history",
+          "The last few stats reports, oldest first",
+          GST_TYPE_STRUCTURE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstWebRTCBin:preallocate-transports:
+   *
+   * Build the DTLS/SRTP transport elements for the first session as soon
+   * as the element goes to PAUSED instead of during negotiation, so that
+   * applying a session description only has to pay for the ICE/DTLS
+   * handshake. Most useful with bundle-policy=max-bundle, where all media
+   * share that one transport.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class,
+      PROP_PREALLOCATE_TRANSPORTS,
+      g_param_spec_boolean ("preallocate-transports",
+          "Pre-allocate transports",
+          "Build the transport elements for the first session before "
+          "negotiation starts", FALSE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstWebRTCBin::create-offer:
    * @object: the #webrtcbin
@@ -134,7 +134,15 @@ struct _GstWebRTCBinPrivate
   /* the number of times create_offer has been called for the version field */
   guint offer_count;
 
+  gboolean preallocate_transports;
+
   GstStructure *stats;
+  /* ring of previous stats reports, most recent overwriting the oldest.
+   * Filled from reports that would otherwise be freed on update, so
+   * keeping it costs no extra allocation or copy on the update path */
+#define GST_WEBRTC_BIN_STATS_HISTORY_LEN 8
+  GstStructure *stats_history[GST_WEBRTC_BIN_STATS_HISTORY_LEN];
+  guint stats_history_pos;
 };
 
 typedef void (*GstWebRTCBinFunc) (GstWebRTCBin * webrtc, gpointer data);
@@ -145,6 +153,8 @@ typedef struct
   GstWebRTCBinFunc op;
   gpointer data;
   GDestroyNotify notify;
+  /* run the op without holding PC_LOCK, for ops that don't touch pc state */
+  gboolean no_lock;
 //  GstPromise *promise;      /* FIXME */
 } GstWebRTCBinTask;
 
@@ -153,6 +163,11 @@ void            gst_webrtc_bin_enqueue_task             (GstWebRTCBin * pc,
                                                          gpointer data,
                                                          GDestroyNotify notify);
 
+void            gst_webrtc_bin_enqueue_delivery         (GstWebRTCBin * pc,
+                                                         GstWebRTCBinFunc func,
+                                                         gpointer data,
+                                                         GDestroyNotify notify);
+
 G_END_DECLS
 
 #endif /* __GST_WEBRTC_BIN_H__ */
@@ -562,7 +562,17 @@ gst_webrtc_bin_update_stats (GstWebRTCBin * webrtc)
 
   gst_structure_remove_field (s, "timestamp");
 
-  if (webrtc->priv->stats)
-    gst_structure_free (webrtc->priv->stats);
+  /* rotate the previous report into the history ring instead of throwing
+   * it away, so rates can be computed from the stats-history property
+   * without polling get-stats any faster */
+  if (webrtc->priv->stats) {
+    guint pos = webrtc->priv->stats_history_pos;
+
+    if (webrtc->priv->stats_history[pos])
+      gst_structure_free (webrtc->priv->stats_history[pos]);
+    webrtc->priv->stats_history[pos] = webrtc->priv->stats;
+    webrtc->priv->stats_history_pos =
+        (pos + 1) % GST_WEBRTC_BIN_STATS_HISTORY_LEN;
+  }
   webrtc->priv->stats = s;
 }
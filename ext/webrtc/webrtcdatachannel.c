@@ -283,6 +283,26 @@ _channel_enqueue_task (GstWebRTCDataChannel * channel, ChannelTask func,
       (GstWebRTCBinFunc) _execute_task, task, (GDestroyNotify) _free_task);
 }
 
+/* Delivery of received messages to the application. Runs on the pc thread
+ * like _channel_enqueue_task so per-channel ordering is kept, but without
+ * holding PC_LOCK across the signal emission: message delivery then doesn't
+ * serialize with signalling/stats tasks, and on-message handlers can call
+ * back into the webrtcbin API without deadlocking */
+static void
+_channel_enqueue_delivery (GstWebRTCDataChannel * channel, ChannelTask func,
+    gpointer user_data, GDestroyNotify notify)
+{
+  struct task *task = g_new0 (struct task, 1);
+
+  task->channel = gst_object_ref (channel);
+  task->func = func;
+  task->user_data = user_data;
+  task->notify = notify;
+
+  gst_webrtc_bin_enqueue_delivery (channel->webrtcbin,
+      (GstWebRTCBinFunc) _execute_task, task, (GDestroyNotify) _free_task);
+}
+
 static void
 _channel_store_error (GstWebRTCDataChannel * channel, GError * error)
 {
@@ -623,7 +643,7 @@ _data_channel_have_sample (GstWebRTCDataChannel * channel, GstSample * sample,
         ret = GST_FLOW_ERROR;
       } else {
         gchar *str = g_strndup ((gchar *) info.data, info.size);
-        _channel_enqueue_task (channel, (ChannelTask) _emit_have_string, str,
+        _channel_enqueue_delivery (channel, (ChannelTask) _emit_have_string, str,
             g_free);
       }
       break;
@@ -640,17 +660,17 @@ _data_channel_have_sample (GstWebRTCDataChannel * channel, GstSample * sample,
         GBytes *data = g_bytes_new_with_free_func (info->map_info.data,
             info->map_info.size, (GDestroyNotify) buffer_unmap_and_unref, info);
         info->buffer = gst_buffer_ref (buffer);
-        _channel_enqueue_task (channel, (ChannelTask) _emit_have_data, data,
+        _channel_enqueue_delivery (channel, (ChannelTask) _emit_have_data, data,
             (GDestroyNotify) g_bytes_unref);
       }
       break;
     }
     case DATA_CHANNEL_PPID_WEBRTC_BINARY_EMPTY:
-      _channel_enqueue_task (channel, (ChannelTask) _emit_have_data, NULL,
+      _channel_enqueue_delivery (channel, (ChannelTask) _emit_have_data, NULL,
           NULL);
       break;
     case DATA_CHANNEL_PPID_WEBRTC_STRING_EMPTY:
-      _channel_enqueue_task (channel, (ChannelTask) _emit_have_string, NULL,
+      _channel_enqueue_delivery (channel, (ChannelTask) _emit_have_string, NULL,
           NULL);
       break;
     default:
@@ -249,6 +249,10 @@ struct _GstWebrtcDsp
   GstAdapter *adapter;
   GstPlanarAudioAdapter *padapter;
   webrtc::AudioProcessing * apm;
+  /* Pooled frame for the 10ms periods; constructing an AudioFrame
+   * zero-fills its whole sample area, so do it once instead of twice
+   * per period */
+  webrtc::AudioFrame * frame;
 
   /* Protected by the object lock */
   gchar *probe_name;
@@ -373,7 +377,7 @@ gst_webrtc_dsp_analyze_reverse_stream (GstWebrtcDsp * self,
 {
   GstWebrtcEchoProbe *probe = NULL;
   webrtc::AudioProcessing * apm;
-  webrtc::AudioFrame frame;
+  webrtc::AudioFrame *frame;
   GstBuffer *buf = NULL;
   GstFlowReturn ret = GST_FLOW_OK;
   gint err, delay;
@@ -388,28 +392,29 @@ gst_webrtc_dsp_analyze_reverse_stream (GstWebrtcDsp * self,
     return GST_FLOW_OK;
 
   apm = self->apm;
+  frame = self->frame;
 
   if (self->delay_agnostic)
     rec_time = GST_CLOCK_TIME_NONE;
 
 again:
-  delay = gst_webrtc_echo_probe_read (probe, rec_time, (gpointer) &frame, &buf);
+  delay = gst_webrtc_echo_probe_read (probe, rec_time, (gpointer) frame, &buf);
   apm->set_stream_delay_ms (delay);
 
   if (delay < 0)
     goto done;
 
-  if (frame.sample_rate_hz_ != self->info.rate) {
+  if (frame->sample_rate_hz_ != self->info.rate) {
     GST_ELEMENT_ERROR (self, STREAM, FORMAT,
         ("Echo Probe has rate %i , while the DSP is running at rate %i,"
          " use a caps filter to ensure those are the same.",
-         frame.sample_rate_hz_, self->info.rate), (NULL));
+         frame->sample_rate_hz_, self->info.rate), (NULL));
     ret = GST_FLOW_ERROR;
     goto done;
   }
 
   if (buf) {
-    webrtc::StreamConfig config (frame.sample_rate_hz_, frame.num_channels_,
+    webrtc::StreamConfig config (frame->sample_rate_hz_, frame->num_channels_,
         false);
     GstAudioBuffer abuf;
     float * const * data;
@@ -422,7 +427,7 @@ again:
     gst_audio_buffer_unmap (&abuf);
     gst_buffer_replace (&buf, NULL);
   } else {
-    if ((err = apm->AnalyzeReverseStream (&frame)) < 0)
+    if ((err = apm->AnalyzeReverseStream (frame)) < 0)
       GST_WARNING_OBJECT (self, "Reverse stream analyses failed: %s.",
           webrtc_error_to_string (err));
   }
@@ -474,15 +479,15 @@ gst_webrtc_dsp_process_stream (GstWebrtcDsp * self,
   }
 
   if (self->interleaved) {
-    webrtc::AudioFrame frame;
-    frame.num_channels_ = self->info.channels;
-    frame.sample_rate_hz_ = self->info.rate;
-    frame.samples_per_channel_ = self->period_samples;
+    webrtc::AudioFrame *frame = self->frame;
+    frame->num_channels_ = self->info.channels;
+    frame->sample_rate_hz_ = self->info.rate;
+    frame->samples_per_channel_ = self->period_samples;
 
-    memcpy (frame.data_, abuf.planes[0], self->period_size);
-    err = apm->ProcessStream (&frame);
+    memcpy (frame->data_, abuf.planes[0], self->period_size);
+    err = apm->ProcessStream (frame);
     if (err >= 0)
-      memcpy (abuf.planes[0], frame.data_, self->period_size);
+      memcpy (abuf.planes[0], frame->data_, self->period_size);
   } else {
     float * const * data = (float * const *) abuf.planes;
     webrtc::StreamConfig config (self->info.rate, self->info.channels, false);
@@ -581,6 +586,7 @@ gst_webrtc_dsp_start (GstBaseTransform * btrans)
   /* TODO Intelligibility enhancer, Beamforming, etc. */
 
   self->apm = webrtc::AudioProcessing::Create (config);
+  self->frame = new webrtc::AudioFrame ();
 
   if (self->echo_cancel) {
     self->probe = gst_webrtc_acquire_echo_probe (self->probe_name);
@@ -761,6 +767,8 @@ gst_webrtc_dsp_stop (GstBaseTransform * btrans)
 
   delete self->apm;
   self->apm = NULL;
+  delete self->frame;
+  self->frame = NULL;
 
   GST_OBJECT_UNLOCK (self);
 
@@ -174,12 +174,19 @@ gst_webrtc_echo_probe_transform_ip (GstBaseTransform * btrans,
 {
   GstWebrtcEchoProbe *self = GST_WEBRTC_ECHO_PROBE (btrans);
   GstBuffer *newbuf = NULL;
+  GstClockTime rec_time;
 
   GST_WEBRTC_ECHO_PROBE_LOCK (self);
-  newbuf = gst_buffer_copy (buffer);
-  /* Moves the buffer timestamp to be in Running time */
-  GST_BUFFER_PTS (newbuf) = gst_segment_to_running_time (&btrans->segment,
+  /* Moves the buffer timestamp to be in Running time; only copy the
+   * buffer when the timestamp actually needs rewriting */
+  rec_time = gst_segment_to_running_time (&btrans->segment,
       GST_FORMAT_TIME, GST_BUFFER_PTS (buffer));
+  if (rec_time == GST_BUFFER_PTS (buffer)) {
+    newbuf = gst_buffer_ref (buffer);
+  } else {
+    newbuf = gst_buffer_copy (buffer);
+    GST_BUFFER_PTS (newbuf) = rec_time;
+  }
 
   if (self->interleaved) {
     gst_adapter_push (self->adapter, newbuf);
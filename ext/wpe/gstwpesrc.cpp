@@ -102,6 +102,8 @@ struct _GstWpeSrc
   GstGLMemoryAllocator *allocator;
   GstGLVideoAllocationParams *gl_alloc_params;
   guint64 n_frames;
+  GstEGLImage *last_image;
+  GstBuffer *last_buffer;
   gchar *location;
   gboolean draw_background;
   gboolean negotiated;
@@ -140,6 +142,22 @@ gst_wpe_src_create (GstPushSrc * psrc, GstBuffer ** buffer)
 
   g_return_val_if_fail(img != NULL, GST_FLOW_ERROR);
 
+  if (img == src->last_image && src->last_buffer) {
+    /* WPE only exports a new EGLImage when the page content actually
+     * changed, so on a static page we can resubmit the previous buffer
+     * instead of wrapping the same image in a new texture every frame.
+     * A shallow copy shares the GL memory but gives us writable metadata
+     * for the new offsets and timestamps. */
+    GST_TRACE_OBJECT (src, "content unchanged, resubmitting previous buffer");
+    *buffer = gst_buffer_copy (src->last_buffer);
+
+    GST_BUFFER_OFFSET (*buffer) = src->n_frames;
+    src->n_frames++;
+    GST_BUFFER_OFFSET_END (*buffer) = src->n_frames;
+
+    return GST_FLOW_OK;
+  }
+
   *buffer = gst_buffer_new ();
   imgs[0] = (gpointer) img;
   alloc_params->parent.gl_handle = img;
@@ -150,6 +168,9 @@ gst_wpe_src_create (GstPushSrc * psrc, GstBuffer ** buffer)
   if (sync_meta)
     gst_gl_sync_meta_set_sync_point (sync_meta, src->context);
 
+  src->last_image = img;
+  gst_buffer_replace (&src->last_buffer, *buffer);
+
   GST_BUFFER_OFFSET (*buffer) = src->n_frames;
   src->n_frames++;
   GST_BUFFER_OFFSET_END (*buffer) = src->n_frames;
@@ -173,6 +194,8 @@ gst_wpe_src_start (GstBaseSrc * base_src)
   GST_OBJECT_LOCK (src);
 
   src->n_frames = 0;
+  src->last_image = NULL;
+  src->last_buffer = NULL;
   src->negotiated = FALSE;
   src->allocator = GST_GL_MEMORY_ALLOCATOR (gst_allocator_find (GST_GL_MEMORY_EGL_ALLOCATOR_NAME));
   src->gl_alloc_params = NULL;
@@ -197,6 +220,8 @@ gst_wpe_src_stop (GstBaseSrc * base_src)
   }
 
   gst_caps_replace (&src->out_caps, NULL);
+  gst_buffer_replace (&src->last_buffer, NULL);
+  src->last_image = NULL;
 
   if (src->context)
     g_clear_object (&src->context);
@@ -300,6 +325,10 @@ gst_wpe_src_set_caps (GstBaseSrc * base_src, GstCaps * caps)
         GST_VIDEO_INFO_HEIGHT (&src->out_info));
   }
 
+  /* any cached buffer has the old dimensions */
+  gst_buffer_replace (&src->last_buffer, NULL);
+  src->last_image = NULL;
+
   src->negotiated = TRUE;
   gst_caps_replace (&src->out_caps, caps);
   return TRUE;
@@ -54,7 +54,8 @@ enum
   PROP_X265_LOG_LEVEL,
   PROP_SPEED_PRESET,
   PROP_TUNE,
-  PROP_KEY_INT_MAX
+  PROP_KEY_INT_MAX,
+  PROP_NUMA_POOLS
 };
 
 #define PROP_BITRATE_DEFAULT            (2 * 1024)
@@ -64,6 +65,7 @@ enum
 #define PROP_SPEED_PRESET_DEFAULT        6      /* Medium */
 #define PROP_TUNE_DEFAULT                2      /* SSIM   */
 #define PROP_KEY_INT_MAX_DEFAULT         0      /* x265 lib default */
+#define PROP_NUMA_POOLS_DEFAULT          NULL   /* x265 lib default */
 
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
 #define FORMATS "I420, Y444, I420_10LE, Y444_10LE"
@@ -410,6 +412,23 @@ gst_x265_enc_class_init (GstX265EncClass * klass)
           "Maximal distance between two key-frames (0 = x265 default / 250)",
           0, G_MAXINT32, PROP_KEY_INT_MAX_DEFAULT, G_PARAM_READWRITE));
 
+  /**
+   * GstX265Enc::numa-pools:
+   *
+   * Thread pool specification passed to x265 as the \"pools\" parameter,
+   * e.g. \"8,8\" for two pools of eight threads pinned to NUMA nodes 0
+   * and 1. By default x265 creates one pool per NUMA node sized to all
+   * of its cores, which oversubscribes machines running several
+   * encoders; use this to bound each instance.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_NUMA_POOLS,
+      g_param_spec_string ("numa-pools", "NUMA pools",
+          "Comma separated list of threads per NUMA node "
+          "(x265 \"pools\" parameter, NULL = x265 default)",
+          PROP_NUMA_POOLS_DEFAULT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (element_class,
       "x265enc", "Codec/Encoder/Video", "H265 Encoder",
       "Thijs Vermeir <thijs.vermeir@barco.com>");
@@ -437,6 +456,7 @@ gst_x265_enc_init (GstX265Enc * encoder)
   encoder->speed_preset = PROP_SPEED_PRESET_DEFAULT;
   encoder->tune = PROP_TUNE_DEFAULT;
   encoder->keyintmax = PROP_KEY_INT_MAX_DEFAULT;
+  encoder->numa_pools = PROP_NUMA_POOLS_DEFAULT;
 }
 
 typedef struct
@@ -553,6 +573,7 @@ gst_x265_enc_finalize (GObject * object)
   gst_x265_enc_close_encoder (encoder);
 
   g_string_free (encoder->option_string_prop, TRUE);
+  g_free (encoder->numa_pools);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -660,6 +681,12 @@ gst_x265_enc_init_encoder (GstX265Enc * encoder)
   }
 
   /* set up encoder parameters */
+  if (encoder->numa_pools != NULL) {
+    if (x265_param_parse (&encoder->x265param, "pools",
+            encoder->numa_pools) < 0)
+      GST_WARNING_OBJECT (encoder, "Invalid NUMA pool specification %s",
+          encoder->numa_pools);
+  }
   encoder->x265param.logLevel = encoder->log_level;
   encoder->x265param.internalCsp =
       gst_x265_enc_gst_to_x265_video_format (info->finfo->format, NULL);
@@ -1153,9 +1180,15 @@ gst_x265_enc_encode_frame (GstX265Enc * encoder, x265_picture * pic_in,
 
   GST_OBJECT_LOCK (encoder);
   if (encoder->reconfig) {
-    /* x265_encoder_reconfig is not yet implemented thus we shut down and re-create encoder */
-    gst_x265_enc_init_encoder (encoder);
-    update_latency = TRUE;
+    /* x265_encoder_reconfig applies the updated rate control settings to
+     * the running encoder; only fall back to a full restart if the
+     * library rejects the new parameters */
+    if (x265_encoder_reconfig (encoder->x265enc, &encoder->x265param) < 0) {
+      GST_WARNING_OBJECT (encoder,
+          "Could not reconfigure the encoder, restarting it");
+      update_latency = TRUE;
+    }
+    encoder->reconfig = FALSE;
   }
 
   if (pic_in && input_frame) {
@@ -1166,8 +1199,11 @@ gst_x265_enc_encode_frame (GstX265Enc * encoder, x265_picture * pic_in,
   }
   GST_OBJECT_UNLOCK (encoder);
 
-  if (G_UNLIKELY (update_latency))
+  if (G_UNLIKELY (update_latency)) {
+    /* init_encoder takes the object lock itself */
+    gst_x265_enc_init_encoder (encoder);
     gst_x265_enc_set_latency (encoder);
+  }
 
   encoder_return = x265_encoder_encode (encoder->x265enc,
       &nal, i_nal, pic_in, &pic_out);
@@ -1306,6 +1342,10 @@ gst_x265_enc_set_property (GObject * object, guint prop_id,
     case PROP_KEY_INT_MAX:
       encoder->keyintmax = g_value_get_int (value);
       break;
+    case PROP_NUMA_POOLS:
+      g_free (encoder->numa_pools);
+      encoder->numa_pools = g_value_dup_string (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1353,6 +1393,9 @@ gst_x265_enc_get_property (GObject * object, guint prop_id,
     case PROP_KEY_INT_MAX:
       g_value_set_int (value, encoder->keyintmax);
       break;
+    case PROP_NUMA_POOLS:
+      g_value_set_string (value, encoder->numa_pools);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -62,6 +62,7 @@ struct _GstX265Enc
   gint tune;
   gint speed_preset;
   gint keyintmax;
+  gchar *numa_pools;
   GString *option_string_prop;  /* option-string property */
   /*GString *option_string; *//* used by set prop */
 
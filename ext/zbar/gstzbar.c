@@ -73,12 +73,17 @@ enum
   PROP_0,
   PROP_MESSAGE,
   PROP_ATTACH_FRAME,
-  PROP_CACHE
+  PROP_CACHE,
+  PROP_SCAN_DOWNSCALE,
+  PROP_FULL_SCAN_INTERVAL
 };
 
 #define DEFAULT_CACHE    FALSE
 #define DEFAULT_MESSAGE  TRUE
 #define DEFAULT_ATTACH_FRAME FALSE
+#define DEFAULT_SCAN_DOWNSCALE 1
+#define DEFAULT_FULL_SCAN_INTERVAL 1
+#define MAX_SCAN_DOWNSCALE 8
 
 #define ZBAR_YUV_CAPS \
     "{ Y800, I420, YV12, NV12, NV21, Y41B, Y42B, YUV9, YVU9 }"
@@ -154,6 +159,38 @@ gst_zbar_class_init (GstZBarClass * g_class)
           G_PARAM_READWRITE | GST_PARAM_MUTABLE_READY |
           G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstZBar:scan-downscale:
+   *
+   * Downscale factor for the luma pre-scan. When larger than 1 and a frame
+   * is not due for a full-resolution scan, a decimated copy of the luma
+   * plane is scanned instead; a full-resolution scan is only run when the
+   * pre-scan spots a candidate code.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_SCAN_DOWNSCALE,
+      g_param_spec_uint ("scan-downscale", "Scan downscale",
+          "Downscale factor for the luma pre-scan (1 = always scan at "
+          "full resolution)",
+          1, MAX_SCAN_DOWNSCALE, DEFAULT_SCAN_DOWNSCALE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstZBar:full-scan-interval:
+   *
+   * Run a full-resolution scan only every Nth frame. Frames in between are
+   * handled by the downscaled pre-scan when scan-downscale is larger
+   * than 1, and skipped entirely otherwise.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_FULL_SCAN_INTERVAL,
+      g_param_spec_uint ("full-scan-interval", "Full scan interval",
+          "Scan at full resolution only every Nth frame (1 = every frame)",
+          1, G_MAXUINT, DEFAULT_FULL_SCAN_INTERVAL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (gstelement_class, "Barcode detector",
       "Filter/Analyzer/Video",
       "Detect bar codes in the video streams",
@@ -178,8 +215,11 @@ gst_zbar_init (GstZBar * zbar)
   zbar->cache = DEFAULT_CACHE;
   zbar->message = DEFAULT_MESSAGE;
   zbar->attach_frame = DEFAULT_ATTACH_FRAME;
+  zbar->scan_downscale = DEFAULT_SCAN_DOWNSCALE;
+  zbar->full_scan_interval = DEFAULT_FULL_SCAN_INTERVAL;
 
   zbar->scanner = zbar_image_scanner_create ();
+  zbar->prepass_scanner = zbar_image_scanner_create ();
 }
 
 static void
@@ -188,6 +228,8 @@ gst_zbar_finalize (GObject * object)
   GstZBar *zbar = GST_ZBAR (object);
 
   zbar_image_scanner_destroy (zbar->scanner);
+  zbar_image_scanner_destroy (zbar->prepass_scanner);
+  g_free (zbar->downscale_data);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -211,6 +253,12 @@ gst_zbar_set_property (GObject * object, guint prop_id, const GValue * value,
     case PROP_ATTACH_FRAME:
       zbar->attach_frame = g_value_get_boolean (value);
       break;
+    case PROP_SCAN_DOWNSCALE:
+      zbar->scan_downscale = g_value_get_uint (value);
+      break;
+    case PROP_FULL_SCAN_INTERVAL:
+      zbar->full_scan_interval = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -236,12 +284,69 @@ gst_zbar_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_ATTACH_FRAME:
       g_value_set_boolean (value, zbar->attach_frame);
       break;
+    case PROP_SCAN_DOWNSCALE:
+      g_value_set_uint (value, zbar->scan_downscale);
+      break;
+    case PROP_FULL_SCAN_INTERVAL:
+      g_value_set_uint (value, zbar->full_scan_interval);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
   }
 }
 
+/* Scans a decimated copy of the luma plane with a separate, cache-less
+ * scanner and reports whether any candidate code was spotted. */
+static gboolean
+gst_zbar_prepass (GstZBar * zbar, const guint8 * data, gint width, gint height)
+{
+  guint factor = zbar->scan_downscale;
+  gint dwidth = width / factor;
+  gint dheight = height / factor;
+  gsize dsize = (gsize) dwidth * dheight;
+  zbar_image_t *image;
+  gint x, y;
+  int n;
+
+  if (dwidth == 0 || dheight == 0)
+    return TRUE;
+
+  if (zbar->downscale_size < dsize) {
+    g_free (zbar->downscale_data);
+    zbar->downscale_data = g_malloc (dsize);
+    zbar->downscale_size = dsize;
+  }
+
+  for (y = 0; y < dheight; y++) {
+    const guint8 *in = data + (gsize) y * factor * width;
+    guint8 *out = zbar->downscale_data + (gsize) y * dwidth;
+
+    for (x = 0; x < dwidth; x++)
+      out[x] = in[x * factor];
+  }
+
+  image = zbar_image_create ();
+  zbar_image_set_format (image, GST_MAKE_FOURCC ('Y', '8', '0', '0'));
+  zbar_image_set_size (image, dwidth, dheight);
+  zbar_image_set_data (image, zbar->downscale_data, dsize, NULL);
+
+  n = zbar_scan_image (zbar->prepass_scanner, image);
+
+  zbar_image_scanner_recycle_image (zbar->prepass_scanner, image);
+  zbar_image_destroy (image);
+
+  if (G_UNLIKELY (n == -1)) {
+    GST_WARNING_OBJECT (zbar, "Error trying to pre-scan frame");
+    /* fall through to a full scan rather than dropping the frame */
+    return TRUE;
+  }
+
+  GST_LOG_OBJECT (zbar, "pre-scan found %d candidate(s)", n);
+
+  return n > 0;
+}
+
 static GstFlowReturn
 gst_zbar_transform_frame_ip (GstVideoFilter * vfilter, GstVideoFrame * frame)
 {
@@ -250,16 +355,29 @@ gst_zbar_transform_frame_ip (GstVideoFilter * vfilter, GstVideoFrame * frame)
   gint stride, height;
   zbar_image_t *image;
   const zbar_symbol_t *symbol;
+  guint frame_number;
   int n;
 
-  image = zbar_image_create ();
-
   /* all formats we support start with an 8-bit Y plane. zbar doesn't need
    * to know about the chroma plane(s) */
   data = GST_VIDEO_FRAME_COMP_DATA (frame, 0);
   stride = GST_VIDEO_FRAME_COMP_STRIDE (frame, 0);
   height = GST_VIDEO_FRAME_HEIGHT (frame);
 
+  /* Frames that are not due for a full-resolution scan get the cheap
+   * downscaled pre-scan; a full scan is then only run when the pre-scan
+   * spots a candidate. Without a downscale factor they are skipped. */
+  frame_number = zbar->frame_count++;
+  if (zbar->full_scan_interval > 1 &&
+      (frame_number % zbar->full_scan_interval) != 0) {
+    if (zbar->scan_downscale <= 1)
+      return GST_FLOW_OK;
+    if (!gst_zbar_prepass (zbar, data, stride, height))
+      return GST_FLOW_OK;
+  }
+
+  image = zbar_image_create ();
+
   zbar_image_set_format (image, GST_MAKE_FOURCC ('Y', '8', '0', '0'));
   zbar_image_set_size (image, stride, height);
   zbar_image_set_data (image, (gpointer) data, stride * height, NULL);
@@ -330,6 +448,8 @@ gst_zbar_start (GstBaseTransform * base)
   /* start the cache if enabled (e.g. for filtering dupes) */
   zbar_image_scanner_enable_cache (zbar->scanner, zbar->cache);
 
+  zbar->frame_count = 0;
+
   return TRUE;
 }
 
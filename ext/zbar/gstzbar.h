@@ -55,9 +55,15 @@ struct _GstZBar
   gboolean message;
   gboolean attach_frame;
   gboolean cache;
+  guint scan_downscale;
+  guint full_scan_interval;
 
   /* internals */
   zbar_image_scanner_t *scanner;
+  zbar_image_scanner_t *prepass_scanner;
+  guint frame_count;
+  guint8 *downscale_data;
+  gsize downscale_size;
 };
 
 struct _GstZBarClass
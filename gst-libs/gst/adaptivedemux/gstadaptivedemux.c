@@ -119,6 +119,7 @@ that the demux object and its streams are not changed by anybody else.
 #endif
 
 #include "gstadaptivedemux.h"
+#include "gstadaptivedemuxbwestimator.h"
 #include "gst/gst-i18n-plugin.h"
 #include <gst/base/gstadapter.h>
 
@@ -129,8 +130,12 @@ GST_DEBUG_CATEGORY (adaptivedemux_debug);
 #define DEFAULT_FAILED_COUNT 3
 #define DEFAULT_CONNECTION_SPEED 0
 #define DEFAULT_BITRATE_LIMIT 0.8f
+#define DEFAULT_PREFETCH_DEPTH 0
+#define DEFAULT_PREFETCH_BYTE_BUDGET (32 * 1024 * 1024)
+#define DEFAULT_STATS_UPDATE_INTERVAL 0
 #define SRC_QUEUE_MAX_BYTES 20 * 1024 * 1024    /* For safety. Large enough to hold a segment. */
 #define NUM_LOOKBACK_FRAGMENTS 3
+#define BITRATE_ESTIMATOR_WINDOW 10
 
 #define GST_MANIFEST_GET_LOCK(d) (&(GST_ADAPTIVE_DEMUX_CAST(d)->priv->manifest_lock))
 #define GST_MANIFEST_LOCK(d) G_STMT_START { \
@@ -157,9 +162,17 @@ enum
   PROP_0,
   PROP_CONNECTION_SPEED,
   PROP_BITRATE_LIMIT,
+  PROP_PREFETCH_DEPTH,
+  PROP_PREFETCH_BYTE_BUDGET,
+  PROP_STATS_UPDATE_INTERVAL,
+  PROP_STATISTICS,
   PROP_LAST
 };
 
+/* Name of the marker event queued between prefetched fragments so the
+ * prefetch task can account for complete fragments draining */
+#define PREFETCH_BOUNDARY_NAME "adaptive-demux-prefetch-fragment-boundary"
+
 /* Internal, so not using GST_FLOW_CUSTOM_SUCCESS_N */
 #define GST_ADAPTIVE_DEMUX_FLOW_SWITCH (GST_FLOW_CUSTOM_SUCCESS_2 + 1)
 
@@ -205,6 +218,19 @@ struct _GstAdaptiveDemuxPrivate
    * without needing to stop tasks when they just want to
    * update the segment boundaries */
   GMutex segment_lock;
+
+  /* Protects the prefetch queues of all streams and the shared byte
+   * accounting. Signalled whenever a queue or the accounting changes */
+  GMutex prefetch_lock;
+  GCond prefetch_cond;
+  guint64 prefetch_bytes;       /* queued bytes over all streams */
+
+  /* bandwidth estimate over all streams, protected by manifest_lock */
+  GstAdaptiveDemuxBitrateEstimator *bitrate_estimator;
+
+  /* monotonic time of the last periodic statistics message, protected
+   * by manifest_lock */
+  gint64 last_stats_time;
 };
 
 typedef struct _GstAdaptiveDemuxTimer
@@ -269,6 +295,13 @@ static gboolean gst_adaptive_demux_has_next_period (GstAdaptiveDemux * demux);
 static void gst_adaptive_demux_advance_period (GstAdaptiveDemux * demux);
 
 static void gst_adaptive_demux_stream_free (GstAdaptiveDemuxStream * stream);
+static void gst_adaptive_demux_stream_prefetch_loop (GstAdaptiveDemuxStream *
+    stream);
+static GstFlowReturn
+gst_adaptive_demux_stream_prefetch_queue_object (GstAdaptiveDemuxStream *
+    stream, GstMiniObject * object);
+static void gst_adaptive_demux_stream_prefetch_flush (GstAdaptiveDemuxStream *
+    stream);
 static GstFlowReturn
 gst_adaptive_demux_stream_push_event (GstAdaptiveDemuxStream * stream,
     GstEvent * event);
@@ -343,6 +376,38 @@ gst_adaptive_demux_get_instance_private (GstAdaptiveDemux * self)
   return (G_STRUCT_MEMBER_P (self, private_offset));
 }
 
+/* must be called with manifest_lock taken */
+static GstStructure *
+gst_adaptive_demux_get_statistics (GstAdaptiveDemux * demux)
+{
+  GstStructure *s;
+  GList *iter;
+
+  s = gst_structure_new (GST_ADAPTIVE_DEMUX_STREAM_STATISTICS_MESSAGE_NAME,
+      "manifest-uri", G_TYPE_STRING, demux->manifest_uri, NULL);
+
+  for (iter = demux->streams; iter; iter = g_list_next (iter)) {
+    GstAdaptiveDemuxStream *stream = iter->data;
+    GstStructure *sub;
+
+    sub = gst_structure_new ("stream-statistics",
+        "queued-bytes", G_TYPE_UINT64, stream->prefetch_bytes,
+        "queued-fragments", G_TYPE_UINT, stream->prefetch_fragments,
+        "last-bitrate", G_TYPE_UINT64, stream->last_bitrate,
+        "moving-bitrate", G_TYPE_UINT64, stream->moving_bitrate,
+        "last-latency", GST_TYPE_CLOCK_TIME, stream->last_latency,
+        "last-download-time", GST_TYPE_CLOCK_TIME, stream->last_download_time,
+        "download-total-bytes", G_TYPE_UINT64,
+        (guint64) stream->download_total_bytes,
+        "stall-count", G_TYPE_UINT, stream->stall_count, NULL);
+    gst_structure_set (s, GST_PAD_NAME (stream->pad), GST_TYPE_STRUCTURE,
+        sub, NULL);
+    gst_structure_free (sub);
+  }
+
+  return s;
+}
+
 static void
 gst_adaptive_demux_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec)
@@ -361,6 +426,17 @@ gst_adaptive_demux_set_property (GObject * object, guint prop_id,
     case PROP_BITRATE_LIMIT:
       demux->bitrate_limit = g_value_get_float (value);
       break;
+    case PROP_PREFETCH_DEPTH:
+      demux->prefetch_depth = g_value_get_uint (value);
+      GST_DEBUG_OBJECT (demux, "Prefetch depth set to %u",
+          demux->prefetch_depth);
+      break;
+    case PROP_PREFETCH_BYTE_BUDGET:
+      demux->prefetch_byte_budget = g_value_get_uint64 (value);
+      break;
+    case PROP_STATS_UPDATE_INTERVAL:
+      demux->stats_update_interval = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -385,6 +461,18 @@ gst_adaptive_demux_get_property (GObject * object, guint prop_id,
     case PROP_BITRATE_LIMIT:
       g_value_set_float (value, demux->bitrate_limit);
       break;
+    case PROP_PREFETCH_DEPTH:
+      g_value_set_uint (value, demux->prefetch_depth);
+      break;
+    case PROP_PREFETCH_BYTE_BUDGET:
+      g_value_set_uint64 (value, demux->prefetch_byte_budget);
+      break;
+    case PROP_STATS_UPDATE_INTERVAL:
+      g_value_set_uint (value, demux->stats_update_interval);
+      break;
+    case PROP_STATISTICS:
+      g_value_take_boxed (value, gst_adaptive_demux_get_statistics (demux));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -430,6 +518,69 @@ gst_adaptive_demux_class_init (GstAdaptiveDemuxClass * klass)
           0, 1, DEFAULT_BITRATE_LIMIT,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAdaptiveDemux:prefetch-depth:
+   *
+   * Number of fragments to download ahead of the fragment currently
+   * being pushed downstream, per stream. When non-zero, downloads
+   * overlap with downstream consumption, which helps on high-RTT
+   * links. 0 disables prefetching (previous behaviour).
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_PREFETCH_DEPTH,
+      g_param_spec_uint ("prefetch-depth", "Prefetch depth",
+          "Number of fragments to download ahead per stream (0 = disable)",
+          0, 16, DEFAULT_PREFETCH_DEPTH,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAdaptiveDemux:prefetch-byte-budget:
+   *
+   * Maximum number of bytes that may be queued by the prefetcher over
+   * all streams of this demuxer. Only used when prefetch-depth is
+   * non-zero.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_PREFETCH_BYTE_BUDGET,
+      g_param_spec_uint64 ("prefetch-byte-budget", "Prefetch byte budget",
+          "Maximum number of prefetched bytes over all streams",
+          0, G_MAXUINT64, DEFAULT_PREFETCH_BYTE_BUDGET,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAdaptiveDemux:stats-update-interval:
+   *
+   * Interval in milliseconds between periodic
+   * %GST_ADAPTIVE_DEMUX_STREAM_STATISTICS_MESSAGE_NAME element messages
+   * on the bus. 0 disables the messages; the #GstAdaptiveDemux:statistics
+   * property can still be queried at any time.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS_UPDATE_INTERVAL,
+      g_param_spec_uint ("stats-update-interval", "Stats update interval",
+          "Interval between statistics bus messages in ms (0 = disable)",
+          0, G_MAXUINT, DEFAULT_STATS_UPDATE_INTERVAL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAdaptiveDemux:statistics:
+   *
+   * Per-stream download statistics as a #GstStructure. It contains the
+   * manifest URI and one sub-structure per exposed stream, named after
+   * the stream's pad, with the queued bytes and fragments, last and
+   * moving-average bitrate, last request latency and download time,
+   * total downloaded bytes and the cumulative stall count.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_STATISTICS,
+      g_param_spec_boxed ("statistics", "Statistics",
+          "Per-stream download statistics",
+          GST_TYPE_STRUCTURE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state = gst_adaptive_demux_change_state;
 
   gstbin_class->handle_message = gst_adaptive_demux_handle_message;
@@ -454,6 +605,8 @@ gst_adaptive_demux_init (GstAdaptiveDemux * demux,
 
   demux->priv = gst_adaptive_demux_get_instance_private (demux);
   demux->priv->input_adapter = gst_adapter_new ();
+  demux->priv->bitrate_estimator =
+      gst_adaptive_demux_bitrate_estimator_new (BITRATE_ESTIMATOR_WINDOW);
   demux->downloader = gst_uri_downloader_new ();
   gst_uri_downloader_set_parent (demux->downloader, GST_ELEMENT_CAST (demux));
   demux->stream_struct_size = sizeof (GstAdaptiveDemuxStream);
@@ -509,6 +662,9 @@ gst_adaptive_demux_init (GstAdaptiveDemux * demux,
   g_cond_init (&demux->priv->preroll_cond);
   g_mutex_init (&demux->priv->preroll_lock);
 
+  g_mutex_init (&demux->priv->prefetch_lock);
+  g_cond_init (&demux->priv->prefetch_cond);
+
   pad_template =
       gst_element_class_get_pad_template (GST_ELEMENT_CLASS (klass), "sink");
   g_return_if_fail (pad_template != NULL);
@@ -522,6 +678,9 @@ gst_adaptive_demux_init (GstAdaptiveDemux * demux,
   /* Properties */
   demux->bitrate_limit = DEFAULT_BITRATE_LIMIT;
   demux->connection_speed = DEFAULT_CONNECTION_SPEED;
+  demux->prefetch_depth = DEFAULT_PREFETCH_DEPTH;
+  demux->prefetch_byte_budget = DEFAULT_PREFETCH_BYTE_BUDGET;
+  demux->stats_update_interval = DEFAULT_STATS_UPDATE_INTERVAL;
 
   gst_element_add_pad (GST_ELEMENT (demux), demux->sinkpad);
 }
@@ -535,6 +694,7 @@ gst_adaptive_demux_finalize (GObject * object)
   GST_DEBUG_OBJECT (object, "finalize");
 
   g_object_unref (priv->input_adapter);
+  gst_adaptive_demux_bitrate_estimator_free (priv->bitrate_estimator);
   g_object_unref (demux->downloader);
 
   g_mutex_clear (&priv->updates_timed_lock);
@@ -554,6 +714,9 @@ gst_adaptive_demux_finalize (GObject * object)
   g_cond_clear (&demux->priv->preroll_cond);
   g_mutex_clear (&demux->priv->preroll_lock);
 
+  g_mutex_clear (&demux->priv->prefetch_lock);
+  g_cond_clear (&demux->priv->prefetch_cond);
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -1313,6 +1476,15 @@ gst_adaptive_demux_stream_new (GstAdaptiveDemux * demux, GstPad * pad)
       stream, NULL);
   gst_task_set_lock (stream->download_task, &stream->download_lock);
 
+  /* Prefetch output task, only started when prefetch-depth is non-zero */
+  g_rec_mutex_init (&stream->prefetch_task_lock);
+  stream->prefetch_task =
+      gst_task_new ((GstTaskFunction) gst_adaptive_demux_stream_prefetch_loop,
+      stream, NULL);
+  gst_task_set_lock (stream->prefetch_task, &stream->prefetch_task_lock);
+  g_queue_init (&stream->prefetch_queue);
+  stream->prefetch_ret = GST_FLOW_OK;
+
   stream->pad = pad;
   stream->demux = demux;
   stream->fragment_bitrates =
@@ -1397,6 +1569,24 @@ gst_adaptive_demux_stream_free (GstAdaptiveDemuxStream * stream)
     stream->download_task = NULL;
   }
 
+  if (stream->prefetch_task) {
+    g_mutex_lock (&demux->priv->prefetch_lock);
+    stream->prefetch_flushing = TRUE;
+    gst_task_stop (stream->prefetch_task);
+    g_cond_broadcast (&demux->priv->prefetch_cond);
+    g_mutex_unlock (&demux->priv->prefetch_lock);
+
+    /* temporarily drop the manifest lock to join the task */
+    GST_MANIFEST_UNLOCK (demux);
+    gst_task_join (stream->prefetch_task);
+    GST_MANIFEST_LOCK (demux);
+
+    gst_adaptive_demux_stream_prefetch_flush (stream);
+    gst_object_unref (stream->prefetch_task);
+    g_rec_mutex_clear (&stream->prefetch_task_lock);
+    stream->prefetch_task = NULL;
+  }
+
   gst_adaptive_demux_stream_fragment_clear (&stream->fragment);
 
   if (stream->pending_segment) {
@@ -2033,6 +2223,17 @@ gst_adaptive_demux_start_tasks (GstAdaptiveDemux * demux,
     }
 
     stream->last_ret = GST_FLOW_OK;
+
+    /* Latch the prefetch configuration for the lifetime of the task */
+    stream->prefetch_active = demux->prefetch_depth > 0;
+    if (stream->prefetch_active) {
+      g_mutex_lock (&demux->priv->prefetch_lock);
+      stream->prefetch_flushing = FALSE;
+      stream->prefetch_ret = GST_FLOW_OK;
+      g_mutex_unlock (&demux->priv->prefetch_lock);
+      gst_task_start (stream->prefetch_task);
+    }
+
     gst_task_start (stream->download_task);
   }
 }
@@ -2099,6 +2300,12 @@ gst_adaptive_demux_stop_tasks (GstAdaptiveDemux * demux, gboolean stop_updates)
       gst_task_stop (stream->download_task);
       g_cond_signal (&stream->fragment_download_cond);
       g_mutex_unlock (&stream->fragment_download_lock);
+
+      g_mutex_lock (&demux->priv->prefetch_lock);
+      stream->prefetch_flushing = TRUE;
+      gst_task_stop (stream->prefetch_task);
+      g_cond_broadcast (&demux->priv->prefetch_cond);
+      g_mutex_unlock (&demux->priv->prefetch_lock);
     }
     list_to_process = demux->prepared_streams;
   }
@@ -2135,6 +2342,7 @@ gst_adaptive_demux_stop_tasks (GstAdaptiveDemux * demux, gboolean stop_updates)
        * outside critical section
        */
       gst_task_join (stream->download_task);
+      gst_task_join (stream->prefetch_task);
 
       GST_MANIFEST_LOCK (demux);
     }
@@ -2155,6 +2363,7 @@ gst_adaptive_demux_stop_tasks (GstAdaptiveDemux * demux, gboolean stop_updates)
       stream->download_error_count = 0;
       stream->need_header = TRUE;
       stream->qos_earliest_time = GST_CLOCK_TIME_NONE;
+      gst_adaptive_demux_stream_prefetch_flush (stream);
     }
     list_to_process = demux->prepared_streams;
   }
@@ -2233,6 +2442,7 @@ gst_adaptive_demux_stream_update_current_bitrate (GstAdaptiveDemux * demux,
 {
   guint64 average_bitrate;
   guint64 fragment_bitrate;
+  guint64 estimated_bitrate;
 
   if (demux->connection_speed) {
     GST_LOG_OBJECT (demux, "Connection-speed is set to %u kbps, using it",
@@ -2253,6 +2463,20 @@ gst_adaptive_demux_stream_update_current_bitrate (GstAdaptiveDemux * demux,
       "Last %u fragments average bitrate is %" G_GUINT64_FORMAT,
       NUM_LOOKBACK_FRAGMENTS, average_bitrate);
 
+  gst_adaptive_demux_bitrate_estimator_add_sample (demux->priv->
+      bitrate_estimator, fragment_bitrate, stream->last_download_time);
+  estimated_bitrate =
+      gst_adaptive_demux_bitrate_estimator_get_estimate (demux->priv->
+      bitrate_estimator);
+  if (estimated_bitrate > 0) {
+    GST_INFO_OBJECT (stream,
+        "Harmonic-mean bandwidth estimate is %" G_GUINT64_FORMAT,
+        estimated_bitrate);
+    /* the windowed harmonic mean oscillates much less than the short
+     * arithmetic average, so prefer it for the switch decision */
+    average_bitrate = estimated_bitrate;
+  }
+
   /* Conservative approach, make sure we don't upgrade too fast */
   stream->current_download_rate = MIN (average_bitrate, fragment_bitrate);
 
@@ -2319,6 +2543,135 @@ gst_adaptive_demux_handle_preroll (GstAdaptiveDemux * demux,
   }
 }
 
+/* Park a downloaded buffer or serialized event on the stream's prefetch
+ * queue to be pushed downstream from the prefetch task. Returns the flow
+ * result of the last downstream push, so errors propagate back to the
+ * download loop with one object of latency.
+ * Called without any locks held, takes ownership of @object */
+static GstFlowReturn
+gst_adaptive_demux_stream_prefetch_queue_object (GstAdaptiveDemuxStream *
+    stream, GstMiniObject * object)
+{
+  GstAdaptiveDemux *demux = stream->demux;
+  GstFlowReturn ret;
+
+  g_mutex_lock (&demux->priv->prefetch_lock);
+  if (stream->prefetch_flushing) {
+    g_mutex_unlock (&demux->priv->prefetch_lock);
+    gst_mini_object_unref (object);
+    return GST_FLOW_FLUSHING;
+  }
+
+  if (GST_IS_BUFFER (object)) {
+    gsize size = gst_buffer_get_size (GST_BUFFER_CAST (object));
+
+    stream->prefetch_bytes += size;
+    demux->priv->prefetch_bytes += size;
+  }
+  g_queue_push_tail (&stream->prefetch_queue, object);
+  ret = stream->prefetch_ret;
+  g_cond_broadcast (&demux->priv->prefetch_cond);
+  g_mutex_unlock (&demux->priv->prefetch_lock);
+
+  return ret;
+}
+
+/* Drop everything still sitting on the prefetch queue and reset the
+ * accounting. Called when the stream is being stopped or freed */
+static void
+gst_adaptive_demux_stream_prefetch_flush (GstAdaptiveDemuxStream * stream)
+{
+  GstAdaptiveDemux *demux = stream->demux;
+  GstMiniObject *object;
+
+  g_mutex_lock (&demux->priv->prefetch_lock);
+  while ((object = g_queue_pop_head (&stream->prefetch_queue)))
+    gst_mini_object_unref (object);
+  demux->priv->prefetch_bytes -= stream->prefetch_bytes;
+  stream->prefetch_bytes = 0;
+  stream->prefetch_fragments = 0;
+  stream->prefetch_ret = GST_FLOW_OK;
+  g_cond_broadcast (&demux->priv->prefetch_cond);
+  g_mutex_unlock (&demux->priv->prefetch_lock);
+}
+
+/* Called from the download loop before starting a new fragment. Blocks
+ * until the number of queued fragments drops below the configured depth
+ * and the shared byte budget has room again.
+ * Called without any locks held */
+static void
+gst_adaptive_demux_stream_prefetch_wait (GstAdaptiveDemuxStream * stream)
+{
+  GstAdaptiveDemux *demux = stream->demux;
+
+  g_mutex_lock (&demux->priv->prefetch_lock);
+  while (!stream->prefetch_flushing
+      && (stream->prefetch_fragments >= demux->prefetch_depth
+          || (demux->prefetch_byte_budget != 0
+              && demux->priv->prefetch_bytes >= demux->prefetch_byte_budget)))
+    g_cond_wait (&demux->priv->prefetch_cond, &demux->priv->prefetch_lock);
+  g_mutex_unlock (&demux->priv->prefetch_lock);
+}
+
+static void
+gst_adaptive_demux_stream_prefetch_loop (GstAdaptiveDemuxStream * stream)
+{
+  GstAdaptiveDemux *demux = stream->demux;
+  GstMiniObject *object;
+
+  g_mutex_lock (&demux->priv->prefetch_lock);
+  while (g_queue_is_empty (&stream->prefetch_queue)
+      && !stream->prefetch_flushing)
+    g_cond_wait (&demux->priv->prefetch_cond, &demux->priv->prefetch_lock);
+
+  if (stream->prefetch_flushing) {
+    g_mutex_unlock (&demux->priv->prefetch_lock);
+    GST_DEBUG_OBJECT (stream->pad, "Prefetch task flushing, pausing");
+    gst_task_pause (stream->prefetch_task);
+    return;
+  }
+
+  object = g_queue_pop_head (&stream->prefetch_queue);
+  if (GST_IS_BUFFER (object)) {
+    gsize size = gst_buffer_get_size (GST_BUFFER_CAST (object));
+
+    stream->prefetch_bytes -= size;
+    demux->priv->prefetch_bytes -= size;
+  }
+  g_cond_broadcast (&demux->priv->prefetch_cond);
+  g_mutex_unlock (&demux->priv->prefetch_lock);
+
+  if (GST_IS_EVENT (object)) {
+    GstEvent *event = GST_EVENT_CAST (object);
+
+    if (GST_EVENT_TYPE (event) == GST_EVENT_CUSTOM_DOWNSTREAM
+        && gst_event_has_name (event, PREFETCH_BOUNDARY_NAME)) {
+      /* a complete fragment has drained, make room for the next one */
+      g_mutex_lock (&demux->priv->prefetch_lock);
+      if (stream->prefetch_fragments > 0)
+        stream->prefetch_fragments--;
+      g_cond_broadcast (&demux->priv->prefetch_cond);
+      g_mutex_unlock (&demux->priv->prefetch_lock);
+      gst_event_unref (event);
+    } else {
+      GST_DEBUG_OBJECT (stream->pad, "Pushing prefetched event %"
+          GST_PTR_FORMAT, event);
+      gst_pad_push_event (stream->pad, event);
+    }
+  } else {
+    GstFlowReturn ret;
+
+    ret = gst_pad_push (stream->pad, GST_BUFFER_CAST (object));
+    GST_LOG_OBJECT (stream->pad, "Prefetched push result: %d %s", ret,
+        gst_flow_get_name (ret));
+    if (ret != GST_FLOW_OK) {
+      g_mutex_lock (&demux->priv->prefetch_lock);
+      stream->prefetch_ret = ret;
+      g_mutex_unlock (&demux->priv->prefetch_lock);
+    }
+  }
+}
+
 /* must be called with manifest_lock taken.
  * Temporarily releases manifest_lock
  */
@@ -2452,6 +2805,48 @@ gst_adaptive_demux_stream_push_buffer (GstAdaptiveDemuxStream * stream,
 
   GST_MANIFEST_UNLOCK (demux);
 
+  if (stream->prefetch_active) {
+    /* Hand everything over to the prefetch task, keeping the order of
+     * serialized events and buffers intact */
+    if (G_UNLIKELY (pending_caps))
+      gst_adaptive_demux_stream_prefetch_queue_object (stream,
+          GST_MINI_OBJECT_CAST (pending_caps));
+    if (G_UNLIKELY (pending_segment))
+      gst_adaptive_demux_stream_prefetch_queue_object (stream,
+          GST_MINI_OBJECT_CAST (pending_segment));
+    if (G_UNLIKELY (pending_tags))
+      gst_adaptive_demux_stream_prefetch_queue_object (stream,
+          GST_MINI_OBJECT_CAST (pending_tags));
+    while (pending_events != NULL) {
+      GstEvent *event = pending_events->data;
+
+      gst_adaptive_demux_stream_prefetch_queue_object (stream,
+          GST_MINI_OBJECT_CAST (event));
+      pending_events = g_list_delete_link (pending_events, pending_events);
+    }
+
+    GST_DEBUG_OBJECT (stream->pad,
+        "Queueing buffer of size %" G_GSIZE_FORMAT " for prefetched push",
+        gst_buffer_get_size (buffer));
+
+    ret =
+        gst_adaptive_demux_stream_prefetch_queue_object (stream,
+        GST_MINI_OBJECT_CAST (buffer));
+
+    GST_MANIFEST_LOCK (demux);
+
+    g_mutex_lock (&stream->fragment_download_lock);
+    if (G_UNLIKELY (stream->cancelled)) {
+      GST_LOG_OBJECT (stream, "Stream was cancelled");
+      ret = stream->last_ret = GST_FLOW_FLUSHING;
+      g_mutex_unlock (&stream->fragment_download_lock);
+      return ret;
+    }
+    g_mutex_unlock (&stream->fragment_download_lock);
+
+    return ret;
+  }
+
   /* Do not push events or buffers holding the manifest lock */
   if (G_UNLIKELY (pending_caps)) {
     GST_DEBUG_OBJECT (stream->pad, "Setting pending caps: %" GST_PTR_FORMAT,
@@ -2744,6 +3139,20 @@ _src_event (GstPad * pad, GstObject * parent, GstEvent * event)
       GST_DEBUG_OBJECT (pad, "Saw EOS on src pad");
       GST_MANIFEST_LOCK (demux);
 
+      if (stream->prefetch_active && !stream->downloading_header
+          && !stream->downloading_index) {
+        /* Mark the fragment boundary on the prefetch queue so the
+         * prefetch task can account for drained fragments */
+        GstEvent *boundary = gst_event_new_custom (GST_EVENT_CUSTOM_DOWNSTREAM,
+            gst_structure_new_empty (PREFETCH_BOUNDARY_NAME));
+
+        g_mutex_lock (&demux->priv->prefetch_lock);
+        stream->prefetch_fragments++;
+        g_queue_push_tail (&stream->prefetch_queue, boundary);
+        g_cond_broadcast (&demux->priv->prefetch_cond);
+        g_mutex_unlock (&demux->priv->prefetch_lock);
+      }
+
       gst_adaptive_demux_eos_handling (stream);
 
       /* FIXME ?
@@ -3463,6 +3872,7 @@ again:
   last_status_code = stream->last_status_code;
   GST_WARNING_OBJECT (stream->pad, "Got custom error, status %u, dc %d",
       last_status_code, stream->download_error_count);
+  stream->stall_count++;
 
   live = gst_adaptive_demux_is_live (demux);
   if (!retried_once && ((last_status_code / 100 == 4 && live)
@@ -3710,6 +4120,22 @@ gst_adaptive_demux_stream_download_loop (GstAdaptiveDemuxStream * stream)
 
   live = gst_adaptive_demux_is_live (demux);
 
+  if (stream->prefetch_active) {
+    /* Throttle against the configured depth and the shared byte budget
+     * before fetching another fragment */
+    GST_MANIFEST_UNLOCK (demux);
+    gst_adaptive_demux_stream_prefetch_wait (stream);
+    GST_MANIFEST_LOCK (demux);
+
+    g_mutex_lock (&stream->fragment_download_lock);
+    if (G_UNLIKELY (stream->cancelled)) {
+      stream->last_ret = GST_FLOW_FLUSHING;
+      g_mutex_unlock (&stream->fragment_download_lock);
+      goto cancelled;
+    }
+    g_mutex_unlock (&stream->fragment_download_lock);
+  }
+
   /* Get information about the fragment to download */
   GST_DEBUG_OBJECT (demux, "Calling update_fragment_info");
   ret = gst_adaptive_demux_stream_update_fragment_info (demux, stream);
@@ -3846,6 +4272,7 @@ gst_adaptive_demux_stream_download_loop (GstAdaptiveDemuxStream * stream)
       if (ret <= GST_FLOW_ERROR) {
         gboolean is_live = gst_adaptive_demux_is_live (demux);
         GST_WARNING_OBJECT (demux, "Error while downloading fragment");
+        stream->stall_count++;
         if (++stream->download_error_count > MAX_DOWNLOAD_ERROR_COUNT) {
           goto download_error;
         }
@@ -4082,6 +4509,17 @@ gst_adaptive_demux_stream_push_event (GstAdaptiveDemuxStream * stream,
     stream->eos = TRUE;
   }
 
+  if (stream->prefetch_active && GST_EVENT_IS_SERIALIZED (event)) {
+    /* Keep serialized events ordered with the buffers still sitting on
+     * the prefetch queue */
+    GST_MANIFEST_UNLOCK (demux);
+    ret =
+        gst_adaptive_demux_stream_prefetch_queue_object (stream,
+        GST_MINI_OBJECT_CAST (event)) == GST_FLOW_OK;
+    GST_MANIFEST_LOCK (demux);
+    return ret;
+  }
+
   pad = gst_object_ref (GST_ADAPTIVE_DEMUX_STREAM_PAD (stream));
 
   /* Can't push events holding the manifest lock */
@@ -4190,6 +4628,18 @@ gst_adaptive_demux_stream_advance_fragment_unlocked (GstAdaptiveDemux * demux,
               stream->download_total_bytes, "fragment-download-time",
               GST_TYPE_CLOCK_TIME, stream->last_download_time, NULL)));
 
+  if (demux->stats_update_interval > 0) {
+    gint64 now = g_get_monotonic_time ();
+
+    if (now - demux->priv->last_stats_time >=
+        (gint64) demux->stats_update_interval * 1000) {
+      demux->priv->last_stats_time = now;
+      gst_element_post_message (GST_ELEMENT_CAST (demux),
+          gst_message_new_element (GST_OBJECT_CAST (demux),
+              gst_adaptive_demux_get_statistics (demux)));
+    }
+  }
+
   /* Don't update to the end of the segment if in reverse playback */
   GST_ADAPTIVE_DEMUX_SEGMENT_LOCK (demux);
   if (GST_CLOCK_TIME_IS_VALID (duration) && demux->segment.rate > 0) {
@@ -4328,7 +4778,12 @@ gst_adaptive_demux_stream_get_fragment_waiting_time (GstAdaptiveDemux *
   return 0;
 }
 
-/* must be called with manifest_lock taken */
+/* must be called with manifest_lock taken.
+ * Temporarily releases manifest_lock during the download so that seeks and
+ * the download tasks are not blocked behind a slow manifest server for a
+ * whole HTTP timeout; the parsed manifest is still swapped in under the
+ * lock, so readers always see a consistent manifest.
+ */
 static GstFlowReturn
 gst_adaptive_demux_update_manifest_default (GstAdaptiveDemux * demux)
 {
@@ -4337,9 +4792,20 @@ gst_adaptive_demux_update_manifest_default (GstAdaptiveDemux * demux)
   GstBuffer *buffer;
   GstFlowReturn ret;
   GError *error = NULL;
+  gchar *manifest_uri;
+
+  /* Take a copy of the URI: the demux members may be modified by another
+   * thread once the lock is released */
+  manifest_uri = g_strdup (demux->manifest_uri);
+
+  GST_MANIFEST_UNLOCK (demux);
 
   download = gst_uri_downloader_fetch_uri (demux->downloader,
-      demux->manifest_uri, NULL, TRUE, TRUE, TRUE, &error);
+      manifest_uri, NULL, TRUE, TRUE, TRUE, &error);
+  g_free (manifest_uri);
+
+  GST_MANIFEST_LOCK (demux);
+
   if (download) {
     g_free (demux->manifest_uri);
     g_free (demux->manifest_base_uri);
@@ -4367,7 +4833,10 @@ gst_adaptive_demux_update_manifest_default (GstAdaptiveDemux * demux)
   return ret;
 }
 
-/* must be called with manifest_lock taken */
+/* must be called with manifest_lock taken.
+ * The default update_manifest implementation temporarily releases
+ * manifest_lock while the new manifest is downloaded.
+ */
 static GstFlowReturn
 gst_adaptive_demux_update_manifest (GstAdaptiveDemux * demux)
 {
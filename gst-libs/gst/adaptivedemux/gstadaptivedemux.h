@@ -75,6 +75,18 @@ G_BEGIN_DECLS
  */
 #define GST_ADAPTIVE_DEMUX_STATISTICS_MESSAGE_NAME "adaptive-streaming-statistics"
 
+/**
+ * GST_ADAPTIVE_DEMUX_STREAM_STATISTICS_MESSAGE_NAME:
+ *
+ * Name of the ELEMENT type messages periodically posted with per-stream
+ * statistics when #GstAdaptiveDemux:stats-update-interval is non-zero.
+ * The same structure is returned by the #GstAdaptiveDemux:statistics
+ * property.
+ *
+ * Since: 1.18
+ */
+#define GST_ADAPTIVE_DEMUX_STREAM_STATISTICS_MESSAGE_NAME "adaptive-streaming-stream-statistics"
+
 #define GST_ELEMENT_ERROR_FROM_ERROR(el, msg, err) G_STMT_START { \
   gchar *__dbg = g_strdup_printf ("%s: %s", msg, err->message);         \
   GST_WARNING_OBJECT (el, "error: %s", __dbg);                          \
@@ -191,10 +203,29 @@ struct _GstAdaptiveDemuxStream
 
   guint download_error_count;
 
+  /* cumulative count of download errors and retries over the stream's
+   * lifetime (unlike download_error_count, never reset on success) */
+  guint stall_count;
+
   /* TODO check if used */
   gboolean eos;
 
   gboolean do_block; /* TRUE if stream should block on preroll */
+
+  /* Prefetch output stage, used when GstAdaptiveDemux:prefetch-depth is
+   * non-zero. Downloaded buffers and serialized events are parked in
+   * prefetch_queue and pushed downstream from prefetch_task, so the
+   * download loop can start fetching the next fragment while earlier
+   * ones are still being consumed downstream. All fields are protected
+   * by the demux-wide prefetch lock. */
+  GstTask *prefetch_task;
+  GRecMutex prefetch_task_lock;
+  GQueue prefetch_queue;        /* of GstMiniObject */
+  guint64 prefetch_bytes;       /* queued bytes on this stream */
+  guint prefetch_fragments;     /* complete fragments in the queue */
+  gboolean prefetch_active;     /* latched from prefetch-depth on start */
+  gboolean prefetch_flushing;
+  GstFlowReturn prefetch_ret;   /* last downstream push result */
 };
 
 /**
@@ -228,6 +259,9 @@ struct _GstAdaptiveDemux
   /* Properties */
   gfloat bitrate_limit;         /* limit of the available bitrate to use */
   guint connection_speed;
+  guint prefetch_depth;         /* fragments to download ahead per stream */
+  guint64 prefetch_byte_budget; /* shared cap on prefetched bytes */
+  guint stats_update_interval;  /* ms between statistics messages, 0 = off */
 
   gboolean have_group_id;
   guint group_id;
@@ -0,0 +1,184 @@
+/* GStreamer
+ *
+ * Copyright (C) 2020 GStreamer developers
+ *
+ * gstadaptivedemuxbwestimator.c:
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:gstadaptivedemuxbwestimator
+ * @short_description: Download bandwidth estimation helper
+ *
+ * Keeps a sliding window of fragment download measurements and derives a
+ * bandwidth estimate from them. The estimate is the harmonic mean of the
+ * windowed bitrates, which weights slow downloads more heavily than an
+ * arithmetic mean and so reacts quickly to congestion while smoothing out
+ * single fast outliers. The estimate is additionally discounted by the
+ * coefficient of variation of the download times, so that a jittery
+ * connection yields a more conservative figure than a steady one with the
+ * same mean throughput.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+
+#include "gstadaptivedemuxbwestimator.h"
+
+typedef struct
+{
+  guint64 bitrate;              /* bps */
+  GstClockTime download_time;
+} GstAdaptiveDemuxBitrateSample;
+
+struct _GstAdaptiveDemuxBitrateEstimator
+{
+  GstAdaptiveDemuxBitrateSample *samples;
+  guint window_size;
+  guint next_index;
+  guint num_samples;            /* number of valid entries, <= window_size */
+};
+
+/**
+ * gst_adaptive_demux_bitrate_estimator_new:
+ * @window_size: number of fragment downloads to keep in the sliding window
+ *
+ * Returns: (transfer full): a new #GstAdaptiveDemuxBitrateEstimator
+ */
+GstAdaptiveDemuxBitrateEstimator *
+gst_adaptive_demux_bitrate_estimator_new (guint window_size)
+{
+  GstAdaptiveDemuxBitrateEstimator *estimator;
+
+  g_return_val_if_fail (window_size > 0, NULL);
+
+  estimator = g_new0 (GstAdaptiveDemuxBitrateEstimator, 1);
+  estimator->samples = g_new0 (GstAdaptiveDemuxBitrateSample, window_size);
+  estimator->window_size = window_size;
+
+  return estimator;
+}
+
+/**
+ * gst_adaptive_demux_bitrate_estimator_free:
+ * @estimator: a #GstAdaptiveDemuxBitrateEstimator
+ *
+ * Frees @estimator.
+ */
+void
+gst_adaptive_demux_bitrate_estimator_free (GstAdaptiveDemuxBitrateEstimator *
+    estimator)
+{
+  g_return_if_fail (estimator != NULL);
+
+  g_free (estimator->samples);
+  g_free (estimator);
+}
+
+/**
+ * gst_adaptive_demux_bitrate_estimator_reset:
+ * @estimator: a #GstAdaptiveDemuxBitrateEstimator
+ *
+ * Drops all collected samples, e.g. after a longer pause during which the
+ * network conditions may have changed completely.
+ */
+void
+gst_adaptive_demux_bitrate_estimator_reset (GstAdaptiveDemuxBitrateEstimator *
+    estimator)
+{
+  g_return_if_fail (estimator != NULL);
+
+  estimator->next_index = 0;
+  estimator->num_samples = 0;
+}
+
+/**
+ * gst_adaptive_demux_bitrate_estimator_add_sample:
+ * @estimator: a #GstAdaptiveDemuxBitrateEstimator
+ * @bitrate: measured bitrate of the download, in bits per second
+ * @download_time: how long the download took
+ *
+ * Records one finished fragment download, evicting the oldest sample once
+ * the window is full. Zero bitrates are ignored since they carry no
+ * information about the link.
+ */
+void
+gst_adaptive_demux_bitrate_estimator_add_sample (GstAdaptiveDemuxBitrateEstimator
+    * estimator, guint64 bitrate, GstClockTime download_time)
+{
+  GstAdaptiveDemuxBitrateSample *sample;
+
+  g_return_if_fail (estimator != NULL);
+
+  if (bitrate == 0)
+    return;
+
+  sample = &estimator->samples[estimator->next_index];
+  sample->bitrate = bitrate;
+  sample->download_time = download_time;
+
+  estimator->next_index = (estimator->next_index + 1) % estimator->window_size;
+  if (estimator->num_samples < estimator->window_size)
+    estimator->num_samples++;
+}
+
+/**
+ * gst_adaptive_demux_bitrate_estimator_get_estimate:
+ * @estimator: a #GstAdaptiveDemuxBitrateEstimator
+ *
+ * Returns: the current bandwidth estimate in bits per second, or 0 if no
+ * samples have been collected yet
+ */
+guint64
+gst_adaptive_demux_bitrate_estimator_get_estimate (GstAdaptiveDemuxBitrateEstimator
+    * estimator)
+{
+  gdouble inv_sum = 0, time_sum = 0, time_sq_sum = 0;
+  gdouble harmonic_mean, time_mean, time_var, cv;
+  guint i;
+
+  g_return_val_if_fail (estimator != NULL, 0);
+
+  if (estimator->num_samples == 0)
+    return 0;
+
+  for (i = 0; i < estimator->num_samples; i++) {
+    GstAdaptiveDemuxBitrateSample *sample = &estimator->samples[i];
+    gdouble download_time = (gdouble) sample->download_time / GST_SECOND;
+
+    inv_sum += 1.0 / (gdouble) sample->bitrate;
+    time_sum += download_time;
+    time_sq_sum += download_time * download_time;
+  }
+
+  harmonic_mean = (gdouble) estimator->num_samples / inv_sum;
+
+  /* discount by the relative spread of the download times: on a link with
+   * large jitter the harmonic mean alone is still too optimistic to base
+   * an upwards switch on */
+  time_mean = time_sum / estimator->num_samples;
+  time_var = time_sq_sum / estimator->num_samples - time_mean * time_mean;
+  if (time_mean > 0 && time_var > 0) {
+    cv = sqrt (time_var) / time_mean;
+    harmonic_mean /= 1.0 + MIN (cv, 1.0);
+  }
+
+  return (guint64) harmonic_mean;
+}
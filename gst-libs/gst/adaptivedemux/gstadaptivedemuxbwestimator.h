@@ -0,0 +1,52 @@
+/* GStreamer
+ *
+ * Copyright (C) 2020 GStreamer developers
+ *
+ * gstadaptivedemuxbwestimator.h:
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _GST_ADAPTIVE_DEMUX_BW_ESTIMATOR_H_
+#define _GST_ADAPTIVE_DEMUX_BW_ESTIMATOR_H_
+
+#include <gst/gst.h>
+#include <gst/adaptivedemux/adaptive-demux-prelude.h>
+
+G_BEGIN_DECLS
+
+typedef struct _GstAdaptiveDemuxBitrateEstimator GstAdaptiveDemuxBitrateEstimator;
+
+GST_ADAPTIVE_DEMUX_API
+GstAdaptiveDemuxBitrateEstimator * gst_adaptive_demux_bitrate_estimator_new (guint window_size);
+
+GST_ADAPTIVE_DEMUX_API
+void     gst_adaptive_demux_bitrate_estimator_free (GstAdaptiveDemuxBitrateEstimator * estimator);
+
+GST_ADAPTIVE_DEMUX_API
+void     gst_adaptive_demux_bitrate_estimator_reset (GstAdaptiveDemuxBitrateEstimator * estimator);
+
+GST_ADAPTIVE_DEMUX_API
+void     gst_adaptive_demux_bitrate_estimator_add_sample (GstAdaptiveDemuxBitrateEstimator * estimator,
+                                                          guint64 bitrate,
+                                                          GstClockTime download_time);
+
+GST_ADAPTIVE_DEMUX_API
+guint64  gst_adaptive_demux_bitrate_estimator_get_estimate (GstAdaptiveDemuxBitrateEstimator * estimator);
+
+G_END_DECLS
+
+#endif /* _GST_ADAPTIVE_DEMUX_BW_ESTIMATOR_H_ */
@@ -176,7 +176,8 @@ enum
   PROP_CURRENT_SUBSONG,
   PROP_SUBSONG_MODE,
   PROP_NUM_LOOPS,
-  PROP_OUTPUT_MODE
+  PROP_OUTPUT_MODE,
+  PROP_LOOKAHEAD
 };
 
 #define DEFAULT_CURRENT_SUBSONG 0
@@ -184,6 +185,7 @@ enum
 #define DEFAULT_NUM_SUBSONGS 0
 #define DEFAULT_NUM_LOOPS 0
 #define DEFAULT_OUTPUT_MODE GST_NONSTREAM_AUDIO_OUTPUT_MODE_STEADY
+#define DEFAULT_LOOKAHEAD FALSE
 
 
 
@@ -251,6 +253,17 @@ static gboolean gst_nonstream_audio_decoder_start_task (GstNonstreamAudioDecoder
 static gboolean gst_nonstream_audio_decoder_stop_task (GstNonstreamAudioDecoder
     * dec);
 
+static gpointer
+gst_nonstream_audio_decoder_lookahead_loop (GstNonstreamAudioDecoder * dec);
+static gboolean
+gst_nonstream_audio_decoder_start_lookahead_thread (GstNonstreamAudioDecoder *
+    dec);
+static void
+gst_nonstream_audio_decoder_stop_lookahead_thread (GstNonstreamAudioDecoder *
+    dec);
+static void
+gst_nonstream_audio_decoder_flush_lookahead (GstNonstreamAudioDecoder * dec);
+
 static gboolean
 gst_nonstream_audio_decoder_switch_to_subsong (GstNonstreamAudioDecoder * dec,
     guint new_subsong, guint32 const *seqnum);
@@ -457,6 +470,26 @@ gst_nonstream_audio_decoder_class_init (GstNonstreamAudioDecoderClass * klass)
           GST_TYPE_NONSTREAM_AUDIO_DECODER_OUTPUT_MODE,
           DEFAULT_OUTPUT_MODE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
       );
+
+  /**
+   * GstNonstreamAudioDecoder:lookahead:
+   *
+   * Render the next block of samples on a helper thread while the current
+   * block is being pushed downstream. This hides decoding spikes (for
+   * example when a module pattern triggers expensive effects) that can
+   * otherwise cause sink underruns. Only effective in the steady output
+   * mode; in looping mode, blocks are rendered on demand as before.
+   * Takes effect the next time the output task is started.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (object_class,
+      PROP_LOOKAHEAD,
+      g_param_spec_boolean ("lookahead",
+          "Lookahead rendering",
+          "Render the next block on a helper thread while the current one plays",
+          DEFAULT_LOOKAHEAD, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+      );
 }
 
 
@@ -473,6 +506,7 @@ gst_nonstream_audio_decoder_init (GstNonstreamAudioDecoder * dec,
   dec->subsong_mode = DEFAULT_SUBSONG_MODE;
   dec->output_mode = DEFAULT_OUTPUT_MODE;
   dec->num_loops = DEFAULT_NUM_LOOPS;
+  dec->lookahead = DEFAULT_LOOKAHEAD;
 
   /* Calling this here, not in the NULL->READY state change,
    * to make sure get_property calls return valid values */
@@ -481,6 +515,16 @@ gst_nonstream_audio_decoder_init (GstNonstreamAudioDecoder * dec,
   dec->input_data_adapter = gst_adapter_new ();
   g_mutex_init (&(dec->mutex));
 
+  dec->lookahead_thread = NULL;
+  g_mutex_init (&(dec->lookahead_mutex));
+  g_cond_init (&(dec->lookahead_cond));
+  dec->lookahead_buffer = NULL;
+  dec->lookahead_num_samples = 0;
+  dec->lookahead_eos = FALSE;
+  dec->lookahead_bypass = FALSE;
+  dec->lookahead_active = FALSE;
+  dec->lookahead_generation = 0;
+
   {
     /* set up src pad */
 
@@ -522,6 +566,11 @@ gst_nonstream_audio_decoder_finalize (GObject * object)
 {
   GstNonstreamAudioDecoder *dec = GST_NONSTREAM_AUDIO_DECODER (object);
 
+  /* normally stopped in the PAUSED->READY state change already */
+  gst_nonstream_audio_decoder_stop_lookahead_thread (dec);
+  g_mutex_clear (&(dec->lookahead_mutex));
+  g_cond_clear (&(dec->lookahead_cond));
+
   g_mutex_clear (&(dec->mutex));
   g_object_unref (G_OBJECT (dec->input_data_adapter));
 
@@ -577,6 +626,8 @@ gst_nonstream_audio_decoder_set_property (GObject * object, guint prop_id,
           if (proceed) {
             gst_nonstream_audio_decoder_output_new_segment (dec, cur_position);
             dec->output_mode = new_output_mode;
+            /* a block rendered ahead under the old output mode is stale */
+            gst_nonstream_audio_decoder_flush_lookahead (dec);
           }
         }
 
@@ -664,6 +715,14 @@ gst_nonstream_audio_decoder_set_property (GObject * object, guint prop_id,
       break;
     }
 
+    case PROP_LOOKAHEAD:
+    {
+      GST_NONSTREAM_AUDIO_DECODER_LOCK_MUTEX (dec);
+      dec->lookahead = g_value_get_boolean (value);
+      GST_NONSTREAM_AUDIO_DECODER_UNLOCK_MUTEX (dec);
+      break;
+    }
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -710,6 +769,14 @@ gst_nonstream_audio_decoder_get_property (GObject * object, guint prop_id,
       break;
     }
 
+    case PROP_LOOKAHEAD:
+    {
+      GST_NONSTREAM_AUDIO_DECODER_LOCK_MUTEX (dec);
+      g_value_set_boolean (value, dec->lookahead);
+      GST_NONSTREAM_AUDIO_DECODER_UNLOCK_MUTEX (dec);
+      break;
+    }
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1481,9 +1548,165 @@ gst_nonstream_audio_decoder_finish_load (GstNonstreamAudioDecoder * dec,
 }
 
 
+/* The lookahead thread renders the next block with the subclass' decode()
+ * function while the output task is busy pushing the current block
+ * downstream. It uses a single-slot mailbox (lookahead_buffer), so at most
+ * one block is rendered ahead. decode() is called with the decoder mutex
+ * held, exactly as it would be from the output task, so seeks and property
+ * changes serialize with it as usual. The thread never holds both the
+ * decoder mutex and the lookahead mutex at the same time.
+ *
+ * Looking ahead is only done in the steady output mode; in the looping
+ * output mode, decode() may call gst_nonstream_audio_decoder_handle_loop(),
+ * which pushes a new segment, and serialized events must not be pushed
+ * from a thread that runs concurrently with the output task. In that case
+ * the thread sets lookahead_bypass, and the output task decodes on demand
+ * as before. */
+static gpointer
+gst_nonstream_audio_decoder_lookahead_loop (GstNonstreamAudioDecoder * dec)
+{
+  GstNonstreamAudioDecoderClass *klass =
+      GST_NONSTREAM_AUDIO_DECODER_GET_CLASS (dec);
+
+  GST_DEBUG_OBJECT (dec, "lookahead thread started");
+
+  g_mutex_lock (&(dec->lookahead_mutex));
+
+  while (dec->lookahead_active) {
+    guint generation;
+    GstBuffer *outbuf = NULL;
+    guint num_samples = 0;
+    gboolean decode_ok = FALSE;
+    gboolean bypass;
+
+    if (dec->lookahead_buffer != NULL || dec->lookahead_eos
+        || dec->lookahead_bypass) {
+      /* the slot is occupied, or there is nothing left to render;
+       * wait until the output task or a flush wakes us up */
+      g_cond_wait (&(dec->lookahead_cond), &(dec->lookahead_mutex));
+      continue;
+    }
+
+    generation = dec->lookahead_generation;
+    g_mutex_unlock (&(dec->lookahead_mutex));
+
+    GST_NONSTREAM_AUDIO_DECODER_LOCK_MUTEX (dec);
+    bypass = !(dec->loaded_mode)
+        || (dec->output_mode != GST_NONSTREAM_AUDIO_OUTPUT_MODE_STEADY);
+    if (!bypass)
+      decode_ok = klass->decode (dec, &outbuf, &num_samples);
+    GST_NONSTREAM_AUDIO_DECODER_UNLOCK_MUTEX (dec);
+
+    g_mutex_lock (&(dec->lookahead_mutex));
+
+    if (generation != dec->lookahead_generation) {
+      /* a seek, subsong switch or output mode change happened while
+       * decoding - the rendered block belongs to the old position */
+      gst_buffer_replace (&outbuf, NULL);
+      continue;
+    }
+
+    if (bypass)
+      dec->lookahead_bypass = TRUE;
+    else if (!decode_ok)
+      dec->lookahead_eos = TRUE;
+    else {
+      dec->lookahead_buffer = outbuf;
+      dec->lookahead_num_samples = num_samples;
+    }
+
+    g_cond_broadcast (&(dec->lookahead_cond));
+  }
+
+  g_mutex_unlock (&(dec->lookahead_mutex));
+
+  GST_DEBUG_OBJECT (dec, "lookahead thread stopped");
+
+  return NULL;
+}
+
+
+static gboolean
+gst_nonstream_audio_decoder_start_lookahead_thread (GstNonstreamAudioDecoder *
+    dec)
+{
+  GError *error = NULL;
+  gchar *name;
+
+  if (dec->lookahead_thread != NULL)
+    return TRUE;
+
+  dec->lookahead_active = TRUE;
+  dec->lookahead_eos = FALSE;
+  dec->lookahead_bypass = FALSE;
+
+  name = g_strdup_printf ("%s:lookahead", GST_OBJECT_NAME (dec));
+  dec->lookahead_thread = g_thread_try_new (name,
+      (GThreadFunc) gst_nonstream_audio_decoder_lookahead_loop, dec, &error);
+  g_free (name);
+
+  if (dec->lookahead_thread == NULL) {
+    GST_WARNING_OBJECT (dec, "could not start lookahead thread: %s",
+        (error != NULL) ? error->message : "unknown error");
+    g_clear_error (&error);
+    dec->lookahead_active = FALSE;
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+
+static void
+gst_nonstream_audio_decoder_stop_lookahead_thread (GstNonstreamAudioDecoder *
+    dec)
+{
+  if (dec->lookahead_thread == NULL)
+    return;
+
+  g_mutex_lock (&(dec->lookahead_mutex));
+  dec->lookahead_active = FALSE;
+  g_cond_broadcast (&(dec->lookahead_cond));
+  g_mutex_unlock (&(dec->lookahead_mutex));
+
+  g_thread_join (dec->lookahead_thread);
+  dec->lookahead_thread = NULL;
+
+  gst_buffer_replace (&(dec->lookahead_buffer), NULL);
+  dec->lookahead_eos = FALSE;
+  dec->lookahead_bypass = FALSE;
+}
+
+
+/* Drops any block that was rendered ahead and invalidates one that might
+ * currently be rendering, then wakes up the lookahead thread so it starts
+ * rendering at the new playback position right away. Called after seeks,
+ * subsong switches and output mode changes. Safe to call with the decoder
+ * mutex held. */
+static void
+gst_nonstream_audio_decoder_flush_lookahead (GstNonstreamAudioDecoder * dec)
+{
+  if (dec->lookahead_thread == NULL)
+    return;
+
+  g_mutex_lock (&(dec->lookahead_mutex));
+  dec->lookahead_generation++;
+  gst_buffer_replace (&(dec->lookahead_buffer), NULL);
+  dec->lookahead_eos = FALSE;
+  dec->lookahead_bypass = FALSE;
+  g_cond_broadcast (&(dec->lookahead_cond));
+  g_mutex_unlock (&(dec->lookahead_mutex));
+}
+
+
 static gboolean
 gst_nonstream_audio_decoder_start_task (GstNonstreamAudioDecoder * dec)
 {
+  /* if the thread cannot be started, the output task
+   * simply decodes on demand, as without lookahead */
+  if (dec->lookahead)
+    gst_nonstream_audio_decoder_start_lookahead_thread (dec);
+
   if (!gst_pad_start_task (dec->srcpad,
           (GstTaskFunction) gst_nonstream_audio_decoder_output_task, dec,
           NULL)) {
@@ -1497,6 +1720,8 @@ gst_nonstream_audio_decoder_start_task (GstNonstreamAudioDecoder * dec)
 static gboolean
 gst_nonstream_audio_decoder_stop_task (GstNonstreamAudioDecoder * dec)
 {
+  gst_nonstream_audio_decoder_stop_lookahead_thread (dec);
+
   if (!gst_pad_stop_task (dec->srcpad)) {
     GST_ERROR_OBJECT (dec, "could not stop decoder output task");
     return FALSE;
@@ -1608,6 +1833,12 @@ gst_nonstream_audio_decoder_switch_to_subsong (GstNonstreamAudioDecoder * dec,
      * needs to be set to 0, since it defines the segment.base value */
     dec->num_decoded_samples = 0;
 
+    /* The lookahead thread (if any) may have a block from the old subsong
+     * in flight; drop it, and let the thread prefetch the start of the new
+     * subsong while the flush-stop/duration/segment/tag events below are
+     * being sent out */
+    gst_nonstream_audio_decoder_flush_lookahead (dec);
+
 
     fevent = gst_event_new_flush_stop (TRUE);
     if (seqnum != NULL) {
@@ -1951,6 +2182,9 @@ gst_nonstream_audio_decoder_do_seek (GstNonstreamAudioDecoder * dec,
 
   GST_NONSTREAM_AUDIO_DECODER_UNLOCK_MUTEX (dec);
 
+  /* drop any block that was rendered ahead of the old position */
+  gst_nonstream_audio_decoder_flush_lookahead (dec);
+
   if (flush) {
     GstEvent *fevent = gst_event_new_flush_stop (TRUE);
     gst_event_set_seqnum (fevent, seqnum);
@@ -2034,17 +2268,55 @@ static void
 gst_nonstream_audio_decoder_output_task (GstNonstreamAudioDecoder * dec)
 {
   GstFlowReturn flow;
-  GstBuffer *outbuf;
-  guint num_samples;
+  GstBuffer *outbuf = NULL;
+  guint num_samples = 0;
+  gboolean decode_ok = FALSE;
+  gboolean use_lookahead;
 
   GstNonstreamAudioDecoderClass *klass;
   klass = GST_NONSTREAM_AUDIO_DECODER_CLASS (G_OBJECT_GET_CLASS (dec));
   g_assert (klass->decode != NULL);
 
+  use_lookahead = (dec->lookahead_thread != NULL);
+
+  if (use_lookahead) {
+    /* take the block the lookahead thread prepared (waiting for it if it
+     * is still being rendered); the thread starts rendering the next
+     * block right away, while this task pushes the current one */
+    g_mutex_lock (&(dec->lookahead_mutex));
+
+    while ((dec->lookahead_buffer == NULL) && !(dec->lookahead_eos)
+        && !(dec->lookahead_bypass) && dec->lookahead_active)
+      g_cond_wait (&(dec->lookahead_cond), &(dec->lookahead_mutex));
+
+    if (!(dec->lookahead_active)) {
+      /* the thread is being shut down - just stop the task */
+      g_mutex_unlock (&(dec->lookahead_mutex));
+      goto pause;
+    }
+
+    if (dec->lookahead_bypass) {
+      /* the thread cannot look ahead (for example, in the looping
+       * output mode) - decode on demand below */
+      use_lookahead = FALSE;
+    } else {
+      outbuf = dec->lookahead_buffer;
+      dec->lookahead_buffer = NULL;
+      num_samples = dec->lookahead_num_samples;
+      decode_ok = (outbuf != NULL);
+      g_cond_broadcast (&(dec->lookahead_cond));
+    }
+
+    g_mutex_unlock (&(dec->lookahead_mutex));
+  }
+
   GST_NONSTREAM_AUDIO_DECODER_LOCK_MUTEX (dec);
 
   /* perform the actual decoding */
-  if (!(klass->decode (dec, &outbuf, &num_samples))) {
+  if (!use_lookahead)
+    decode_ok = klass->decode (dec, &outbuf, &num_samples);
+
+  if (!decode_ok) {
     /* EOS case */
     GST_INFO_OBJECT (dec, "decode() reports end -> sending EOS event");
     gst_pad_push_event (dec->srcpad, gst_event_new_eos ());
@@ -172,6 +172,18 @@ struct _GstNonstreamAudioDecoder
 
   /* thread safety */
   GMutex mutex;
+
+  /* optional lookahead rendering (see the "lookahead" property) */
+  gboolean lookahead;
+  GThread *lookahead_thread;
+  GMutex lookahead_mutex;
+  GCond lookahead_cond;
+  GstBuffer *lookahead_buffer;
+  guint lookahead_num_samples;
+  gboolean lookahead_eos;
+  gboolean lookahead_bypass;
+  gboolean lookahead_active;
+  guint lookahead_generation;
 };
 
 
@@ -1431,6 +1431,86 @@ beach:
   return res;
 }
 
+/**
+ * gst_h264_parser_identify_all_nalus:
+ * @nalparser: a #GstH264NalParser
+ * @data: The data to parse, containing Annex B coded NAL units
+ * @offset: the offset in @data from which to parse
+ * @size: the size of @data
+ * @nalus: (element-type GstH264NalUnit) (transfer none): a caller-provided
+ *   #GArray of #GstH264NalUnit to append the identified NAL units to
+ *
+ * Identifies all NAL units in @data and appends them to @nalus. The
+ * result is the same as calling gst_h264_parser_identify_nalu() in a loop,
+ * advancing past each identified NAL unit, except that the data in between
+ * start codes is only scanned once.
+ *
+ * Identification stops at the first NAL unit that is not cleanly bounded.
+ * On %GST_H264_PARSER_NO_NAL_END or %GST_H264_PARSER_BROKEN_DATA the
+ * offending NAL unit is still appended as the last entry; in the
+ * %GST_H264_PARSER_NO_NAL_END case its size extends to the end of @data,
+ * so callers that are draining can consume it as-is.
+ *
+ * Returns: %GST_H264_PARSER_NO_NAL if all of @data was consumed, else the
+ * result of the first failed identification
+ *
+ * Since: 1.18
+ */
+GstH264ParserResult
+gst_h264_parser_identify_all_nalus (GstH264NalParser * nalparser,
+    const guint8 * data, guint offset, gsize size, GArray * nalus)
+{
+  GstH264ParserResult res;
+  GstH264NalUnit nalu;
+  gint off2;
+
+  g_return_val_if_fail (nalus != NULL, GST_H264_PARSER_ERROR);
+
+  while (TRUE) {
+    res = gst_h264_parser_identify_nalu_unchecked (nalparser, data, offset,
+        size, &nalu);
+
+    if (res != GST_H264_PARSER_OK)
+      break;
+
+    /* The two NALs are exactly 1 byte size and are placed at the end of an AU,
+     * there is no need to wait for the following */
+    if (nalu.type == GST_H264_NAL_SEQ_END ||
+        nalu.type == GST_H264_NAL_STREAM_END) {
+      g_array_append_val (nalus, nalu);
+      offset = nalu.offset + nalu.size;
+      continue;
+    }
+
+    off2 = scan_for_start_codes (data + nalu.offset, size - nalu.offset);
+    if (off2 < 0) {
+      GST_DEBUG ("Nal start %d, No end found", nalu.offset);
+      g_array_append_val (nalus, nalu);
+      res = GST_H264_PARSER_NO_NAL_END;
+      break;
+    }
+
+    /* Resume the next identification from the start code we just found,
+     * so every byte is only scanned once */
+    offset = nalu.offset + off2;
+
+    while (off2 > 0 && data[nalu.offset + off2 - 1] == 00)
+      off2--;
+
+    nalu.size = off2;
+    if (nalu.size < 2) {
+      g_array_append_val (nalus, nalu);
+      res = GST_H264_PARSER_BROKEN_DATA;
+      break;
+    }
+
+    GST_DEBUG ("Complete nal found. Off: %d, Size: %d", nalu.offset,
+        nalu.size);
+    g_array_append_val (nalus, nalu);
+  }
+
+  return res;
+}
 
 /**
  * gst_h264_parser_identify_nalu_avc:
@@ -2279,6 +2359,117 @@ error:
   return GST_H264_PARSER_ERROR;
 }
 
+/**
+ * gst_h264_parser_parse_slice_hdr_minimal:
+ * @nalparser: a #GstH264NalParser
+ * @nalu: The #GST_H264_NAL_SLICE to #GST_H264_NAL_SLICE_IDR #GstH264NalUnit to parse
+ * @slice: The #GstH264SliceHdr to fill.
+ *
+ * Parses only the leading fields of the slice header of @nalu, up to
+ * and including the picture order count fields. That is enough for
+ * access unit boundary and keyframe detection (7.4.1.2.4), and
+ * considerably cheaper than gst_h264_parser_parse_slice_hdr() which
+ * also decodes the reference picture list modifications and everything
+ * after them. All later fields of @slice are left zeroed.
+ *
+ * Returns: a #GstH264ParserResult
+ *
+ * Since: 1.18
+ */
+GstH264ParserResult
+gst_h264_parser_parse_slice_hdr_minimal (GstH264NalParser * nalparser,
+    GstH264NalUnit * nalu, GstH264SliceHdr * slice)
+{
+  NalReader nr;
+  gint pps_id;
+  GstH264PPS *pps;
+  GstH264SPS *sps;
+
+  memset (slice, 0, sizeof (*slice));
+
+  if (!nalu->size) {
+    GST_DEBUG ("Invalid Nal Unit");
+    return GST_H264_PARSER_ERROR;
+  }
+
+  nal_reader_init (&nr, nalu->data + nalu->offset + nalu->header_bytes,
+      nalu->size - nalu->header_bytes);
+
+  READ_UE (&nr, slice->first_mb_in_slice);
+  READ_UE (&nr, slice->type);
+
+  GST_DEBUG ("parsing \"Slice header (minimal)\", slice type %u", slice->type);
+
+  READ_UE_MAX (&nr, pps_id, GST_H264_MAX_PPS_COUNT - 1);
+  pps = gst_h264_parser_get_pps (nalparser, pps_id);
+
+  if (!pps) {
+    GST_WARNING ("couldn't find associated picture parameter set with id: %d",
+        pps_id);
+
+    return GST_H264_PARSER_BROKEN_LINK;
+  }
+
+  slice->pps = pps;
+  sps = pps->sequence;
+  if (!sps) {
+    GST_WARNING ("couldn't find associated sequence parameter set with id: %d",
+        pps->id);
+    return GST_H264_PARSER_BROKEN_LINK;
+  }
+
+  /* Check we can actually parse this slice (AVC, MVC headers only) */
+  if (sps->extension_type && sps->extension_type != GST_H264_NAL_EXTENSION_MVC) {
+    GST_WARNING ("failed to parse unsupported slice header");
+    return GST_H264_PARSER_BROKEN_DATA;
+  }
+
+  /* set default values for fields that might not be present in the bitstream
+     and have valid defaults */
+  slice->num_ref_idx_l0_active_minus1 = pps->num_ref_idx_l0_active_minus1;
+  slice->num_ref_idx_l1_active_minus1 = pps->num_ref_idx_l1_active_minus1;
+
+  if (sps->separate_colour_plane_flag)
+    READ_UINT8 (&nr, slice->colour_plane_id, 2);
+
+  READ_UINT16 (&nr, slice->frame_num, sps->log2_max_frame_num_minus4 + 4);
+
+  if (!sps->frame_mbs_only_flag) {
+    READ_UINT8 (&nr, slice->field_pic_flag, 1);
+    if (slice->field_pic_flag)
+      READ_UINT8 (&nr, slice->bottom_field_flag, 1);
+  }
+
+  /* calculate MaxPicNum */
+  if (slice->field_pic_flag)
+    slice->max_pic_num = 2 * sps->max_frame_num;
+  else
+    slice->max_pic_num = sps->max_frame_num;
+
+  if (nalu->idr_pic_flag)
+    READ_UE_MAX (&nr, slice->idr_pic_id, G_MAXUINT16);
+
+  if (sps->pic_order_cnt_type == 0) {
+    READ_UINT16 (&nr, slice->pic_order_cnt_lsb,
+        sps->log2_max_pic_order_cnt_lsb_minus4 + 4);
+
+    if (pps->pic_order_present_flag && !slice->field_pic_flag)
+      READ_SE (&nr, slice->delta_pic_order_cnt_bottom);
+  }
+
+  if (sps->pic_order_cnt_type == 1 && !sps->delta_pic_order_always_zero_flag) {
+    READ_SE (&nr, slice->delta_pic_order_cnt[0]);
+    if (pps->pic_order_present_flag && !slice->field_pic_flag)
+      READ_SE (&nr, slice->delta_pic_order_cnt[1]);
+  }
+
+  return GST_H264_PARSER_OK;
+
+error:
+  GST_WARNING ("error parsing \"Slice header (minimal)\"");
+  return GST_H264_PARSER_ERROR;
+}
+
 /* Free MVC-specific data from subset SPS header */
 static void
 gst_h264_sps_mvc_clear (GstH264SPS * sps)
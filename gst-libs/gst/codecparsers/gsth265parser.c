@@ -1390,6 +1390,86 @@ beach:
   return res;
 }
 
+/**
+ * gst_h265_parser_identify_all_nalus:
+ * @parser: a #GstH265Parser
+ * @data: The data to parse, containing Annex B coded NAL units
+ * @offset: the offset in @data from which to parse
+ * @size: the size of @data
+ * @nalus: (element-type GstH265NalUnit) (transfer none): a caller-provided
+ *   #GArray of #GstH265NalUnit to append the identified NAL units to
+ *
+ * Identifies all NAL units in @data and appends them to @nalus. The
+ * result is the same as calling gst_h265_parser_identify_nalu() in a loop,
+ * advancing past each identified NAL unit, except that the data in between
+ * start codes is only scanned once.
+ *
+ * Identification stops at the first NAL unit that is not cleanly bounded.
+ * On %GST_H265_PARSER_NO_NAL_END or %GST_H265_PARSER_BROKEN_DATA the
+ * offending NAL unit is still appended as the last entry; in the
+ * %GST_H265_PARSER_NO_NAL_END case its size extends to the end of @data,
+ * so callers that are draining can consume it as-is.
+ *
+ * Returns: %GST_H265_PARSER_NO_NAL if all of @data was consumed, else the
+ * result of the first failed identification
+ *
+ * Since: 1.18
+ */
+GstH265ParserResult
+gst_h265_parser_identify_all_nalus (GstH265Parser * parser,
+    const guint8 * data, guint offset, gsize size, GArray * nalus)
+{
+  GstH265ParserResult res;
+  GstH265NalUnit nalu;
+  gint off2;
+
+  g_return_val_if_fail (nalus != NULL, GST_H265_PARSER_ERROR);
+
+  while (TRUE) {
+    res = gst_h265_parser_identify_nalu_unchecked (parser, data, offset,
+        size, &nalu);
+
+    if (res != GST_H265_PARSER_OK)
+      break;
+
+    /* The two NALs are exactly 2 bytes size and are placed at the end of an AU,
+     * there is no need to wait for the following */
+    if (nalu.type == GST_H265_NAL_EOS || nalu.type == GST_H265_NAL_EOB) {
+      g_array_append_val (nalus, nalu);
+      offset = nalu.offset + nalu.size;
+      continue;
+    }
+
+    off2 = scan_for_start_codes (data + nalu.offset, size - nalu.offset);
+    if (off2 < 0) {
+      GST_DEBUG ("Nal start %d, No end found", nalu.offset);
+      g_array_append_val (nalus, nalu);
+      res = GST_H265_PARSER_NO_NAL_END;
+      break;
+    }
+
+    /* Resume the next identification from the start code we just found,
+     * so every byte is only scanned once */
+    offset = nalu.offset + off2;
+
+    while (off2 > 0 && data[nalu.offset + off2 - 1] == 00)
+      off2--;
+
+    nalu.size = off2;
+    if (nalu.size < 3) {
+      g_array_append_val (nalus, nalu);
+      res = GST_H265_PARSER_BROKEN_DATA;
+      break;
+    }
+
+    GST_DEBUG ("Complete nal found. Off: %d, Size: %d", nalu.offset,
+        nalu.size);
+    g_array_append_val (nalus, nalu);
+  }
+
+  return res;
+}
+
 /**
  * gst_h265_parser_identify_nalu_hevc:
  * @parser: a #GstH265Parser
@@ -1287,6 +1287,13 @@ GstH265ParserResult gst_h265_parser_identify_nalu_unchecked (GstH265Parser * par
                                                         gsize            size,
                                                         GstH265NalUnit * nalu);
 
+GST_CODEC_PARSERS_API
+GstH265ParserResult gst_h265_parser_identify_all_nalus (GstH265Parser  * parser,
+                                                        const guint8   * data,
+                                                        guint            offset,
+                                                        gsize            size,
+                                                        GArray         * nalus);
+
 GST_CODEC_PARSERS_API
 GstH265ParserResult gst_h265_parser_identify_nalu_hevc (GstH265Parser  * parser,
                                                         const guint8   * data,
@@ -267,19 +267,29 @@ failed:
 static guint
 find_psc (GstByteReader * br)
 {
-  guint psc_pos = -1, psc;
+  guint psc_pos = -1;
+  const guint8 *data, *p, *end;
+  guint rem;
 
-  if (!gst_byte_reader_peek_uint24_be (br, &psc))
+  rem = gst_byte_reader_get_remaining (br);
+  if (rem < 3)
     goto failed;
 
-  /* Scan for the picture start code (22 bits - 0x0020) */
-  while ((gst_byte_reader_get_remaining (br) >= 3)) {
-    if (gst_byte_reader_peek_uint24_be (br, &psc) &&
-        ((psc & 0xfffffc) == 0x000080)) {
+  /* Scan for the picture start code (22 bits - 0x0020): two zero bytes
+   * followed by 1000 00xx. Let memchr(), which the C library vectorizes,
+   * race through the data looking for the second zero byte and check the
+   * bytes around each candidate */
+  data = br->data + br->byte;
+  p = data + 1;
+  end = data + rem - 1;
+
+  while (p < end && (p = memchr (p, 0x00, end - p)) != NULL) {
+    if (p[-1] == 0x00 && (p[1] & 0xfc) == 0x80) {
+      gst_byte_reader_skip_unchecked (br, p - 1 - data);
       psc_pos = gst_byte_reader_get_pos (br);
       break;
-    } else
-      gst_byte_reader_skip_unchecked (br, 1);
+    }
+    p++;
   }
 
 failed:
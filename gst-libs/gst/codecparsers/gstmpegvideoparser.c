@@ -193,7 +193,6 @@ static inline gint
 scan_for_start_codes (const GstByteReader * reader, guint offset, guint size)
 {
   const guint8 *data;
-  guint i = 0;
 
   g_assert ((guint64) offset + size <= reader->size - reader->byte);
 
@@ -203,21 +202,19 @@ scan_for_start_codes (const GstByteReader * reader, guint offset, guint size)
 
   data = reader->data + reader->byte + offset;
 
-  while (i <= (size - 4)) {
-    if (data[i + 2] > 1) {
-      i += 3;
-    } else if (data[i + 1]) {
-      i += 2;
-    } else if (data[i] || data[i + 2] != 1) {
-      i++;
-    } else {
-      break;
+  {
+    /* Look for the 0x01 of a start code with memchr(), which the C
+     * library vectorizes, and check the two bytes before each candidate */
+    const guint8 *p = data + 2;
+    const guint8 *end = data + size - 1;
+
+    while (p < end && (p = memchr (p, 0x01, end - p)) != NULL) {
+      if (p[-1] == 0x00 && p[-2] == 0x00)
+        return offset + (p - data) - 2;
+      p++;
     }
   }
 
-  if (i <= (size - 4))
-    return offset + i;
-
   /* nothing found */
   return -1;
 }
@@ -286,6 +283,85 @@ failed:
   }
 }
 
+/**
+ * gst_mpeg_video_parse_skip_slices:
+ * @packet: a #GstMpegVideoPacket to fill with the data and offset of the
+ *     next non-slice packet found
+ * @data: The data to parse
+ * @size: The size of @data
+ * @offset: The offset from which to start parsing
+ *
+ * Like gst_mpeg_video_parse(), but slice packets are skipped
+ * transparently: the returned packet is the next sequence, GOP, picture,
+ * extension or user data packet. Meant for callers that only need
+ * framing and don't care about the individual slices.
+ *
+ * Note that slice data still has to be scanned for start codes (slice
+ * sizes are not coded in the bitstream), but no per-slice packet is set
+ * up and reported.
+ *
+ * Returns: TRUE if a non-slice packet start code was found, otherwise
+ * FALSE.
+ *
+ * Since: 1.18
+ */
+gboolean
+gst_mpeg_video_parse_skip_slices (GstMpegVideoPacket * packet,
+    const guint8 * data, gsize size, guint offset)
+{
+  gint off;
+  guint8 type;
+  guint pos = offset;
+  GstByteReader br;
+
+  while (TRUE) {
+    gsize rem;
+
+    if (size <= pos) {
+      GST_DEBUG ("Can't parse from offset %d, buffer is to small", pos);
+      return FALSE;
+    }
+
+    rem = size - pos;
+    gst_byte_reader_init (&br, &data[pos], rem);
+
+    off = scan_for_start_codes (&br, 0, rem);
+
+    if (off < 0) {
+      GST_DEBUG ("No start code prefix in this buffer");
+      return FALSE;
+    }
+
+    /* need the type byte after the start code prefix */
+    if ((guint) off + 4 > rem) {
+      GST_WARNING ("Failed to parse");
+      return FALSE;
+    }
+
+    type = data[pos + off + 3];
+    if (!GST_MPEG_VIDEO_PACKET_IS_SLICE (type))
+      break;
+
+    pos += off + 4;
+  }
+
+  packet->data = data;
+  packet->type = type;
+  packet->offset = pos + off + 4;
+  packet->size = -1;
+
+  /* try to find end of packet */
+  if (size > packet->offset) {
+    gst_byte_reader_init (&br, &data[packet->offset], size - packet->offset);
+    off = scan_for_start_codes (&br, 0, size - packet->offset);
+
+    if (off >= 0)
+      packet->size = off;
+  }
+
+  return TRUE;
+}
+
 /**
  * gst_mpeg_video_packet_parse_sequence_header:
  * @packet: The #GstMpegVideoPacket that carries the data
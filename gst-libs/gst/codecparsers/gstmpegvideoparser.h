@@ -506,6 +506,10 @@ GST_CODEC_PARSERS_API
 gboolean gst_mpeg_video_parse                         (GstMpegVideoPacket * packet,
                                                        const guint8 * data, gsize size, guint offset);
 
+GST_CODEC_PARSERS_API
+gboolean gst_mpeg_video_parse_skip_slices             (GstMpegVideoPacket * packet,
+                                                       const guint8 * data, gsize size, guint offset);
+
 GST_CODEC_PARSERS_API
 gboolean gst_mpeg_video_packet_parse_sequence_header    (const GstMpegVideoPacket * packet,
                                                          GstMpegVideoSequenceHdr * seqhdr);
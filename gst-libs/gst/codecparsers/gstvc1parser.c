@@ -684,12 +684,25 @@ failed:
 static inline gint
 scan_for_start_codes (const guint8 * data, guint size)
 {
-  GstByteReader br;
-  gst_byte_reader_init (&br, data, size);
+  const guint8 *p, *end;
+
+  /* we can't find the pattern with less than 4 bytes */
+  if (G_UNLIKELY (size < 4))
+    return -1;
+
+  /* Look for the 0x01 of a start code with memchr(), which the C
+   * library vectorizes, and check the two bytes before each candidate */
+  p = data + 2;
+  end = data + size - 1;        /* BDU not empty, so we can at least expect
+                                 * 1 (even 2) bytes following sc */
+
+  while (p < end && (p = memchr (p, 0x01, end - p)) != NULL) {
+    if (p[-1] == 0x00 && p[-2] == 0x00)
+      return (p - data) - 2;
+    p++;
+  }
 
-  /* NALU not empty, so we can at least expect 1 (even 2) bytes following sc */
-  return gst_byte_reader_masked_scan_uint32 (&br, 0xffffff00, 0x00000100,
-      0, size);
+  return -1;
 }
 
 static inline gint
@@ -67,6 +67,21 @@ typedef struct _ReferenceSize
   guint32 height;
 } ReferenceSize;
 
+/* everything the derived parser->segmentation array depends on,
+ * used to skip the per-frame recomputation when nothing changed */
+typedef struct
+{
+  GstVp9QuantIndices quant_indices;
+  guint8 filter_level;
+  guint8 mode_ref_delta_enabled;
+  guint8 seg_enabled;
+  guint8 bit_depth;
+  gint8 ref_deltas[GST_VP9_MAX_REF_LF_DELTAS];
+  gint8 mode_deltas[GST_VP9_MAX_MODE_LF_DELTAS];
+  guint8 abs_delta;
+  GstVp9SegmentationInfoData segmentation[GST_VP9_MAX_SEGMENTS];
+} GstVp9SegCacheKey;
+
 typedef struct
 {
   /* for loop filters */
@@ -77,6 +92,9 @@ typedef struct
   GstVp9SegmentationInfoData segmentation[GST_VP9_MAX_SEGMENTS];
 
   ReferenceSize reference[GST_VP9_REF_FRAMES];
+
+  gboolean seg_cache_valid;
+  GstVp9SegCacheKey seg_cache_key;
 } GstVp9ParserPrivate;
 
 static gint32
@@ -467,14 +485,35 @@ static void
 segmentation_update (GstVp9Parser * parser, const GstVp9FrameHdr * frame_hdr)
 {
   int i = 0;
-  const GstVp9ParserPrivate *priv = GST_VP9_PARSER_GET_PRIVATE (parser);
+  GstVp9ParserPrivate *priv = GST_VP9_PARSER_GET_PRIVATE (parser);
   const GstVp9LoopFilter *lf = &frame_hdr->loopfilter;
   const GstVp9QuantIndices *quant_indices = &frame_hdr->quant_indices;
   int default_filter = lf->filter_level;
   const int scale = 1 << (default_filter >> 5);
+  GstVp9SegCacheKey key;
 
   segmentation_save (parser, frame_hdr);
 
+  /* VP9 streams rarely change segmentation or loop filter parameters
+   * mid-stream; skip the per-segment quantizer and filter level
+   * recomputation when all of its inputs match the previous frame.
+   * Padding in the key is zero: the frame header is memset before
+   * parsing and the saved data is copied from it wholesale. */
+  memset (&key, 0, sizeof (key));
+  key.quant_indices = *quant_indices;
+  key.filter_level = lf->filter_level;
+  key.mode_ref_delta_enabled = lf->mode_ref_delta_enabled;
+  key.seg_enabled = frame_hdr->segmentation.enabled;
+  key.bit_depth = parser->bit_depth;
+  memcpy (key.ref_deltas, priv->ref_deltas, sizeof (key.ref_deltas));
+  memcpy (key.mode_deltas, priv->mode_deltas, sizeof (key.mode_deltas));
+  key.abs_delta = priv->segmentation_abs_delta;
+  memcpy (key.segmentation, priv->segmentation, sizeof (key.segmentation));
+
+  if (priv->seg_cache_valid &&
+      memcmp (&key, &priv->seg_cache_key, sizeof (key)) == 0)
+    return;
+
   for (i = 0; i < GST_VP9_MAX_SEGMENTS; i++) {
     guint8 q = seg_get_base_qindex (parser, frame_hdr, i);
 
@@ -514,6 +553,9 @@ segmentation_update (GstVp9Parser * parser, const GstVp9FrameHdr * frame_hdr)
     seg->reference_frame = info->reference_frame;
     seg->reference_skip = info->reference_skip;
   }
+
+  priv->seg_cache_key = key;
+  priv->seg_cache_valid = TRUE;
 }
 
 static void
@@ -37,6 +37,8 @@
 
 #include "nalutils.h"
 
+#include <string.h>
+
 /* Compute Ceil(Log2(v)) */
 /* Derived from branchless code for integer log2(v) from:
    <http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog> */
@@ -98,8 +100,8 @@ nal_reader_read (NalReader * nr, guint nbits)
     byte = nr->data[nr->byte++];
 
     /* check if the byte is a emulation_prevention_three_byte */
-    if (check_three_byte && byte == 0x03 && nr->first_byte == 0x00 &&
-        ((nr->cache & 0xff) == 0)) {
+    if (G_UNLIKELY (check_three_byte && byte == 0x03 && nr->first_byte == 0x00
+            && ((nr->cache & 0xff) == 0))) {
       /* next byte goes unconditionally to the cache, even if it's 0x03 */
       check_three_byte = FALSE;
       nr->n_epb++;
@@ -300,10 +302,25 @@ nal_reader_has_more_data (NalReader * nr)
 gint
 scan_for_start_codes (const guint8 * data, guint size)
 {
-  GstByteReader br;
-  gst_byte_reader_init (&br, data, size);
+  const guint8 *p, *end;
+
+  /* we can't find the pattern with less than 4 bytes */
+  if (G_UNLIKELY (size < 4))
+    return -1;
+
+  /* Look for the 0x01 of a start code with memchr(), which the C
+   * library vectorizes (SSE2/NEON), and check the two bytes before
+   * each candidate. 0x01 bytes are rare in compressed payload, so
+   * almost all of the input is covered by the wide scan */
+  p = data + 2;
+  end = data + size - 1;        /* NALU not empty, so we can at least expect
+                                 * 1 (even 2) bytes following sc */
+
+  while (p < end && (p = memchr (p, 0x01, end - p)) != NULL) {
+    if (p[-1] == 0x00 && p[-2] == 0x00)
+      return (p - data) - 2;
+    p++;
+  }
 
-  /* NALU not empty, so we can at least expect 1 (even 2) bytes following sc */
-  return gst_byte_reader_masked_scan_uint32 (&br, 0xffffff00, 0x00000100,
-      0, size);
+  return -1;
 }
@@ -42,12 +42,12 @@ static gboolean initialized = FALSE;
     initialized = TRUE; \
   }
 
-static const guint8 tfrf_uuid[] = {
+const guint8 gst_isoff_tfrf_uuid[16] = {
   0xd4, 0x80, 0x7e, 0xf2, 0xca, 0x39, 0x46, 0x95,
   0x8e, 0x54, 0x26, 0xcb, 0x9e, 0x46, 0xa7, 0x9f
 };
 
-static const guint8 tfxd_uuid[] = {
+const guint8 gst_isoff_tfxd_uuid[16] = {
   0x6d, 0x1d, 0x9b, 0x05, 0x42, 0xd5, 0x44, 0xe6,
   0x80, 0xe2, 0x14, 0x1d, 0xaf, 0xf7, 0x57, 0xb2
 };
@@ -289,7 +289,7 @@ gst_isoff_tfdt_box_parse (GstTfdtBox * tfdt, GstByteReader * reader)
   return TRUE;
 }
 
-static gboolean
+gboolean
 gst_isoff_tfxd_box_parse (GstTfxdBox * tfxd, GstByteReader * reader)
 {
   guint8 version;
@@ -336,7 +336,7 @@ gst_isoff_tfxd_box_parse (GstTfxdBox * tfxd, GstByteReader * reader)
   return TRUE;
 }
 
-static gboolean
+gboolean
 gst_isoff_tfrf_box_parse (GstTfrfBox * tfrf, GstByteReader * reader)
 {
   guint8 version;
@@ -455,14 +455,14 @@ gst_isoff_traf_box_parse (GstTrafBox * traf, GstByteReader * reader)
       }
       case GST_ISOFF_FOURCC_UUID:{
         /* smooth-streaming specific */
-        if (memcmp (extended_type, tfrf_uuid, 16) == 0) {
+        if (memcmp (extended_type, gst_isoff_tfrf_uuid, 16) == 0) {
           traf->tfrf = g_new0 (GstTfrfBox, 1);
           gst_byte_reader_get_sub_reader (reader, &sub_reader,
               size - header_size);
 
           if (!gst_isoff_tfrf_box_parse (traf->tfrf, &sub_reader))
             goto error;
-        } else if (memcmp (extended_type, tfxd_uuid, 16) == 0) {
+        } else if (memcmp (extended_type, gst_isoff_tfxd_uuid, 16) == 0) {
           traf->tfxd = g_new0 (GstTfxdBox, 1);
           gst_byte_reader_get_sub_reader (reader, &sub_reader,
               size - header_size);
@@ -799,12 +799,16 @@ gst_isoff_sidx_parser_init (GstSidxParser * parser)
   parser->cumulative_entry_size = 0;
   parser->sidx.entries = NULL;
   parser->sidx.entries_count = 0;
+  parser->raw_entries = NULL;
+  parser->raw_entries_filled = 0;
+  parser->lazy_index = 0;
 }
 
 void
 gst_isoff_sidx_parser_clear (GstSidxParser * parser)
 {
   g_free (parser->sidx.entries);
+  g_free (parser->raw_entries);
   memset (parser, 0, sizeof (*parser));
 
   gst_isoff_sidx_parser_init (parser);
@@ -973,3 +977,204 @@ done:
   gst_buffer_unmap (buffer, &info);
   return res;
 }
+
+/* size of one sidx entry record on the wire */
+#define GST_ISOFF_SIDX_ENTRY_SIZE 12
+
+/* Like gst_isoff_sidx_parser_parse but keeps the entry records in their
+ * raw (wire) form instead of decoding them all up front. This bounds the
+ * cost of multi-hour DVR indexes with very large entry counts: only the
+ * entries actually accessed through gst_isoff_sidx_parser_get_entry ()
+ * are decoded, and storage stays at 12 bytes per entry. */
+GstIsoffParserResult
+gst_isoff_sidx_parser_parse_lazy (GstSidxParser * parser,
+    GstByteReader * reader, guint * consumed)
+{
+  GstIsoffParserResult res = GST_ISOFF_PARSER_OK;
+  gsize remaining;
+
+  INITIALIZE_DEBUG_CATEGORY;
+  switch (parser->status) {
+    case GST_ISOFF_SIDX_PARSER_INIT:
+      /* Try again once we have enough data for the FullBox header */
+      if (gst_byte_reader_get_remaining (reader) < 4) {
+        gst_byte_reader_set_pos (reader, 0);
+        break;
+      }
+      parser->sidx.version = gst_byte_reader_get_uint8_unchecked (reader);
+      parser->sidx.flags = gst_byte_reader_get_uint24_le_unchecked (reader);
+
+      parser->status = GST_ISOFF_SIDX_PARSER_HEADER;
+
+    case GST_ISOFF_SIDX_PARSER_HEADER:
+      remaining = gst_byte_reader_get_remaining (reader);
+      if (remaining < 12 + (parser->sidx.version == 0 ? 8 : 16)) {
+        break;
+      }
+
+      parser->sidx.ref_id = gst_byte_reader_get_uint32_be_unchecked (reader);
+      parser->sidx.timescale = gst_byte_reader_get_uint32_be_unchecked (reader);
+      if (parser->sidx.version == 0) {
+        parser->sidx.earliest_pts =
+            gst_byte_reader_get_uint32_be_unchecked (reader);
+        parser->sidx.first_offset =
+            gst_byte_reader_get_uint32_be_unchecked (reader);
+      } else {
+        parser->sidx.earliest_pts =
+            gst_byte_reader_get_uint64_be_unchecked (reader);
+        parser->sidx.first_offset =
+            gst_byte_reader_get_uint64_be_unchecked (reader);
+      }
+      /* skip 2 reserved bytes */
+      gst_byte_reader_skip_unchecked (reader, 2);
+      parser->sidx.entries_count =
+          gst_byte_reader_get_uint16_be_unchecked (reader);
+
+      GST_LOG ("Timescale: %" G_GUINT32_FORMAT, parser->sidx.timescale);
+      GST_LOG ("Earliest pts: %" G_GUINT64_FORMAT, parser->sidx.earliest_pts);
+      GST_LOG ("First offset: %" G_GUINT64_FORMAT, parser->sidx.first_offset);
+
+      parser->cumulative_pts =
+          gst_util_uint64_scale_int_round (parser->sidx.earliest_pts,
+          GST_SECOND, parser->sidx.timescale);
+
+      if (parser->sidx.entries_count) {
+        parser->raw_entries =
+            g_malloc (GST_ISOFF_SIDX_ENTRY_SIZE * parser->sidx.entries_count);
+      }
+      parser->raw_entries_filled = 0;
+      parser->lazy_index = 0;
+      parser->sidx.entry_index = 0;
+
+      parser->status = GST_ISOFF_SIDX_PARSER_DATA;
+
+    case GST_ISOFF_SIDX_PARSER_DATA:
+      remaining = gst_byte_reader_get_remaining (reader);
+      while (parser->raw_entries_filled < parser->sidx.entries_count &&
+          remaining >= GST_ISOFF_SIDX_ENTRY_SIZE) {
+        gint n = MIN (remaining / GST_ISOFF_SIDX_ENTRY_SIZE,
+            parser->sidx.entries_count - parser->raw_entries_filled);
+
+        memcpy (parser->raw_entries +
+            parser->raw_entries_filled * GST_ISOFF_SIDX_ENTRY_SIZE,
+            gst_byte_reader_get_data_unchecked (reader,
+                n * GST_ISOFF_SIDX_ENTRY_SIZE),
+            n * GST_ISOFF_SIDX_ENTRY_SIZE);
+        parser->raw_entries_filled += n;
+        remaining = gst_byte_reader_get_remaining (reader);
+      }
+
+      if (parser->raw_entries_filled == parser->sidx.entries_count)
+        parser->status = GST_ISOFF_SIDX_PARSER_FINISHED;
+      else
+        break;
+    case GST_ISOFF_SIDX_PARSER_FINISHED:
+      res = GST_ISOFF_PARSER_DONE;
+      break;
+  }
+
+  *consumed = gst_byte_reader_get_pos (reader);
+
+  return res;
+}
+
+GstIsoffParserResult
+gst_isoff_sidx_parser_add_buffer_lazy (GstSidxParser * parser,
+    GstBuffer * buffer, guint * consumed)
+{
+  GstIsoffParserResult res = GST_ISOFF_PARSER_OK;
+  GstByteReader reader;
+  GstMapInfo info;
+  guint32 fourcc;
+
+  INITIALIZE_DEBUG_CATEGORY;
+  if (!gst_buffer_map (buffer, &info, GST_MAP_READ)) {
+    *consumed = 0;
+    return GST_ISOFF_PARSER_ERROR;
+  }
+
+  gst_byte_reader_init (&reader, info.data, info.size);
+
+  if (parser->status == GST_ISOFF_SIDX_PARSER_INIT) {
+    if (!gst_isoff_parse_box_header (&reader, &fourcc, NULL, NULL,
+            &parser->size))
+      goto done;
+
+    if (fourcc != GST_ISOFF_FOURCC_SIDX) {
+      res = GST_ISOFF_PARSER_UNEXPECTED;
+      gst_byte_reader_set_pos (&reader, 0);
+      goto done;
+    }
+
+    if (parser->size == 0) {
+      res = GST_ISOFF_PARSER_ERROR;
+      gst_byte_reader_set_pos (&reader, 0);
+      goto done;
+    }
+
+    /* Try again once we have enough data for the FullBox header */
+    if (gst_byte_reader_get_remaining (&reader) < 4) {
+      gst_byte_reader_set_pos (&reader, 0);
+      goto done;
+    }
+  }
+
+  res = gst_isoff_sidx_parser_parse_lazy (parser, &reader, consumed);
+
+done:
+  gst_buffer_unmap (buffer, &info);
+  return res;
+}
+
+/* Returns the entry at @index. With the eager parser this is a simple
+ * array access; with the lazy parser the entry is decoded on demand.
+ * Entry offsets and pts are prefix sums, so lazy access walks forward
+ * from an internal cursor: sequential access is O(1) amortized, while
+ * going backwards restarts the accumulation from the first entry.
+ * The returned pointer is only valid until the next call and until the
+ * parser is cleared. */
+const GstSidxBoxEntry *
+gst_isoff_sidx_parser_get_entry (GstSidxParser * parser, gint index)
+{
+  GstByteReader reader;
+  GstSidxBoxEntry *entry = &parser->lazy_entry;
+
+  g_return_val_if_fail (index >= 0, NULL);
+  g_return_val_if_fail (index < parser->sidx.entries_count, NULL);
+
+  if (parser->sidx.entries)
+    return &parser->sidx.entries[index];
+
+  g_return_val_if_fail (parser->raw_entries != NULL, NULL);
+  g_return_val_if_fail (index < parser->raw_entries_filled, NULL);
+
+  /* the last decoded entry is still cached */
+  if (index == parser->lazy_index - 1)
+    return entry;
+
+  if (index < parser->lazy_index) {
+    parser->lazy_index = 0;
+    parser->cumulative_entry_size = 0;
+    parser->cumulative_pts =
+        gst_util_uint64_scale_int_round (parser->sidx.earliest_pts,
+        GST_SECOND, parser->sidx.timescale);
+  }
+
+  while (parser->lazy_index <= index) {
+    gst_byte_reader_init (&reader,
+        parser->raw_entries + parser->lazy_index * GST_ISOFF_SIDX_ENTRY_SIZE,
+        GST_ISOFF_SIDX_ENTRY_SIZE);
+
+    entry->offset = parser->cumulative_entry_size;
+    entry->pts = parser->cumulative_pts;
+    gst_isoff_parse_sidx_entry (entry, &reader);
+    entry->duration = gst_util_uint64_scale_int_round (entry->duration,
+        GST_SECOND, parser->sidx.timescale);
+    parser->cumulative_entry_size += entry->size;
+    parser->cumulative_pts += entry->duration;
+
+    parser->lazy_index++;
+  }
+
+  return entry;
+}
@@ -101,6 +101,16 @@ typedef struct _GstTfrfBox
   GArray *entries;
 } GstTfrfBox;
 
+/* the extended types of the Smooth-Streaming specific uuid boxes */
+GST_ISOFF_API extern const guint8 gst_isoff_tfxd_uuid[16];
+GST_ISOFF_API extern const guint8 gst_isoff_tfrf_uuid[16];
+
+GST_ISOFF_API
+gboolean gst_isoff_tfxd_box_parse (GstTfxdBox *tfxd, GstByteReader *reader);
+
+GST_ISOFF_API
+gboolean gst_isoff_tfrf_box_parse (GstTfrfBox *tfrf, GstByteReader *reader);
+
 /* Common boxes */
 typedef struct _GstMfhdBox
 {
@@ -280,6 +290,15 @@ typedef struct _GstSidxParser
   guint64 cumulative_pts;
 
   GstSidxBox sidx;
+
+  /* lazy mode: raw (undecoded) entry records, only filled by
+   * gst_isoff_sidx_parser_add_buffer_lazy (), in which case
+   * sidx.entries stays NULL and entries must be accessed through
+   * gst_isoff_sidx_parser_get_entry () */
+  guint8 *raw_entries;
+  gint raw_entries_filled;
+  gint lazy_index;
+  GstSidxBoxEntry lazy_entry;
 } GstSidxParser;
 
 GST_ISOFF_API
@@ -294,6 +313,15 @@ GstIsoffParserResult gst_isoff_sidx_parser_parse (GstSidxParser * parser, GstByt
 GST_ISOFF_API
 GstIsoffParserResult gst_isoff_sidx_parser_add_buffer (GstSidxParser * parser, GstBuffer * buf, guint * consumed);
 
+GST_ISOFF_API
+GstIsoffParserResult gst_isoff_sidx_parser_parse_lazy (GstSidxParser * parser, GstByteReader * reader, guint * consumed);
+
+GST_ISOFF_API
+GstIsoffParserResult gst_isoff_sidx_parser_add_buffer_lazy (GstSidxParser * parser, GstBuffer * buf, guint * consumed);
+
+GST_ISOFF_API
+const GstSidxBoxEntry * gst_isoff_sidx_parser_get_entry (GstSidxParser * parser, gint index);
+
 G_END_DECLS
 
 #endif /* __GST_ISOFF_H__ */
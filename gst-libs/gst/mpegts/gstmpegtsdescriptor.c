@@ -959,6 +959,120 @@ gst_mpegts_parse_descriptors (guint8 * buffer, gsize buf_len)
   return res;
 }
 
+static void
+_arena_descriptor_free (GstMpegtsDescriptor * desc)
+{
+  /* the array frees its elements in index order, so only the last
+   * descriptor, marked as the owner, releases the shared arena */
+  if (desc->_gst_reserved[1] != NULL)
+    g_free (desc->_gst_reserved[1]);
+}
+
+/**
+ * gst_mpegts_parse_descriptors_arena:
+ * @buffer: (transfer none): descriptors to parse
+ * @buf_len: Size of @buffer
+ *
+ * Parses the descriptors present in @buffer like
+ * gst_mpegts_parse_descriptors(), but places all the descriptors and
+ * their data in a single allocation which is released in one shot when
+ * the returned array is freed. This avoids the per-descriptor
+ * allocations of the regular parse and is meant for callers processing
+ * a high rate of sections.
+ *
+ * The returned array must be treated as immutable: do not remove or
+ * steal individual descriptors from it, release the whole array with
+ * g_ptr_array_unref() instead. Boxed copies of individual descriptors
+ * (g_boxed_copy()) are deep copies and remain valid after the array is
+ * released.
+ *
+ * Returns: (transfer full) (element-type GstMpegtsDescriptor): an
+ * array of the parsed descriptors or %NULL if there was an error.
+ * Release with #g_ptr_array_unref when done with it.
+ *
+ * Since: 1.18
+ */
+GPtrArray *
+gst_mpegts_parse_descriptors_arena (guint8 * buffer, gsize buf_len)
+{
+  GPtrArray *res;
+  guint8 length;
+  guint8 *data;
+  guint8 *arena, *payload;
+  GstMpegtsDescriptor *descs;
+  guint i, nb_desc = 0;
+
+  /* fast-path */
+  if (buf_len == 0)
+    return g_ptr_array_new ();
+
+  data = buffer;
+
+  GST_MEMDUMP ("Full descriptor array", buffer, buf_len);
+
+  while (data - buffer < buf_len) {
+    data++;                     /* skip tag */
+    length = *data++;
+
+    if (data - buffer > buf_len) {
+      GST_WARNING ("invalid descriptor length %d now at %d max %"
+          G_GSIZE_FORMAT, length, (gint) (data - buffer), buf_len);
+      return NULL;
+    }
+
+    data += length;
+    nb_desc++;
+  }
+
+  GST_DEBUG ("Saw %d descriptors, read %" G_GSIZE_FORMAT " bytes",
+      nb_desc, (gsize) (data - buffer));
+
+  if (data - buffer != buf_len) {
+    GST_WARNING ("descriptors size %d expected %" G_GSIZE_FORMAT,
+        (gint) (data - buffer), buf_len);
+    return NULL;
+  }
+
+  /* single allocation: the descriptor structs up front, one copy of the
+   * raw descriptor data after them */
+  arena = g_malloc0 (nb_desc * sizeof (GstMpegtsDescriptor) + buf_len);
+  descs = (GstMpegtsDescriptor *) arena;
+  payload = arena + nb_desc * sizeof (GstMpegtsDescriptor);
+  memcpy (payload, buffer, buf_len);
+
+  res =
+      g_ptr_array_new_full (nb_desc + 1,
+      (GDestroyNotify) _arena_descriptor_free);
+
+  data = payload;
+
+  for (i = 0; i < nb_desc; i++) {
+    GstMpegtsDescriptor *desc = &descs[i];
+
+    desc->data = data;
+    desc->tag = *data++;
+    desc->length = *data++;
+    GST_LOG ("descriptor 0x%02x length:%d", desc->tag, desc->length);
+    /* extended descriptors */
+    if (G_UNLIKELY (desc->tag == 0x7f))
+      desc->tag_extension = *data;
+
+    data += desc->length;
+
+    desc->_gst_reserved[0] = arena;
+
+    /* Set the descriptor in the array */
+    g_ptr_array_index (res, i) = desc;
+  }
+
+  /* the last element owns the arena */
+  descs[nb_desc - 1]._gst_reserved[1] = arena;
+
+  res->len = nb_desc;
+
+  return res;
+}
+
 /**
  * gst_mpegts_find_descriptor:
  * @descriptors: (element-type GstMpegtsDescriptor) (transfer none): an array
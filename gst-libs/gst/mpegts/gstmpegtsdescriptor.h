@@ -270,6 +270,9 @@ void       gst_mpegts_descriptor_free (GstMpegtsDescriptor *desc);
 GST_MPEGTS_API
 GPtrArray *gst_mpegts_parse_descriptors (guint8 * buffer, gsize buf_len);
 
+GST_MPEGTS_API
+GPtrArray *gst_mpegts_parse_descriptors_arena (guint8 * buffer, gsize buf_len);
+
 GST_MPEGTS_API
 const GstMpegtsDescriptor * gst_mpegts_find_descriptor (GPtrArray *descriptors,
 							guint8 tag);
@@ -138,10 +138,16 @@ gst_opencv_video_filter_transform_frame (GstVideoFilter * trans,
 
   g_return_val_if_fail (fclass->cv_trans_func != NULL, GST_FLOW_ERROR);
 
-  transform->cvImage.data = (unsigned char *) inframe->data[0];
-  transform->cvImage.datastart = (unsigned char *) inframe->data[0];
-  transform->out_cvImage.data = (unsigned char *) outframe->data[0];
-  transform->out_cvImage.datastart = (unsigned char *) outframe->data[0];
+  /* Wrap the mapped frames into Mat headers, no image data is copied or
+   * allocated here */
+  transform->cvImage =
+      cv::Mat (cv::Size (transform->in_width, transform->in_height),
+      transform->in_cv_type, inframe->data[0],
+      GST_VIDEO_FRAME_PLANE_STRIDE (inframe, 0));
+  transform->out_cvImage =
+      cv::Mat (cv::Size (transform->out_width, transform->out_height),
+      transform->out_cv_type, outframe->data[0],
+      GST_VIDEO_FRAME_PLANE_STRIDE (outframe, 0));
   ret = fclass->cv_trans_func (transform, inframe->buffer, transform->cvImage,
       outframe->buffer, transform->out_cvImage);
 
@@ -161,8 +167,12 @@ gst_opencv_video_filter_transform_frame_ip (GstVideoFilter * trans,
 
   g_return_val_if_fail (fclass->cv_trans_ip_func != NULL, GST_FLOW_ERROR);
 
-  transform->cvImage.data = (unsigned char *) frame->data[0];
-  transform->cvImage.datastart = (unsigned char *) frame->data[0];
+  /* Wrap the mapped frame into a Mat header, no image data is copied or
+   * allocated here */
+  transform->cvImage =
+      cv::Mat (cv::Size (transform->in_width, transform->in_height),
+      transform->in_cv_type, frame->data[0],
+      GST_VIDEO_FRAME_PLANE_STRIDE (frame, 0));
 
   ret = fclass->cv_trans_ip_func (transform, frame->buffer, transform->cvImage);
 
@@ -205,8 +215,16 @@ gst_opencv_video_filter_set_info (GstVideoFilter * trans, GstCaps * incaps,
       return FALSE;
   }
 
-  transform->cvImage.create (cv::Size (in_width, in_height), in_cv_type);
-  transform->out_cvImage.create (cv::Size (out_width, out_height), out_cv_type);
+  /* The Mat headers are created around the mapped frame data in the
+   * transform functions, no image data needs to be allocated here */
+  transform->in_width = in_width;
+  transform->in_height = in_height;
+  transform->in_cv_type = in_cv_type;
+  transform->out_width = out_width;
+  transform->out_height = out_height;
+  transform->out_cv_type = out_cv_type;
+  transform->cvImage.release ();
+  transform->out_cvImage.release ();
 
   gst_base_transform_set_in_place (GST_BASE_TRANSFORM (transform),
       transform->in_place);
@@ -90,6 +90,11 @@ struct _GstOpencvVideoFilter
 
   gboolean in_place;
 
+  gint in_width, in_height;
+  int in_cv_type;
+  gint out_width, out_height;
+  int out_cv_type;
+
   cv::Mat cvImage;
   cv::Mat out_cvImage;
 };
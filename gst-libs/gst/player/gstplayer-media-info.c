@@ -32,6 +32,9 @@
 #include "gstplayer-media-info.h"
 #include "gstplayer-media-info-private.h"
 
+#include <gst/tag/tag.h>
+#include <gst/pbutils/pbutils.h>
+
 /* Per-stream information */
 G_DEFINE_ABSTRACT_TYPE (GstPlayerStreamInfo, gst_player_stream_info,
     G_TYPE_OBJECT);
@@ -902,3 +905,508 @@ gst_player_get_subtitle_streams (const GstPlayerMediaInfo * info)
   return gst_player_media_info_get_subtitle_streams (info);
 }
 #endif
+
+/* Fast parser-only media scanning.
+ *
+ * A small headless pipeline of urisourcebin ! parsebin is run just far
+ * enough for every parsed stream to reach its first buffer; the stream
+ * info is then filled from the parser caps and the tag events collected
+ * on the way. No decoders and no sinks are involved, so scanning a local
+ * file typically completes in tens of milliseconds. */
+
+typedef struct
+{
+  GstPad *pad;
+  GstTagList *tags;
+  gulong probe_id;
+  gboolean done;
+} ScanPad;
+
+typedef struct
+{
+  GMutex lock;
+  GCond cond;
+  GPtrArray *pads;              /* of ScanPad */
+  GstTagList *global_tags;
+  gboolean no_more_pads;
+  gboolean error;
+} ScanContext;
+
+static void
+scan_pad_free (gpointer data)
+{
+  ScanPad *spad = data;
+
+  if (spad->probe_id)
+    gst_pad_remove_probe (spad->pad, spad->probe_id);
+  if (spad->tags)
+    gst_tag_list_unref (spad->tags);
+  gst_object_unref (spad->pad);
+  g_free (spad);
+}
+
+static gboolean
+scan_context_done_unlocked (ScanContext * ctx)
+{
+  guint i;
+
+  if (ctx->error)
+    return TRUE;
+  if (!ctx->no_more_pads)
+    return FALSE;
+  for (i = 0; i < ctx->pads->len; i++) {
+    ScanPad *spad = g_ptr_array_index (ctx->pads, i);
+
+    if (!spad->done)
+      return FALSE;
+  }
+  return ctx->pads->len > 0;
+}
+
+static GstPadProbeReturn
+scan_pad_probe_cb (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
+{
+  ScanContext *ctx = user_data;
+  ScanPad *spad = NULL;
+  guint i;
+
+  g_mutex_lock (&ctx->lock);
+  for (i = 0; i < ctx->pads->len; i++) {
+    ScanPad *p = g_ptr_array_index (ctx->pads, i);
+
+    if (p->pad == pad) {
+      spad = p;
+      break;
+    }
+  }
+
+  if (spad == NULL) {
+    g_mutex_unlock (&ctx->lock);
+    return GST_PAD_PROBE_PASS;
+  }
+
+  if (GST_PAD_PROBE_INFO_TYPE (info) & GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM) {
+    GstEvent *event = GST_PAD_PROBE_INFO_EVENT (info);
+
+    if (GST_EVENT_TYPE (event) == GST_EVENT_TAG) {
+      GstTagList *tags = NULL;
+
+      gst_event_parse_tag (event, &tags);
+      if (tags != NULL) {
+        if (gst_tag_list_get_scope (tags) == GST_TAG_SCOPE_GLOBAL) {
+          GstTagList *merged = gst_tag_list_merge (ctx->global_tags, tags,
+              GST_TAG_MERGE_REPLACE);
+          if (ctx->global_tags)
+            gst_tag_list_unref (ctx->global_tags);
+          ctx->global_tags = merged;
+        } else {
+          GstTagList *merged = gst_tag_list_merge (spad->tags, tags,
+              GST_TAG_MERGE_REPLACE);
+          if (spad->tags)
+            gst_tag_list_unref (spad->tags);
+          spad->tags = merged;
+        }
+      }
+      g_mutex_unlock (&ctx->lock);
+      return GST_PAD_PROBE_PASS;
+    } else if (GST_EVENT_TYPE (event) == GST_EVENT_EOS) {
+      /* stream ended without data, e.g. an empty subtitle track */
+      spad->done = TRUE;
+      g_cond_signal (&ctx->cond);
+      g_mutex_unlock (&ctx->lock);
+      return GST_PAD_PROBE_OK;
+    }
+
+    g_mutex_unlock (&ctx->lock);
+    return GST_PAD_PROBE_PASS;
+  }
+
+  /* first buffer: the sticky caps and tags are final enough, keep the
+   * pad blocked from here on */
+  spad->done = TRUE;
+  g_cond_signal (&ctx->cond);
+  g_mutex_unlock (&ctx->lock);
+
+  return GST_PAD_PROBE_OK;
+}
+
+static void
+scan_parsebin_pad_added_cb (GstElement * parsebin, GstPad * pad,
+    gpointer user_data)
+{
+  ScanContext *ctx = user_data;
+  ScanPad *spad;
+
+  if (GST_PAD_DIRECTION (pad) != GST_PAD_SRC)
+    return;
+
+  spad = g_new0 (ScanPad, 1);
+  spad->pad = gst_object_ref (pad);
+
+  g_mutex_lock (&ctx->lock);
+  g_ptr_array_add (ctx->pads, spad);
+  spad->probe_id = gst_pad_add_probe (pad,
+      GST_PAD_PROBE_TYPE_BLOCK | GST_PAD_PROBE_TYPE_BUFFER |
+      GST_PAD_PROBE_TYPE_BUFFER_LIST | GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM,
+      scan_pad_probe_cb, ctx, NULL);
+  g_mutex_unlock (&ctx->lock);
+}
+
+static void
+scan_parsebin_no_more_pads_cb (GstElement * parsebin, gpointer user_data)
+{
+  ScanContext *ctx = user_data;
+
+  g_mutex_lock (&ctx->lock);
+  ctx->no_more_pads = TRUE;
+  g_cond_signal (&ctx->cond);
+  g_mutex_unlock (&ctx->lock);
+}
+
+static void
+scan_source_pad_added_cb (GstElement * urisourcebin, GstPad * pad,
+    gpointer user_data)
+{
+  GstElement *parsebin = user_data;
+  GstPad *sinkpad;
+
+  sinkpad = gst_element_get_static_pad (parsebin, "sink");
+  if (sinkpad != NULL) {
+    if (!gst_pad_is_linked (sinkpad))
+      gst_pad_link (pad, sinkpad);
+    gst_object_unref (sinkpad);
+  }
+}
+
+static GstBusSyncReply
+scan_bus_sync_handler (GstBus * bus, GstMessage * message, gpointer user_data)
+{
+  ScanContext *ctx = user_data;
+
+  if (GST_MESSAGE_TYPE (message) == GST_MESSAGE_ERROR) {
+    GError *err = NULL;
+    gchar *debug = NULL;
+
+    gst_message_parse_error (message, &err, &debug);
+    GST_WARNING ("error while scanning: %s (%s)", err->message,
+        GST_STR_NULL (debug));
+    g_clear_error (&err);
+    g_free (debug);
+
+    g_mutex_lock (&ctx->lock);
+    ctx->error = TRUE;
+    g_cond_signal (&ctx->cond);
+    g_mutex_unlock (&ctx->lock);
+  }
+
+  gst_message_unref (message);
+  return GST_BUS_DROP;
+}
+
+static gchar *
+scan_stream_get_codec (GstPlayerStreamInfo * s)
+{
+  const gchar *type;
+  gchar *codec = NULL;
+
+  if (GST_IS_PLAYER_VIDEO_INFO (s))
+    type = GST_TAG_VIDEO_CODEC;
+  else if (GST_IS_PLAYER_AUDIO_INFO (s))
+    type = GST_TAG_AUDIO_CODEC;
+  else
+    type = GST_TAG_SUBTITLE_CODEC;
+
+  if (s->tags) {
+    gst_tag_list_get_string (s->tags, type, &codec);
+    if (!codec)
+      gst_tag_list_get_string (s->tags, GST_TAG_CODEC, &codec);
+  }
+
+  if (!codec && s->caps)
+    codec = gst_pb_utils_get_codec_description (s->caps);
+
+  return codec;
+}
+
+static void
+scan_fill_stream_info (GstPlayerStreamInfo * s)
+{
+  GstStructure *structure = NULL;
+
+  if (s->caps)
+    structure = gst_caps_get_structure (s->caps, 0);
+
+  if (GST_IS_PLAYER_VIDEO_INFO (s)) {
+    GstPlayerVideoInfo *info = (GstPlayerVideoInfo *) s;
+
+    info->width = info->height = -1;
+    info->par_num = info->par_denom = 1;
+    info->framerate_num = 0;
+    info->framerate_denom = 1;
+    info->bitrate = info->max_bitrate = -1;
+
+    if (structure) {
+      gst_structure_get_int (structure, "width", &info->width);
+      gst_structure_get_int (structure, "height", &info->height);
+      gst_structure_get_fraction (structure, "framerate",
+          &info->framerate_num, &info->framerate_denom);
+      gst_structure_get_fraction (structure, "pixel-aspect-ratio",
+          &info->par_num, &info->par_denom);
+    }
+    if (s->tags) {
+      gst_tag_list_get_uint (s->tags, GST_TAG_BITRATE, &info->bitrate);
+      if (!gst_tag_list_get_uint (s->tags, GST_TAG_MAXIMUM_BITRATE,
+              &info->max_bitrate))
+        gst_tag_list_get_uint (s->tags, GST_TAG_NOMINAL_BITRATE,
+            &info->max_bitrate);
+    }
+  } else if (GST_IS_PLAYER_AUDIO_INFO (s)) {
+    GstPlayerAudioInfo *info = (GstPlayerAudioInfo *) s;
+
+    info->sample_rate = -1;
+    info->channels = 0;
+    info->bitrate = info->max_bitrate = -1;
+
+    if (structure) {
+      gst_structure_get_int (structure, "rate", &info->sample_rate);
+      gst_structure_get_int (structure, "channels", &info->channels);
+    }
+    if (s->tags) {
+      gchar *lang_code = NULL;
+
+      gst_tag_list_get_uint (s->tags, GST_TAG_BITRATE, &info->bitrate);
+      if (!gst_tag_list_get_uint (s->tags, GST_TAG_MAXIMUM_BITRATE,
+              &info->max_bitrate))
+        gst_tag_list_get_uint (s->tags, GST_TAG_NOMINAL_BITRATE,
+            &info->max_bitrate);
+
+      gst_tag_list_get_string (s->tags, GST_TAG_LANGUAGE_NAME,
+          &info->language);
+      if (!info->language &&
+          gst_tag_list_get_string (s->tags, GST_TAG_LANGUAGE_CODE,
+              &lang_code)) {
+        info->language = g_strdup (gst_tag_get_language_name (lang_code));
+        g_free (lang_code);
+      }
+    }
+  } else {
+    GstPlayerSubtitleInfo *info = (GstPlayerSubtitleInfo *) s;
+
+    if (s->tags) {
+      gchar *lang_code = NULL;
+
+      gst_tag_list_get_string (s->tags, GST_TAG_LANGUAGE_NAME,
+          &info->language);
+      if (!info->language &&
+          gst_tag_list_get_string (s->tags, GST_TAG_LANGUAGE_CODE,
+              &lang_code)) {
+        info->language = g_strdup (gst_tag_get_language_name (lang_code));
+        g_free (lang_code);
+      }
+    }
+  }
+
+  g_free (s->codec);
+  s->codec = scan_stream_get_codec (s);
+}
+
+static GType
+scan_stream_type_from_caps (GstCaps * caps)
+{
+  const gchar *name;
+
+  if (caps == NULL || gst_caps_get_size (caps) == 0)
+    return G_TYPE_INVALID;
+
+  name = gst_structure_get_name (gst_caps_get_structure (caps, 0));
+
+  if (g_str_has_prefix (name, "audio/"))
+    return GST_TYPE_PLAYER_AUDIO_INFO;
+  if (g_str_has_prefix (name, "video/") || g_str_has_prefix (name, "image/"))
+    return GST_TYPE_PLAYER_VIDEO_INFO;
+  if (g_str_has_prefix (name, "text/") ||
+      g_str_has_prefix (name, "subpicture/") ||
+      g_str_has_prefix (name, "application/x-subtitle") ||
+      g_str_has_prefix (name, "application/x-ssa") ||
+      g_str_has_prefix (name, "application/x-ass"))
+    return GST_TYPE_PLAYER_SUBTITLE_INFO;
+
+  return G_TYPE_INVALID;
+}
+
+/**
+ * gst_player_media_info_scan_uri:
+ * @uri: the URI to scan
+ * @timeout: maximum time to wait in nanoseconds, or %GST_CLOCK_TIME_NONE
+ *   to wait indefinitely
+ *
+ * Collects the media information of @uri without building a playback
+ * pipeline. Only parser elements are used, no decoders and no sinks, so
+ * the returned information is limited to what the container and the
+ * parsers report: stream topology, caps, codec names, tags, duration and
+ * seekability. Scanning a local file typically takes a few tens of
+ * milliseconds, which makes this suitable for interactively listing
+ * large collections of files.
+ *
+ * This function is synchronous and can be called without a #GstPlayer.
+ *
+ * Returns: (transfer full) (nullable): a new #GstPlayerMediaInfo, or %NULL
+ *   if the URI could not be scanned within @timeout.
+ *
+ * Since: 1.18
+ */
+GstPlayerMediaInfo *
+gst_player_media_info_scan_uri (const gchar * uri, GstClockTime timeout)
+{
+  GstPlayerMediaInfo *media_info = NULL;
+  GstElement *pipeline, *source, *parsebin;
+  GstBus *bus;
+  ScanContext ctx;
+  gint64 end_time;
+  gboolean timed_out = FALSE;
+  guint i;
+  guint n_audio = 0, n_video = 0, n_text = 0;
+
+  g_return_val_if_fail (uri != NULL, NULL);
+
+  source = gst_element_factory_make ("urisourcebin", NULL);
+  parsebin = gst_element_factory_make ("parsebin", NULL);
+  if (source == NULL || parsebin == NULL) {
+    GST_WARNING ("missing urisourcebin or parsebin element");
+    if (source)
+      gst_object_unref (source);
+    if (parsebin)
+      gst_object_unref (parsebin);
+    return NULL;
+  }
+
+  g_mutex_init (&ctx.lock);
+  g_cond_init (&ctx.cond);
+  ctx.pads = g_ptr_array_new_with_free_func (scan_pad_free);
+  ctx.global_tags = NULL;
+  ctx.no_more_pads = FALSE;
+  ctx.error = FALSE;
+
+  pipeline = gst_pipeline_new ("mediainfo-scan");
+  g_object_set (source, "uri", uri, NULL);
+  gst_bin_add_many (GST_BIN (pipeline), source, parsebin, NULL);
+
+  g_signal_connect (source, "pad-added",
+      G_CALLBACK (scan_source_pad_added_cb), parsebin);
+  g_signal_connect (parsebin, "pad-added",
+      G_CALLBACK (scan_parsebin_pad_added_cb), &ctx);
+  g_signal_connect (parsebin, "no-more-pads",
+      G_CALLBACK (scan_parsebin_no_more_pads_cb), &ctx);
+
+  bus = gst_element_get_bus (pipeline);
+  gst_bus_set_sync_handler (bus, scan_bus_sync_handler, &ctx, NULL);
+
+  if (gst_element_set_state (pipeline,
+          GST_STATE_PAUSED) == GST_STATE_CHANGE_FAILURE)
+    goto beach;
+
+  if (timeout == GST_CLOCK_TIME_NONE)
+    end_time = G_MAXINT64;
+  else
+    end_time = g_get_monotonic_time () + timeout / GST_USECOND;
+
+  g_mutex_lock (&ctx.lock);
+  while (!scan_context_done_unlocked (&ctx)) {
+    if (!g_cond_wait_until (&ctx.cond, &ctx.lock, end_time)) {
+      timed_out = TRUE;
+      break;
+    }
+  }
+  g_mutex_unlock (&ctx.lock);
+
+  if (ctx.error || (timed_out && ctx.pads->len == 0))
+    goto beach;
+
+  /* all streaming threads are now parked in the pad probes; it is safe to
+   * pick up caps, tags and queries without further locking */
+  media_info = gst_player_media_info_new (uri);
+  media_info->duration = GST_CLOCK_TIME_NONE;
+
+  for (i = 0; i < ctx.pads->len; i++) {
+    ScanPad *spad = g_ptr_array_index (ctx.pads, i);
+    GstPlayerStreamInfo *s;
+    GstCaps *caps;
+    GType type;
+    gint64 duration = -1;
+
+    caps = gst_pad_get_current_caps (spad->pad);
+    type = scan_stream_type_from_caps (caps);
+    if (type == G_TYPE_INVALID) {
+      if (caps)
+        gst_caps_unref (caps);
+      continue;
+    }
+
+    if (type == GST_TYPE_PLAYER_AUDIO_INFO)
+      s = gst_player_stream_info_new (n_audio++, type);
+    else if (type == GST_TYPE_PLAYER_VIDEO_INFO)
+      s = gst_player_stream_info_new (n_video++, type);
+    else
+      s = gst_player_stream_info_new (n_text++, type);
+
+    s->caps = caps;
+    s->tags = spad->tags ? gst_tag_list_ref (spad->tags) : NULL;
+    s->stream_id = gst_pad_get_stream_id (spad->pad);
+    scan_fill_stream_info (s);
+
+    media_info->stream_list = g_list_append (media_info->stream_list, s);
+    if (type == GST_TYPE_PLAYER_AUDIO_INFO)
+      media_info->audio_stream_list =
+          g_list_append (media_info->audio_stream_list, s);
+    else if (type == GST_TYPE_PLAYER_VIDEO_INFO)
+      media_info->video_stream_list =
+          g_list_append (media_info->video_stream_list, s);
+    else
+      media_info->subtitle_stream_list =
+          g_list_append (media_info->subtitle_stream_list, s);
+
+    if (gst_pad_query_duration (spad->pad, GST_FORMAT_TIME, &duration) &&
+        duration != -1) {
+      if (!GST_CLOCK_TIME_IS_VALID (media_info->duration) ||
+          (GstClockTime) duration > media_info->duration)
+        media_info->duration = duration;
+    }
+
+    if (!media_info->seekable) {
+      GstQuery *query = gst_query_new_seeking (GST_FORMAT_TIME);
+
+      if (gst_pad_query (spad->pad, query))
+        gst_query_parse_seeking (query, NULL, &media_info->seekable, NULL,
+            NULL);
+      gst_query_unref (query);
+    }
+  }
+
+  if (ctx.global_tags)
+    media_info->tags = gst_tag_list_ref (ctx.global_tags);
+
+  if (media_info->tags) {
+    gst_tag_list_get_string (media_info->tags, GST_TAG_TITLE,
+        &media_info->title);
+    if (!media_info->title)
+      gst_tag_list_get_string (media_info->tags, GST_TAG_TITLE_SORTNAME,
+          &media_info->title);
+    gst_tag_list_get_string (media_info->tags, GST_TAG_CONTAINER_FORMAT,
+        &media_info->container);
+  }
+
+beach:
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_bus_set_sync_handler (bus, NULL, NULL, NULL);
+  gst_object_unref (bus);
+
+  g_ptr_array_unref (ctx.pads);
+  if (ctx.global_tags)
+    gst_tag_list_unref (ctx.global_tags);
+  g_mutex_clear (&ctx.lock);
+  g_cond_clear (&ctx.cond);
+
+  gst_object_unref (pipeline);
+
+  return media_info;
+}
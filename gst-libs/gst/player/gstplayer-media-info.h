@@ -241,6 +241,10 @@ const gchar*  gst_player_media_info_get_container_format (const GstPlayerMediaIn
 GST_PLAYER_API
 GstSample*    gst_player_media_info_get_image_sample (const GstPlayerMediaInfo *info);
 
+GST_PLAYER_API
+GstPlayerMediaInfo * gst_player_media_info_scan_uri (const gchar *uri,
+                                                     GstClockTime timeout);
+
 GST_PLAYER_DEPRECATED_FOR(gst_player_media_info_get_video_streams)
 GList*        gst_player_get_video_streams    (const GstPlayerMediaInfo *info);
 
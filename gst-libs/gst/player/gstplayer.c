@@ -193,6 +193,9 @@ struct _GstPlayer
   GstClockTime last_seek_time;  /* Only set from main context */
   GSource *seek_source;
   GstClockTime seek_position;
+  gboolean scrubbing;           /* A scrub gesture is active, seek to
+                                 * keyframes only and throttle tighter */
+  GstClockTime scrub_position;  /* Last position seeked while scrubbing */
   /* If TRUE, all signals are inhibited except the
    * state-changed:GST_PLAYER_STATE_STOPPED/PAUSED. This ensures that no signal
    * is emitted after gst_player_stop/pause() has been called by the user. */
@@ -301,6 +304,8 @@ gst_player_init (GstPlayer * self)
   self->seek_pending = FALSE;
   self->seek_position = GST_CLOCK_TIME_NONE;
   self->last_seek_time = GST_CLOCK_TIME_NONE;
+  self->scrubbing = FALSE;
+  self->scrub_position = GST_CLOCK_TIME_NONE;
   self->inhibit_sigs = FALSE;
 
   GST_TRACE_OBJECT (self, "Initialized");
@@ -3317,6 +3322,7 @@ gst_player_seek_internal_locked (GstPlayer * self)
   GstEvent *s_event;
   GstSeekFlags flags = 0;
   gboolean accurate = FALSE;
+  gboolean scrubbing;
 
   remove_seek_source (self);
 
@@ -3341,6 +3347,9 @@ gst_player_seek_internal_locked (GstPlayer * self)
   self->seek_position = GST_CLOCK_TIME_NONE;
   self->seek_pending = TRUE;
   rate = self->rate;
+  scrubbing = self->scrubbing;
+  if (scrubbing)
+    self->scrub_position = position;
   g_mutex_unlock (&self->lock);
 
   remove_tick_source (self);
@@ -3360,6 +3369,15 @@ gst_player_seek_internal_locked (GstPlayer * self)
     flags |= GST_SEEK_FLAG_TRICKMODE;
   }
 
+  if (scrubbing) {
+    /* while the scrub gesture is active the exact position does not matter,
+     * landing on the nearest keyframe is what keeps the timeline fluid. The
+     * final accurate seek is issued from gst_player_scrub_end(). */
+    flags &= ~GST_SEEK_FLAG_ACCURATE;
+    flags |= GST_SEEK_FLAG_KEY_UNIT | GST_SEEK_FLAG_SNAP_NEAREST |
+        GST_SEEK_FLAG_TRICKMODE | GST_SEEK_FLAG_TRICKMODE_KEY_UNITS;
+  }
+
   if (rate >= 0.0) {
     s_event = gst_event_new_seek (rate, GST_FORMAT_TIME, flags,
         GST_SEEK_TYPE_SET, position, GST_SEEK_TYPE_NONE, GST_CLOCK_TIME_NONE);
@@ -3454,10 +3472,15 @@ gst_player_seek (GstPlayer * self, GstClockTime position)
    */
   if (!self->seek_source) {
     GstClockTime now = gst_util_get_timestamp ();
-
-    /* If no seek is pending or it was started more than 250 mseconds ago seek
-     * immediately, otherwise wait until the 250 mseconds have passed */
-    if (!self->seek_pending || (now - self->last_seek_time > 250 * GST_MSECOND)) {
+    /* keyframe seeks during a scrub gesture complete quickly, so they can
+     * be dispatched at a higher rate */
+    GstClockTime interval = self->scrubbing ? 100 * GST_MSECOND :
+        250 * GST_MSECOND;
+
+    /* If no seek is pending or it was started more than the coalescing
+     * interval ago seek immediately, otherwise wait until the interval has
+     * passed */
+    if (!self->seek_pending || (now - self->last_seek_time > interval)) {
       self->seek_source = g_idle_source_new ();
       g_source_set_callback (self->seek_source,
           (GSourceFunc) gst_player_seek_internal, self, NULL);
@@ -3465,10 +3488,10 @@ gst_player_seek (GstPlayer * self, GstClockTime position)
           GST_TIME_ARGS (position));
       g_source_attach (self->seek_source, self->context);
     } else {
-      guint delay = 250000 - (now - self->last_seek_time) / 1000;
+      guint delay = (interval - (now - self->last_seek_time)) / 1000;
 
       /* Note that last_seek_time must be set to something at this point and
-       * it must be smaller than 250 mseconds */
+       * it must be less than the coalescing interval in the past */
       self->seek_source = g_timeout_source_new (delay);
       g_source_set_callback (self->seek_source,
           (GSourceFunc) gst_player_seek_internal, self, NULL);
@@ -3482,6 +3505,65 @@ gst_player_seek (GstPlayer * self, GstClockTime position)
   g_mutex_unlock (&self->lock);
 }
 
+/**
+ * gst_player_scrub_start:
+ * @player: #GstPlayer instance
+ *
+ * Marks the start of a timeline scrub gesture. Until
+ * gst_player_scrub_end() is called, calls to gst_player_seek() are
+ * coalesced more aggressively and are executed as fast keyframe-only
+ * seeks (%GST_SEEK_FLAG_KEY_UNIT and
+ * %GST_SEEK_FLAG_TRICKMODE_KEY_UNITS) instead of the configured seek
+ * accuracy, which keeps scrubbing fluid even on streams that are
+ * expensive to decode.
+ *
+ * Since: 1.18
+ */
+void
+gst_player_scrub_start (GstPlayer * self)
+{
+  g_return_if_fail (GST_IS_PLAYER (self));
+
+  g_mutex_lock (&self->lock);
+  self->scrubbing = TRUE;
+  self->scrub_position = GST_CLOCK_TIME_NONE;
+  g_mutex_unlock (&self->lock);
+
+  GST_DEBUG_OBJECT (self, "Scrub gesture started");
+}
+
+/**
+ * gst_player_scrub_end:
+ * @player: #GstPlayer instance
+ *
+ * Marks the end of a timeline scrub gesture started with
+ * gst_player_scrub_start(). The last position seeked during the gesture
+ * is re-issued as a regular seek, so playback ends up exactly where the
+ * gesture was released, honouring the configured seek accuracy again.
+ *
+ * Since: 1.18
+ */
+void
+gst_player_scrub_end (GstPlayer * self)
+{
+  GstClockTime position;
+
+  g_return_if_fail (GST_IS_PLAYER (self));
+
+  g_mutex_lock (&self->lock);
+  self->scrubbing = FALSE;
+  position = self->scrub_position;
+  self->scrub_position = GST_CLOCK_TIME_NONE;
+  g_mutex_unlock (&self->lock);
+
+  GST_DEBUG_OBJECT (self, "Scrub gesture ended at %" GST_TIME_FORMAT,
+      GST_TIME_ARGS (position));
+
+  /* refine the last keyframe seek to the exact position */
+  if (position != GST_CLOCK_TIME_NONE)
+    gst_player_seek (self, position);
+}
+
 static void
 remove_seek_source (GstPlayer * self)
 {
@@ -124,6 +124,12 @@ GST_PLAYER_API
 void         gst_player_seek                          (GstPlayer    * player,
                                                        GstClockTime   position);
 
+GST_PLAYER_API
+void         gst_player_scrub_start                   (GstPlayer    * player);
+
+GST_PLAYER_API
+void         gst_player_scrub_end                     (GstPlayer    * player);
+
 GST_PLAYER_API
 void         gst_player_set_rate                      (GstPlayer    * player,
                                                        gdouble        rate);
@@ -45,6 +45,16 @@ enum
 struct _GstFragmentPrivate
 {
   GstBuffer *buffer;
+  /* Downloaded data not yet assembled into buffer. The adapter keeps the
+   * original memories chained, so assembling the output buffer does not
+   * copy the data */
+  GstAdapter *adapter;
+  /* Optional preallocated arena, used instead of the adapter when the
+   * expected fragment size is known up front (e.g. from Content-Length).
+   * Produces a single contiguous memory at the cost of one copy */
+  GstMemory *arena;
+  GstMapInfo arena_map;
+  gsize arena_fill;
   GstCaps *caps;
   GMutex lock;
 };
@@ -159,6 +169,7 @@ gst_fragment_init (GstFragment * fragment)
 
   g_mutex_init (&fragment->priv->lock);
   priv->buffer = NULL;
+  priv->adapter = gst_adapter_new ();
   fragment->download_start_time = gst_util_get_timestamp ();
   fragment->start_time = 0;
   fragment->stop_time = 0;
@@ -200,6 +211,17 @@ gst_fragment_dispose (GObject * object)
     priv->buffer = NULL;
   }
 
+  if (priv->adapter != NULL) {
+    g_object_unref (priv->adapter);
+    priv->adapter = NULL;
+  }
+
+  if (priv->arena != NULL) {
+    gst_memory_unmap (priv->arena, &priv->arena_map);
+    gst_memory_unref (priv->arena);
+    priv->arena = NULL;
+  }
+
   if (priv->caps != NULL) {
     gst_caps_unref (priv->caps);
     priv->caps = NULL;
@@ -208,18 +230,51 @@ gst_fragment_dispose (GObject * object)
   G_OBJECT_CLASS (gst_fragment_parent_class)->dispose (object);
 }
 
+/* Assemble the downloaded data into priv->buffer if not done yet.
+ * Called with the fragment lock taken */
+static void
+gst_fragment_ensure_buffer (GstFragment * fragment)
+{
+  GstFragmentPrivate *priv = fragment->priv;
+
+  if (priv->buffer != NULL)
+    return;
+
+  if (priv->arena != NULL) {
+    gst_memory_unmap (priv->arena, &priv->arena_map);
+    gst_memory_resize (priv->arena, 0, priv->arena_fill);
+    priv->buffer = gst_buffer_new ();
+    gst_buffer_append_memory (priv->buffer, priv->arena);
+    priv->arena = NULL;
+  } else {
+    gsize available = gst_adapter_available (priv->adapter);
+
+    if (available == 0)
+      return;
+
+    /* this keeps the original downloaded memories, no copy */
+    priv->buffer = gst_adapter_take_buffer_fast (priv->adapter, available);
+  }
+}
+
 GstBuffer *
 gst_fragment_get_buffer (GstFragment * fragment)
 {
+  GstBuffer *buffer;
+
   g_return_val_if_fail (fragment != NULL, NULL);
 
   if (!fragment->completed)
     return NULL;
-  if (!fragment->priv->buffer)
-    return NULL;
 
-  gst_buffer_ref (fragment->priv->buffer);
-  return fragment->priv->buffer;
+  g_mutex_lock (&fragment->priv->lock);
+  gst_fragment_ensure_buffer (fragment);
+  buffer = fragment->priv->buffer;
+  if (buffer)
+    gst_buffer_ref (buffer);
+  g_mutex_unlock (&fragment->priv->lock);
+
+  return buffer;
 }
 
 void
@@ -241,6 +296,7 @@ gst_fragment_get_caps (GstFragment * fragment)
     return NULL;
 
   g_mutex_lock (&fragment->priv->lock);
+  gst_fragment_ensure_buffer (fragment);
   if (fragment->priv->caps == NULL) {
     guint64 offset, offset_end;
 
@@ -275,9 +331,72 @@ gst_fragment_add_buffer (GstFragment * fragment, GstBuffer * buffer)
 
   GST_DEBUG ("Adding new buffer to the fragment");
   /* We steal the buffers you pass in */
-  if (fragment->priv->buffer == NULL)
-    fragment->priv->buffer = buffer;
-  else
-    fragment->priv->buffer = gst_buffer_append (fragment->priv->buffer, buffer);
+  g_mutex_lock (&fragment->priv->lock);
+  if (fragment->priv->arena != NULL) {
+    gsize size = gst_buffer_get_size (buffer);
+
+    if (fragment->priv->arena_fill + size <= fragment->priv->arena_map.size) {
+      gst_buffer_extract (buffer, 0,
+          fragment->priv->arena_map.data + fragment->priv->arena_fill, size);
+      fragment->priv->arena_fill += size;
+      gst_buffer_unref (buffer);
+      g_mutex_unlock (&fragment->priv->lock);
+      return TRUE;
+    }
+
+    /* The download is larger than announced, move what we have to the
+     * adapter and continue without the arena */
+    GST_DEBUG ("Fragment outgrew its arena (%" G_GSIZE_FORMAT " bytes), "
+        "falling back to chained memories", fragment->priv->arena_map.size);
+    gst_memory_unmap (fragment->priv->arena, &fragment->priv->arena_map);
+    gst_memory_resize (fragment->priv->arena, 0, fragment->priv->arena_fill);
+    if (fragment->priv->arena_fill > 0) {
+      GstBuffer *arena_buffer = gst_buffer_new ();
+
+      gst_buffer_append_memory (arena_buffer, fragment->priv->arena);
+      gst_adapter_push (fragment->priv->adapter, arena_buffer);
+    } else {
+      gst_memory_unref (fragment->priv->arena);
+    }
+    fragment->priv->arena = NULL;
+  }
+
+  gst_adapter_push (fragment->priv->adapter, buffer);
+  g_mutex_unlock (&fragment->priv->lock);
   return TRUE;
 }
+
+/**
+ * gst_fragment_set_expected_size:
+ * @fragment: a #GstFragment
+ * @size: the expected total size of the fragment in bytes
+ *
+ * Preallocates a single contiguous memory of @size bytes (e.g. from the
+ * Content-Length of the response) that the downloaded data is written
+ * into. The assembled buffer is then backed by one memory instead of a
+ * chain of network buffers, which is cheaper for consumers that map the
+ * whole fragment. Without an expected size the fragment keeps the
+ * downloaded memories chained without copying.
+ *
+ * Has no effect once data has been added to the fragment.
+ */
+void
+gst_fragment_set_expected_size (GstFragment * fragment, gsize size)
+{
+  g_return_if_fail (fragment != NULL);
+
+  g_mutex_lock (&fragment->priv->lock);
+  if (fragment->priv->arena == NULL && fragment->priv->buffer == NULL &&
+      gst_adapter_available (fragment->priv->adapter) == 0 && size > 0) {
+    GstMemory *arena = gst_allocator_alloc (NULL, size, NULL);
+
+    if (arena != NULL && gst_memory_map (arena, &fragment->priv->arena_map,
+            GST_MAP_WRITE)) {
+      fragment->priv->arena = arena;
+      fragment->priv->arena_fill = 0;
+    } else if (arena != NULL) {
+      gst_memory_unref (arena);
+    }
+  }
+  g_mutex_unlock (&fragment->priv->lock);
+}
@@ -81,6 +81,9 @@ GstCaps * gst_fragment_get_caps (GstFragment * fragment);
 GST_URI_DOWNLOADER_API
 gboolean gst_fragment_add_buffer (GstFragment *fragment, GstBuffer *buffer);
 
+GST_URI_DOWNLOADER_API
+void gst_fragment_set_expected_size (GstFragment *fragment, gsize size);
+
 GST_URI_DOWNLOADER_API
 GstFragment * gst_fragment_new (void);
 
@@ -30,10 +30,27 @@
 #define GST_CAT_DEFAULT uridownloader_debug
 GST_DEBUG_CATEGORY (uridownloader_debug);
 
+/* A source element kept alive in READY state so its connection to the
+ * server stays warm between fragment downloads */
+typedef struct
+{
+  GstElement *src;
+  gchar *protocol;
+  gchar *host;
+} GstUriDownloaderPoolEntry;
+
+/* Maximum number of idle per-host source elements kept around */
+#define MAX_POOLED_SOURCES 4
+
 struct _GstUriDownloaderPrivate
 {
   /* Fragments fetcher */
   GstElement *urisrc;
+  gchar *urisrc_protocol;
+  gchar *urisrc_host;
+  /* Idle source elements with warm connections, most recently used
+   * first. Protected by the object lock like urisrc */
+  GList *src_pool;
   GstBus *bus;
   GstPad *pad;
   GTimeVal *timeout;
@@ -62,6 +79,8 @@ static GstBusSyncReply gst_uri_downloader_bus_handler (GstBus * bus,
 static gboolean gst_uri_downloader_ensure_src (GstUriDownloader * downloader,
     const gchar * uri);
 static void gst_uri_downloader_destroy_src (GstUriDownloader * downloader);
+static void gst_uri_downloader_pool_entry_free (GstUriDownloaderPoolEntry *
+    entry);
 
 static GstStaticPadTemplate sinkpadtemplate = GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_SINK,
@@ -118,6 +137,12 @@ gst_uri_downloader_dispose (GObject * object)
 
   gst_uri_downloader_destroy_src (downloader);
 
+  if (downloader->priv->src_pool) {
+    g_list_free_full (downloader->priv->src_pool,
+        (GDestroyNotify) gst_uri_downloader_pool_entry_free);
+    downloader->priv->src_pool = NULL;
+  }
+
   if (downloader->priv->bus != NULL) {
     gst_object_unref (downloader->priv->bus);
     downloader->priv->bus = NULL;
@@ -207,9 +232,31 @@ gst_uri_downloader_sink_event (GstPad * pad, GstObject * parent,
       if (gst_structure_has_name (str, "http-headers")) {
         GST_OBJECT_LOCK (downloader);
         if (downloader->priv->download != NULL) {
+          const GstStructure *response_headers;
+          const GValue *response_value;
+
           if (downloader->priv->download->headers)
             gst_structure_free (downloader->priv->download->headers);
           downloader->priv->download->headers = gst_structure_copy (str);
+
+          /* Size the fragment's arena from Content-Length so the
+           * download ends up in a single contiguous memory */
+          response_value = gst_structure_get_value (str, "response-headers");
+          if (response_value != NULL
+              && (response_headers = gst_value_get_structure (response_value))) {
+            guint64 content_length = 0;
+            const gchar *field;
+
+            if (!gst_structure_get_uint64 (response_headers, "Content-Length",
+                    &content_length)
+                && (field = gst_structure_get_string (response_headers,
+                        "Content-Length")))
+              content_length = g_ascii_strtoull (field, NULL, 10);
+
+            if (content_length > 0)
+              gst_fragment_set_expected_size (downloader->priv->download,
+                  content_length);
+          }
         }
         GST_OBJECT_UNLOCK (downloader);
       }
@@ -398,36 +445,106 @@ gst_uri_downloader_set_range (GstUriDownloader * downloader,
   return TRUE;
 }
 
+static void
+gst_uri_downloader_pool_entry_free (GstUriDownloaderPoolEntry * entry)
+{
+  gst_element_set_state (entry->src, GST_STATE_NULL);
+  gst_object_unref (entry->src);
+  g_free (entry->protocol);
+  g_free (entry->host);
+  g_slice_free (GstUriDownloaderPoolEntry, entry);
+}
+
+/* Move the current source element to the pool of warm sources instead of
+ * destroying it, so its connection can be re-used when we come back to
+ * the same host. Called with the object lock taken */
+static void
+gst_uri_downloader_park_src (GstUriDownloader * downloader)
+{
+  GstUriDownloaderPoolEntry *entry;
+
+  if (!downloader->priv->urisrc)
+    return;
+
+  entry = g_slice_new (GstUriDownloaderPoolEntry);
+  entry->src = downloader->priv->urisrc;
+  entry->protocol = downloader->priv->urisrc_protocol;
+  entry->host = downloader->priv->urisrc_host;
+  downloader->priv->urisrc = NULL;
+  downloader->priv->urisrc_protocol = NULL;
+  downloader->priv->urisrc_host = NULL;
+
+  GST_DEBUG_OBJECT (downloader, "Parking source element %s for host %s",
+      GST_ELEMENT_NAME (entry->src), GST_STR_NULL (entry->host));
+  downloader->priv->src_pool =
+      g_list_prepend (downloader->priv->src_pool, entry);
+
+  /* Drop the least recently used entry when over budget */
+  if (g_list_length (downloader->priv->src_pool) > MAX_POOLED_SOURCES) {
+    GList *last = g_list_last (downloader->priv->src_pool);
+
+    GST_DEBUG_OBJECT (downloader, "Source pool full, dropping host %s",
+        GST_STR_NULL (((GstUriDownloaderPoolEntry *) last->data)->host));
+    gst_uri_downloader_pool_entry_free (last->data);
+    downloader->priv->src_pool =
+        g_list_delete_link (downloader->priv->src_pool, last);
+  }
+}
+
 static gboolean
 gst_uri_downloader_ensure_src (GstUriDownloader * downloader, const gchar * uri)
 {
+  gchar *new_protocol, *new_host = NULL;
+  GstUri *parsed;
+
+  new_protocol = gst_uri_get_protocol (uri);
+  parsed = gst_uri_from_string (uri);
+  if (parsed) {
+    new_host = g_strdup (gst_uri_get_host (parsed));
+    gst_uri_unref (parsed);
+  }
+
   if (downloader->priv->urisrc) {
-    gchar *old_protocol, *new_protocol;
-    gchar *old_uri;
+    if (g_strcmp0 (downloader->priv->urisrc_protocol, new_protocol) != 0 ||
+        g_strcmp0 (downloader->priv->urisrc_host, new_host) != 0) {
+      /* keep the connection warm in case we come back to that host */
+      gst_uri_downloader_park_src (downloader);
+    }
+  }
+
+  if (!downloader->priv->urisrc) {
+    /* look for a warm source element for this host */
+    GList *iter;
+
+    for (iter = downloader->priv->src_pool; iter; iter = g_list_next (iter)) {
+      GstUriDownloaderPoolEntry *entry = iter->data;
+
+      if (g_strcmp0 (entry->protocol, new_protocol) == 0 &&
+          g_strcmp0 (entry->host, new_host) == 0) {
+        GST_DEBUG_OBJECT (downloader, "Re-using warm source element for "
+            "host %s", GST_STR_NULL (new_host));
+        downloader->priv->urisrc = entry->src;
+        downloader->priv->urisrc_protocol = entry->protocol;
+        downloader->priv->urisrc_host = entry->host;
+        downloader->priv->src_pool =
+            g_list_delete_link (downloader->priv->src_pool, iter);
+        g_slice_free (GstUriDownloaderPoolEntry, entry);
+        break;
+      }
+    }
+  }
 
-    old_uri =
-        gst_uri_handler_get_uri (GST_URI_HANDLER (downloader->priv->urisrc));
-    old_protocol = gst_uri_get_protocol (old_uri);
-    new_protocol = gst_uri_get_protocol (uri);
+  if (downloader->priv->urisrc) {
+    GError *err = NULL;
 
-    if (!g_str_equal (old_protocol, new_protocol)) {
+    GST_DEBUG_OBJECT (downloader, "Re-using old source element");
+    if (!gst_uri_handler_set_uri
+        (GST_URI_HANDLER (downloader->priv->urisrc), uri, &err)) {
+      GST_DEBUG_OBJECT (downloader,
+          "Failed to re-use old source element: %s", err->message);
+      g_clear_error (&err);
       gst_uri_downloader_destroy_src (downloader);
-      GST_DEBUG_OBJECT (downloader, "Can't re-use old source element");
-    } else {
-      GError *err = NULL;
-
-      GST_DEBUG_OBJECT (downloader, "Re-using old source element");
-      if (!gst_uri_handler_set_uri
-          (GST_URI_HANDLER (downloader->priv->urisrc), uri, &err)) {
-        GST_DEBUG_OBJECT (downloader,
-            "Failed to re-use old source element: %s", err->message);
-        g_clear_error (&err);
-        gst_uri_downloader_destroy_src (downloader);
-      }
     }
-    g_free (old_uri);
-    g_free (old_protocol);
-    g_free (new_protocol);
   }
 
   if (!downloader->priv->urisrc) {
@@ -441,9 +558,21 @@ gst_uri_downloader_ensure_src (GstUriDownloader * downloader, const gchar * uri)
        * should take it.
        */
       gst_object_ref_sink (downloader->priv->urisrc);
+      downloader->priv->urisrc_protocol = new_protocol;
+      downloader->priv->urisrc_host = new_host;
+      new_protocol = NULL;
+      new_host = NULL;
     }
+  } else if (downloader->priv->urisrc_protocol == NULL) {
+    downloader->priv->urisrc_protocol = new_protocol;
+    downloader->priv->urisrc_host = new_host;
+    new_protocol = NULL;
+    new_host = NULL;
   }
 
+  g_free (new_protocol);
+  g_free (new_host);
+
   return downloader->priv->urisrc != NULL;
 }
 
@@ -456,6 +585,10 @@ gst_uri_downloader_destroy_src (GstUriDownloader * downloader)
   gst_element_set_state (downloader->priv->urisrc, GST_STATE_NULL);
   gst_object_unref (downloader->priv->urisrc);
   downloader->priv->urisrc = NULL;
+  g_free (downloader->priv->urisrc_protocol);
+  downloader->priv->urisrc_protocol = NULL;
+  g_free (downloader->priv->urisrc_host);
+  downloader->priv->urisrc_host = NULL;
 }
 
 static gboolean
@@ -207,6 +207,30 @@ gst_accurip_finalize (GObject * object)
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
+/* Multiply-accumulate over a run of samples with no per-sample
+ * exceptions. Keeping the state in locals lets the compiler unroll and
+ * vectorize this loop. */
+static void
+gst_accurip_crc_block (GstAccurip * accurip, const guint32 * data,
+    guint nsamples)
+{
+  guint64 num_samples = accurip->num_samples;
+  guint32 crc = accurip->crc;
+  guint32 crc_v2 = accurip->crc_v2;
+  guint i;
+
+  for (i = 0; i < nsamples; i++) {
+    guint64 mult_sample = data[i] * (num_samples + 1 + i);
+
+    crc += (guint32) mult_sample;
+    crc_v2 += (guint32) mult_sample + (guint32) (mult_sample >> 32);
+  }
+
+  accurip->num_samples = num_samples + nsamples;
+  accurip->crc = crc;
+  accurip->crc_v2 = crc_v2;
+}
+
 static GstFlowReturn
 gst_accurip_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
 {
@@ -232,6 +256,16 @@ gst_accurip_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
   for (i = 0; i < nsamples; i++) {
     guint64 mult_sample;
 
+    /* Only the skipped region at the start of the first track and the
+     * CRC ring of the last track need per-sample handling; everything
+     * else goes through the branch-free block kernel in one go.
+     */
+    if (!accurip->is_last && !(accurip->is_first
+            && accurip->num_samples + 1 < IGNORED_SAMPLES_COUNT)) {
+      gst_accurip_crc_block (accurip, data + i, nsamples - i);
+      break;
+    }
+
     /* the AccurateRip algorithm counts samples starting from 1 instead
      * of 0, that's why we start by incrementing the number of samples
      * before doing the calculations
@@ -167,10 +167,36 @@ read_sample (const guint8 * data)
   return *((gint16 *) & val);
 }
 
+/* Decode one 4-bit MS ADPCM code into a sample, updating the channel's
+   idelta state. Coefficients are passed in so callers can hoist the
+   predictor table lookups out of the sample loop. */
+static inline gint16
+adpcmdec_decode_ms_sample (int bytecode, gint16 * idelta, int coeff1,
+    int coeff2, gint16 s1, gint16 s2)
+{
+  int delta = *idelta;
+  int predict;
+  int current;
+
+  *idelta = (AdaptationTable[bytecode] * delta) >> 8;
+  if (*idelta < 16)
+    *idelta = 16;
+
+  /* Bytecode is used above as an index into the table. Below, it's used
+     as a signed 4-bit value; convert appropriately */
+  if (bytecode & 0x8)
+    bytecode -= 0x10;
+
+  predict = ((s1 * coeff1) + (s2 * coeff2)) >> 8;
+  current = (bytecode * delta) + predict;
+
+  return CLAMP (current, G_MININT16, G_MAXINT16);
+}
+
 /* Decode a single block of data from 'data', storing 'n_samples' decoded 16 bit
    samples in 'samples'.
 
-   All buffer lengths have been verified by the caller 
+   All buffer lengths have been verified by the caller
  */
 static gboolean
 adpcmdec_decode_ms_block (ADPCMDec * dec, int n_samples, const guint8 * data,
@@ -178,6 +204,7 @@ adpcmdec_decode_ms_block (ADPCMDec * dec, int n_samples, const guint8 * data,
 {
   gint16 pred[2];
   gint16 idelta[2];
+  int coeff1[2], coeff2[2];
   int idx;                      /* Current byte offset in 'data' */
   int i;                        /* Current sample index in 'samples' */
 
@@ -211,38 +238,43 @@ adpcmdec_decode_ms_block (ADPCMDec * dec, int n_samples, const guint8 * data,
       return FALSE;
     }
   }
-  for (; i < n_samples; i++) {
-    int chan = i % dec->channels;
-    int bytecode;
-    int delta;
-    int current;
-    int predict;
-    if (i % 2 == 0) {
-      bytecode = (data[idx] >> 4) & 0x0F;
-    } else {
-      bytecode = data[idx] & 0x0F;
+  coeff1[0] = AdaptCoeff1[pred[0]];
+  coeff2[0] = AdaptCoeff2[pred[0]];
+  if (dec->channels == 2) {
+    coeff1[1] = AdaptCoeff1[pred[1]];
+    coeff2[1] = AdaptCoeff2[pred[1]];
+  }
+
+  /* Each input byte carries two codes; consuming one byte per iteration
+     avoids recomputing the nibble and channel selection per sample. In
+     stereo blocks the high nibble is the left channel and the low nibble
+     the right one. */
+  if (dec->channels == 1) {
+    for (; i + 1 < n_samples; i += 2) {
+      samples[i] = adpcmdec_decode_ms_sample ((data[idx] >> 4) & 0x0F,
+          &idelta[0], coeff1[0], coeff2[0], samples[i - 1], samples[i - 2]);
+      samples[i + 1] = adpcmdec_decode_ms_sample (data[idx] & 0x0F,
+          &idelta[0], coeff1[0], coeff2[0], samples[i], samples[i - 1]);
       idx++;
     }
+  } else {
+    for (; i + 1 < n_samples; i += 2) {
+      samples[i] = adpcmdec_decode_ms_sample ((data[idx] >> 4) & 0x0F,
+          &idelta[0], coeff1[0], coeff2[0], samples[i - 2], samples[i - 4]);
+      samples[i + 1] = adpcmdec_decode_ms_sample (data[idx] & 0x0F,
+          &idelta[1], coeff1[1], coeff2[1], samples[i - 1], samples[i - 3]);
+      idx++;
+    }
+  }
 
-    delta = idelta[chan];
-    idelta[chan] = (AdaptationTable[bytecode] * delta) >> 8;
-    if (idelta[chan] < 16)
-      idelta[chan] = 16;
-
-    /* Bytecode is used above as an index into the table. Below, it's used
-       as a signed 4-bit value; convert appropriately */
-    if (bytecode & 0x8)
-      bytecode -= 0x10;
-
-    predict = ((samples[i - dec->channels] * AdaptCoeff1[pred[chan]]) +
-        (samples[i - 2 * dec->channels] * AdaptCoeff2[pred[chan]])
-        ) >> 8;
-
-    current = (bytecode * delta) + predict;
-
-    /* Clamp to 16 bits, store decoded sample */
-    samples[i] = CLAMP (current, G_MININT16, G_MAXINT16);
+  /* Blocks always hold an even sample count, but be safe with a
+     truncated trailing byte */
+  if (i < n_samples) {
+    samples[i] = adpcmdec_decode_ms_sample ((data[idx] >> 4) & 0x0F,
+        &idelta[0], coeff1[0], coeff2[0], samples[i - dec->channels],
+        samples[i - 2 * dec->channels]);
   }
+
   return TRUE;
 }
 
@@ -260,10 +292,33 @@ static const int ima_step_size[89] = {
   32767
 };
 
+/* Precomputed per (step index, bytecode) sample difference and next step
+   index, filled in once at registration time. Looking these up replaces a
+   multiply, a divide, a sign branch and a CLAMP per decoded nibble. */
+static gint32 ima_diff_lookup[89][16];
+static guint8 ima_index_lookup[89][16];
+
+static void
+adpcmdec_init_ima_tables (void)
+{
+  int s, b;
+
+  for (s = 0; s < 89; s++) {
+    int step = ima_step_size[s];
+
+    for (b = 0; b < 16; b++) {
+      int diff = (2 * (b & 0x7) * step + step) / 8;
+
+      ima_diff_lookup[s][b] = (b & 8) ? -diff : diff;
+      ima_index_lookup[s][b] = CLAMP (s + ima_indx_adjust[b], 0, 88);
+    }
+  }
+}
+
 /* Decode a single block of data from 'data', storing 'n_samples' decoded 16 bit
    samples in 'samples'.
 
-   All buffer lengths have been verified by the caller 
+   All buffer lengths have been verified by the caller
  */
 static gboolean
 adpcmdec_decode_ima_block (ADPCMDec * dec, int n_samples, const guint8 * data,
@@ -295,30 +350,29 @@ adpcmdec_decode_ima_block (ADPCMDec * dec, int n_samples, const guint8 * data,
 
   while (i < n_samples) {
     for (channel = 0; channel < dec->channels; channel++) {
+      gint16 stepidx = stepindex[channel];
+
       sample = i + channel;
-      for (j = 0; j < 8; j++) {
-        int bytecode;
-        int step;
-        int diff;
-
-        if (j % 2 == 0) {
-          bytecode = data[idx] & 0x0F;
-        } else {
-          bytecode = (data[idx] >> 4) & 0x0F;
-          idx++;
-        }
-        step = ima_step_size[stepindex[channel]];
-        diff = (2 * (bytecode & 0x7) * step + step) / 8;
-        if (bytecode & 8)
-          diff = -diff;
+      /* 8 codes per channel per chunk, two per byte (low nibble first) */
+      for (j = 0; j < 4; j++) {
+        int bytecode = data[idx] & 0x0F;
+
+        samples[sample] =
+            CLAMP (samples[sample - dec->channels] +
+            ima_diff_lookup[stepidx][bytecode], G_MININT16, G_MAXINT16);
+        stepidx = ima_index_lookup[stepidx][bytecode];
+        sample += dec->channels;
+
+        bytecode = (data[idx] >> 4) & 0x0F;
+        idx++;
 
         samples[sample] =
-            CLAMP (samples[sample - dec->channels] + diff, G_MININT16,
-            G_MAXINT16);
-        stepindex[channel] =
-            CLAMP (stepindex[channel] + ima_indx_adjust[bytecode], 0, 88);
+            CLAMP (samples[sample - dec->channels] +
+            ima_diff_lookup[stepidx][bytecode], G_MININT16, G_MAXINT16);
+        stepidx = ima_index_lookup[stepidx][bytecode];
         sample += dec->channels;
       }
+      stepindex[channel] = stepidx;
     }
     i += 8 * dec->channels;
   }
@@ -342,7 +396,9 @@ adpcmdec_decode_block (ADPCMDec * dec, const guint8 * data, int blocksize)
       goto exit;
     samples = (blocksize - 7 * dec->channels) * 2 + 2 * dec->channels;
     outsize = 2 * samples;
-    outbuf = gst_buffer_new_and_alloc (outsize);
+    outbuf =
+        gst_audio_decoder_allocate_output_buffer (GST_AUDIO_DECODER (dec),
+        outsize);
 
     gst_buffer_map (outbuf, &omap, GST_MAP_WRITE);
     res = adpcmdec_decode_ms_block (dec, samples, data, (gint16 *) omap.data);
@@ -354,7 +410,9 @@ adpcmdec_decode_block (ADPCMDec * dec, const guint8 * data, int blocksize)
       goto exit;
     samples = (blocksize - 4 * dec->channels) * 2 + dec->channels;
     outsize = 2 * samples;
-    outbuf = gst_buffer_new_and_alloc (outsize);
+    outbuf =
+        gst_audio_decoder_allocate_output_buffer (GST_AUDIO_DECODER (dec),
+        outsize);
 
     gst_buffer_map (outbuf, &omap, GST_MAP_WRITE);
     res = adpcmdec_decode_ima_block (dec, samples, data, (gint16 *) omap.data);
@@ -486,6 +544,7 @@ static gboolean
 plugin_init (GstPlugin * plugin)
 {
   GST_DEBUG_CATEGORY_INIT (adpcmdec_debug, "adpcmdec", 0, "ADPCM Decoders");
+  adpcmdec_init_ima_tables ();
   if (!gst_element_register (plugin, "adpcmdec", GST_RANK_PRIMARY,
           GST_TYPE_ADPCM_DEC)) {
     return FALSE;
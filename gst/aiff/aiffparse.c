@@ -103,6 +103,9 @@ GST_STATIC_PAD_TEMPLATE ("src",
 
 #define MAX_BUFFER_SIZE 4096
 
+/* number of output buffers fetched with a single pull in pull mode */
+#define READAHEAD_CHUNKS 16
+
 #define gst_aiff_parse_parent_class parent_class
 G_DEFINE_TYPE (GstAiffParse, gst_aiff_parse, GST_TYPE_ELEMENT);
 
@@ -154,6 +157,8 @@ gst_aiff_parse_reset (GstAiffParse * aiff)
   if (aiff->seek_event)
     gst_event_unref (aiff->seek_event);
   aiff->seek_event = NULL;
+  gst_buffer_replace (&aiff->readahead, NULL);
+  aiff->readahead_offset = 0;
   if (aiff->adapter) {
     gst_adapter_clear (aiff->adapter);
     aiff->adapter = NULL;
@@ -1302,6 +1307,57 @@ gst_aiff_parse_send_event (GstElement * element, GstEvent * event)
   return res;
 }
 
+/*
+ * Pulls @size bytes at @offset for the data streaming loop. Instead of
+ * issuing one gst_pad_pull_range() per output buffer, a window of
+ * READAHEAD_CHUNKS output buffers is pulled at once and the output
+ * buffers are sliced from it as sub-buffers sharing its memory, so
+ * sequential scanning does a fraction of the upstream requests.
+ */
+static GstFlowReturn
+gst_aiff_parse_pull_data (GstAiffParse * aiff, guint64 offset, guint64 size,
+    GstBuffer ** buf)
+{
+  GstFlowReturn res;
+  guint64 ra_size;
+
+  if (aiff->readahead != NULL) {
+    gsize ra_avail = gst_buffer_get_size (aiff->readahead);
+
+    if (offset >= aiff->readahead_offset
+        && offset + size <= aiff->readahead_offset + ra_avail) {
+      *buf = gst_buffer_copy_region (aiff->readahead, GST_BUFFER_COPY_MEMORY,
+          offset - aiff->readahead_offset, size);
+      return GST_FLOW_OK;
+    }
+    /* seeked or short window, refill */
+    gst_buffer_replace (&aiff->readahead, NULL);
+  }
+
+  ra_size = MIN (size * READAHEAD_CHUNKS, aiff->dataleft);
+  ra_size = MAX (ra_size, size);
+
+  GST_LOG_OBJECT (aiff, "Pulling readahead window of %" G_GUINT64_FORMAT
+      " bytes at offset %" G_GUINT64_FORMAT, ra_size, offset);
+
+  res = gst_pad_pull_range (aiff->sinkpad, offset, ra_size, &aiff->readahead);
+  if (res != GST_FLOW_OK)
+    return res;
+
+  aiff->readahead_offset = offset;
+
+  if (gst_buffer_get_size (aiff->readahead) < size) {
+    /* short read near EOS, hand out what we got */
+    *buf = aiff->readahead;
+    aiff->readahead = NULL;
+    return GST_FLOW_OK;
+  }
+
+  *buf = gst_buffer_copy_region (aiff->readahead, GST_BUFFER_COPY_MEMORY,
+      0, size);
+  return GST_FLOW_OK;
+}
+
 static GstFlowReturn
 gst_aiff_parse_stream_data (GstAiffParse * aiff)
 {
@@ -1349,7 +1405,7 @@ iterate_adapter:
 
     buf = gst_adapter_take_buffer (aiff->adapter, desired);
   } else {
-    if ((res = gst_pad_pull_range (aiff->sinkpad, aiff->offset,
+    if ((res = gst_aiff_parse_pull_data (aiff, aiff->offset,
                 desired, &buf)) != GST_FLOW_OK)
       goto pull_error;
   }
@@ -84,6 +84,11 @@ struct _GstAiffParse {
   guint bytes_per_sample;
   guint max_buf_size;
 
+  /* pull-mode readahead window: one larger pull upstream serves
+   * several output buffers as zero-copy sub-buffers */
+  GstBuffer *readahead;
+  guint64 readahead_offset;
+
   guint32   total_frames;
 
   guint32 ssnd_offset;
@@ -198,6 +198,12 @@ gst_asf_mux_reset (GstAsfMux * asfmux)
   asfmux->payloads = NULL;
   asfmux->payload_data_size = 0;
 
+  if (asfmux->packet_pool) {
+    gst_buffer_pool_set_active (asfmux->packet_pool, FALSE);
+    gst_object_unref (asfmux->packet_pool);
+    asfmux->packet_pool = NULL;
+  }
+
   asfmux->file_id.v1 = 0;
   asfmux->file_id.v2 = 0;
   asfmux->file_id.v3 = 0;
@@ -1412,17 +1418,19 @@ static void
 gst_asf_mux_add_simple_index_entry (GstAsfMux * asfmux,
     GstAsfVideoPad * videopad)
 {
-  SimpleIndexEntry *entry = NULL;
+  SimpleIndexEntry entry;
   GST_DEBUG_OBJECT (asfmux, "Adding new simple index entry "
       "packet number: %" G_GUINT32_FORMAT ", "
       "packet count: %" G_GUINT16_FORMAT,
       videopad->last_keyframe_packet, videopad->last_keyframe_packet_count);
-  entry = g_malloc0 (sizeof (SimpleIndexEntry));
-  entry->packet_number = videopad->last_keyframe_packet;
-  entry->packet_count = videopad->last_keyframe_packet_count;
-  if (entry->packet_count > videopad->max_keyframe_packet_count)
-    videopad->max_keyframe_packet_count = entry->packet_count;
-  videopad->simple_index = g_slist_append (videopad->simple_index, entry);
+  entry.packet_number = videopad->last_keyframe_packet;
+  entry.packet_count = videopad->last_keyframe_packet_count;
+  if (entry.packet_count > videopad->max_keyframe_packet_count)
+    videopad->max_keyframe_packet_count = entry.packet_count;
+  if (videopad->simple_index == NULL)
+    videopad->simple_index =
+        g_array_sized_new (FALSE, FALSE, sizeof (SimpleIndexEntry), 256);
+  g_array_append_val (videopad->simple_index, entry);
 }
 
 /**
@@ -1480,7 +1488,15 @@ gst_asf_mux_flush_payloads (GstAsfMux * asfmux)
 
   GST_LOG_OBJECT (asfmux, "Flushing payloads");
 
-  buf = gst_buffer_new_and_alloc (asfmux->packet_size);
+  if (asfmux->packet_pool) {
+    GstFlowReturn ret;
+
+    ret = gst_buffer_pool_acquire_buffer (asfmux->packet_pool, &buf, NULL);
+    if (ret != GST_FLOW_OK)
+      return ret;
+  } else {
+    buf = gst_buffer_new_and_alloc (asfmux->packet_size);
+  }
   gst_buffer_map (buf, &map, GST_MAP_WRITE);
   memset (map.data, 0, asfmux->packet_size);
 
@@ -1691,12 +1707,12 @@ stream_number_compare (gconstpointer a, gconstpointer b)
 static GstFlowReturn
 gst_asf_mux_push_simple_index (GstAsfMux * asfmux, GstAsfVideoPad * pad)
 {
+  guint32 entries_count = pad->simple_index ? pad->simple_index->len : 0;
   guint64 object_size = ASF_SIMPLE_INDEX_OBJECT_SIZE +
-      g_slist_length (pad->simple_index) * ASF_SIMPLE_INDEX_ENTRY_SIZE;
+      entries_count * ASF_SIMPLE_INDEX_ENTRY_SIZE;
   GstBuffer *buf;
-  GSList *walk;
+  guint i;
   guint8 *data;
-  guint32 entries_count = g_slist_length (pad->simple_index);
   GstMapInfo map;
   gsize bufsize;
 
@@ -1720,8 +1736,9 @@ gst_asf_mux_push_simple_index (GstAsfMux * asfmux, GstAsfVideoPad * pad)
       G_GUINT32_FORMAT, object_size, pad->time_interval,
       pad->max_keyframe_packet_count, entries_count);
 
-  for (walk = pad->simple_index; walk; walk = g_slist_next (walk)) {
-    SimpleIndexEntry *entry = (SimpleIndexEntry *) walk->data;
+  for (i = 0; i < entries_count; i++) {
+    SimpleIndexEntry *entry =
+        &g_array_index (pad->simple_index, SimpleIndexEntry, i);
     GST_DEBUG_OBJECT (asfmux, "Simple index entry: packet_number:%"
         G_GUINT32_FORMAT " packet_count:%" G_GUINT16_FORMAT,
         entry->packet_number, entry->packet_count);
@@ -2092,14 +2109,8 @@ gst_asf_mux_pad_reset (GstAsfPad * pad)
     videopad->max_keyframe_packet_count = 0;
     videopad->next_index_time = 0;
     videopad->time_interval = DEFAULT_SIMPLE_INDEX_TIME_INTERVAL;
-    if (videopad->simple_index) {
-      GSList *walk;
-      for (walk = videopad->simple_index; walk; walk = g_slist_next (walk)) {
-        g_free (walk->data);
-        walk->data = NULL;
-      }
-      g_slist_free (videopad->simple_index);
-    }
+    if (videopad->simple_index)
+      g_array_free (videopad->simple_index, TRUE);
     videopad->simple_index = NULL;
   }
 }
@@ -2413,6 +2424,7 @@ gst_asf_mux_change_state (GstElement * element, GstStateChange transition)
 {
   GstAsfMux *asfmux;
   GstStateChangeReturn ret;
+  GstStructure *config;
 
   asfmux = GST_ASF_MUX (element);
 
@@ -2425,6 +2437,19 @@ gst_asf_mux_change_state (GstElement * element, GstStateChange transition)
       asfmux->packet_size = asfmux->prop_packet_size;
       asfmux->preroll = asfmux->prop_preroll;
       asfmux->merge_stream_tags = asfmux->prop_merge_stream_tags;
+      /* data packets all have the same size, recycle their
+       * memory instead of allocating each packet */
+      asfmux->packet_pool = gst_buffer_pool_new ();
+      config = gst_buffer_pool_get_config (asfmux->packet_pool);
+      gst_buffer_pool_config_set_params (config, NULL, asfmux->packet_size,
+          0, 0);
+      if (!gst_buffer_pool_set_config (asfmux->packet_pool, config) ||
+          !gst_buffer_pool_set_active (asfmux->packet_pool, TRUE)) {
+        GST_WARNING_OBJECT (asfmux, "Failed to activate packet pool, "
+            "falling back to unpooled allocation");
+        gst_object_unref (asfmux->packet_pool);
+        asfmux->packet_pool = NULL;
+      }
       gst_collect_pads_start (asfmux->collect);
       break;
     case GST_STATE_CHANGE_PAUSED_TO_PLAYING:
@@ -2432,6 +2457,11 @@ gst_asf_mux_change_state (GstElement * element, GstStateChange transition)
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       gst_collect_pads_stop (asfmux->collect);
       asfmux->state = GST_ASF_MUX_STATE_NONE;
+      if (asfmux->packet_pool) {
+        gst_buffer_pool_set_active (asfmux->packet_pool, FALSE);
+        gst_object_unref (asfmux->packet_pool);
+        asfmux->packet_pool = NULL;
+      }
       break;
     default:
       break;
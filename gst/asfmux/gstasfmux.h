@@ -86,8 +86,8 @@ struct _GstAsfVideoPad
 
   gst_riff_strf_vids vidinfo;
 
-  /* Simple Index Entries */
-  GSList *simple_index;
+  /* Simple Index Entries, stored inline in the array */
+  GArray *simple_index;
   gboolean has_keyframe;        /* if we have received one at least */
   guint32 last_keyframe_packet;
   guint16 last_keyframe_packet_count;
@@ -140,6 +140,9 @@ struct _GstAsfMux
 
   GstClockTime first_ts;
 
+  /* pool for the fixed-size data packets */
+  GstBufferPool *packet_pool;
+
   /* pads */
   GstPad *srcpad;
 
@@ -359,6 +359,7 @@ gst_audio_buffer_split_output (GstAudioBufferSplit * self, gboolean force,
 {
   gint size, avail;
   GstFlowReturn ret = GST_FLOW_OK;
+  GstBufferList *list = NULL;
   GstClockTime resync_time;
 
   resync_time = self->resync_time;
@@ -376,7 +377,10 @@ gst_audio_buffer_split_output (GstAudioBufferSplit * self, gboolean force,
     GstClockTime resync_time_diff;
 
     size = MIN (size, avail);
-    buffer = gst_adapter_take_buffer (self->adapter, size);
+    /* take the chunk as a list of memory references into the input
+     * buffers instead of flattening it; the adapter itself keeps the
+     * remainder crossing buffer boundaries without copying */
+    buffer = gst_adapter_take_buffer_fast (self->adapter, size);
 
     /* After a reset we have to set the discont flag */
     if (self->current_offset == 0)
@@ -415,9 +419,9 @@ gst_audio_buffer_split_output (GstAudioBufferSplit * self, gboolean force,
         GST_TIME_ARGS (GST_BUFFER_TIMESTAMP (buffer)),
         GST_TIME_ARGS (GST_BUFFER_DURATION (buffer)), size / bpf);
 
-    ret = gst_pad_push (self->srcpad, buffer);
-    if (ret != GST_FLOW_OK)
-      break;
+    if (!list)
+      list = gst_buffer_list_new ();
+    gst_buffer_list_add (list, buffer);
 
     /* Update the size based on the accumulated error we have now after
      * taking out a buffer. Same code as above */
@@ -427,6 +431,10 @@ gst_audio_buffer_split_output (GstAudioBufferSplit * self, gboolean force,
       size += bpf;
   }
 
+  /* push everything that became ready in one go */
+  if (list)
+    ret = gst_pad_push_list (self->srcpad, list);
+
   return ret;
 }
 
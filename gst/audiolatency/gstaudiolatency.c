@@ -55,6 +55,8 @@
 #include "config.h"
 #endif
 
+#include <math.h>
+
 #include "gstaudiolatency.h"
 
 #define AUDIOLATENCY_CAPS "audio/x-raw, " \
@@ -87,11 +89,13 @@ enum
   PROP_0,
   PROP_PRINT_LATENCY,
   PROP_LAST_LATENCY,
-  PROP_AVERAGE_LATENCY
+  PROP_AVERAGE_LATENCY,
+  PROP_JITTER
 };
 
 static gint64 gst_audiolatency_get_latency (GstAudioLatency * self);
 static gint64 gst_audiolatency_get_average_latency (GstAudioLatency * self);
+static gint64 gst_audiolatency_get_jitter (GstAudioLatency * self);
 static GstFlowReturn gst_audiolatency_sink_chain (GstPad * pad,
     GstObject * parent, GstBuffer * buffer);
 static GstPadProbeReturn gst_audiolatency_src_probe (GstPad * pad,
@@ -113,6 +117,9 @@ gst_audiolatency_get_property (GObject * object,
     case PROP_AVERAGE_LATENCY:
       g_value_set_int64 (value, gst_audiolatency_get_average_latency (self));
       break;
+    case PROP_JITTER:
+      g_value_set_int64 (value, gst_audiolatency_get_jitter (self));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -159,6 +166,20 @@ gst_audiolatency_class_init (GstAudioLatencyClass * klass)
           "The running average latency, in microseconds", 0,
           G_USEC_PER_SEC, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAudioLatency:jitter:
+   *
+   * The standard deviation of the measurements that make up the running
+   * average, in microseconds.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_JITTER,
+      g_param_spec_int64 ("jitter", "Latency jitter",
+          "The standard deviation of the last measured latencies,"
+          " in microseconds", 0,
+          G_USEC_PER_SEC, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_add_static_pad_template (gstelement_class, &src_template);
   gst_element_class_add_static_pad_template (gstelement_class, &sink_template);
 
@@ -247,10 +268,42 @@ gst_audiolatency_get_average_latency (GstAudioLatency * self)
   return average;
 }
 
+static gint64
+gst_audiolatency_get_jitter_unlocked (GstAudioLatency * self)
+{
+  int ii, n = 0;
+  gint64 average, variance = 0;
+
+  average = gst_audiolatency_get_average_latency_unlocked (self);
+  for (ii = 0; ii < GST_AUDIOLATENCY_NUM_LATENCIES; ii++) {
+    gint64 d;
+
+    if (G_LIKELY (self->latencies[ii] <= 0))
+      continue;
+    d = self->latencies[ii] - average;
+    variance += d * d;
+    n += 1;
+  }
+
+  return (gint64) sqrt (variance / MAX (n, 1));
+}
+
+static gint64
+gst_audiolatency_get_jitter (GstAudioLatency * self)
+{
+  gint64 jitter;
+
+  GST_OBJECT_LOCK (self);
+  jitter = gst_audiolatency_get_jitter_unlocked (self);
+  GST_OBJECT_UNLOCK (self);
+
+  return jitter;
+}
+
 static void
 gst_audiolatency_set_latency (GstAudioLatency * self, gint64 latency)
 {
-  gint64 avg_latency;
+  gint64 avg_latency, jitter;
 
   GST_OBJECT_LOCK (self);
   self->latencies[self->next_latency_idx] = latency;
@@ -261,17 +314,20 @@ gst_audiolatency_set_latency (GstAudioLatency * self, gint64 latency)
     self->next_latency_idx = 0;
 
   avg_latency = gst_audiolatency_get_average_latency_unlocked (self);
+  jitter = gst_audiolatency_get_jitter_unlocked (self);
 
   if (self->print_latency)
-    g_print ("last latency: %" G_GINT64_FORMAT "ms, running average: %"
-        G_GINT64_FORMAT "ms\n", latency / 1000, avg_latency / 1000);
+    g_print ("last latency: %" G_GINT64_FORMAT "us, running average: %"
+        G_GINT64_FORMAT "us, jitter: %" G_GINT64_FORMAT "us\n", latency,
+        avg_latency, jitter);
   GST_OBJECT_UNLOCK (self);
 
   /* Post an element message about it */
   gst_element_post_message (GST_ELEMENT (self),
       gst_message_new_element (GST_OBJECT (self),
           gst_structure_new ("latency", "last-latency", G_TYPE_INT64, latency,
-              "average-latency", G_TYPE_INT64, avg_latency, NULL)));
+              "average-latency", G_TYPE_INT64, avg_latency,
+              "jitter", G_TYPE_INT64, jitter, NULL)));
 }
 
 static gint64
@@ -322,9 +378,29 @@ buffer_has_wave (GstBuffer * buffer, GstPad * pad)
   /* Read only one channel */
   for (ii = 1; ii < fsize; ii += channels) {
     if (ABS (fdata[ii]) > 0.7) {
+      gfloat prev, cur, frac, energy;
+      gint jj, n;
+
+      /* A tick lasts many samples; require the signal to stay up for a few
+       * more samples so a single noise spike doesn't count as a tick */
+      energy = 0;
+      n = 0;
+      for (jj = ii; jj < fsize && n < 4; jj += channels, n++)
+        energy += ABS (fdata[jj]);
+      if (energy / n < 0.35)
+        continue;
+
+      /* Interpolate the threshold crossing between the previous and the
+       * current sample for sub-sample resolution */
+      prev = (ii - channels) >= 0 ? ABS (fdata[ii - channels]) : 0.0;
+      cur = ABS (fdata[ii]);
+      frac = (cur > prev) ? (cur - 0.7) / (cur - prev) : 0.0;
+      frac = CLAMP (frac, 0.0, 1.0);
+
       /* The waveform probably starts somewhere inside the buffer,
        * so get the offset in nanoseconds from the buffer pts */
-      offset = gst_util_uint64_scale_int_round (duration, ii, fsize);
+      offset = (gint64) (gst_guint64_to_gdouble (duration) *
+          (ii - frac * channels) / fsize);
       break;
     }
   }
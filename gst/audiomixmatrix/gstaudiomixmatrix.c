@@ -410,6 +410,73 @@ gst_audio_mix_matrix_change_state (GstElement * element,
 }
 
 
+/* Specialised mixers for common layouts.  With the channel counts known
+ * at compile time the compiler fully unrolls the coefficient loop and
+ * vectorises across samples; the arithmetic is the same as in the
+ * generic loops below. */
+#define DEFINE_MIX_FUNC(name, CTYPE, INCH, OUTCH)                       \
+static void                                                             \
+name (const CTYPE * inarray, CTYPE * outarray, const gdouble * matrix,  \
+    guint n_samples)                                                    \
+{                                                                       \
+  guint sample;                                                         \
+  gint in, out;                                                         \
+                                                                        \
+  for (sample = 0; sample < n_samples; sample++) {                      \
+    for (out = 0; out < (OUTCH); out++) {                               \
+      CTYPE outval = 0;                                                 \
+      for (in = 0; in < (INCH); in++) {                                 \
+        outval += inarray[sample * (INCH) + in] *                       \
+            matrix[out * (INCH) + in];                                  \
+      }                                                                 \
+      outarray[sample * (OUTCH) + out] = outval;                        \
+    }                                                                   \
+  }                                                                     \
+}
+
+/* For a diagonal matrix every output channel is just its input channel
+ * scaled, so skip the zero coefficients entirely (passthrough with
+ * gain, whatever the channel count). */
+#define DEFINE_MIX_DIAG_FUNC(name, CTYPE)                               \
+static void                                                             \
+name (const CTYPE * inarray, CTYPE * outarray, const gdouble * matrix,  \
+    guint n_samples, guint channels)                                    \
+{                                                                       \
+  guint sample, ch;                                                     \
+                                                                        \
+  for (sample = 0; sample < n_samples; sample++) {                      \
+    for (ch = 0; ch < channels; ch++) {                                 \
+      outarray[sample * channels + ch] =                                \
+          inarray[sample * channels + ch] * matrix[ch * channels + ch]; \
+    }                                                                   \
+  }                                                                     \
+}
+
+/* *INDENT-OFF* */
+DEFINE_MIX_FUNC (gst_audio_mix_matrix_mix_f32_2_2, gfloat, 2, 2)
+DEFINE_MIX_FUNC (gst_audio_mix_matrix_mix_f32_6_2, gfloat, 6, 2)
+DEFINE_MIX_FUNC (gst_audio_mix_matrix_mix_f32_8_2, gfloat, 8, 2)
+DEFINE_MIX_FUNC (gst_audio_mix_matrix_mix_f64_2_2, gdouble, 2, 2)
+DEFINE_MIX_FUNC (gst_audio_mix_matrix_mix_f64_6_2, gdouble, 6, 2)
+DEFINE_MIX_FUNC (gst_audio_mix_matrix_mix_f64_8_2, gdouble, 8, 2)
+DEFINE_MIX_DIAG_FUNC (gst_audio_mix_matrix_mix_f32_diag, gfloat)
+DEFINE_MIX_DIAG_FUNC (gst_audio_mix_matrix_mix_f64_diag, gdouble)
+/* *INDENT-ON* */
+
+static gboolean
+gst_audio_mix_matrix_is_diagonal (const gdouble * matrix, guint channels)
+{
+  guint in, out;
+
+  for (out = 0; out < channels; out++) {
+    for (in = 0; in < channels; in++) {
+      if (in != out && matrix[out * channels + in] != 0.0)
+        return FALSE;
+    }
+  }
+  return TRUE;
+}
+
 static GstFlowReturn
 gst_audio_mix_matrix_transform (GstBaseTransform * vfilter,
     GstBuffer * inbuf, GstBuffer * outbuf)
@@ -439,15 +506,30 @@ gst_audio_mix_matrix_transform (GstBaseTransform * vfilter,
       inarray = (gfloat *) inmap.data;
       outarray = (gfloat *) outmap.data;
 
-      for (sample = 0; sample < n_samples; sample++) {
-        for (out = 0; out < outchannels; out++) {
-          gfloat outval = 0;
-          for (in = 0; in < inchannels; in++) {
-            outval +=
-                inarray[sample * inchannels +
-                in] * matrix[out * inchannels + in];
+      if (inchannels == 2 && outchannels == 2) {
+        gst_audio_mix_matrix_mix_f32_2_2 (inarray, outarray, matrix,
+            n_samples);
+      } else if (inchannels == 6 && outchannels == 2) {
+        gst_audio_mix_matrix_mix_f32_6_2 (inarray, outarray, matrix,
+            n_samples);
+      } else if (inchannels == 8 && outchannels == 2) {
+        gst_audio_mix_matrix_mix_f32_8_2 (inarray, outarray, matrix,
+            n_samples);
+      } else if (inchannels == outchannels
+          && gst_audio_mix_matrix_is_diagonal (matrix, inchannels)) {
+        gst_audio_mix_matrix_mix_f32_diag (inarray, outarray, matrix,
+            n_samples, inchannels);
+      } else {
+        for (sample = 0; sample < n_samples; sample++) {
+          for (out = 0; out < outchannels; out++) {
+            gfloat outval = 0;
+            for (in = 0; in < inchannels; in++) {
+              outval +=
+                  inarray[sample * inchannels +
+                  in] * matrix[out * inchannels + in];
+            }
+            outarray[sample * outchannels + out] = outval;
           }
-          outarray[sample * outchannels + out] = outval;
         }
       }
       break;
@@ -461,15 +543,30 @@ gst_audio_mix_matrix_transform (GstBaseTransform * vfilter,
       inarray = (gdouble *) inmap.data;
       outarray = (gdouble *) outmap.data;
 
-      for (sample = 0; sample < n_samples; sample++) {
-        for (out = 0; out < outchannels; out++) {
-          gdouble outval = 0;
-          for (in = 0; in < inchannels; in++) {
-            outval +=
-                inarray[sample * inchannels +
-                in] * matrix[out * inchannels + in];
+      if (inchannels == 2 && outchannels == 2) {
+        gst_audio_mix_matrix_mix_f64_2_2 (inarray, outarray, matrix,
+            n_samples);
+      } else if (inchannels == 6 && outchannels == 2) {
+        gst_audio_mix_matrix_mix_f64_6_2 (inarray, outarray, matrix,
+            n_samples);
+      } else if (inchannels == 8 && outchannels == 2) {
+        gst_audio_mix_matrix_mix_f64_8_2 (inarray, outarray, matrix,
+            n_samples);
+      } else if (inchannels == outchannels
+          && gst_audio_mix_matrix_is_diagonal (matrix, inchannels)) {
+        gst_audio_mix_matrix_mix_f64_diag (inarray, outarray, matrix,
+            n_samples, inchannels);
+      } else {
+        for (sample = 0; sample < n_samples; sample++) {
+          for (out = 0; out < outchannels; out++) {
+            gdouble outval = 0;
+            for (in = 0; in < inchannels; in++) {
+              outval +=
+                  inarray[sample * inchannels +
+                  in] * matrix[out * inchannels + in];
+            }
+            outarray[sample * outchannels + out] = outval;
           }
-          outarray[sample * outchannels + out] = outval;
         }
       }
       break;
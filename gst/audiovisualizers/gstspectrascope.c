@@ -37,6 +37,7 @@
 #include "config.h"
 #endif
 #include <stdlib.h>
+#include <string.h>
 
 #include "gstspectrascope.h"
 
@@ -118,6 +119,10 @@ gst_spectra_scope_finalize (GObject * object)
     g_free (scope->freq_data);
     scope->freq_data = NULL;
   }
+  if (scope->mono_adata) {
+    g_free (scope->mono_adata);
+    scope->mono_adata = NULL;
+  }
 
   G_OBJECT_CLASS (gst_spectra_scope_parent_class)->finalize (object);
 }
@@ -127,15 +132,26 @@ gst_spectra_scope_setup (GstAudioVisualizer * bscope)
 {
   GstSpectraScope *scope = GST_SPECTRA_SCOPE (bscope);
   guint num_freq = GST_VIDEO_INFO_WIDTH (&bscope->vinfo) + 1;
+  guint spf = num_freq * 2 - 2;
+
+  /* we'd need this amount of samples per render() call */
+  bscope->req_spf = spf;
+
+  /* the FFT plan only depends on the window size, which follows the video
+   * width; keep it and the buffers sized from it across renegotiations
+   * that don't change the width (e.g. framerate changes) */
+  if (scope->fft_ctx && spf == scope->fft_size)
+    return TRUE;
 
   if (scope->fft_ctx)
     gst_fft_s16_free (scope->fft_ctx);
   g_free (scope->freq_data);
+  g_free (scope->mono_adata);
 
-  /* we'd need this amount of samples per render() call */
-  bscope->req_spf = num_freq * 2 - 2;
-  scope->fft_ctx = gst_fft_s16_new (bscope->req_spf, FALSE);
+  scope->fft_ctx = gst_fft_s16_new (spf, FALSE);
   scope->freq_data = g_new (GstFFTS16Complex, num_freq);
+  scope->mono_adata = g_new (gint16, spf);
+  scope->fft_size = spf;
 
   return TRUE;
 }
@@ -184,27 +200,33 @@ gst_spectra_scope_render (GstAudioVisualizer * bscope, GstBuffer * audio,
 
   channels = GST_AUDIO_INFO_CHANNELS (&bscope->ainfo);
 
-  mono_adata = (gint16 *) g_memdup (amap.data, amap.size);
+  /* mixdown into the scratch buffer allocated in setup(); the fft windowing
+   * modifies its input in place, so we can't run it on the mapped data */
+  mono_adata = scope->mono_adata;
 
   if (channels > 1) {
+    gint16 *adata = (gint16 *) amap.data;
     guint ch = channels;
-    guint num_samples = amap.size / (ch * sizeof (gint16));
+    guint num_samples = MIN (amap.size / (ch * sizeof (gint16)),
+        bscope->req_spf);
     guint i, c, v, s = 0;
 
     /* deinterleave and mixdown adata */
     for (i = 0; i < num_samples; i++) {
       v = 0;
       for (c = 0; c < ch; c++) {
-        v += mono_adata[s++];
+        v += adata[s++];
       }
       mono_adata[i] = v / ch;
     }
+  } else {
+    memcpy (mono_adata, amap.data,
+        MIN (amap.size, bscope->req_spf * sizeof (gint16)));
   }
 
   /* run fft */
   gst_fft_s16_window (scope->fft_ctx, mono_adata, GST_FFT_WINDOW_HAMMING);
   gst_fft_s16_fft (scope->fft_ctx, mono_adata, fdata);
-  g_free (mono_adata);
 
   /* draw lines */
   for (x = 0; x < w; x++) {
@@ -39,7 +39,9 @@ struct _GstSpectraScope
   GstAudioVisualizer parent;
 
   GstFFTS16 *fft_ctx;
+  guint fft_size;
   GstFFTS16Complex *freq_data;
+  gint16 *mono_adata;
 };
 
 struct _GstSpectraScopeClass
@@ -133,6 +133,10 @@ static gboolean gst_auto_convert_internal_src_event (GstPad * pad,
 static gboolean gst_auto_convert_internal_src_query (GstPad * pad,
     GstObject * parent, GstQuery * query);
 
+typedef struct _GstAutoConvertCacheEntry GstAutoConvertCacheEntry;
+static void gst_auto_convert_cache_entry_free (GstAutoConvertCacheEntry *
+    entry);
+
 static GList *gst_auto_convert_load_factories (GstAutoConvert * autoconvert);
 static GstElement
     * gst_auto_convert_get_or_make_element_from_factory (GstAutoConvert *
@@ -220,6 +224,12 @@ gst_auto_convert_dispose (GObject * object)
   g_clear_object (&autoconvert->current_internal_sinkpad);
   g_clear_object (&autoconvert->current_internal_srcpad);
 
+  GST_AUTOCONVERT_LOCK (autoconvert);
+  g_list_free_full (autoconvert->negotiation_cache,
+      (GDestroyNotify) gst_auto_convert_cache_entry_free);
+  autoconvert->negotiation_cache = NULL;
+  GST_AUTOCONVERT_UNLOCK (autoconvert);
+
   for (;;) {
     GList *factories = g_atomic_pointer_get (&autoconvert->factories);
 
@@ -569,6 +579,110 @@ gst_auto_convert_get_or_make_element_from_factory (GstAutoConvert * autoconvert,
   return element;
 }
 
+/* Remembers which factory won a previous negotiation for a given pair of
+ * sink caps and downstream caps, so that renegotiating to already-seen caps
+ * can go straight to that factory instead of iterating over all candidates
+ * again. The subelements themselves are already kept alive in the bin and
+ * reused, so a cache hit only costs one accept-caps query.
+ */
+
+struct _GstAutoConvertCacheEntry
+{
+  GstCaps *caps;
+  GstCaps *other_caps;          /* downstream caps, may be NULL */
+  GstElementFactory *factory;
+};
+
+/* Maximum number of remembered negotiation results */
+#define NEGOTIATION_CACHE_MAX_LENGTH 16
+
+static void
+gst_auto_convert_cache_entry_free (GstAutoConvertCacheEntry * entry)
+{
+  gst_caps_unref (entry->caps);
+  if (entry->other_caps)
+    gst_caps_unref (entry->other_caps);
+  gst_object_unref (entry->factory);
+  g_slice_free (GstAutoConvertCacheEntry, entry);
+}
+
+static gboolean
+gst_auto_convert_cache_entry_matches (GstAutoConvertCacheEntry * entry,
+    GstCaps * caps, GstCaps * other_caps)
+{
+  if (!gst_caps_is_equal (entry->caps, caps))
+    return FALSE;
+  if ((entry->other_caps == NULL) != (other_caps == NULL))
+    return FALSE;
+  if (entry->other_caps && !gst_caps_is_equal (entry->other_caps, other_caps))
+    return FALSE;
+
+  return TRUE;
+}
+
+static GstElementFactory *
+gst_auto_convert_cache_lookup (GstAutoConvert * autoconvert, GstCaps * caps,
+    GstCaps * other_caps)
+{
+  GstElementFactory *factory = NULL;
+  GList *item;
+
+  GST_AUTOCONVERT_LOCK (autoconvert);
+  for (item = autoconvert->negotiation_cache; item; item = g_list_next (item)) {
+    if (gst_auto_convert_cache_entry_matches (item->data, caps, other_caps)) {
+      factory = gst_object_ref (((GstAutoConvertCacheEntry *)
+              item->data)->factory);
+      break;
+    }
+  }
+  GST_AUTOCONVERT_UNLOCK (autoconvert);
+
+  return factory;
+}
+
+static void
+gst_auto_convert_cache_store (GstAutoConvert * autoconvert, GstCaps * caps,
+    GstCaps * other_caps, GstElementFactory * factory)
+{
+  GstAutoConvertCacheEntry *entry;
+
+  entry = g_slice_new (GstAutoConvertCacheEntry);
+  entry->caps = gst_caps_ref (caps);
+  entry->other_caps = other_caps ? gst_caps_ref (other_caps) : NULL;
+  entry->factory = gst_object_ref (factory);
+
+  GST_AUTOCONVERT_LOCK (autoconvert);
+  autoconvert->negotiation_cache =
+      g_list_prepend (autoconvert->negotiation_cache, entry);
+  if (g_list_length (autoconvert->negotiation_cache) >
+      NEGOTIATION_CACHE_MAX_LENGTH) {
+    GList *last = g_list_last (autoconvert->negotiation_cache);
+
+    gst_auto_convert_cache_entry_free (last->data);
+    autoconvert->negotiation_cache =
+        g_list_delete_link (autoconvert->negotiation_cache, last);
+  }
+  GST_AUTOCONVERT_UNLOCK (autoconvert);
+}
+
+static void
+gst_auto_convert_cache_remove (GstAutoConvert * autoconvert, GstCaps * caps,
+    GstCaps * other_caps)
+{
+  GList *item;
+
+  GST_AUTOCONVERT_LOCK (autoconvert);
+  for (item = autoconvert->negotiation_cache; item; item = g_list_next (item)) {
+    if (gst_auto_convert_cache_entry_matches (item->data, caps, other_caps)) {
+      gst_auto_convert_cache_entry_free (item->data);
+      autoconvert->negotiation_cache =
+          g_list_delete_link (autoconvert->negotiation_cache, item);
+      break;
+    }
+  }
+  GST_AUTOCONVERT_UNLOCK (autoconvert);
+}
+
 /*
  * This function checks if there is one and only one pad template on the
  * factory that can accept the given caps. If there is one and only one,
@@ -714,6 +828,7 @@ gst_auto_convert_sink_setcaps (GstAutoConvert * autoconvert, GstCaps * caps)
   GstCaps *other_caps = NULL;
   GList *factories;
   GstCaps *current_caps;
+  GstElementFactory *cached_factory;
 
   g_return_val_if_fail (autoconvert != NULL, FALSE);
 
@@ -749,6 +864,32 @@ gst_auto_convert_sink_setcaps (GstAutoConvert * autoconvert, GstCaps * caps)
 
   other_caps = gst_pad_peer_query_caps (autoconvert->srcpad, NULL);
 
+  /* If we negotiated this pair of caps before, try the factory that won
+   * last time before iterating over all the candidates again */
+  cached_factory = gst_auto_convert_cache_lookup (autoconvert, caps,
+      other_caps);
+  if (cached_factory) {
+    GstElement *element =
+        gst_auto_convert_get_or_make_element_from_factory (autoconvert,
+        cached_factory);
+
+    if (element) {
+      if (gst_auto_convert_activate_element (autoconvert, element, caps)) {
+        GST_DEBUG_OBJECT (autoconvert,
+            "Reactivated cached factory %s for caps %" GST_PTR_FORMAT,
+            gst_plugin_feature_get_name (GST_PLUGIN_FEATURE (cached_factory)),
+            caps);
+        gst_object_unref (cached_factory);
+        goto get_out;
+      }
+      gst_object_unref (element);
+    }
+
+    /* The cached decision no longer holds, drop it and do a full search */
+    gst_auto_convert_cache_remove (autoconvert, caps, other_caps);
+    gst_object_unref (cached_factory);
+  }
+
   factories = g_atomic_pointer_get (&autoconvert->factories);
 
   if (!factories)
@@ -786,10 +927,14 @@ gst_auto_convert_sink_setcaps (GstAutoConvert * autoconvert, GstCaps * caps)
       continue;
 
     /* And make it the current child */
-    if (gst_auto_convert_activate_element (autoconvert, element, caps))
+    if (gst_auto_convert_activate_element (autoconvert, element, caps)) {
+      /* remember the winner, so renegotiating to these caps again can skip
+       * the factory iteration */
+      gst_auto_convert_cache_store (autoconvert, caps, other_caps, factory);
       break;
-    else
+    } else {
       gst_object_unref (element);
+    }
   }
 
 get_out:
@@ -53,6 +53,11 @@ struct _GstAutoConvert
   GstElement *current_subelement;
   GstPad *current_internal_srcpad;
   GstPad *current_internal_sinkpad;
+
+  /* Cache of factories that won a previous negotiation, keyed by the
+   * (sink caps, downstream caps) pair they were selected for.
+   * Protected by the object lock */
+  GList *negotiation_cache;
 };
 
 struct _GstAutoConvertClass
@@ -123,6 +123,13 @@ struct _GstBayer2RGB
   int g_off;                    /* offset for green */
   int b_off;                    /* offset for blue */
   int format;
+
+  /* horizontal band threading */
+  GThreadPool *worker_pool;
+  guint n_workers;
+  GMutex task_lock;
+  GCond task_cond;
+  guint tasks_pending;
 };
 
 struct _GstBayer2RGBClass
@@ -160,6 +167,9 @@ static GstCaps *gst_bayer2rgb_transform_caps (GstBaseTransform * base,
     GstPadDirection direction, GstCaps * caps, GstCaps * filter);
 static gboolean gst_bayer2rgb_get_unit_size (GstBaseTransform * base,
     GstCaps * caps, gsize * size);
+static gboolean gst_bayer2rgb_start (GstBaseTransform * base);
+static gboolean gst_bayer2rgb_stop (GstBaseTransform * base);
+static void gst_bayer2rgb_finalize (GObject * object);
 
 
 static void
@@ -173,6 +183,7 @@ gst_bayer2rgb_class_init (GstBayer2RGBClass * klass)
 
   gobject_class->set_property = gst_bayer2rgb_set_property;
   gobject_class->get_property = gst_bayer2rgb_get_property;
+  gobject_class->finalize = gst_bayer2rgb_finalize;
 
   gst_element_class_set_static_metadata (gstelement_class,
       "Bayer to RGB decoder for cameras", "Filter/Converter/Video",
@@ -194,6 +205,9 @@ gst_bayer2rgb_class_init (GstBayer2RGBClass * klass)
       GST_DEBUG_FUNCPTR (gst_bayer2rgb_set_caps);
   GST_BASE_TRANSFORM_CLASS (klass)->transform =
       GST_DEBUG_FUNCPTR (gst_bayer2rgb_transform);
+  GST_BASE_TRANSFORM_CLASS (klass)->start =
+      GST_DEBUG_FUNCPTR (gst_bayer2rgb_start);
+  GST_BASE_TRANSFORM_CLASS (klass)->stop = GST_DEBUG_FUNCPTR (gst_bayer2rgb_stop);
 
   GST_DEBUG_CATEGORY_INIT (gst_bayer2rgb_debug, "bayer2rgb", 0,
       "bayer2rgb element");
@@ -203,9 +217,22 @@ static void
 gst_bayer2rgb_init (GstBayer2RGB * filter)
 {
   gst_bayer2rgb_reset (filter);
+  g_mutex_init (&filter->task_lock);
+  g_cond_init (&filter->task_cond);
   gst_base_transform_set_in_place (GST_BASE_TRANSFORM (filter), TRUE);
 }
 
+static void
+gst_bayer2rgb_finalize (GObject * object)
+{
+  GstBayer2RGB *filter = GST_BAYER2RGB (object);
+
+  g_mutex_clear (&filter->task_lock);
+  g_cond_clear (&filter->task_cond);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
 /* No properties are implemented, so only a warning is produced */
 static void
 gst_bayer2rgb_set_property (GObject * object, guint prop_id,
@@ -381,12 +408,108 @@ typedef void (*process_func) (guint8 * d0, const guint8 * s0, const guint8 * s1,
     const guint8 * s2, const guint8 * s3, const guint8 * s4, const guint8 * s5,
     int n);
 
+/* process the rows [j0, j1) of the frame. each band splits its own copy of
+ * the neighbouring source lines into a private scratch buffer, so disjoint
+ * bands can run concurrently */
 static void
-gst_bayer2rgb_process (GstBayer2RGB * bayer2rgb, uint8_t * dest,
-    int dest_stride, uint8_t * src, int src_stride)
+gst_bayer2rgb_process_band (GstBayer2RGB * bayer2rgb, guint8 * dest,
+    int dest_stride, const guint8 * src, int src_stride,
+    const process_func * merge, int j0, int j1)
 {
   int j;
   guint8 *tmp;
+
+  tmp = g_malloc (2 * 4 * bayer2rgb->width);
+#define LINE(x) (tmp + ((x)&7) * bayer2rgb->width)
+
+  /* split the line above the band; the first line of the frame mirrors its
+   * opposite-parity neighbour below instead */
+  gst_bayer2rgb_split_and_upsample_horiz (LINE ((j0 - 1) * 2 + 0),
+      LINE ((j0 - 1) * 2 + 1),
+      src + (j0 > 0 ? j0 - 1 : 1) * src_stride, bayer2rgb->width);
+  gst_bayer2rgb_split_and_upsample_horiz (LINE (j0 * 2 + 0), LINE (j0 * 2 + 1),
+      src + j0 * src_stride, bayer2rgb->width);
+
+  for (j = j0; j < j1; j++) {
+    if (j < bayer2rgb->height - 1) {
+      gst_bayer2rgb_split_and_upsample_horiz (LINE ((j + 1) * 2 + 0),
+          LINE ((j + 1) * 2 + 1), src + (j + 1) * src_stride, bayer2rgb->width);
+    }
+
+    merge[j & 1] (dest + j * dest_stride,
+        LINE (j * 2 - 2), LINE (j * 2 - 1),
+        LINE (j * 2 + 0), LINE (j * 2 + 1),
+        LINE (j * 2 + 2), LINE (j * 2 + 3), bayer2rgb->width >> 1);
+  }
+#undef LINE
+
+  g_free (tmp);
+}
+
+/* don't bother spawning a band for less than this many rows */
+#define MIN_ROWS_PER_BAND 64
+#define MAX_WORKERS 8
+
+typedef struct
+{
+  GstBayer2RGB *bayer2rgb;
+  guint8 *dest;
+  int dest_stride;
+  const guint8 *src;
+  int src_stride;
+  process_func merge[2];
+  int j0, j1;
+} BayerBand;
+
+static void
+gst_bayer2rgb_band_func (gpointer data, gpointer user_data)
+{
+  BayerBand *band = data;
+  GstBayer2RGB *bayer2rgb = band->bayer2rgb;
+
+  gst_bayer2rgb_process_band (bayer2rgb, band->dest, band->dest_stride,
+      band->src, band->src_stride, band->merge, band->j0, band->j1);
+
+  g_mutex_lock (&bayer2rgb->task_lock);
+  bayer2rgb->tasks_pending--;
+  if (bayer2rgb->tasks_pending == 0)
+    g_cond_signal (&bayer2rgb->task_cond);
+  g_mutex_unlock (&bayer2rgb->task_lock);
+
+  g_slice_free (BayerBand, band);
+}
+
+static gboolean
+gst_bayer2rgb_start (GstBaseTransform * base)
+{
+  GstBayer2RGB *bayer2rgb = GST_BAYER2RGB (base);
+
+  bayer2rgb->n_workers = CLAMP (g_get_num_processors (), 1, MAX_WORKERS);
+  if (bayer2rgb->n_workers > 1)
+    bayer2rgb->worker_pool = g_thread_pool_new (gst_bayer2rgb_band_func,
+        bayer2rgb, bayer2rgb->n_workers, TRUE, NULL);
+
+  return TRUE;
+}
+
+static gboolean
+gst_bayer2rgb_stop (GstBaseTransform * base)
+{
+  GstBayer2RGB *bayer2rgb = GST_BAYER2RGB (base);
+
+  if (bayer2rgb->worker_pool) {
+    g_thread_pool_free (bayer2rgb->worker_pool, FALSE, TRUE);
+    bayer2rgb->worker_pool = NULL;
+  }
+
+  return TRUE;
+}
+
+static void
+gst_bayer2rgb_process (GstBayer2RGB * bayer2rgb, uint8_t * dest,
+    int dest_stride, uint8_t * src, int src_stride)
+{
+  int n_bands;
   process_func merge[2] = { NULL, NULL };
   int r_off, g_off, b_off;
 
@@ -423,28 +546,42 @@ gst_bayer2rgb_process (GstBayer2RGB * bayer2rgb, uint8_t * dest,
     merge[1] = tmp;
   }
 
-  tmp = g_malloc (2 * 4 * bayer2rgb->width);
-#define LINE(x) (tmp + ((x)&7) * bayer2rgb->width)
-
-  gst_bayer2rgb_split_and_upsample_horiz (LINE (3 * 2 + 0), LINE (3 * 2 + 1),
-      src + 1 * src_stride, bayer2rgb->width);
-  j = 0;
-  gst_bayer2rgb_split_and_upsample_horiz (LINE (j * 2 + 0), LINE (j * 2 + 1),
-      src + j * src_stride, bayer2rgb->width);
-
-  for (j = 0; j < bayer2rgb->height; j++) {
-    if (j < bayer2rgb->height - 1) {
-      gst_bayer2rgb_split_and_upsample_horiz (LINE ((j + 1) * 2 + 0),
-          LINE ((j + 1) * 2 + 1), src + (j + 1) * src_stride, bayer2rgb->width);
+  n_bands = 1;
+  if (bayer2rgb->worker_pool)
+    n_bands = CLAMP (bayer2rgb->height / MIN_ROWS_PER_BAND, 1,
+        (int) bayer2rgb->n_workers);
+
+  if (n_bands > 1) {
+    int rows = (bayer2rgb->height + n_bands - 1) / n_bands;
+    int b;
+
+    g_mutex_lock (&bayer2rgb->task_lock);
+    bayer2rgb->tasks_pending += n_bands;
+    g_mutex_unlock (&bayer2rgb->task_lock);
+
+    for (b = 0; b < n_bands; b++) {
+      BayerBand *band = g_slice_new (BayerBand);
+
+      band->bayer2rgb = bayer2rgb;
+      band->dest = dest;
+      band->dest_stride = dest_stride;
+      band->src = src;
+      band->src_stride = src_stride;
+      band->merge[0] = merge[0];
+      band->merge[1] = merge[1];
+      band->j0 = b * rows;
+      band->j1 = MIN ((b + 1) * rows, bayer2rgb->height);
+      g_thread_pool_push (bayer2rgb->worker_pool, band, NULL);
     }
 
-    merge[j & 1] (dest + j * dest_stride,
-        LINE (j * 2 - 2), LINE (j * 2 - 1),
-        LINE (j * 2 + 0), LINE (j * 2 + 1),
-        LINE (j * 2 + 2), LINE (j * 2 + 3), bayer2rgb->width >> 1);
+    g_mutex_lock (&bayer2rgb->task_lock);
+    while (bayer2rgb->tasks_pending > 0)
+      g_cond_wait (&bayer2rgb->task_cond, &bayer2rgb->task_lock);
+    g_mutex_unlock (&bayer2rgb->task_lock);
+  } else {
+    gst_bayer2rgb_process_band (bayer2rgb, dest, dest_stride, src, src_stride,
+        merge, 0, bayer2rgb->height);
   }
-
-  g_free (tmp);
 }
 
 
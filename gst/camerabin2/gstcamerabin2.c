@@ -547,6 +547,8 @@ gst_camera_bin_dispose (GObject * object)
     gst_object_unref (camerabin->imagesink);
   if (camerabin->image_encodebin)
     gst_object_unref (camerabin->image_encodebin);
+  if (camerabin->imagebin_queue)
+    gst_object_unref (camerabin->imagebin_queue);
   if (camerabin->imagebin_capsfilter)
     gst_object_unref (camerabin->imagebin_capsfilter);
 
@@ -1608,17 +1610,35 @@ gst_camera_bin_create_elements (GstCameraBin2 * camera)
         "max-size-time", (guint64) 0, "max-size-bytes", (guint) 0,
         "max-size-buffers", (guint) 1, NULL);
 
+    camera->imagebin_queue =
+        gst_element_factory_make ("queue", "imagebin-queue");
+    if (!camera->imagebin_queue) {
+      missing_element_name = "queue";
+      goto missing_element;
+    }
+
+    /* Decouple image encoding from the camera source's streaming thread so
+     * that a burst of captures is buffered here instead of stalling the
+     * viewfinder while each image is encoded. The number of queued captures
+     * is already bounded by the source, so the queue itself is unlimited. */
+    g_object_set (camera->imagebin_queue, "silent", TRUE,
+        "max-size-time", (guint64) 0, "max-size-bytes", (guint) 0,
+        "max-size-buffers", (guint) 0, NULL);
+
     gst_bin_add_many (GST_BIN_CAST (camera),
         gst_object_ref (camera->video_encodebin),
         gst_object_ref (camera->videosink),
         gst_object_ref (camera->image_encodebin),
         gst_object_ref (camera->imagesink),
+        gst_object_ref (camera->imagebin_queue),
         gst_object_ref (camera->viewfinderbin_queue), NULL);
 
     gst_element_link_pads_full (camera->video_encodebin, "src",
         camera->videosink, "sink", GST_PAD_LINK_CHECK_NOTHING);
     gst_element_link_pads_full (camera->image_encodebin, "src",
         camera->imagesink, "sink", GST_PAD_LINK_CHECK_NOTHING);
+    gst_element_link_pads_full (camera->imagebin_queue, "src",
+        camera->imagebin_capsfilter, "sink", GST_PAD_LINK_CHECK_CAPS);
     gst_element_link_pads_full (camera->viewfinderbin_queue, "src",
         camera->viewfinderbin_capsfilter, "sink", GST_PAD_LINK_CHECK_CAPS);
     gst_element_link_pads_full (camera->viewfinderbin_capsfilter, "src",
@@ -1752,9 +1772,9 @@ gst_camera_bin_create_elements (GstCameraBin2 * camera)
     }
 
     if (!gst_element_link_pads (camera->src, "imgsrc",
-            camera->imagebin_capsfilter, "sink")) {
+            camera->imagebin_queue, "sink")) {
       GST_ERROR_OBJECT (camera,
-          "Failed to link camera source's imgsrc pad to image bin capsfilter");
+          "Failed to link camera source's imgsrc pad to image bin queue");
       goto fail;
     }
     if (!gst_element_link_pads (camera->src, "vidsrc",
@@ -1770,8 +1790,8 @@ gst_camera_bin_create_elements (GstCameraBin2 * camera)
   }
 
   gst_camera_bin_check_and_replace_filter (camera, &camera->image_filter,
-      camera->user_image_filter, camera->src, camera->imagebin_capsfilter,
-      "imgsrc");
+      camera->user_image_filter, camera->imagebin_queue,
+      camera->imagebin_capsfilter, NULL);
   gst_camera_bin_check_and_replace_filter (camera, &camera->video_filter,
       camera->user_video_filter, camera->src, camera->videobin_capsfilter,
       "vidsrc");
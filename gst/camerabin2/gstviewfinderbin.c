@@ -198,6 +198,13 @@ gst_viewfinder_bin_create_elements (GstViewfinderBin * vfbin)
     gst_ghost_pad_set_target (GST_GHOST_PAD (vfbin->ghostpad), NULL);
 
     /* add the elements, user wants them */
+    videoscale = gst_element_factory_make ("videoscale", "vfbin-videoscale");
+    if (!videoscale) {
+      missing_element_name = "videoscale";
+      goto missing_element;
+    }
+    gst_bin_add (GST_BIN_CAST (vfbin), videoscale);
+
     csp = gst_element_factory_make ("videoconvert", "vfbin-csp");
     if (!csp) {
       missing_element_name = "videoconvert";
@@ -205,14 +212,10 @@ gst_viewfinder_bin_create_elements (GstViewfinderBin * vfbin)
     }
     gst_bin_add (GST_BIN_CAST (vfbin), csp);
 
-    videoscale = gst_element_factory_make ("videoscale", "vfbin->videoscale");
-    if (!videoscale) {
-      missing_element_name = "videoscale";
-      goto missing_element;
-    }
-    gst_bin_add (GST_BIN_CAST (vfbin), videoscale);
-
-    gst_element_link_pads_full (csp, "src", videoscale, "sink",
+    /* scale before converting so that with a high resolution source and a
+     * small viewfinder the colorspace conversion only runs on the
+     * scaled-down frames, like the preview pipeline already does */
+    gst_element_link_pads_full (videoscale, "src", csp, "sink",
         GST_PAD_LINK_CHECK_NOTHING);
 
     vfbin->elements_created = TRUE;
@@ -225,21 +228,20 @@ gst_viewfinder_bin_create_elements (GstViewfinderBin * vfbin)
   /* if sink was replaced -> link it to the internal converters */
   if (newsink && !vfbin->disable_converters) {
     gboolean unref = FALSE;
-    if (!videoscale) {
-      videoscale = gst_bin_get_by_name (GST_BIN_CAST (vfbin),
-          "vfbin-videscale");
+    if (!csp) {
+      csp = gst_bin_get_by_name (GST_BIN_CAST (vfbin), "vfbin-csp");
       unref = TRUE;
     }
 
-    if (!gst_element_link_pads_full (videoscale, "src", vfbin->video_sink,
+    if (!gst_element_link_pads_full (csp, "src", vfbin->video_sink,
             "sink", GST_PAD_LINK_CHECK_CAPS)) {
       GST_ELEMENT_ERROR (vfbin, CORE, NEGOTIATION, (NULL),
-          ("linking videoscale and viewfindersink failed"));
+          ("linking videoconvert and viewfindersink failed"));
     }
 
     if (unref)
-      gst_object_unref (videoscale);
-    videoscale = NULL;
+      gst_object_unref (csp);
+    csp = NULL;
   }
 
   /* Check if we need a new ghostpad target */
@@ -247,8 +249,8 @@ gst_viewfinder_bin_create_elements (GstViewfinderBin * vfbin)
     if (vfbin->disable_converters) {
       firstpad = gst_element_get_static_pad (vfbin->video_sink, "sink");
     } else {
-      /* csp should always exist at this point */
-      firstpad = gst_element_get_static_pad (csp, "sink");
+      /* videoscale should always exist at this point */
+      firstpad = gst_element_get_static_pad (videoscale, "sink");
     }
   }
 
@@ -83,6 +83,9 @@ enum
   PROP_FPS_UPDATE_INTERVAL,
   PROP_MAX_FPS,
   PROP_MIN_FPS,
+  PROP_FPS,
+  PROP_DROPRATE,
+  PROP_AVG_FPS,
   PROP_SIGNAL_FPS_MEASUREMENTS,
   PROP_FRAMES_DROPPED,
   PROP_FRAMES_RENDERED,
@@ -161,6 +164,25 @@ fps_display_sink_class_init (GstFPSDisplaySinkClass * klass)
           "-1 means no measurement has yet been done", -1, G_MAXDOUBLE, -1,
           G_PARAM_STATIC_STRINGS | G_PARAM_READABLE));
 
+  g_object_class_install_property (gobject_klass, PROP_FPS,
+      g_param_spec_double ("fps", "Fps",
+          "Last measured fps. Updated without messages or allocations, "
+          "for cheap periodic scraping. "
+          "-1 means no measurement has yet been done", -1, G_MAXDOUBLE, -1,
+          G_PARAM_STATIC_STRINGS | G_PARAM_READABLE));
+
+  g_object_class_install_property (gobject_klass, PROP_DROPRATE,
+      g_param_spec_double ("droprate", "Droprate",
+          "Last measured drop rate in frames per second. "
+          "-1 means no measurement has yet been done", -1, G_MAXDOUBLE, -1,
+          G_PARAM_STATIC_STRINGS | G_PARAM_READABLE));
+
+  g_object_class_install_property (gobject_klass, PROP_AVG_FPS,
+      g_param_spec_double ("avg-fps", "Average fps",
+          "Average fps since the start of the measurement. "
+          "-1 means no measurement has yet been done", -1, G_MAXDOUBLE, -1,
+          G_PARAM_STATIC_STRINGS | G_PARAM_READABLE));
+
   g_object_class_install_property (gobject_klass, PROP_FRAMES_DROPPED,
       g_param_spec_uint ("frames-dropped", "dropped frames",
           "Number of frames dropped by the sink", 0, G_MAXUINT, 0,
@@ -334,6 +356,9 @@ fps_display_sink_init (GstFPSDisplaySink * self,
   self->video_sink = NULL;
   self->max_fps = -1;
   self->min_fps = -1;
+  self->current_fps = -1;
+  self->current_droprate = -1;
+  self->average_fps = -1;
   self->silent = DEFAULT_SILENT;
   self->last_message = g_strdup (DEFAULT_LAST_MESSAGE);
 
@@ -376,6 +401,10 @@ display_current_fps (gpointer data)
     GST_DEBUG_OBJECT (self, "Updated min-fps to %f", rr);
   }
 
+  self->current_fps = rr;
+  self->current_droprate = dr;
+  self->average_fps = average_fps;
+
   if (self->signal_measurements) {
     GST_LOG_OBJECT (self, "Signaling measurements: fps:%f droprate:%f "
         "avg-fps:%f", rr, dr, average_fps);
@@ -384,22 +413,26 @@ display_current_fps (gpointer data)
         average_fps);
   }
 
-  /* Display on a single line to make it easier to read and import
-   * into, for example, excel..  note: it would be nice to show
-   * timestamp too.. need to check if there is a sane way to log
-   * timestamp of last rendered buffer, so we could correlate dips
-   * in framerate to certain positions in the stream.
-   */
-  if (dr == 0.0) {
-    g_snprintf (fps_message, 255,
-        "rendered: %" G_GUINT64_FORMAT ", dropped: %" G_GUINT64_FORMAT
-        ", current: %.2f, average: %.2f", frames_rendered, frames_dropped, rr,
-        average_fps);
-  } else {
-    g_snprintf (fps_message, 255,
-        "rendered: %" G_GUINT64_FORMAT ", dropped: %" G_GUINT64_FORMAT
-        ", fps: %.2f, drop rate: %.2f", frames_rendered, frames_dropped, rr,
-        dr);
+  /* without the overlay and with silent set, the properties above are
+   * the only consumers, so skip the message formatting altogether */
+  if (self->use_text_overlay || !self->silent) {
+    /* Display on a single line to make it easier to read and import
+     * into, for example, excel..  note: it would be nice to show
+     * timestamp too.. need to check if there is a sane way to log
+     * timestamp of last rendered buffer, so we could correlate dips
+     * in framerate to certain positions in the stream.
+     */
+    if (dr == 0.0) {
+      g_snprintf (fps_message, 255,
+          "rendered: %" G_GUINT64_FORMAT ", dropped: %" G_GUINT64_FORMAT
+          ", current: %.2f, average: %.2f", frames_rendered, frames_dropped,
+          rr, average_fps);
+    } else {
+      g_snprintf (fps_message, 255,
+          "rendered: %" G_GUINT64_FORMAT ", dropped: %" G_GUINT64_FORMAT
+          ", fps: %.2f, drop rate: %.2f", frames_rendered, frames_dropped, rr,
+          dr);
+    }
   }
 
   if (self->use_text_overlay) {
@@ -433,6 +466,9 @@ fps_display_sink_start (GstFPSDisplaySink * self)
   self->last_frames_dropped = G_GUINT64_CONSTANT (0);
   self->max_fps = -1;
   self->min_fps = -1;
+  self->current_fps = -1;
+  self->current_droprate = -1;
+  self->average_fps = -1;
 
   /* init time stamps */
   self->last_ts = self->start_ts = self->interval_ts = GST_CLOCK_TIME_NONE;
@@ -601,6 +637,15 @@ fps_display_sink_get_property (GObject * object, guint prop_id,
     case PROP_MIN_FPS:
       g_value_set_double (value, self->min_fps);
       break;
+    case PROP_FPS:
+      g_value_set_double (value, self->current_fps);
+      break;
+    case PROP_DROPRATE:
+      g_value_set_double (value, self->current_droprate);
+      break;
+    case PROP_AVG_FPS:
+      g_value_set_double (value, self->average_fps);
+      break;
     case PROP_FRAMES_DROPPED:
       g_value_set_uint (value, g_atomic_int_get (&self->frames_dropped));
       break;
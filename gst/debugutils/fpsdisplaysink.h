@@ -66,6 +66,11 @@ struct _GstFPSDisplaySink
   GstClockTime fps_update_interval;
   gdouble max_fps;
   gdouble min_fps;
+  /* last measurement, readable through properties for scraping without
+   * message or signal traffic; updated with plain stores */
+  gdouble current_fps;
+  gdouble current_droprate;
+  gdouble average_fps;
   gboolean silent;
   gchar *last_message;
 };
@@ -937,7 +937,8 @@ gst_dvbsub_overlay_subs_to_comp (GstDVBSubOverlay * overlay,
     guint8 *in_data;
     guint32 *palette, *data;
     gint rx, ry, rw, rh, stride;
-    gint k, l;
+    gint k, l, n_palette;
+    guint32 palette_be[256] = { 0, };
     GstMapInfo map;
 
     GST_LOG_OBJECT (overlay, "rectangle %d: %dx%d @ (%d, %d)", i,
@@ -952,16 +953,20 @@ gst_dvbsub_overlay_subs_to_comp (GstDVBSubOverlay * overlay,
     in_data = srect->pict.data;
     palette = srect->pict.palette;
     stride = srect->pict.rowstride;
+
+    /* convert the palette to the stored byte order once per region, so the
+     * per-pixel loop below is a plain table lookup the compiler can
+     * vectorize instead of a byte swap per pixel */
+    n_palette = 1 << srect->pict.palette_bits_count;
+    for (k = 0; k < n_palette; k++)
+      palette_be[k] = GUINT32_TO_BE (palette[k]);
+
     for (k = 0; k < h; k++) {
-      for (l = 0; l < w; l++) {
-        guint32 ayuv;
+      const guint8 *in = in_data + k * stride;
+      guint32 *out = data + k * w;
 
-        ayuv = palette[*in_data];
-        GST_WRITE_UINT32_BE (data, ayuv);
-        in_data++;
-        data++;
-      }
-      in_data += stride - w;
+      for (l = 0; l < w; l++)
+        out[l] = palette_be[in[l]];
     }
     gst_buffer_unmap (buf, &map);
 
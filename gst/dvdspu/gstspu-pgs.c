@@ -169,61 +169,46 @@ dump_rle_data (GstDVDSpu * dvdspu, guint8 * data, guint32 len)
 #endif
 }
 
-static void
-pgs_composition_object_render (PgsCompositionObject * obj, SpuState * state,
-    GstVideoFrame * frame)
+/* Expand the object's RLE data into a bitmap of premultiplied colours,
+ * so displaying the same composition for many frames (e.g. a still menu)
+ * only walks the RLE and palette once. The cache is rebuilt when new RLE
+ * data arrives or when the palette changes. */
+static gboolean
+pgs_composition_object_ensure_decoded (PgsCompositionObject * obj,
+    SpuState * state)
 {
-  SpuColour *colour;
-  guint8 *planes[3];            /* YUV frame pointers */
-  gint strides[3];
+  SpuColour *bitmap, *row;
   guint8 *data, *end;
-  guint16 obj_w;
-  guint16 obj_h G_GNUC_UNUSED;
-  guint x, y, i, min_x, max_x;
+  guint16 obj_w, obj_h;
+  guint x, y, i;
 
-  if (G_UNLIKELY (obj->rle_data == NULL || obj->rle_data_size == 0
-          || obj->rle_data_used != obj->rle_data_size))
-    return;
+  if (obj->dec_bitmap != NULL
+      && obj->dec_palette_gen == state->pgs.palette_gen)
+    return TRUE;
+
+  g_free (obj->dec_bitmap);
+  obj->dec_bitmap = NULL;
 
   data = obj->rle_data;
   end = data + obj->rle_data_used;
 
   if (data + 4 > end)
-    return;
-
-  /* FIXME: Calculate and use the cropping window for the output, as the
-   * intersection of the crop rectangle for this object (if any) and the
-   * window specified by the object's window_id */
-
-  /* Store the start of each plane */
-  planes[0] = GST_VIDEO_FRAME_COMP_DATA (frame, 0);
-  planes[1] = GST_VIDEO_FRAME_COMP_DATA (frame, 1);
-  planes[2] = GST_VIDEO_FRAME_COMP_DATA (frame, 2);
-
-  strides[0] = GST_VIDEO_FRAME_COMP_STRIDE (frame, 0);
-  strides[1] = GST_VIDEO_FRAME_COMP_STRIDE (frame, 1);
-  strides[2] = GST_VIDEO_FRAME_COMP_STRIDE (frame, 2);
-
-  y = MIN (obj->y, state->info.height);
-
-  planes[0] += strides[0] * y;
-  planes[1] += strides[1] * (y / 2);
-  planes[2] += strides[2] * (y / 2);
+    return FALSE;
 
   /* RLE data: */
   obj_w = GST_READ_UINT16_BE (data);
   obj_h = GST_READ_UINT16_BE (data + 2);
   data += 4;
 
-  min_x = MIN (obj->x, strides[0]);
-  max_x = MIN (obj->x + obj_w, strides[0]);
+  if (obj_w == 0 || obj_h == 0)
+    return FALSE;
 
-  state->comp_left = x = min_x;
-  state->comp_right = max_x;
+  bitmap = g_new0 (SpuColour, (gsize) obj_w * obj_h);
 
-  gstspu_clear_comp_buffers (state);
+  x = y = 0;
+  row = bitmap;
 
-  while (data < end) {
+  while (data < end && y < obj_h) {
     guint8 pal_id;
     guint16 run_len;
 
@@ -232,7 +217,7 @@ pgs_composition_object_render (PgsCompositionObject * obj, SpuState * state,
       run_len = 1;
     } else {
       if (data + 1 > end)
-        return;
+        break;
       switch (data[0] & 0xC0) {
         case 0x00:
           run_len = (data[0] & 0x3f);
@@ -240,20 +225,20 @@ pgs_composition_object_render (PgsCompositionObject * obj, SpuState * state,
           break;
         case 0x40:
           if (data + 2 > end)
-            return;
+            goto done;
           run_len = ((data[0] << 8) | data[1]) & 0x3fff;
           data += 2;
           break;
         case 0x80:
           if (data + 2 > end)
-            return;
+            goto done;
           run_len = (data[0] & 0x3f);
           pal_id = data[1];
           data += 2;
           break;
         case 0xC0:
           if (data + 3 > end)
-            return;
+            goto done;
           run_len = ((data[0] << 8) | data[1]) & 0x3fff;
           pal_id = data[2];
           data += 3;
@@ -264,39 +249,108 @@ pgs_composition_object_render (PgsCompositionObject * obj, SpuState * state,
       }
     }
 
-    colour = &state->pgs.palette[pal_id];
-    if (colour->A) {
-      guint32 inv_A = 0xff - colour->A;
-      if (G_UNLIKELY (x + run_len > max_x))
-        run_len = (max_x - x);
+    if (run_len) {
+      SpuColour *colour = &state->pgs.palette[pal_id];
 
-      for (i = 0; i < run_len; i++) {
-        planes[0][x] = (inv_A * planes[0][x] + colour->Y) / 0xff;
+      if (G_UNLIKELY (x + run_len > obj_w))
+        run_len = obj_w - x;
 
-        state->comp_bufs[0][x / 2] += colour->U;
-        state->comp_bufs[1][x / 2] += colour->V;
-        state->comp_bufs[2][x / 2] += colour->A;
-        x++;
+      if (colour->A) {
+        for (i = 0; i < run_len; i++)
+          row[x + i] = *colour;
       }
-    } else {
       x += run_len;
     }
 
-    if (!run_len || x > max_x) {
-      x = min_x;
-      planes[0] += strides[0];
+    if (!run_len || x > obj_w) {
+      x = 0;
+      row += obj_w;
+      y++;
+    }
+  }
+
+done:
+  obj->dec_bitmap = bitmap;
+  obj->dec_w = obj_w;
+  obj->dec_h = obj_h;
+  obj->dec_palette_gen = state->pgs.palette_gen;
 
-      if (y % 2) {
-        gstspu_blend_comp_buffers (state, planes);
-        gstspu_clear_comp_buffers (state);
+  return TRUE;
+}
 
-        planes[1] += strides[1];
-        planes[2] += strides[2];
+static void
+pgs_composition_object_render (PgsCompositionObject * obj, SpuState * state,
+    GstVideoFrame * frame)
+{
+  const SpuColour *pix;
+  guint8 *planes[3];            /* YUV frame pointers */
+  gint strides[3];
+  guint16 obj_w;
+  guint x, y, row, min_x, max_x;
+
+  if (G_UNLIKELY (obj->rle_data == NULL || obj->rle_data_size == 0
+          || obj->rle_data_used != obj->rle_data_size))
+    return;
+
+  if (!pgs_composition_object_ensure_decoded (obj, state))
+    return;
+
+  obj_w = obj->dec_w;
+
+  /* FIXME: Calculate and use the cropping window for the output, as the
+   * intersection of the crop rectangle for this object (if any) and the
+   * window specified by the object's window_id */
+
+  /* Store the start of each plane */
+  planes[0] = GST_VIDEO_FRAME_COMP_DATA (frame, 0);
+  planes[1] = GST_VIDEO_FRAME_COMP_DATA (frame, 1);
+  planes[2] = GST_VIDEO_FRAME_COMP_DATA (frame, 2);
+
+  strides[0] = GST_VIDEO_FRAME_COMP_STRIDE (frame, 0);
+  strides[1] = GST_VIDEO_FRAME_COMP_STRIDE (frame, 1);
+  strides[2] = GST_VIDEO_FRAME_COMP_STRIDE (frame, 2);
+
+  y = MIN (obj->y, state->info.height);
+
+  planes[0] += strides[0] * y;
+  planes[1] += strides[1] * (y / 2);
+  planes[2] += strides[2] * (y / 2);
+
+  min_x = MIN (obj->x, strides[0]);
+  max_x = MIN (obj->x + obj_w, strides[0]);
+
+  state->comp_left = min_x;
+  state->comp_right = max_x;
+
+  gstspu_clear_comp_buffers (state);
+
+  for (row = 0; row < obj->dec_h; row++) {
+    pix = obj->dec_bitmap + (gsize) row * obj_w;
+
+    for (x = min_x; x < max_x; x++, pix++) {
+      if (pix->A) {
+        guint32 inv_A = 0xff - pix->A;
+
+        planes[0][x] = (inv_A * planes[0][x] + pix->Y) / 0xff;
+
+        state->comp_bufs[0][x / 2] += pix->U;
+        state->comp_bufs[1][x / 2] += pix->V;
+        state->comp_bufs[2][x / 2] += pix->A;
       }
-      y++;
-      if (y >= state->info.height)
-        return;                 /* Hit the bottom */
     }
+
+    planes[0] += strides[0];
+
+    if (y % 2) {
+      gstspu_blend_comp_buffers (state, planes);
+      gstspu_clear_comp_buffers (state);
+
+      planes[1] += strides[1];
+      planes[2] += strides[2];
+    }
+    y++;
+    if (y >= state->info.height)
+      return;                   /* Hit the bottom */
   }
 
   if (y % 2)
@@ -311,6 +365,12 @@ pgs_composition_object_clear (PgsCompositionObject * obj)
     obj->rle_data = NULL;
   }
   obj->rle_data_size = obj->rle_data_used = 0;
+
+  if (obj->dec_bitmap) {
+    g_free (obj->dec_bitmap);
+    obj->dec_bitmap = NULL;
+  }
+  obj->dec_w = obj->dec_h = 0;
 }
 
 static void
@@ -510,6 +570,9 @@ parse_set_palette (GstDVDSpu * dvdspu, guint8 type, guint8 * payload,
     PGS_DUMP ("\n");
 #endif
 
+  /* object bitmaps decoded with the previous palette are stale now */
+  state->pgs.palette_gen++;
+
   if (payload != end) {
     GST_ERROR ("PGS Set Palette: %" G_GSSIZE_FORMAT " bytes not consumed",
         (gssize) (end - payload));
@@ -587,6 +650,10 @@ parse_set_object_data (GstDVDSpu * dvdspu, guint8 type, guint8 * payload,
   if (flags & PGS_OBJECT_UPDATE_FLAG_START_RLE) {
     obj->rle_data_ver = obj_ver;
 
+    /* new RLE data invalidates the decoded cache */
+    g_free (obj->dec_bitmap);
+    obj->dec_bitmap = NULL;
+
     if (payload + 3 > end)
       return 0;
 
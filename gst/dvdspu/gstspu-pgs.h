@@ -77,6 +77,12 @@ struct PgsCompositionObject
   guint32 rle_data_size;
   guint32 rle_data_used;
 
+  /* Cache of @rle_data decoded to premultiplied colours; rebuilt when new
+   * RLE data arrives or the palette changes */
+  SpuColour *dec_bitmap;
+  guint16 dec_w, dec_h;
+  guint dec_palette_gen;
+
   /* Top left corner of this object */
   guint16 x, y;
 
@@ -93,6 +99,9 @@ struct SpuPgsState {
   PgsPresentationSegment pres_seg;
 
   SpuColour palette[256];
+  /* bumped on each palette segment so cached object bitmaps decoded with
+   * an older palette are rebuilt */
+  guint palette_gen;
 
   guint16 win_x, win_y, win_w, win_h;
 };
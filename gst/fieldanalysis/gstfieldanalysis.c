@@ -82,6 +82,13 @@ GST_DEBUG_CATEGORY_STATIC (gst_field_analysis_debug);
 #define DEFAULT_BLOCK_HEIGHT 16
 #define DEFAULT_BLOCK_THRESH 80
 #define DEFAULT_IGNORED_LINES 2
+#define DEFAULT_PREPASS FALSE
+
+/* the prepass samples one in every PREPASS_SAMPLE_STEP pairs of lines */
+#define PREPASS_SAMPLE_STEP 4
+/* coarse scores within this factor of the threshold are considered ambiguous
+ * and are recomputed at full resolution */
+#define PREPASS_GUARD 4.0f
 
 enum
 {
@@ -96,7 +103,8 @@ enum
   PROP_BLOCK_WIDTH,
   PROP_BLOCK_HEIGHT,
   PROP_BLOCK_THRESH,
-  PROP_IGNORED_LINES
+  PROP_IGNORED_LINES,
+  PROP_PREPASS
 };
 
 static GstStaticPadTemplate sink_factory =
@@ -274,6 +282,10 @@ gst_field_analysis_class_init (GstFieldAnalysisClass * klass)
           "Ignore this many lines from the top and bottom for windowed comb detection",
           2, G_MAXUINT64, DEFAULT_IGNORED_LINES,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_PREPASS,
+      g_param_spec_boolean ("prepass", "Subsampled prepass",
+          "Compute metrics on a vertically subsampled prepass and only rerun them at full resolution when the score is close to the threshold",
+          DEFAULT_PREPASS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_field_analysis_change_state);
@@ -358,6 +370,8 @@ gst_field_analysis_init (GstFieldAnalysis * filter)
   filter->block_height = DEFAULT_BLOCK_HEIGHT;
   filter->block_thresh = DEFAULT_BLOCK_THRESH;
   filter->ignored_lines = DEFAULT_IGNORED_LINES;
+  filter->prepass = DEFAULT_PREPASS;
+  filter->sample_step = 1;
 }
 
 static void
@@ -445,6 +459,9 @@ gst_field_analysis_set_property (GObject * object, guint prop_id,
     case PROP_IGNORED_LINES:
       filter->ignored_lines = g_value_get_uint64 (value);
       break;
+    case PROP_PREPASS:
+      filter->prepass = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -519,6 +536,9 @@ gst_field_analysis_get_property (GObject * object, guint prop_id,
     case PROP_IGNORED_LINES:
       g_value_set_uint64 (value, filter->ignored_lines);
       break;
+    case PROP_PREPASS:
+      g_value_set_boolean (value, filter->prepass);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -811,10 +831,11 @@ same_parity_sad (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
 
   const gint width = GST_VIDEO_FRAME_WIDTH (&(*history)[0].frame);
   const gint height = GST_VIDEO_FRAME_HEIGHT (&(*history)[0].frame);
+  const gint step = filter->sample_step;
   const gint stride0x2 =
-      GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[0].frame, 0) << 1;
+      (GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[0].frame, 0) << 1) * step;
   const gint stride1x2 =
-      GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0) << 1;
+      (GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0) << 1) * step;
   const guint32 noise_floor = filter->noise_floor;
 
   f1j =
@@ -831,7 +852,7 @@ same_parity_sad (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
       0);
 
   sum = 0.0f;
-  for (j = 0; j < (height >> 1); j++) {
+  for (j = 0; j < (height >> 1); j += step) {
     guint32 tempsum = 0;
     fieldanalysis_orc_same_parity_sad_planar_yuv (&tempsum, f1j, f2j,
         noise_floor, width);
@@ -840,7 +861,7 @@ same_parity_sad (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
     f2j += stride1x2;
   }
 
-  return sum / (0.5f * width * height);
+  return (sum * step) / (0.5f * width * height);
 }
 
 static gfloat
@@ -852,10 +873,11 @@ same_parity_ssd (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
 
   const gint width = GST_VIDEO_FRAME_WIDTH (&(*history)[0].frame);
   const gint height = GST_VIDEO_FRAME_HEIGHT (&(*history)[0].frame);
+  const gint step = filter->sample_step;
   const gint stride0x2 =
-      GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[0].frame, 0) << 1;
+      (GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[0].frame, 0) << 1) * step;
   const gint stride1x2 =
-      GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0) << 1;
+      (GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0) << 1) * step;
   /* noise floor needs to be squared for SSD */
   const guint32 noise_floor = filter->noise_floor * filter->noise_floor;
 
@@ -873,7 +895,7 @@ same_parity_ssd (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
       0);
 
   sum = 0.0f;
-  for (j = 0; j < (height >> 1); j++) {
+  for (j = 0; j < (height >> 1); j += step) {
     guint32 tempsum = 0;
     fieldanalysis_orc_same_parity_ssd_planar_yuv (&tempsum, f1j, f2j,
         noise_floor, width);
@@ -882,7 +904,7 @@ same_parity_ssd (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
     f2j += stride1x2;
   }
 
-  return sum / (0.5f * width * height); /* field is half height */
+  return (sum * step) / (0.5f * width * height);        /* field is half height */
 }
 
 /* horizontal [1,4,1] diff between fields - is this a good idea or should the
@@ -896,10 +918,11 @@ same_parity_3_tap (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
 
   const gint width = GST_VIDEO_FRAME_WIDTH (&(*history)[0].frame);
   const gint height = GST_VIDEO_FRAME_HEIGHT (&(*history)[0].frame);
+  const gint step = filter->sample_step;
   const gint stride0x2 =
-      GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[0].frame, 0) << 1;
+      (GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[0].frame, 0) << 1) * step;
   const gint stride1x2 =
-      GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0) << 1;
+      (GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0) << 1) * step;
   const gint incr = GST_VIDEO_FRAME_COMP_PSTRIDE (&(*history)[0].frame, 0);
   /* noise floor needs to be *6 for [1,4,1] */
   const guint32 noise_floor = filter->noise_floor * 6;
@@ -916,7 +939,7 @@ same_parity_3_tap (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
       0);
 
   sum = 0.0f;
-  for (j = 0; j < (height >> 1); j++) {
+  for (j = 0; j < (height >> 1); j += step) {
     guint32 tempsum = 0;
     guint32 diff;
 
@@ -942,7 +965,61 @@ same_parity_3_tap (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
     f2j += stride1x2;
   }
 
-  return sum / ((6.0f / 2.0f) * width * height);        /* 1 + 4 + 1 = 6; field is half height */
+  return (sum * step) / ((6.0f / 2.0f) * width * height);       /* 1 + 4 + 1 = 6; field is half height */
+}
+
+/* subsampled variant of opposite_parity_5_tap used for the prepass; the
+ * incremental pointer walk is replaced with per-line addressing so that
+ * lines can be skipped. the first and last line special cases are simply
+ * left out of the estimate */
+static gfloat
+opposite_parity_5_tap_coarse (GstFieldAnalysis * filter,
+    FieldAnalysisFields (*history)[2])
+{
+  gint j;
+  gfloat sum;
+  guint8 *top, *bot;
+  gint tstridex2, bstridex2;
+
+  const gint width = GST_VIDEO_FRAME_WIDTH (&(*history)[0].frame);
+  const gint height = GST_VIDEO_FRAME_HEIGHT (&(*history)[0].frame);
+  const gint step = filter->sample_step;
+  /* noise floor needs to be *6 for [1,-3,4,-3,1] */
+  const guint32 noise_floor = filter->noise_floor * 6;
+
+  if ((*history)[0].parity == TOP_FIELD) {
+    top = GST_VIDEO_FRAME_COMP_DATA (&(*history)[0].frame,
+        0) + GST_VIDEO_FRAME_COMP_OFFSET (&(*history)[0].frame, 0);
+    bot = GST_VIDEO_FRAME_COMP_DATA (&(*history)[1].frame,
+        0) + GST_VIDEO_FRAME_COMP_OFFSET (&(*history)[1].frame,
+        0) + GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0);
+    tstridex2 = GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[0].frame, 0) << 1;
+    bstridex2 = GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0) << 1;
+  } else {
+    top = GST_VIDEO_FRAME_COMP_DATA (&(*history)[1].frame,
+        0) + GST_VIDEO_FRAME_COMP_OFFSET (&(*history)[1].frame, 0);
+    bot = GST_VIDEO_FRAME_COMP_DATA (&(*history)[0].frame,
+        0) + GST_VIDEO_FRAME_COMP_OFFSET (&(*history)[0].frame,
+        0) + GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[0].frame, 0);
+    tstridex2 = GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0) << 1;
+    bstridex2 = GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[0].frame, 0) << 1;
+  }
+
+  sum = 0.0f;
+  for (j = 1; j < (height >> 1) - 1; j += step) {
+    guint8 *fj = top + j * tstridex2;
+    guint8 *fjm2 = fj - tstridex2;
+    guint8 *fjp2 = fj + tstridex2;
+    guint8 *fjm1 = bot + (j - 1) * bstridex2;
+    guint8 *fjp1 = fjm1 + bstridex2;
+    guint32 tempsum = 0;
+
+    fieldanalysis_orc_opposite_parity_5_tap_planar_yuv (&tempsum, fjm2, fjm1,
+        fj, fjp1, fjp2, noise_floor, width);
+    sum += tempsum;
+  }
+
+  return (sum * step) / ((6.0f / 2.0f) * width * height);       /* 1 + 4 + 1 == 3 + 3 == 6; field is half height */
 }
 
 /* vertical [1,-3,4,-3,1] - same as is used in FieldDiff from TIVTC,
@@ -966,6 +1043,9 @@ opposite_parity_5_tap (GstFieldAnalysis * filter,
   /* noise floor needs to be *6 for [1,-3,4,-3,1] */
   const guint32 noise_floor = filter->noise_floor * 6;
 
+  if (filter->sample_step > 1)
+    return opposite_parity_5_tap_coarse (filter, history);
+
   sum = 0.0f;
 
   /* fj is line j of the combined frame made from the top field even lines of
@@ -1384,6 +1464,34 @@ opposite_parity_windowed_comb (GstFieldAnalysis * filter,
   return (gfloat) slightly_combed;      /* TRUE means blend, else don't */
 }
 
+/* run a metric on a subsampled prepass first and only rerun it at full
+ * resolution when the coarse score is too close to the threshold to be
+ * decisive either way. metrics that do not honour sample_step (such as the
+ * windowed comb detection) just run once at full resolution */
+static gfloat
+gst_field_analysis_run_metric (GstFieldAnalysis * filter,
+    gfloat (*metric) (GstFieldAnalysis *, FieldAnalysisFields (*)[2]),
+    FieldAnalysisFields (*history)[2], gfloat thresh)
+{
+  gfloat score;
+
+  if (!filter->prepass)
+    return metric (filter, history);
+
+  filter->sample_step = PREPASS_SAMPLE_STEP;
+  score = metric (filter, history);
+  filter->sample_step = 1;
+
+  if (score > thresh / PREPASS_GUARD && score < thresh * PREPASS_GUARD) {
+    GST_LOG_OBJECT (filter,
+        "Coarse score %f ambiguous against threshold %f - escalating to full resolution",
+        score, thresh);
+    score = metric (filter, history);
+  }
+
+  return score;
+}
+
 /* this is where the magic happens
  *
  * the buffer incoming to the chain function (buf_to_queue) is added to the
@@ -1441,7 +1549,8 @@ gst_field_analysis_process_buffer (GstFieldAnalysis * filter,
     history[1].parity = BOTTOM_FIELD;
     /* compare the fields within the buffer, if the buffer exhibits combing it
      * could be interlaced or a mixed telecine frame */
-    res0->f = filter->same_frame (filter, &history);
+    res0->f = gst_field_analysis_run_metric (filter, filter->same_frame,
+        &history, filter->frame_thresh);
     res0->t = res0->b = res0->t_b = res0->b_t = G_MAXFLOAT;
     if (filter->nframes == 1)
       GST_DEBUG_OBJECT (filter, "Scores: f %f, t , b , t_b , b_t ", res0->f);
@@ -1464,19 +1573,23 @@ gst_field_analysis_process_buffer (GstFieldAnalysis * filter,
     /* compare the top and bottom fields to the previous frame */
     history[0].parity = TOP_FIELD;
     history[1].parity = TOP_FIELD;
-    res0->t = filter->same_field (filter, &history);
+    res0->t = gst_field_analysis_run_metric (filter, filter->same_field,
+        &history, filter->field_thresh);
     history[0].parity = BOTTOM_FIELD;
     history[1].parity = BOTTOM_FIELD;
-    res0->b = filter->same_field (filter, &history);
+    res0->b = gst_field_analysis_run_metric (filter, filter->same_field,
+        &history, filter->field_thresh);
 
     /* compare the top field from this frame to the bottom of the previous for
      * for combing (and vice versa) */
     history[0].parity = TOP_FIELD;
     history[1].parity = BOTTOM_FIELD;
-    res0->t_b = filter->same_frame (filter, &history);
+    res0->t_b = gst_field_analysis_run_metric (filter, filter->same_frame,
+        &history, filter->frame_thresh);
     history[0].parity = BOTTOM_FIELD;
     history[1].parity = TOP_FIELD;
-    res0->b_t = filter->same_frame (filter, &history);
+    res0->b_t = gst_field_analysis_run_metric (filter, filter->same_frame,
+        &history, filter->frame_thresh);
 
     GST_DEBUG_OBJECT (filter,
         "Scores: f %f, t %f, b %f, t_b %f, b_t %f", res0->f,
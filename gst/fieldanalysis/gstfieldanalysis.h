@@ -126,6 +126,8 @@ struct _GstFieldAnalysis
   guint8 *comb_mask;
   guint *block_scores;
   gboolean flushing;     /* indicates whether we are flushing or not */
+  guint sample_step;     /* 1 for full resolution; >1 while a metric runs as a
+                          * subsampled prepass */
 
   /* properties */
   guint32 noise_floor; /* threshold for the result of a metric to be valid */
@@ -135,6 +137,8 @@ struct _GstFieldAnalysis
   guint64 block_width, block_height; /* width/height of window used for comb clusted detection */
   guint64 block_thresh;
   guint64 ignored_lines;
+  gboolean prepass;      /* compute metrics on subsampled luma first and only
+                          * escalate ambiguous scores to full resolution */
 };
 
 struct _GstFieldAnalysisClass
@@ -195,17 +195,35 @@ freeverb_allpass_getfeedback(freeverb_allpass* allpass)
   return allpass->feedback;
 }*/
 
-#define freeverb_allpass_process(_allpass, _input_1) \
-{ \
-  gfloat output; \
-  gfloat bufout; \
-  bufout = _allpass.buffer[_allpass.bufidx]; \
-  output = bufout-_input_1; \
-  _allpass.buffer[_allpass.bufidx] = _input_1 + (bufout * _allpass.feedback); \
-  if (++_allpass.bufidx >= _allpass.bufsize) { \
-    _allpass.bufidx = 0; \
-  } \
-  _input_1 = output; \
+/* Runs one allpass over a whole tile in place.  Each filter keeps its
+ * own sample order, so this is sample-exact with per-sample processing;
+ * splitting at the ring buffer wrap keeps the inner loop branch-free. */
+static void
+freeverb_allpass_process_block (freeverb_allpass * allpass, gfloat * io,
+    gint n)
+{
+  const gfloat feedback = allpass->feedback;
+  gfloat *buffer = allpass->buffer;
+  gint bufidx = allpass->bufidx, bufsize = allpass->bufsize;
+  gint i = 0, j;
+
+  while (i < n) {
+    gint span = MIN (n - i, bufsize - bufidx);
+    gfloat *b = buffer + bufidx;
+
+    for (j = 0; j < span; j++) {
+      gfloat bufout = b[j];
+      gfloat output = bufout - io[i + j];
+
+      b[j] = io[i + j] + (bufout * feedback);
+      io[i + j] = output;
+    }
+    i += span;
+    bufidx += span;
+    if (bufidx >= bufsize)
+      bufidx = 0;
+  }
+  allpass->bufidx = bufidx;
 }
 
 /* comb filter */
@@ -274,19 +292,46 @@ freeverb_comb_getfeedback(freeverb_comb* comb)
   return comb->feedback;
 }*/
 
-#define freeverb_comb_process(_comb, _input_1, _output) \
-{ \
-  gfloat _tmp = _comb.buffer[_comb.bufidx]; \
-  _comb.filterstore = (_tmp * _comb.damp2) + (_comb.filterstore * _comb.damp1); \
-  _comb.buffer[_comb.bufidx] = _input_1 + (_comb.filterstore * _comb.feedback); \
-  if (++_comb.bufidx >= _comb.bufsize) { \
-    _comb.bufidx = 0; \
-  } \
-  _output += _tmp; \
+/* Runs one comb over a whole tile, accumulating into out.  The damping
+ * IIR stays sequential per comb, but the filter state lives in locals
+ * and the ring buffer is walked in linear spans. */
+static void
+freeverb_comb_process_block (freeverb_comb * comb, const gfloat * in,
+    gfloat * out, gint n)
+{
+  const gfloat damp1 = comb->damp1, damp2 = comb->damp2;
+  const gfloat feedback = comb->feedback;
+  gfloat filterstore = comb->filterstore;
+  gfloat *buffer = comb->buffer;
+  gint bufidx = comb->bufidx, bufsize = comb->bufsize;
+  gint i = 0, j;
+
+  while (i < n) {
+    gint span = MIN (n - i, bufsize - bufidx);
+    gfloat *b = buffer + bufidx;
+
+    for (j = 0; j < span; j++) {
+      gfloat tmp = b[j];
+
+      filterstore = (tmp * damp2) + (filterstore * damp1);
+      b[j] = in[i + j] + (filterstore * feedback);
+      out[i + j] += tmp;
+    }
+    i += span;
+    bufidx += span;
+    if (bufidx >= bufsize)
+      bufidx = 0;
+  }
+  comb->filterstore = filterstore;
+  comb->bufidx = bufidx;
 }
 
 #define numcombs 8
 #define numallpasses 4
+/* samples processed per filter pass; combs are independent of each
+ * other and each allpass sees its full input tile before running, so
+ * any tile size produces the same output as per-sample processing */
+#define FREEVERB_TILE_SIZE 64
 #define	fixedgain 0.015f
 #define scalewet 1.0f
 #define scaledry 1.0f
@@ -690,46 +735,56 @@ gst_freeverb_transform_m2s_int (GstFreeverb * filter,
     gint16 * idata, gint16 * odata, guint num_samples)
 {
   GstFreeverbPrivate *priv = filter->priv;
-  gint i, k;
-  gfloat out_l1, out_r1, input_1;
-  gfloat out_l2, out_r2, input_2;
+  gfloat input_1[FREEVERB_TILE_SIZE], input_2[FREEVERB_TILE_SIZE];
+  gfloat out_l[FREEVERB_TILE_SIZE], out_r[FREEVERB_TILE_SIZE];
+  gint i, k, n;
+  gfloat out_l2, out_r2;
   gboolean drained = TRUE;
 
-  for (k = 0; k < num_samples; k++) {
-    out_l1 = out_r1 = 0.0;
+  while (num_samples > 0) {
+    n = MIN (num_samples, FREEVERB_TILE_SIZE);
 
     /* The original Freeverb code expects a stereo signal and 'input_1'
      * is set to the sum of the left and right input_1 sample. Since
      * this code works on a mono signal, 'input_1' is set to twice the
      * input_1 sample. */
-    input_2 = (gfloat) * idata++;
-    input_1 = (2.0f * input_2 + DC_OFFSET) * priv->gain;
+    for (k = 0; k < n; k++) {
+      input_2[k] = (gfloat) idata[k];
+      input_1[k] = (2.0f * input_2[k] + DC_OFFSET) * priv->gain;
+      out_l[k] = out_r[k] = 0.0;
+    }
 
     /* Accumulate comb filters in parallel */
     for (i = 0; i < numcombs; i++) {
-      freeverb_comb_process (priv->combL[i], input_1, out_l1);
-      freeverb_comb_process (priv->combR[i], input_1, out_r1);
+      freeverb_comb_process_block (&priv->combL[i], input_1, out_l, n);
+      freeverb_comb_process_block (&priv->combR[i], input_1, out_r, n);
     }
     /* Feed through allpasses in series */
     for (i = 0; i < numallpasses; i++) {
-      freeverb_allpass_process (priv->allpassL[i], out_l1);
-      freeverb_allpass_process (priv->allpassR[i], out_r1);
+      freeverb_allpass_process_block (&priv->allpassL[i], out_l, n);
+      freeverb_allpass_process_block (&priv->allpassR[i], out_r, n);
     }
 
-    /* Remove the DC offset */
-    out_l1 -= (gfloat) DC_OFFSET;
-    out_r1 -= (gfloat) DC_OFFSET;
-
-    /* Calculate output */
-    out_l2 = out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2 * priv->dry;
-    out_r2 = out_r1 * priv->wet1 + out_l1 * priv->wet2 + input_2 * priv->dry;
-    out_l2 = CLAMP (out_l2, G_MININT16, G_MAXINT16);
-    out_r2 = CLAMP (out_r2, G_MININT16, G_MAXINT16);
-    *odata++ = (gint16) out_l2;
-    *odata++ = (gint16) out_r2;
-
-    if (abs ((gint16) out_l2) > 0 || abs ((gint16) out_r2) > 0)
-      drained = FALSE;
+    for (k = 0; k < n; k++) {
+      /* Remove the DC offset */
+      gfloat out_l1 = out_l[k] - (gfloat) DC_OFFSET;
+      gfloat out_r1 = out_r[k] - (gfloat) DC_OFFSET;
+
+      /* Calculate output */
+      out_l2 =
+          out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2[k] * priv->dry;
+      out_r2 =
+          out_r1 * priv->wet1 + out_l1 * priv->wet2 + input_2[k] * priv->dry;
+      out_l2 = CLAMP (out_l2, G_MININT16, G_MAXINT16);
+      out_r2 = CLAMP (out_r2, G_MININT16, G_MAXINT16);
+      *odata++ = (gint16) out_l2;
+      *odata++ = (gint16) out_r2;
+
+      if (abs ((gint16) out_l2) > 0 || abs ((gint16) out_r2) > 0)
+        drained = FALSE;
+    }
+    idata += n;
+    num_samples -= n;
   }
   return drained;
 }
@@ -739,44 +794,55 @@ gst_freeverb_transform_s2s_int (GstFreeverb * filter,
     gint16 * idata, gint16 * odata, guint num_samples)
 {
   GstFreeverbPrivate *priv = filter->priv;
-  gint i, k;
-  gfloat out_l1, out_r1, input_1l, input_1r;
-  gfloat out_l2, out_r2, input_2l, input_2r;
+  gfloat input_1l[FREEVERB_TILE_SIZE], input_1r[FREEVERB_TILE_SIZE];
+  gfloat input_2l[FREEVERB_TILE_SIZE], input_2r[FREEVERB_TILE_SIZE];
+  gfloat out_l[FREEVERB_TILE_SIZE], out_r[FREEVERB_TILE_SIZE];
+  gint i, k, n;
+  gfloat out_l2, out_r2;
   gboolean drained = TRUE;
 
-  for (k = 0; k < num_samples; k++) {
-    out_l1 = out_r1 = 0.0;
+  while (num_samples > 0) {
+    n = MIN (num_samples, FREEVERB_TILE_SIZE);
 
-    input_2l = (gfloat) * idata++;
-    input_2r = (gfloat) * idata++;
-    input_1l = (input_2l + DC_OFFSET) * priv->gain;
-    input_1r = (input_2r + DC_OFFSET) * priv->gain;
+    for (k = 0; k < n; k++) {
+      input_2l[k] = (gfloat) idata[2 * k];
+      input_2r[k] = (gfloat) idata[2 * k + 1];
+      input_1l[k] = (input_2l[k] + DC_OFFSET) * priv->gain;
+      input_1r[k] = (input_2r[k] + DC_OFFSET) * priv->gain;
+      out_l[k] = out_r[k] = 0.0;
+    }
 
     /* Accumulate comb filters in parallel */
     for (i = 0; i < numcombs; i++) {
-      freeverb_comb_process (priv->combL[i], input_1l, out_l1);
-      freeverb_comb_process (priv->combR[i], input_1r, out_r1);
+      freeverb_comb_process_block (&priv->combL[i], input_1l, out_l, n);
+      freeverb_comb_process_block (&priv->combR[i], input_1r, out_r, n);
     }
     /* Feed through allpasses in series */
     for (i = 0; i < numallpasses; i++) {
-      freeverb_allpass_process (priv->allpassL[i], out_l1);
-      freeverb_allpass_process (priv->allpassR[i], out_r1);
+      freeverb_allpass_process_block (&priv->allpassL[i], out_l, n);
+      freeverb_allpass_process_block (&priv->allpassR[i], out_r, n);
     }
 
-    /* Remove the DC offset */
-    out_l1 -= (gfloat) DC_OFFSET;
-    out_r1 -= (gfloat) DC_OFFSET;
-
-    /* Calculate output */
-    out_l2 = out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2l * priv->dry;
-    out_r2 = out_r1 * priv->wet1 + out_l1 * priv->wet2 + input_2r * priv->dry;
-    out_l2 = CLAMP (out_l2, G_MININT16, G_MAXINT16);
-    out_r2 = CLAMP (out_r2, G_MININT16, G_MAXINT16);
-    *odata++ = (gint16) out_l2;
-    *odata++ = (gint16) out_r2;
-
-    if (abs ((gint16) out_l2) > 0 || abs ((gint16) out_r2) > 0)
-      drained = FALSE;
+    for (k = 0; k < n; k++) {
+      /* Remove the DC offset */
+      gfloat out_l1 = out_l[k] - (gfloat) DC_OFFSET;
+      gfloat out_r1 = out_r[k] - (gfloat) DC_OFFSET;
+
+      /* Calculate output */
+      out_l2 =
+          out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2l[k] * priv->dry;
+      out_r2 =
+          out_r1 * priv->wet1 + out_l1 * priv->wet2 + input_2r[k] * priv->dry;
+      out_l2 = CLAMP (out_l2, G_MININT16, G_MAXINT16);
+      out_r2 = CLAMP (out_r2, G_MININT16, G_MAXINT16);
+      *odata++ = (gint16) out_l2;
+      *odata++ = (gint16) out_r2;
+
+      if (abs ((gint16) out_l2) > 0 || abs ((gint16) out_r2) > 0)
+        drained = FALSE;
+    }
+    idata += 2 * n;
+    num_samples -= n;
   }
   return drained;
 }
@@ -786,44 +852,54 @@ gst_freeverb_transform_m2s_float (GstFreeverb * filter,
     gfloat * idata, gfloat * odata, guint num_samples)
 {
   GstFreeverbPrivate *priv = filter->priv;
-  gint i, k;
-  gfloat out_l1, out_r1, input_1;
-  gfloat out_l2, out_r2, input_2;
+  gfloat input_1[FREEVERB_TILE_SIZE], input_2[FREEVERB_TILE_SIZE];
+  gfloat out_l[FREEVERB_TILE_SIZE], out_r[FREEVERB_TILE_SIZE];
+  gint i, k, n;
+  gfloat out_l2, out_r2;
   gboolean drained = TRUE;
 
-  for (k = 0; k < num_samples; k++) {
-    out_l1 = out_r1 = 0.0;
+  while (num_samples > 0) {
+    n = MIN (num_samples, FREEVERB_TILE_SIZE);
 
     /* The original Freeverb code expects a stereo signal and 'input_1'
      * is set to the sum of the left and right input_1 sample. Since
      * this code works on a mono signal, 'input_1' is set to twice the
      * input_1 sample. */
-    input_2 = *idata++;
-    input_1 = (2.0f * input_2 + DC_OFFSET) * priv->gain;
+    for (k = 0; k < n; k++) {
+      input_2[k] = idata[k];
+      input_1[k] = (2.0f * input_2[k] + DC_OFFSET) * priv->gain;
+      out_l[k] = out_r[k] = 0.0;
+    }
 
     /* Accumulate comb filters in parallel */
     for (i = 0; i < numcombs; i++) {
-      freeverb_comb_process (priv->combL[i], input_1, out_l1);
-      freeverb_comb_process (priv->combR[i], input_1, out_r1);
+      freeverb_comb_process_block (&priv->combL[i], input_1, out_l, n);
+      freeverb_comb_process_block (&priv->combR[i], input_1, out_r, n);
     }
     /* Feed through allpasses in series */
     for (i = 0; i < numallpasses; i++) {
-      freeverb_allpass_process (priv->allpassL[i], out_l1);
-      freeverb_allpass_process (priv->allpassR[i], out_r1);
+      freeverb_allpass_process_block (&priv->allpassL[i], out_l, n);
+      freeverb_allpass_process_block (&priv->allpassR[i], out_r, n);
     }
 
-    /* Remove the DC offset */
-    out_l1 -= (gfloat) DC_OFFSET;
-    out_r1 -= (gfloat) DC_OFFSET;
-
-    /* Calculate output */
-    out_l2 = out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2 * priv->dry;
-    out_r2 = out_r1 * priv->wet1 + out_l1 * priv->wet2 + input_2 * priv->dry;
-    *odata++ = out_l2;
-    *odata++ = out_r2;
-
-    if (fabs (out_l2) > 0 || fabs (out_r2) > 0)
-      drained = FALSE;
+    for (k = 0; k < n; k++) {
+      /* Remove the DC offset */
+      gfloat out_l1 = out_l[k] - (gfloat) DC_OFFSET;
+      gfloat out_r1 = out_r[k] - (gfloat) DC_OFFSET;
+
+      /* Calculate output */
+      out_l2 =
+          out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2[k] * priv->dry;
+      out_r2 =
+          out_r1 * priv->wet1 + out_l1 * priv->wet2 + input_2[k] * priv->dry;
+      *odata++ = out_l2;
+      *odata++ = out_r2;
+
+      if (fabs (out_l2) > 0 || fabs (out_r2) > 0)
+        drained = FALSE;
+    }
+    idata += n;
+    num_samples -= n;
   }
   return drained;
 }
@@ -833,42 +909,53 @@ gst_freeverb_transform_s2s_float (GstFreeverb * filter,
     gfloat * idata, gfloat * odata, guint num_samples)
 {
   GstFreeverbPrivate *priv = filter->priv;
-  gint i, k;
-  gfloat out_l1, out_r1, input_1l, input_1r;
-  gfloat out_l2, out_r2, input_2l, input_2r;
+  gfloat input_1l[FREEVERB_TILE_SIZE], input_1r[FREEVERB_TILE_SIZE];
+  gfloat input_2l[FREEVERB_TILE_SIZE], input_2r[FREEVERB_TILE_SIZE];
+  gfloat out_l[FREEVERB_TILE_SIZE], out_r[FREEVERB_TILE_SIZE];
+  gint i, k, n;
+  gfloat out_l2, out_r2;
   gboolean drained = TRUE;
 
-  for (k = 0; k < num_samples; k++) {
-    out_l1 = out_r1 = 0.0;
+  while (num_samples > 0) {
+    n = MIN (num_samples, FREEVERB_TILE_SIZE);
 
-    input_2l = *idata++;
-    input_2r = *idata++;
-    input_1l = (input_2l + DC_OFFSET) * priv->gain;
-    input_1r = (input_2r + DC_OFFSET) * priv->gain;
+    for (k = 0; k < n; k++) {
+      input_2l[k] = idata[2 * k];
+      input_2r[k] = idata[2 * k + 1];
+      input_1l[k] = (input_2l[k] + DC_OFFSET) * priv->gain;
+      input_1r[k] = (input_2r[k] + DC_OFFSET) * priv->gain;
+      out_l[k] = out_r[k] = 0.0;
+    }
 
     /* Accumulate comb filters in parallel */
     for (i = 0; i < numcombs; i++) {
-      freeverb_comb_process (priv->combL[i], input_1l, out_l1);
-      freeverb_comb_process (priv->combR[i], input_1r, out_r1);
+      freeverb_comb_process_block (&priv->combL[i], input_1l, out_l, n);
+      freeverb_comb_process_block (&priv->combR[i], input_1r, out_r, n);
     }
     /* Feed through allpasses in series */
     for (i = 0; i < numallpasses; i++) {
-      freeverb_allpass_process (priv->allpassL[i], out_l1);
-      freeverb_allpass_process (priv->allpassR[i], out_r1);
+      freeverb_allpass_process_block (&priv->allpassL[i], out_l, n);
+      freeverb_allpass_process_block (&priv->allpassR[i], out_r, n);
     }
 
-    /* Remove the DC offset */
-    out_l1 -= (gfloat) DC_OFFSET;
-    out_r1 -= (gfloat) DC_OFFSET;
-
-    /* Calculate output */
-    out_l2 = out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2l * priv->dry;
-    out_r2 = out_r1 * priv->wet1 + out_l1 * priv->wet2 + input_2r * priv->dry;
-    *odata++ = out_l2;
-    *odata++ = out_r2;
-
-    if (fabs (out_l2) > 0 || fabs (out_r2) > 0)
-      drained = FALSE;
+    for (k = 0; k < n; k++) {
+      /* Remove the DC offset */
+      gfloat out_l1 = out_l[k] - (gfloat) DC_OFFSET;
+      gfloat out_r1 = out_r[k] - (gfloat) DC_OFFSET;
+
+      /* Calculate output */
+      out_l2 =
+          out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2l[k] * priv->dry;
+      out_r2 =
+          out_r1 * priv->wet1 + out_l1 * priv->wet2 + input_2r[k] * priv->dry;
+      *odata++ = out_l2;
+      *odata++ = out_r2;
+
+      if (fabs (out_l2) > 0 || fabs (out_r2) > 0)
+        drained = FALSE;
+    }
+    idata += 2 * n;
+    num_samples -= n;
   }
   return drained;
 }
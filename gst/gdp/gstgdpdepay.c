@@ -39,6 +39,7 @@
 #include <string.h>
 
 #include "dataprotocol.h"
+#include "dp-private.h"
 
 #include "gstgdpdepay.h"
 
@@ -154,7 +155,6 @@ gst_gdp_depay_finalize (GObject * gobject)
   this = GST_GDP_DEPAY (gobject);
   if (this->caps)
     gst_caps_unref (this->caps);
-  g_free (this->header);
   gst_adapter_clear (this->adapter);
   g_object_unref (this->adapter);
   if (this->allocator)
@@ -288,7 +288,7 @@ gst_gdp_depay_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
     switch (this->state) {
       case GST_GDP_DEPAY_STATE_HEADER:
       {
-        guint8 *header;
+        const guint8 *header;
 
         /* collect a complete header, validate and store the header. Figure out
          * the payload length and switch to the PAYLOAD state */
@@ -297,9 +297,12 @@ gst_gdp_depay_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
           goto done;
 
         GST_LOG_OBJECT (this, "reading GDP header from adapter");
-        header = gst_adapter_take (this->adapter, GST_DP_HEADER_LENGTH);
+        /* parse the header in place in the adapter; only the validated
+         * header is copied into our fixed-size storage, so no per-packet
+         * allocation happens here */
+        header = gst_adapter_map (this->adapter, GST_DP_HEADER_LENGTH);
         if (!gst_dp_validate_header (GST_DP_HEADER_LENGTH, header)) {
-          g_free (header);
+          gst_adapter_unmap (this->adapter);
           goto header_validate_error;
         }
 
@@ -307,9 +310,9 @@ gst_gdp_depay_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
          * to make the payload. */
         this->payload_length = gst_dp_header_payload_length (header);
         this->payload_type = gst_dp_header_payload_type (header);
-        /* free previous header and store new one. */
-        g_free (this->header);
-        this->header = header;
+        memcpy (this->header, header, GST_DP_HEADER_LENGTH);
+        gst_adapter_unmap (this->adapter);
+        gst_adapter_flush (this->adapter, GST_DP_HEADER_LENGTH);
 
         GST_LOG_OBJECT (this,
             "read GDP header, payload size %d, payload type %d, switching to state PAYLOAD",
@@ -362,21 +365,45 @@ gst_gdp_depay_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
           goto no_caps;
 
         GST_LOG_OBJECT (this, "reading GDP buffer from adapter");
-        buf =
-            gst_dp_buffer_from_header (GST_DP_HEADER_LENGTH, this->header,
-            this->allocator, &this->allocation_params);
-        if (!buf)
-          goto buffer_failed;
-
-        /* now take the payload if there is any */
-        if (this->payload_length > 0) {
-          GstMapInfo map;
-
-          gst_buffer_map (buf, &map, GST_MAP_WRITE);
-          gst_adapter_copy (this->adapter, map.data, 0, this->payload_length);
-          gst_buffer_unmap (buf, &map);
-
-          gst_adapter_flush (this->adapter, this->payload_length);
+        if (this->allocator == NULL && this->payload_length > 0) {
+          /* no downstream allocator to satisfy; take the payload out of the
+           * adapter without copying. The payload usually sits in a single
+           * upstream buffer, in which case this just slices off a sub-buffer
+           * sharing the input memory. */
+          buf = gst_adapter_take_buffer (this->adapter, this->payload_length);
+          if (!buf)
+            goto buffer_failed;
+          buf = gst_buffer_make_writable (buf);
+
+          GST_BUFFER_TIMESTAMP (buf) =
+              GST_DP_HEADER_TIMESTAMP (this->header);
+          GST_BUFFER_DTS (buf) = GST_DP_HEADER_DTS (this->header);
+          GST_BUFFER_DURATION (buf) = GST_DP_HEADER_DURATION (this->header);
+          GST_BUFFER_OFFSET (buf) = GST_DP_HEADER_OFFSET (this->header);
+          GST_BUFFER_OFFSET_END (buf) =
+              GST_DP_HEADER_OFFSET_END (this->header);
+          GST_BUFFER_FLAGS (buf) =
+              GST_DP_HEADER_BUFFER_FLAGS (this->header);
+        } else {
+          /* downstream asked for a specific allocator, so copy the payload
+           * into a buffer allocated from it */
+          buf =
+              gst_dp_buffer_from_header (GST_DP_HEADER_LENGTH, this->header,
+              this->allocator, &this->allocation_params);
+          if (!buf)
+            goto buffer_failed;
+
+          /* now take the payload if there is any */
+          if (this->payload_length > 0) {
+            GstMapInfo map;
+
+            gst_buffer_map (buf, &map, GST_MAP_WRITE);
+            gst_adapter_copy (this->adapter, map.data, 0,
+                this->payload_length);
+            gst_buffer_unmap (buf, &map);
+
+            gst_adapter_flush (this->adapter, this->payload_length);
+          }
         }
 
         if (GST_BUFFER_TIMESTAMP (buf) > -this->ts_offset)
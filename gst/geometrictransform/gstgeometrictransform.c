@@ -91,6 +91,8 @@ gst_geometric_transform_generate_map (GstGeometricTransform * gt)
   /* cleanup old map */
   g_free (gt->map);
   gt->map = NULL;
+  g_free (gt->offset_map);
+  gt->offset_map = NULL;
 
   klass = GST_GEOMETRIC_TRANSFORM_GET_CLASS (gt);
 
@@ -127,6 +129,161 @@ end:
   return ret;
 }
 
+/* must be called with the object lock, after the map was generated.
+ * Bakes the floating point map, the off-edge handling and the bounds
+ * check into one source byte offset per output pixel, so that applying
+ * the map is a plain gather loop. */
+static void
+gst_geometric_transform_compile_map (GstGeometricTransform * gt)
+{
+  const gdouble *ptr = gt->map;
+  gint32 *offs;
+  gint x, y;
+
+  if (gt->offset_map == NULL)
+    gt->offset_map = g_malloc (sizeof (gint32) * gt->width * gt->height);
+  offs = gt->offset_map;
+
+  for (y = 0; y < gt->height; y++) {
+    for (x = 0; x < gt->width; x++) {
+      gdouble in_x = ptr[0];
+      gdouble in_y = ptr[1];
+      gint trunc_x, trunc_y;
+
+      ptr += 2;
+
+      switch (gt->off_edge_pixels) {
+        case GST_GT_OFF_EDGES_PIXELS_CLAMP:
+          in_x = CLAMP (in_x, 0, gt->width - 1);
+          in_y = CLAMP (in_y, 0, gt->height - 1);
+          break;
+
+        case GST_GT_OFF_EDGES_PIXELS_WRAP:
+          in_x = gst_gm_mod_float (in_x, gt->width);
+          in_y = gst_gm_mod_float (in_y, gt->height);
+          if (in_x < 0)
+            in_x += gt->width;
+          if (in_y < 0)
+            in_y += gt->height;
+          break;
+
+        default:
+          break;
+      }
+
+      trunc_x = (gint) in_x;
+      trunc_y = (gint) in_y;
+      if (trunc_x >= 0 && trunc_x < gt->width && trunc_y >= 0 &&
+          trunc_y < gt->height)
+        *offs++ = trunc_y * gt->row_stride + trunc_x * gt->pixel_stride;
+      else
+        *offs++ = -1;
+    }
+  }
+  gt->compiled_off_edge = gt->off_edge_pixels;
+}
+
+static void
+gst_geometric_transform_remap_rows (GstGeometricTransform * gt,
+    const guint8 * in_data, guint8 * out_data, gint y0, gint y1)
+{
+  const gint32 *offs = gt->offset_map + (gsize) y0 * gt->width;
+  gint x, y;
+
+  if (gt->pixel_stride == 4) {
+    for (y = y0; y < y1; y++) {
+      guint8 *out_row = out_data + y * gt->row_stride;
+
+      for (x = 0; x < gt->width; x++) {
+        gint32 off = *offs++;
+
+        if (off >= 0)
+          memcpy (out_row + x * 4, in_data + off, 4);
+      }
+    }
+  } else {
+    for (y = y0; y < y1; y++) {
+      guint8 *out_row = out_data + y * gt->row_stride;
+
+      for (x = 0; x < gt->width; x++) {
+        gint32 off = *offs++;
+
+        if (off >= 0)
+          memcpy (out_row + x * gt->pixel_stride, in_data + off,
+              gt->pixel_stride);
+      }
+    }
+  }
+}
+
+/* rows per band below which threading is not worth the synchronisation
+ * overhead */
+#define MIN_ROWS_PER_BAND 64
+#define MAX_WORKERS 8
+
+typedef struct
+{
+  GstGeometricTransform *gt;
+  const guint8 *in_data;
+  guint8 *out_data;
+  gint y0, y1;
+} GstGtRemapBand;
+
+static void
+gst_geometric_transform_band_func (gpointer task_data, gpointer user_data)
+{
+  GstGtRemapBand *band = task_data;
+  GstGeometricTransform *gt = band->gt;
+
+  gst_geometric_transform_remap_rows (gt, band->in_data, band->out_data,
+      band->y0, band->y1);
+
+  g_mutex_lock (&gt->task_lock);
+  gt->tasks_pending--;
+  if (gt->tasks_pending == 0)
+    g_cond_signal (&gt->task_cond);
+  g_mutex_unlock (&gt->task_lock);
+
+  g_slice_free (GstGtRemapBand, band);
+}
+
+static void
+gst_geometric_transform_remap (GstGeometricTransform * gt,
+    const guint8 * in_data, guint8 * out_data)
+{
+  gint n_bands = 1;
+
+  if (gt->worker_pool)
+    n_bands = CLAMP (gt->height / MIN_ROWS_PER_BAND, 1, (gint) gt->n_workers);
+
+  if (n_bands > 1) {
+    gint rows = (gt->height + n_bands - 1) / n_bands;
+    gint b;
+
+    g_mutex_lock (&gt->task_lock);
+    gt->tasks_pending += n_bands;
+    g_mutex_unlock (&gt->task_lock);
+
+    for (b = 0; b < n_bands; b++) {
+      GstGtRemapBand *band = g_slice_new (GstGtRemapBand);
+
+      band->gt = gt;
+      band->in_data = in_data;
+      band->out_data = out_data;
+      band->y0 = b * rows;
+      band->y1 = MIN ((b + 1) * rows, gt->height);
+      g_thread_pool_push (gt->worker_pool, band, NULL);
+    }
+
+    g_mutex_lock (&gt->task_lock);
+    while (gt->tasks_pending > 0)
+      g_cond_wait (&gt->task_cond, &gt->task_lock);
+    g_mutex_unlock (&gt->task_lock);
+  } else {
+    gst_geometric_transform_remap_rows (gt, in_data, out_data, 0, gt->height);
+  }
+}
+
 static gboolean
 gst_geometric_transform_set_info (GstVideoFilter * vfilter, GstCaps * incaps,
     GstVideoInfo * in_info, GstCaps * outcaps, GstVideoInfo * out_info)
@@ -231,7 +388,6 @@ gst_geometric_transform_transform_frame (GstVideoFilter * vfilter,
   GstGeometricTransformClass *klass;
   gint x, y, i;
   GstFlowReturn ret = GST_FLOW_OK;
-  gdouble *ptr;
   guint8 *in_data;
   guint8 *out_data;
 
@@ -262,15 +418,10 @@ gst_geometric_transform_transform_frame (GstVideoFilter * vfilter,
       gst_geometric_transform_generate_map (gt);
     }
     g_return_val_if_fail (gt->map, GST_FLOW_ERROR);
-    ptr = gt->map;
-    for (y = 0; y < gt->height; y++) {
-      for (x = 0; x < gt->width; x++) {
-        /* do the mapping */
-        gst_geometric_transform_do_map (gt, in_data, out_data, x, y, ptr[0],
-            ptr[1]);
-        ptr += 2;
-      }
-    }
+    if (gt->offset_map == NULL
+        || gt->compiled_off_edge != gt->off_edge_pixels)
+      gst_geometric_transform_compile_map (gt);
+    gst_geometric_transform_remap (gt, in_data, out_data);
   } else {
     for (y = 0; y < gt->height; y++) {
       for (x = 0; x < gt->width; x++) {
@@ -331,6 +482,19 @@ gst_geometric_transform_get_property (GObject * object, guint prop_id,
 }
 
 
+static gboolean
+gst_geometric_transform_start (GstBaseTransform * trans)
+{
+  GstGeometricTransform *gt = GST_GEOMETRIC_TRANSFORM_CAST (trans);
+
+  gt->n_workers = CLAMP (g_get_num_processors (), 1, MAX_WORKERS);
+  if (gt->n_workers > 1)
+    gt->worker_pool = g_thread_pool_new (gst_geometric_transform_band_func,
+        gt, gt->n_workers, TRUE, NULL);
+
+  return TRUE;
+}
+
 static gboolean
 gst_geometric_transform_stop (GstBaseTransform * trans)
 {
@@ -338,15 +502,33 @@ gst_geometric_transform_stop (GstBaseTransform * trans)
 
   GST_INFO_OBJECT (gt, "Deleting transform map");
 
+  if (gt->worker_pool) {
+    g_thread_pool_free (gt->worker_pool, FALSE, TRUE);
+    gt->worker_pool = NULL;
+  }
+
   gt->width = 0;
   gt->height = 0;
 
   g_free (gt->map);
   gt->map = NULL;
+  g_free (gt->offset_map);
+  gt->offset_map = NULL;
 
   return TRUE;
 }
 
+static void
+gst_geometric_transform_finalize (GObject * object)
+{
+  GstGeometricTransform *gt = GST_GEOMETRIC_TRANSFORM_CAST (object);
+
+  g_mutex_clear (&gt->task_lock);
+  g_cond_clear (&gt->task_cond);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
 static void
 gst_geometric_transform_base_init (gpointer g_class)
 {
@@ -373,7 +555,9 @@ gst_geometric_transform_class_init (gpointer klass, gpointer class_data)
 
   obj_class->set_property = gst_geometric_transform_set_property;
   obj_class->get_property = gst_geometric_transform_get_property;
+  obj_class->finalize = gst_geometric_transform_finalize;
 
+  trans_class->start = GST_DEBUG_FUNCPTR (gst_geometric_transform_start);
   trans_class->stop = GST_DEBUG_FUNCPTR (gst_geometric_transform_stop);
   trans_class->before_transform =
       GST_DEBUG_FUNCPTR (gst_geometric_transform_before_transform);
@@ -398,6 +582,8 @@ gst_geometric_transform_init (GTypeInstance * instance, gpointer g_class)
   gt->off_edge_pixels = DEFAULT_OFF_EDGE_PIXELS;
   gt->precalc_map = TRUE;
   gt->needs_remap = TRUE;
+  g_mutex_init (&gt->task_lock);
+  g_cond_init (&gt->task_cond);
 }
 
 GType
@@ -101,6 +101,18 @@ struct _GstGeometricTransform {
   gint off_edge_pixels;
 
   gdouble *map;
+
+  /* map compiled into per-pixel source byte offsets, -1 where the
+   * source position is off-edge and the pixel is left as background */
+  gint32 *offset_map;
+  gint compiled_off_edge;
+
+  /* row-parallel remap */
+  GThreadPool *worker_pool;
+  guint n_workers;
+  GMutex task_lock;
+  GCond task_cond;
+  guint tasks_pending;
 };
 
 struct _GstGeometricTransformClass {
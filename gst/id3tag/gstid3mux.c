@@ -92,6 +92,7 @@ static void gst_id3_mux_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
 static void gst_id3_mux_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
+static void gst_id3_mux_finalize (GObject * object);
 
 static void
 gst_id3_mux_class_init (GstId3MuxClass * klass)
@@ -101,6 +102,7 @@ gst_id3_mux_class_init (GstId3MuxClass * klass)
 
   gobject_class->set_property = gst_id3_mux_set_property;
   gobject_class->get_property = gst_id3_mux_get_property;
+  gobject_class->finalize = gst_id3_mux_finalize;
 
   g_object_class_install_property (gobject_class, PROP_WRITE_V1,
       g_param_spec_boolean ("write-v1", "Write id3v1 tag",
@@ -140,6 +142,22 @@ gst_id3_mux_init (GstId3Mux * id3mux)
   id3mux->write_v2 = DEFAULT_WRITE_V2;
 
   id3mux->v2_major_version = DEFAULT_V2_MAJOR_VERSION;
+
+  id3mux->cached_taglist = NULL;
+  id3mux->cached_v2_tag = NULL;
+}
+
+static void
+gst_id3_mux_finalize (GObject * object)
+{
+  GstId3Mux *mux = GST_ID3_MUX (object);
+
+  if (mux->cached_taglist)
+    gst_tag_list_unref (mux->cached_taglist);
+  if (mux->cached_v2_tag)
+    gst_buffer_unref (mux->cached_v2_tag);
+
+  G_OBJECT_CLASS (gst_id3_mux_parent_class)->finalize (object);
 }
 
 static void
@@ -190,11 +208,35 @@ static GstBuffer *
 gst_id3_mux_render_v2_tag (GstTagMux * mux, const GstTagList * taglist)
 {
   GstId3Mux *id3mux = GST_ID3_MUX (mux);
+  GstBuffer *buf;
 
-  if (id3mux->write_v2)
-    return id3_mux_render_v2_tag (mux, taglist, id3mux->v2_major_version);
-  else
+  if (!id3mux->write_v2)
     return NULL;
+
+  /* If the tag list did not change since the last render, hand out the
+   * previously rendered tag again instead of serializing all frames */
+  if (id3mux->cached_v2_tag != NULL
+      && id3mux->cached_v2_version == id3mux->v2_major_version
+      && gst_tag_list_is_equal (taglist, id3mux->cached_taglist)) {
+    GST_LOG_OBJECT (mux, "tag list unchanged, reusing rendered tag");
+    /* copy so the base class can set metadata on its own buffer; the tag
+     * data itself is shared, not copied */
+    return gst_buffer_copy (id3mux->cached_v2_tag);
+  }
+
+  buf = id3_mux_render_v2_tag (mux, taglist, id3mux->v2_major_version);
+
+  if (buf) {
+    if (id3mux->cached_taglist)
+      gst_tag_list_unref (id3mux->cached_taglist);
+    id3mux->cached_taglist = gst_tag_list_copy (taglist);
+    if (id3mux->cached_v2_tag)
+      gst_buffer_unref (id3mux->cached_v2_tag);
+    id3mux->cached_v2_tag = gst_buffer_ref (buf);
+    id3mux->cached_v2_version = id3mux->v2_major_version;
+  }
+
+  return buf;
 }
 
 static GstBuffer *
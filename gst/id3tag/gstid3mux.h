@@ -38,6 +38,13 @@ struct _GstId3Mux {
   gboolean write_v2;
 
   gint     v2_major_version;
+
+  /* Tag list and rendered v2 tag of the last render, so re-rendering an
+   * unchanged tag list just shares the already-serialized memory instead
+   * of rendering all frames again */
+  GstTagList *cached_taglist;
+  GstBuffer  *cached_v2_tag;
+  gint        cached_v2_version;
 };
 
 struct _GstId3MuxClass {
@@ -45,11 +45,19 @@ struct _GstInterSurface
   guint64 audio_latency_time;
   guint64 audio_period_time;
 
+  /* last video frame handed to the source, kept for repeats */
   GstBuffer *video_buffer;
+  /* frames queued by the sink but not yet handed to the source, so a
+   * producer running slightly ahead of the consumer does not overwrite
+   * frames before they were ever seen */
+  GQueue video_buffer_queue;
   GstBuffer *sub_buffer;
   GstAdapter *audio_adapter;
 };
 
+/* Maximum number of queued video frames before the oldest is dropped */
+#define MAX_VIDEO_BUFFER_QUEUE_LENGTH 4
+
 #define DEFAULT_AUDIO_BUFFER_TIME  (GST_SECOND)
 #define DEFAULT_AUDIO_LATENCY_TIME (100 * GST_MSECOND)
 #define DEFAULT_AUDIO_PERIOD_TIME  (25 * GST_MSECOND)
@@ -214,6 +214,9 @@ gst_inter_video_sink_stop (GstBaseSink * sink)
     gst_buffer_unref (intervideosink->surface->video_buffer);
   }
   intervideosink->surface->video_buffer = NULL;
+  g_queue_foreach (&intervideosink->surface->video_buffer_queue,
+      (GFunc) gst_buffer_unref, NULL);
+  g_queue_clear (&intervideosink->surface->video_buffer_queue);
   memset (&intervideosink->surface->video_info, 0, sizeof (GstVideoInfo));
   g_mutex_unlock (&intervideosink->surface->mutex);
 
@@ -251,11 +254,18 @@ gst_inter_video_sink_show_frame (GstVideoSink * sink, GstBuffer * buffer)
       GST_TIME_ARGS (GST_BUFFER_PTS (buffer)));
 
   g_mutex_lock (&intervideosink->surface->mutex);
-  if (intervideosink->surface->video_buffer) {
-    gst_buffer_unref (intervideosink->surface->video_buffer);
+  /* queue the frame instead of overwriting a single slot, so a producer
+   * running slightly ahead of the consumer does not drop frames that were
+   * never handed out. The source picks up queued frames in order. */
+  g_queue_push_tail (&intervideosink->surface->video_buffer_queue,
+      gst_buffer_ref (buffer));
+  while (g_queue_get_length (&intervideosink->surface->video_buffer_queue) >
+      MAX_VIDEO_BUFFER_QUEUE_LENGTH) {
+    GST_DEBUG_OBJECT (intervideosink,
+        "Consumer is lagging behind, dropping oldest queued frame");
+    gst_buffer_unref (g_queue_pop_head
+        (&intervideosink->surface->video_buffer_queue));
   }
-  intervideosink->surface->video_buffer = gst_buffer_ref (buffer);
-  intervideosink->surface->video_buffer_count = 0;
   g_mutex_unlock (&intervideosink->surface->mutex);
 
   return GST_FLOW_OK;
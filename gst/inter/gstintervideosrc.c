@@ -360,6 +360,15 @@ gst_inter_video_src_create (GstBaseSrc * src, guint64 offset, guint size,
     }
   }
 
+  if (!g_queue_is_empty (&intervideosrc->surface->video_buffer_queue)) {
+    /* take the next queued frame; this resets the repeat counting below
+     * just like a freshly stored frame used to */
+    gst_buffer_replace (&intervideosrc->surface->video_buffer, NULL);
+    intervideosrc->surface->video_buffer =
+        g_queue_pop_head (&intervideosrc->surface->video_buffer_queue);
+    intervideosrc->surface->video_buffer_count = 0;
+  }
+
   if (intervideosrc->surface->video_buffer) {
     /* We have a buffer to push */
     buffer = gst_buffer_ref (intervideosrc->surface->video_buffer);
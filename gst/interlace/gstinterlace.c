@@ -920,18 +920,28 @@ gst_interlace_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
     if (interlace->stored_fields > 0) {
       GST_DEBUG ("1 field from stored, 1 from current");
 
-      output_buffer = gst_buffer_new_and_alloc (gst_buffer_get_size (buffer));
-      /* take the first field from the stored frame */
-      copy_field (interlace, output_buffer, interlace->stored_frame,
-          interlace->field_index);
+      if (current_fields == 1 && gst_buffer_is_writable (buffer)) {
+        /* the incoming buffer already contains the lines of its own field
+         * and will not be used again afterwards, so weave in place by
+         * copying only the stored field into it */
+        copy_field (interlace, buffer, interlace->stored_frame,
+            interlace->field_index);
+        output_buffer = buffer;
+        buffer = NULL;
+      } else {
+        output_buffer = gst_buffer_new_and_alloc (gst_buffer_get_size (buffer));
+        /* take the first field from the stored frame */
+        copy_field (interlace, output_buffer, interlace->stored_frame,
+            interlace->field_index);
+        /* take the second field from the incoming buffer */
+        copy_field (interlace, output_buffer, buffer,
+            interlace->field_index ^ 1);
+      }
       interlace->stored_fields--;
-      /* take the second field from the incoming buffer */
-      copy_field (interlace, output_buffer, buffer, interlace->field_index ^ 1);
       current_fields--;
       n_output_fields = 2;
       interlaced = TRUE;
     } else {
-      output_buffer = gst_buffer_make_writable (gst_buffer_ref (buffer));
       if (num_fields >= 3 && interlace->allow_rff) {
         GST_DEBUG ("3 fields from current");
         /* take both fields from incoming buffer */
@@ -943,6 +953,14 @@ gst_interlace_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
         current_fields -= 2;
         n_output_fields = 2;
       }
+      if (current_fields == 0) {
+        /* last use of the incoming buffer; hand our own ref to the output
+         * so that make_writable does not have to copy the frame */
+        output_buffer = gst_buffer_make_writable (buffer);
+        buffer = NULL;
+      } else {
+        output_buffer = gst_buffer_make_writable (gst_buffer_ref (buffer));
+      }
     }
     num_fields -= n_output_fields;
 
@@ -981,7 +999,7 @@ gst_interlace_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
   if (current_fields > 0) {
     interlace->stored_frame = buffer;
     interlace->stored_fields = current_fields;
-  } else {
+  } else if (buffer) {
     gst_buffer_unref (buffer);
   }
   return ret;
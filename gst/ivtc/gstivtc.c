@@ -73,7 +73,8 @@ static void gst_ivtc_flush (GstIvtc * ivtc);
 static void gst_ivtc_retire_fields (GstIvtc * ivtc, int n_fields);
 static void gst_ivtc_construct_frame (GstIvtc * itvc, GstBuffer * outbuf);
 
-static int get_comb_score (GstVideoFrame * top, GstVideoFrame * bottom);
+static int get_comb_score (GstVideoFrame * top, GstVideoFrame * bottom,
+    int step);
 
 enum
 {
@@ -83,6 +84,25 @@ enum
 /* pad templates */
 
 #define MAX_WIDTH 2048
+
+/* comb score above which a field pairing is considered combed */
+#define THRESHOLD 100
+
+/* line step used when verifying a predicted cadence; full analysis uses
+ * every line */
+#define IVTC_VERIFY_STEP 8
+/* number of times a candidate period has to repeat before locking on */
+#define IVTC_LOCK_REPEATS 3
+
+/* the actions a full analysis can decide on; a locked cadence predicts the
+ * sequence of these */
+enum
+{
+  IVTC_ACTION_PAIR_PREV,        /* reconstruct with previous field, retire 2 */
+  IVTC_ACTION_PAIR_NEXT,        /* reconstruct with next field, retire 2 */
+  IVTC_ACTION_PAIR_NEXT_RFF,    /* reconstruct with next field, retire 3 */
+  IVTC_ACTION_SINGLE            /* single-field reconstruction, retire 2 */
+};
 #define VIDEO_CAPS \
   "video/x-raw, " \
   "format = (string) { I420, Y444, Y42B }, " \
@@ -271,6 +291,9 @@ gst_ivtc_flush (GstIvtc * ivtc)
   }
 
   gst_ivtc_retire_fields (ivtc, ivtc->n_fields);
+
+  ivtc->cadence_period = 0;
+  ivtc->n_decisions = 0;
 }
 
 enum
@@ -307,7 +330,7 @@ add_field (GstIvtc * ivtc, GstBuffer * buffer, int parity, int index)
 }
 
 static int
-similarity (GstIvtc * ivtc, int i1, int i2)
+similarity (GstIvtc * ivtc, int i1, int i2, int step)
 {
   GstIvtcField *f1, *f2;
   int score;
@@ -319,9 +342,9 @@ similarity (GstIvtc * ivtc, int i1, int i2)
   f2 = &ivtc->fields[i2];
 
   if (f1->parity == TOP_FIELD) {
-    score = get_comb_score (&f1->frame, &f2->frame);
+    score = get_comb_score (&f1->frame, &f2->frame, step);
   } else {
-    score = get_comb_score (&f2->frame, &f1->frame);
+    score = get_comb_score (&f2->frame, &f1->frame, step);
   }
 
   GST_DEBUG ("score %d", score);
@@ -560,6 +583,63 @@ gst_ivtc_transform (GstBaseTransform * trans, GstBuffer * inbuf,
   return GST_FLOW_OK;
 }
 
+/* record a full-analysis decision and look for the shortest period that
+ * explains the recent history; once a period has repeated often enough the
+ * cadence is locked and subsequent frames only verify the prediction */
+static void
+gst_ivtc_record_decision (GstIvtc * ivtc, int action)
+{
+  int p;
+
+  if (ivtc->n_decisions == GST_IVTC_DECISION_HISTORY) {
+    memmove (ivtc->decisions, ivtc->decisions + 1,
+        (GST_IVTC_DECISION_HISTORY - 1) * sizeof (int));
+    ivtc->n_decisions--;
+  }
+  ivtc->decisions[ivtc->n_decisions++] = action;
+
+  for (p = 1; p <= GST_IVTC_MAX_CADENCE; p++) {
+    int i;
+
+    if (ivtc->n_decisions < IVTC_LOCK_REPEATS * p)
+      break;
+
+    for (i = 0; i < (IVTC_LOCK_REPEATS - 1) * p; i++) {
+      if (ivtc->decisions[ivtc->n_decisions - 1 - i] !=
+          ivtc->decisions[ivtc->n_decisions - 1 - i - p])
+        break;
+    }
+    if (i == (IVTC_LOCK_REPEATS - 1) * p) {
+      for (i = 0; i < p; i++)
+        ivtc->cadence[i] = ivtc->decisions[ivtc->n_decisions - p + i];
+      ivtc->cadence_period = p;
+      ivtc->cadence_phase = 0;
+      GST_INFO_OBJECT (ivtc, "locked on cadence with period %d", p);
+      return;
+    }
+  }
+}
+
+/* cheap verification of a predicted action using a line-subsampled comb
+ * score; a full analysis is rerun when this disagrees with the prediction */
+static gboolean
+gst_ivtc_verify_cadence (GstIvtc * ivtc, int action, gboolean forward_ok)
+{
+  switch (action) {
+    case IVTC_ACTION_PAIR_PREV:
+      return similarity (ivtc, 0, 1, IVTC_VERIFY_STEP) < THRESHOLD;
+    case IVTC_ACTION_PAIR_NEXT:
+      return similarity (ivtc, 1, 2, IVTC_VERIFY_STEP) < THRESHOLD;
+    case IVTC_ACTION_PAIR_NEXT_RFF:
+      return forward_ok && similarity (ivtc, 1, 2, IVTC_VERIFY_STEP) <
+          THRESHOLD;
+    case IVTC_ACTION_SINGLE:
+      return similarity (ivtc, 0, 1, IVTC_VERIFY_STEP) >= THRESHOLD &&
+          similarity (ivtc, 1, 2, IVTC_VERIFY_STEP) >= THRESHOLD;
+  }
+  return FALSE;
+}
+
 static void
 gst_ivtc_construct_frame (GstIvtc * ivtc, GstBuffer * outbuf)
 {
@@ -568,6 +648,7 @@ gst_ivtc_construct_frame (GstIvtc * ivtc, GstBuffer * outbuf)
   GstVideoFrame dest_frame;
   int n_retire;
   gboolean forward_ok;
+  int action = -1;
 
   anchor_index = 1;
   if (ivtc->fields[anchor_index].ts < ivtc->current_ts) {
@@ -576,40 +657,67 @@ gst_ivtc_construct_frame (GstIvtc * ivtc, GstBuffer * outbuf)
     forward_ok = FALSE;
   }
 
-  prev_score = similarity (ivtc, anchor_index - 1, anchor_index);
-  next_score = similarity (ivtc, anchor_index, anchor_index + 1);
-
-  gst_video_frame_map (&dest_frame, &ivtc->src_video_info, outbuf,
-      GST_MAP_WRITE);
+  if (ivtc->cadence_period > 0) {
+    int predicted = ivtc->cadence[ivtc->cadence_phase];
 
-#define THRESHOLD 100
-  if (prev_score < THRESHOLD) {
-    if (forward_ok && next_score < prev_score) {
-      reconstruct (ivtc, &dest_frame, anchor_index, anchor_index + 1);
-      n_retire = anchor_index + 2;
+    if (gst_ivtc_verify_cadence (ivtc, predicted, forward_ok)) {
+      action = predicted;
+      ivtc->cadence_phase = (ivtc->cadence_phase + 1) % ivtc->cadence_period;
     } else {
-      if (prev_score >= THRESHOLD / 2) {
+      GST_DEBUG_OBJECT (ivtc, "cadence broken, rerunning full analysis");
+      ivtc->cadence_period = 0;
+      ivtc->n_decisions = 0;
+    }
+  }
+
+  if (action < 0) {
+    prev_score = similarity (ivtc, anchor_index - 1, anchor_index, 1);
+    next_score = similarity (ivtc, anchor_index, anchor_index + 1, 1);
+
+    if (prev_score < THRESHOLD) {
+      if (forward_ok && next_score < prev_score) {
+        action = IVTC_ACTION_PAIR_NEXT_RFF;
+      } else {
+        if (prev_score >= THRESHOLD / 2) {
+          GST_INFO ("borderline prev (%d, %d)", prev_score, next_score);
+        }
+        action = IVTC_ACTION_PAIR_PREV;
+      }
+    } else if (next_score < THRESHOLD) {
+      if (next_score >= THRESHOLD / 2) {
         GST_INFO ("borderline prev (%d, %d)", prev_score, next_score);
       }
+      action = forward_ok ? IVTC_ACTION_PAIR_NEXT_RFF : IVTC_ACTION_PAIR_NEXT;
+    } else {
+      if (prev_score < THRESHOLD * 2 || next_score < THRESHOLD * 2) {
+        GST_INFO ("borderline single (%d, %d)", prev_score, next_score);
+      }
+      action = IVTC_ACTION_SINGLE;
+    }
+
+    gst_ivtc_record_decision (ivtc, action);
+  }
+
+  gst_video_frame_map (&dest_frame, &ivtc->src_video_info, outbuf,
+      GST_MAP_WRITE);
+
+  switch (action) {
+    case IVTC_ACTION_PAIR_PREV:
       reconstruct (ivtc, &dest_frame, anchor_index, anchor_index - 1);
       n_retire = anchor_index + 1;
-    }
-  } else if (next_score < THRESHOLD) {
-    if (next_score >= THRESHOLD / 2) {
-      GST_INFO ("borderline prev (%d, %d)", prev_score, next_score);
-    }
-    reconstruct (ivtc, &dest_frame, anchor_index, anchor_index + 1);
-    if (forward_ok) {
+      break;
+    case IVTC_ACTION_PAIR_NEXT:
+      reconstruct (ivtc, &dest_frame, anchor_index, anchor_index + 1);
+      n_retire = anchor_index + 1;
+      break;
+    case IVTC_ACTION_PAIR_NEXT_RFF:
+      reconstruct (ivtc, &dest_frame, anchor_index, anchor_index + 1);
       n_retire = anchor_index + 2;
-    } else {
+      break;
+    default:
+      reconstruct_single (ivtc, &dest_frame, anchor_index);
       n_retire = anchor_index + 1;
-    }
-  } else {
-    if (prev_score < THRESHOLD * 2 || next_score < THRESHOLD * 2) {
-      GST_INFO ("borderline single (%d, %d)", prev_score, next_score);
-    }
-    reconstruct_single (ivtc, &dest_frame, anchor_index);
-    n_retire = anchor_index + 1;
+      break;
   }
 
   GST_DEBUG ("retiring %d", n_retire);
@@ -630,7 +738,7 @@ gst_ivtc_construct_frame (GstIvtc * ivtc, GstBuffer * outbuf)
 }
 
 static int
-get_comb_score (GstVideoFrame * top, GstVideoFrame * bottom)
+get_comb_score (GstVideoFrame * top, GstVideoFrame * bottom, int step)
 {
   int j;
   int thisline[MAX_WIDTH];
@@ -647,7 +755,7 @@ get_comb_score (GstVideoFrame * top, GstVideoFrame * bottom)
   k = 0;
   /* remove a few lines from top and bottom, as they sometimes contain
    * artifacts */
-  for (j = 2; j < height - 2; j++) {
+  for (j = 2; j < height - 2; j += step) {
     guint8 *src1 = GET_LINE_IL (top, bottom, 0, j - 1);
     guint8 *src2 = GET_LINE_IL (top, bottom, 0, j);
     guint8 *src3 = GET_LINE_IL (top, bottom, 0, j + 1);
@@ -673,7 +781,8 @@ get_comb_score (GstVideoFrame * top, GstVideoFrame * bottom)
 
   GST_DEBUG ("score %d", score);
 
-  return score;
+  /* scale subsampled scores so that they stay comparable to THRESHOLD */
+  return score * step;
 }
 
 
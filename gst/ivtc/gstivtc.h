@@ -44,6 +44,8 @@ struct _GstIvtcField
 };
 
 #define GST_IVTC_MAX_FIELDS 10
+#define GST_IVTC_MAX_CADENCE 5
+#define GST_IVTC_DECISION_HISTORY 16
 
 struct _GstIvtc
 {
@@ -58,6 +60,13 @@ struct _GstIvtc
 
   int n_fields;
   GstIvtcField fields[GST_IVTC_MAX_FIELDS];
+
+  /* cadence lock */
+  int decisions[GST_IVTC_DECISION_HISTORY];
+  int n_decisions;
+  int cadence[GST_IVTC_MAX_CADENCE];
+  int cadence_period;           /* 0 when no cadence is locked */
+  int cadence_phase;
 };
 
 struct _GstIvtcClass
@@ -187,6 +187,44 @@ gst_jpeg_parse_parse_tag_has_entropy_segment (guint8 tag)
   return FALSE;
 }
 
+/*
+ * gst_jpeg_parse_scan_marker:
+ *
+ * Drop-in replacement for scanning with mask/pattern 0x0000ff00: returns
+ * the first offset at or after @offset where a whole 32-bit window fits
+ * below @limit and its third byte is 0xff, filling @value with that
+ * window, or -1. Searching for the 0xff byte with memchr() lets the C
+ * library's vectorized implementation do the scanning, which is
+ * considerably faster over large entropy-coded segments than a rolling
+ * 32-bit comparison per byte.
+ */
+static gint
+gst_jpeg_parse_scan_marker (GstMapInfo * mapinfo, gint offset, gsize limit,
+    guint32 * value)
+{
+  const guint8 *data = mapinfo->data;
+  const guint8 *found;
+  gsize window_end;
+
+  if (offset < 0)
+    return -1;
+
+  window_end = MIN (limit, mapinfo->size);
+  if (window_end < (gsize) offset + 4)
+    return -1;
+
+  /* the 0xff sits at window offset + 2; the last window starts 4 bytes
+   * before the end of the scanned region */
+  found = memchr (data + offset + 2, 0xff, window_end - offset - 3);
+  if (found == NULL)
+    return -1;
+
+  offset = (found - data) - 2;
+  if (value)
+    *value = GST_READ_UINT32_BE (data + offset);
+  return offset;
+}
+
 /* returns image length in bytes if parsed successfully,
  * otherwise 0 if more data needed,
  * if < 0 the absolute value needs to be flushed */
@@ -224,9 +262,7 @@ gst_jpeg_parse_get_image_length (GstJpegParse * parse, GstMapInfo * mapinfo)
     guint frame_len;
     guint32 value;
 
-    noffset =
-        gst_byte_reader_masked_scan_uint32_peek (&reader, 0x0000ff00,
-        0x0000ff00, offset, size - offset, &value);
+    noffset = gst_jpeg_parse_scan_marker (mapinfo, offset, size, &value);
     /* lost sync if 0xff marker not where expected */
     if ((resync = (noffset != offset))) {
       GST_DEBUG ("Lost sync at 0x%08x, resyncing", offset + 2);
@@ -236,9 +272,7 @@ gst_jpeg_parse_get_image_length (GstJpegParse * parse, GstMapInfo * mapinfo)
     /* Skip over extra 0xff */
     while ((noffset >= 0) && ((value & 0xff) == 0xff)) {
       noffset++;
-      noffset =
-          gst_byte_reader_masked_scan_uint32_peek (&reader, 0x0000ff00,
-          0x0000ff00, noffset, size - noffset, &value);
+      noffset = gst_jpeg_parse_scan_marker (mapinfo, noffset, size, &value);
     }
     /* enough bytes left for marker? (we need 0xNN after the 0xff) */
     if (noffset < 0) {
@@ -271,8 +305,7 @@ gst_jpeg_parse_get_image_length (GstJpegParse * parse, GstMapInfo * mapinfo)
       if (offset + 2 + 4 > size)
         goto need_more_data;
       else
-        gst_byte_reader_masked_scan_uint32_peek (&reader, 0x0, 0x0, offset + 2,
-            4, &frame_len);
+        frame_len = GST_READ_UINT32_BE (mapinfo->data + offset + 2);
       frame_len = frame_len & 0xffff;
     }
     GST_DEBUG ("0x%08x: tag %02x, frame_len=%u", offset + 2, value, frame_len);
@@ -288,8 +321,7 @@ gst_jpeg_parse_get_image_length (GstJpegParse * parse, GstMapInfo * mapinfo)
       GST_DEBUG ("0x%08x: finding entropy segment length", offset + 2);
       noffset = offset + 2 + frame_len + eseglen;
       while (1) {
-        noffset = gst_byte_reader_masked_scan_uint32_peek (&reader, 0x0000ff00,
-            0x0000ff00, noffset, size - noffset, &value);
+        noffset = gst_jpeg_parse_scan_marker (mapinfo, noffset, size, &value);
         if (noffset < 0) {
           /* need more data */
           parse->last_entropy_len = size - offset - 4 - frame_len - 2;
@@ -310,9 +342,8 @@ gst_jpeg_parse_get_image_length (GstJpegParse * parse, GstMapInfo * mapinfo)
       /* check if we will still be in sync if we interpret
        * this as a sync point and skip this frame */
       noffset = offset + frame_len + 2;
-      noffset =
-          gst_byte_reader_masked_scan_uint32 (&reader, 0x0000ff00, 0x0000ff00,
-          noffset, 4);
+      noffset = gst_jpeg_parse_scan_marker (mapinfo, noffset,
+          (gsize) noffset + 4, NULL);
       if (noffset < 0) {
         /* ignore and continue resyncing until we hit the end
          * of our data or find a sync point that looks okay */
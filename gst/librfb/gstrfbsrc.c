@@ -469,8 +469,6 @@ gst_rfb_src_negotiate (GstBaseSrc * bsrc)
       decoder->rect_height);
 
   decoder->frame = g_malloc (vinfo.size);
-  if (decoder->use_copyrect)
-    decoder->prev_frame = g_malloc (vinfo.size);
 
   caps = gst_video_info_to_caps (&vinfo);
 
@@ -493,11 +491,6 @@ gst_rfb_src_stop (GstBaseSrc * bsrc)
     src->decoder->frame = NULL;
   }
 
-  if (src->decoder->prev_frame) {
-    g_free (src->decoder->prev_frame);
-    src->decoder->prev_frame = NULL;
-  }
-
   return TRUE;
 }
 
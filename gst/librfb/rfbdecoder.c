@@ -292,12 +292,6 @@ rfb_decoder_send_update_request (RfbDecoder * decoder,
 
   rfb_decoder_send (decoder, data, 10);
 
-  /* create a backup of the prev frame for copyrect encoding */
-  if (decoder->use_copyrect) {
-    memcpy (decoder->prev_frame, decoder->frame,
-        decoder->rect_width * decoder->rect_height * decoder->bpp / 8);
-  }
-
   decoder->state = rfb_decoder_state_normal;
 }
 
@@ -901,16 +895,29 @@ rfb_decoder_copyrect_encoding (RfbDecoder * decoder, gint start_x, gint start_y,
   copyrect_width = rect_w * decoder->bytespp;
   line_width = decoder->line_size;
   src =
-      decoder->prev_frame + ((src_y * decoder->rect_width) +
+      decoder->frame + ((src_y * decoder->rect_width) +
       src_x) * decoder->bytespp;
   dst =
       decoder->frame + ((start_y * decoder->rect_width) +
       start_x) * decoder->bytespp;
 
-  while (rect_h--) {
-    memcpy (dst, src, copyrect_width);
-    src += line_width;
-    dst += line_width;
+  /* the regions may overlap as both live in the current frame; iterate in
+   * the direction that doesn't overwrite still-needed source lines, and
+   * let memmove handle overlap within a line */
+  if (dst <= src) {
+    while (rect_h--) {
+      memmove (dst, src, copyrect_width);
+      src += line_width;
+      dst += line_width;
+    }
+  } else {
+    src += (rect_h - 1) * line_width;
+    dst += (rect_h - 1) * line_width;
+    while (rect_h--) {
+      memmove (dst, src, copyrect_width);
+      src -= line_width;
+      dst -= line_width;
+    }
   }
 
   return TRUE;
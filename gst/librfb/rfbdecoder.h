@@ -50,7 +50,6 @@ struct _RfbDecoder
   guint32 data_len;
   gpointer decoder_private;
   guint8 *frame;
-  guint8 *prev_frame;
 
   GError *error;
 
@@ -62,6 +62,10 @@ enum
 
 #define DEFAULT_TEMPO   500000  /* 120 BPM is the default */
 
+/* pulse->time checkpoints are recorded about this far apart, a seek replays
+ * at most this much of the song before the seek position */
+#define GST_MIDI_PARSE_CHECKPOINT_INTERVAL (10 * GST_SECOND)
+
 typedef struct
 {
   guint8 *data;
@@ -74,6 +78,25 @@ typedef struct
 
 } GstMidiTrack;
 
+typedef struct
+{
+  guint offset;
+  guint64 pulse;
+  guint8 running_status;
+  gboolean eot;
+
+} GstMidiTrackState;
+
+typedef struct
+{
+  guint64 pulse;
+  GstClockTime position;
+  guint tempo;
+  /* one entry per track, in the order of the tracks list */
+  GstMidiTrackState *tracks;
+
+} GstMidiCheckpoint;
+
 typedef GstFlowReturn (*GstMidiPushFunc) (GstMidiParse * parse,
     GstMidiTrack * track, guint8 event, guint8 * data, guint length,
     gpointer user_data);
@@ -230,7 +253,7 @@ gst_midi_parse_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
     }
     case GST_QUERY_SEEKING:
       gst_query_set_seeking (query, midiparse->segment.format,
-          FALSE, 0, midiparse->segment.duration);
+          midiparse->index != NULL, 0, midiparse->segment.duration);
       break;
     default:
       res = gst_pad_query_default (pad, parent, query);
@@ -243,12 +266,56 @@ gst_midi_parse_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
 static gboolean
 gst_midi_parse_do_seek (GstMidiParse * midiparse, GstSegment * segment)
 {
-  /* if seeking backwards, start from 0 else we just let things run and
-   * have it clip downstream */
-  GST_DEBUG_OBJECT (midiparse, "seeking back to 0");
-  segment->position = 0;
-  g_list_foreach (midiparse->tracks, (GFunc) reset_track, midiparse);
-  midiparse->pulse = 0;
+  GstMidiCheckpoint *cp = NULL;
+  GstMidiTrackState *state;
+  GList *walk;
+
+  /* binary search for the last checkpoint at or before the seek position */
+  if (midiparse->index && midiparse->index->len > 0) {
+    guint lo = 0, hi = midiparse->index->len;
+
+    while (lo < hi) {
+      guint mid = lo + (hi - lo) / 2;
+      GstMidiCheckpoint *c =
+          &g_array_index (midiparse->index, GstMidiCheckpoint, mid);
+
+      if (c->position <= (GstClockTime) segment->position)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    if (lo > 0)
+      cp = &g_array_index (midiparse->index, GstMidiCheckpoint, lo - 1);
+  }
+
+  if (cp) {
+    GST_DEBUG_OBJECT (midiparse, "restoring checkpoint %" GST_TIME_FORMAT
+        " for seek to %" GST_TIME_FORMAT, GST_TIME_ARGS (cp->position),
+        GST_TIME_ARGS (segment->position));
+
+    state = cp->tracks;
+    for (walk = midiparse->tracks; walk; walk = g_list_next (walk)) {
+      GstMidiTrack *track = walk->data;
+
+      track->offset = state->offset;
+      track->pulse = state->pulse;
+      track->running_status = state->running_status;
+      track->eot = state->eot;
+      state++;
+    }
+    midiparse->pulse = cp->pulse;
+    midiparse->tempo = cp->tempo;
+    /* events between the checkpoint and the seek position are replayed
+     * and clipped downstream */
+    segment->position = cp->position;
+  } else {
+    /* no index, start from 0 and have it clip downstream */
+    GST_DEBUG_OBJECT (midiparse, "seeking back to 0");
+    segment->position = 0;
+    g_list_foreach (midiparse->tracks, (GFunc) reset_track, midiparse);
+    midiparse->pulse = 0;
+    midiparse->tempo = DEFAULT_TEMPO;
+  }
 
   return TRUE;
 }
@@ -854,6 +921,103 @@ parse_MTrk (GstMidiParse * midiparse, guint8 * data, guint size)
   return TRUE;
 }
 
+static void
+free_checkpoint (GstMidiCheckpoint * checkpoint)
+{
+  g_free (checkpoint->tracks);
+}
+
+static void
+record_checkpoint (GstMidiParse * midiparse, guint64 pulse,
+    GstClockTime position)
+{
+  GstMidiCheckpoint cp;
+  GstMidiTrackState *state;
+  GList *walk;
+
+  cp.pulse = pulse;
+  cp.position = position;
+  cp.tempo = midiparse->tempo;
+  cp.tracks = g_new (GstMidiTrackState, midiparse->track_count);
+
+  state = cp.tracks;
+  for (walk = midiparse->tracks; walk; walk = g_list_next (walk)) {
+    GstMidiTrack *track = walk->data;
+
+    state->offset = track->offset;
+    state->pulse = track->pulse;
+    state->running_status = track->running_status;
+    state->eot = track->eot;
+    state++;
+  }
+
+  GST_LOG_OBJECT (midiparse, "checkpoint %u at pulse %" G_GUINT64_FORMAT
+      ", position %" GST_TIME_FORMAT, midiparse->index->len, pulse,
+      GST_TIME_ARGS (position));
+
+  g_array_append_val (midiparse->index, cp);
+}
+
+/* Walk all tracks once, merged by pulse like gst_midi_parse_do_play() does,
+ * and remember the parser state at regular intervals. A seek then restores
+ * the nearest checkpoint before the seek position instead of replaying the
+ * whole song through downstream. The walk tracks tempo changes, so the
+ * recorded positions match what playback from 0 would produce. */
+static void
+build_index (GstMidiParse * midiparse)
+{
+  guint64 pulse = 0;
+  GstClockTime position, next_checkpoint = 0;
+  GList *walk;
+
+  if (midiparse->index)
+    g_array_free (midiparse->index, TRUE);
+  midiparse->index = g_array_new (FALSE, FALSE, sizeof (GstMidiCheckpoint));
+  g_array_set_clear_func (midiparse->index, (GDestroyNotify) free_checkpoint);
+
+  midiparse->tempo = DEFAULT_TEMPO;
+
+  while (TRUE) {
+    guint64 next_pulse = G_MAXUINT64;
+
+    for (walk = midiparse->tracks; walk; walk = g_list_next (walk)) {
+      GstMidiTrack *track = walk->data;
+
+      while (!track->eot && track->pulse == pulse) {
+        if (handle_next_event (midiparse, track, NULL, NULL) != GST_FLOW_OK) {
+          /* the duration scan walked these events without error but be
+           * paranoid, stop indexing and have seeks fall back to 0 */
+          GST_WARNING_OBJECT (midiparse, "event error while indexing");
+          goto done;
+        }
+      }
+      if (!track->eot && track->pulse < next_pulse)
+        next_pulse = track->pulse;
+    }
+
+    if (next_pulse == G_MAXUINT64)
+      break;
+
+    pulse = next_pulse;
+    position = gst_util_uint64_scale (pulse, 1000 * midiparse->tempo,
+        midiparse->division);
+
+    /* all events before @pulse are consumed now, playback can resume from
+     * this state exactly like gst_midi_parse_do_play() would continue */
+    if (position >= next_checkpoint) {
+      record_checkpoint (midiparse, pulse, position);
+      next_checkpoint = position + GST_MIDI_PARSE_CHECKPOINT_INTERVAL;
+    }
+  }
+
+done:
+  GST_DEBUG_OBJECT (midiparse, "indexed %u checkpoints",
+      midiparse->index->len);
+
+  g_list_foreach (midiparse->tracks, (GFunc) reset_track, midiparse);
+  midiparse->tempo = DEFAULT_TEMPO;
+}
+
 static gboolean
 find_midi_chunk (GstMidiParse * midiparse, guint8 * data, guint size,
     guint * offset, guint * length)
@@ -1017,6 +1181,8 @@ gst_midi_parse_parse_song (GstMidiParse * midiparse)
     length -= consumed;
   }
 
+  build_index (midiparse);
+
   GST_DEBUG_OBJECT (midiparse, "song duration %" GST_TIME_FORMAT,
       GST_TIME_ARGS (midiparse->segment.duration));
 
@@ -1304,6 +1470,10 @@ gst_midi_parse_reset (GstMidiParse * midiparse)
   g_list_free (midiparse->tracks);
   midiparse->tracks = NULL;
   midiparse->track_count = 0;
+  if (midiparse->index) {
+    g_array_free (midiparse->index, TRUE);
+    midiparse->index = NULL;
+  }
   midiparse->have_group_id = FALSE;
   midiparse->group_id = G_MAXUINT;
 }
@@ -68,6 +68,9 @@ struct _GstMidiParse
   GList *tracks;
   guint  track_count;
 
+  /* seek index, array of GstMidiCheckpoint */
+  GArray *index;
+
   guint64 offset;
   GstAdapter *adapter;
   guint8 *data;
@@ -278,6 +278,8 @@ gst_ps_demux_init (GstPsDemux * demux)
   demux->rev_adapter = gst_adapter_new ();
   demux->flowcombiner = gst_flow_combiner_new ();
 
+  demux->scr_index = g_array_new (FALSE, FALSE, sizeof (GstPsDemuxScrEntry));
+
   gst_ps_demux_reset (demux);
 }
 
@@ -291,6 +293,7 @@ gst_ps_demux_finalize (GstPsDemux * demux)
   gst_flow_combiner_free (demux->flowcombiner);
   g_object_unref (demux->adapter);
   g_object_unref (demux->rev_adapter);
+  g_array_free (demux->scr_index, TRUE);
 
   G_OBJECT_CLASS (parent_class)->finalize (G_OBJECT (demux));
 }
@@ -345,6 +348,7 @@ gst_ps_demux_reset (GstPsDemux * demux)
   gst_ps_demux_flush (demux);
   demux->have_group_id = FALSE;
   demux->group_id = G_MAXUINT;
+  g_array_set_size (demux->scr_index, 0);
 }
 
 static GstPsStream *
@@ -1129,6 +1133,85 @@ not_supported:
 
 #define MAX_RECURSION_COUNT 100
 
+/* Minimum distance between two samples in the sparse SCR index, so the
+ * index stays small even for very large files */
+#define SCR_INDEX_INTERVAL (1024 * 1024)
+
+/* Record an (offset, SCR) observation in the sparse seek index. The
+ * index is kept sorted by offset and strictly monotonic in SCR, since
+ * it is only useful for bisecting if both orders agree */
+static void
+gst_ps_demux_scr_index_add (GstPsDemux * demux, guint64 offset, guint64 scr)
+{
+  GstPsDemuxScrEntry entry, *neighbour;
+  guint lo = 0, hi = demux->scr_index->len;
+
+  while (lo < hi) {
+    guint mid = lo + (hi - lo) / 2;
+
+    if (g_array_index (demux->scr_index, GstPsDemuxScrEntry, mid).offset <
+        offset)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  if (lo > 0) {
+    neighbour = &g_array_index (demux->scr_index, GstPsDemuxScrEntry, lo - 1);
+    if (offset - neighbour->offset < SCR_INDEX_INTERVAL
+        || scr <= neighbour->scr)
+      return;
+  }
+  if (lo < demux->scr_index->len) {
+    neighbour = &g_array_index (demux->scr_index, GstPsDemuxScrEntry, lo);
+    if (neighbour->offset - offset < SCR_INDEX_INTERVAL
+        || scr >= neighbour->scr)
+      return;
+  }
+
+  entry.offset = offset;
+  entry.scr = scr;
+  g_array_insert_val (demux->scr_index, lo, entry);
+
+  GST_LOG_OBJECT (demux, "Indexed SCR %" G_GUINT64_FORMAT " at offset %"
+      G_GUINT64_FORMAT " (%u entries)", scr, offset, demux->scr_index->len);
+}
+
+/* Narrow the initial bisection window around @scr using the index */
+static void
+gst_ps_demux_scr_index_search (GstPsDemux * demux, guint64 scr,
+    guint64 * min_scr, guint64 * min_scr_offset,
+    guint64 * max_scr, guint64 * max_scr_offset)
+{
+  GstPsDemuxScrEntry *entry;
+  guint lo = 0, hi = demux->scr_index->len;
+
+  while (lo < hi) {
+    guint mid = lo + (hi - lo) / 2;
+
+    if (g_array_index (demux->scr_index, GstPsDemuxScrEntry, mid).scr <= scr)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  /* lo is now the first entry beyond @scr */
+  if (lo > 0) {
+    entry = &g_array_index (demux->scr_index, GstPsDemuxScrEntry, lo - 1);
+    if (entry->scr > *min_scr) {
+      *min_scr = entry->scr;
+      *min_scr_offset = entry->offset;
+    }
+  }
+  if (lo < demux->scr_index->len) {
+    entry = &g_array_index (demux->scr_index, GstPsDemuxScrEntry, lo);
+    if (entry->scr < *max_scr) {
+      *max_scr = entry->scr;
+      *max_scr_offset = entry->offset;
+    }
+  }
+}
+
 /* Binary search for requested SCR */
 static inline guint64
 find_offset (GstPsDemux * demux, guint64 scr,
@@ -1152,6 +1235,9 @@ find_offset (GstPsDemux * demux, guint64 scr,
     gst_ps_demux_scan_backward_ts (demux, &offset, SCAN_SCR, &fscr, 0);
   }
 
+  /* remember what we found, it will spare later seeks the scan */
+  gst_ps_demux_scr_index_add (demux, offset, fscr);
+
   if (fscr == scr || fscr == min_scr || fscr == max_scr) {
     return offset;
   }
@@ -1171,6 +1257,7 @@ gst_ps_demux_do_seek (GstPsDemux * demux, GstSegment * seeksegment)
   gboolean found;
   guint64 fscr, offset;
   guint64 scr = GSTTIME_TO_MPEGTIME (seeksegment->position + demux->base_time);
+  guint64 min_scr, min_scr_offset, max_scr, max_scr_offset;
 
   /* In some clips the PTS values are completely unaligned with SCR values.
    * To improve the seek in that situation we apply a factor considering the
@@ -1185,9 +1272,18 @@ gst_ps_demux_do_seek (GstPsDemux * demux, GstSegment * seeksegment)
   GST_INFO_OBJECT (demux, "sink segment configured %" GST_SEGMENT_FORMAT
       ", trying to go at SCR: %" G_GUINT64_FORMAT, &demux->sink_segment, scr);
 
+  /* Start bisecting from the closest samples the index has seen so far
+   * rather than from the very ends of the file */
+  min_scr = demux->first_scr;
+  min_scr_offset = demux->first_scr_offset;
+  max_scr = demux->last_scr;
+  max_scr_offset = demux->last_scr_offset;
+  gst_ps_demux_scr_index_search (demux, scr, &min_scr, &min_scr_offset,
+      &max_scr, &max_scr_offset);
+
   offset =
-      find_offset (demux, scr, demux->first_scr, demux->first_scr_offset,
-      demux->last_scr, demux->last_scr_offset, 0);
+      find_offset (demux, scr, min_scr, min_scr_offset,
+      max_scr, max_scr_offset, 0);
 
   if (offset == (guint64) - 1) {
     return FALSE;
@@ -1780,6 +1876,11 @@ gst_ps_demux_parse_pack_start (GstPsDemux * demux)
       demux->first_scr, demux->first_scr_offset,
       scr_rate_n, scr_rate_d, (float) scr_rate_n / scr_rate_d);
 
+  /* Feed the sparse seek index as a side effect of playback. Seeks
+   * compare raw SCRs read from the stream, so store the raw value */
+  if (demux->random_access)
+    gst_ps_demux_scr_index_add (demux, demux->cur_scr_offset, scr);
+
   /* adjustment of the SCR */
   if (G_LIKELY (demux->current_scr != G_MAXUINT64)) {
     guint64 diff;
@@ -84,6 +84,13 @@ typedef enum
   STATE_PS_DEMUX_NEED_MORE_DATA,
 } GstPsDemuxState;
 
+/* An (offset, SCR) sample in the sparse seek index */
+typedef struct _GstPsDemuxScrEntry
+{
+  guint64 offset;
+  guint64 scr;
+} GstPsDemuxScrEntry;
+
 /* Information associated with a single FluPS stream. */
 struct _GstPsStream
 {
@@ -156,6 +163,10 @@ struct _GstPsDemux
 
   /* Indicates an MPEG-2 stream */
   gboolean is_mpeg2_pack;
+
+  /* sparse SCR index built lazily while demuxing and seeking,
+   * sorted by offset; used to narrow the scan window of later seeks */
+  GArray *scr_index;
 };
 
 struct _GstPsDemuxClass
@@ -115,7 +115,14 @@ gboolean
 psmux_write_end_code (PsMux * mux)
 {
   guint8 end_code[4] = { 0, 0, 1, PSMUX_PROGRAM_END };
-  return mux->write_func (end_code, 4, mux->write_func_data);
+  GstBuffer *buf;
+
+  if (G_UNLIKELY (mux->write_func == NULL))
+    return TRUE;
+
+  buf = gst_buffer_new_allocate (NULL, 4, NULL);
+  gst_buffer_fill (buf, 0, end_code, 4);
+  return mux->write_func (buf, mux->write_func_data);
 }
 
 
@@ -147,6 +154,11 @@ psmux_free (PsMux * mux)
   if (mux->psm != NULL)
     gst_buffer_unref (mux->psm);
 
+  if (mux->packet_pool != NULL) {
+    gst_buffer_pool_set_active (mux->packet_pool, FALSE);
+    gst_object_unref (mux->packet_pool);
+  }
+
   g_slice_free (PsMux, mux);
 }
 
@@ -206,11 +218,17 @@ static gboolean
 psmux_packet_out (PsMux * mux)
 {
   gboolean res;
-  if (G_UNLIKELY (mux->write_func == NULL))
+  GstBuffer *buf;
+
+  if (G_UNLIKELY (mux->write_func == NULL)) {
+    mux->packet_bytes_written = 0;
     return TRUE;
+  }
 
-  res = mux->write_func (mux->packet_buf, mux->packet_bytes_written,
-      mux->write_func_data);
+  buf = gst_buffer_new_allocate (NULL, mux->packet_bytes_written, NULL);
+  gst_buffer_fill (buf, 0, mux->packet_buf, mux->packet_bytes_written);
+
+  res = mux->write_func (buf, mux->write_func_data);
 
   if (res) {
     mux->bit_size += mux->packet_bytes_written;
@@ -279,14 +297,49 @@ psmux_write_stream_packet (PsMux * mux, PsMuxStream * stream)
     mux->psm_pts = mux->pts;
   }
 
-  /* Write the packet */
-  if (!(mux->packet_bytes_written =
-          psmux_stream_get_data (stream, mux->packet_buf,
-              mux->pes_max_payload + PSMUX_PES_MAX_HDR_LEN))) {
-    return FALSE;
+  /* Write the packet straight into an output buffer, so the element
+   * can push it along without copying it again */
+  {
+    GstBuffer *buf = NULL;
+    GstMapInfo map;
+    guint len;
+
+    if (G_UNLIKELY (mux->packet_pool == NULL)) {
+      GstStructure *config;
+
+      mux->packet_pool = gst_buffer_pool_new ();
+      config = gst_buffer_pool_get_config (mux->packet_pool);
+      gst_buffer_pool_config_set_params (config, NULL,
+          mux->pes_max_payload + PSMUX_PES_MAX_HDR_LEN, 0, 0);
+      gst_buffer_pool_set_config (mux->packet_pool, config);
+      gst_buffer_pool_set_active (mux->packet_pool, TRUE);
+    }
+
+    if (G_UNLIKELY (gst_buffer_pool_acquire_buffer (mux->packet_pool, &buf,
+                NULL) != GST_FLOW_OK))
+      buf = gst_buffer_new_allocate (NULL,
+          mux->pes_max_payload + PSMUX_PES_MAX_HDR_LEN, NULL);
+
+    gst_buffer_map (buf, &map, GST_MAP_WRITE);
+    len = psmux_stream_get_data (stream, map.data, map.size);
+    gst_buffer_unmap (buf, &map);
+
+    if (len == 0) {
+      gst_buffer_unref (buf);
+      return FALSE;
+    }
+    gst_buffer_set_size (buf, len);
+
+    if (G_UNLIKELY (mux->write_func == NULL)) {
+      gst_buffer_unref (buf);
+      res = TRUE;
+    } else {
+      res = mux->write_func (buf, mux->write_func_data);
+      if (res)
+        mux->bit_size += len;
+    }
   }
 
-  res = psmux_packet_out (mux);
   if (!res) {
     GST_DEBUG_OBJECT (mux, "packet write false");
     return FALSE;
@@ -54,7 +54,7 @@ G_BEGIN_DECLS
 
 #define PSMUX_MAX_ES_INFO_LENGTH ((1 << 12) - 1)
 
-typedef gboolean (*PsMuxWriteFunc) (guint8 *data, guint len, void *user_data);
+typedef gboolean (*PsMuxWriteFunc) (GstBuffer *buf, void *user_data);
 
 struct PsMux {
   GList *streams;    /* PsMuxStream* array of all streams */
@@ -86,6 +86,10 @@ struct PsMux {
   PsMuxWriteFunc write_func;
   void *write_func_data;
 
+  /* pool of output-sized buffers for PES packets, so that writing a
+   * packet doesn't allocate from the system for every packet */
+  GstBufferPool *packet_pool;
+
   /* Scratch space for writing ES_info descriptors */
   guint8 es_info_buf[PSMUX_MAX_ES_INFO_LENGTH];
 
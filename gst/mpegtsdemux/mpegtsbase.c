@@ -176,6 +176,18 @@ mpegts_base_get_property (GObject * object, guint prop_id,
 }
 
 
+/* Recompute the PID interest map as the union of known_psi and is_pes.
+ * Cheap enough (1kB) to redo wholesale whenever those arrays may have
+ * changed, which is only on reset and PSI updates */
+static void
+mpegts_base_refresh_pid_interest (MpegTSBase * base)
+{
+  guint i;
+
+  for (i = 0; i < 1024; i++)
+    base->pid_interest[i] = base->known_psi[i] | base->is_pes[i];
+}
+
 static void
 mpegts_base_reset (MpegTSBase * base)
 {
@@ -222,6 +234,8 @@ mpegts_base_reset (MpegTSBase * base)
 
   if (klass->reset)
     klass->reset (base);
+
+  mpegts_base_refresh_pid_interest (base);
 }
 
 static void
@@ -244,6 +258,7 @@ mpegts_base_init (MpegTSBase * base)
   base->parse_private_sections = FALSE;
   base->is_pes = g_new0 (guint8, 1024);
   base->known_psi = g_new0 (guint8, 1024);
+  base->pid_interest = g_new0 (guint8, 1024);
   base->program_size = sizeof (MpegTSBaseProgram);
   base->stream_size = sizeof (MpegTSBaseStream);
 
@@ -263,6 +278,7 @@ mpegts_base_dispose (GObject * object)
     base->disposed = TRUE;
     g_free (base->known_psi);
     g_free (base->is_pes);
+    g_free (base->pid_interest);
   }
 
   if (G_OBJECT_CLASS (parent_class)->dispose)
@@ -422,6 +438,7 @@ mpegts_base_add_program (MpegTSBase * base,
         pmt_pid);
   }
   MPEGTS_BIT_SET (base->known_psi, pmt_pid);
+  MPEGTS_BIT_SET (base->pid_interest, pmt_pid);
 
   g_hash_table_insert (base->programs,
       GINT_TO_POINTER (program_number), program);
@@ -1180,6 +1197,9 @@ mpegts_base_handle_psi (MpegTSBase * base, GstMpegtsSection * section)
       break;
   }
 
+  /* PAT/PMT/MGT handling above may have changed known_psi/is_pes */
+  mpegts_base_refresh_pid_interest (base);
+
   /* Finally post message (if it wasn't corrupted) */
   if (post_message)
     gst_element_post_message (GST_ELEMENT_CAST (base),
@@ -1433,6 +1453,14 @@ mpegts_base_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
     if (klass->inspect_packet)
       klass->inspect_packet (base, &packet);
 
+    /* Fast path : packets on PIDs we are not interested in only cost
+     * this single bit test */
+    if (G_LIKELY (!MPEGTS_BIT_IS_SET (base->pid_interest, packet.pid))) {
+      if (packet.payload && packet.pid != 0x1fff)
+        GST_LOG ("PID 0x%04x Saw packet on a pid we don't handle", packet.pid);
+      goto next;
+    }
+
     /* If it's a known PES, push it */
     if (MPEGTS_BIT_IS_SET (base->is_pes, packet.pid)) {
       /* push the packet downstream */
@@ -132,6 +132,11 @@ struct _MpegTSBase {
   guint8 *known_psi;
   guint8 *is_pes;
 
+  /* Union of known_psi and is_pes, so that packets on PIDs we are not
+   * interested in only cost a single bit test. Refreshed whenever the
+   * above arrays change (i.e. on reset and PSI updates) */
+  guint8 *pid_interest;
+
   gboolean disposed;
 
   /* size of the MpegTSBaseProgram structure, can be overridden
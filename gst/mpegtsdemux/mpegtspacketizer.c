@@ -698,7 +698,7 @@ mpegts_packetizer_flush_bytes (MpegTSPacketizer2 * packetizer, gsize size)
 static gboolean
 mpegts_packetizer_map (MpegTSPacketizer2 * packetizer, gsize size)
 {
-  gsize available;
+  gsize available, fast;
 
   if (packetizer->map_size - packetizer->map_offset >= size)
     return TRUE;
@@ -709,15 +709,23 @@ mpegts_packetizer_map (MpegTSPacketizer2 * packetizer, gsize size)
   if (available < size)
     return FALSE;
 
-  packetizer->map_data =
-      (guint8 *) gst_adapter_map (packetizer->adapter, available);
+  /* Map the contiguous head of the adapter when it is big enough: that
+   * hands out a reference into the original upstream buffer without any
+   * copy. Only when the requested region spans upstream buffers do we let
+   * the adapter coalesce, and then only the requested size rather than
+   * everything that is queued */
+  fast = gst_adapter_available_fast (packetizer->adapter);
+  if (fast < size)
+    fast = size;
+
+  packetizer->map_data = (guint8 *) gst_adapter_map (packetizer->adapter, fast);
   if (!packetizer->map_data)
     return FALSE;
 
-  packetizer->map_size = available;
+  packetizer->map_size = fast;
   packetizer->map_offset = 0;
 
-  GST_LOG ("mapped %" G_GSIZE_FORMAT " bytes from adapter", available);
+  GST_LOG ("mapped %" G_GSIZE_FORMAT " bytes from adapter", fast);
 
   return TRUE;
 }
@@ -735,16 +743,26 @@ mpegts_try_discover_packet_size (MpegTSPacketizer2 * packetizer)
     MPEGTS_ATSC_PACKETSIZE
   };
 
+retry:
   if (!mpegts_packetizer_map (packetizer, 4 * MPEGTS_MAX_PACKETSIZE))
     return FALSE;
 
   size = packetizer->map_size - packetizer->map_offset;
   data = packetizer->map_data + packetizer->map_offset;
 
-  for (i = 0; i + 3 * MPEGTS_MAX_PACKETSIZE < size; i++) {
-    /* find a sync byte */
-    if (data[i] != PACKET_SYNC_BYTE)
-      continue;
+  i = 0;
+  while (i + 3 * MPEGTS_MAX_PACKETSIZE < size) {
+    const guint8 *candidate;
+
+    /* find a sync byte; memchr() is vectorized (SSE2/NEON) by the C
+     * library, much faster than scanning byte by byte */
+    candidate = memchr (data + i, PACKET_SYNC_BYTE,
+        size - 3 * MPEGTS_MAX_PACKETSIZE - i);
+    if (candidate == NULL) {
+      i = size - 3 * MPEGTS_MAX_PACKETSIZE;
+      break;
+    }
+    i = candidate - data;
 
     /* check for 4 consecutive sync bytes with each possible packet size */
     for (j = 0; j < G_N_ELEMENTS (psizes); j++) {
@@ -757,6 +775,8 @@ mpegts_try_discover_packet_size (MpegTSPacketizer2 * packetizer)
         goto out;
       }
     }
+
+    i++;
   }
 
 out:
@@ -766,7 +786,9 @@ out:
     GST_DEBUG ("Could not determine packet size in %" G_GSIZE_FORMAT
         " bytes buffer, flush %" G_GSIZE_FORMAT " bytes", size, i);
     mpegts_packetizer_flush_bytes (packetizer, packetizer->map_offset);
-    return FALSE;
+    /* We may have only looked at the currently mapped region, scan on
+     * through the rest of the queued data */
+    goto retry;
   }
 
   GST_INFO ("have packetsize detected: %u bytes", packetizer->packet_size);
@@ -788,30 +810,49 @@ mpegts_packetizer_sync (MpegTSPacketizer2 * packetizer)
 
   packet_size = packetizer->packet_size;
 
+  if (packet_size == MPEGTS_M2TS_PACKETSIZE)
+    sync_offset = 4;
+  else
+    sync_offset = 0;
+
+retry:
   if (!mpegts_packetizer_map (packetizer, 3 * packet_size))
     return FALSE;
 
   size = packetizer->map_size - packetizer->map_offset;
   data = packetizer->map_data + packetizer->map_offset;
 
-  if (packet_size == MPEGTS_M2TS_PACKETSIZE)
-    sync_offset = 4;
-  else
-    sync_offset = 0;
+  i = sync_offset;
+  while (i + 2 * packet_size < size) {
+    const guint8 *candidate;
 
-  for (i = sync_offset; i + 2 * packet_size < size; i++) {
-    if (data[i] == PACKET_SYNC_BYTE &&
-        data[i + packet_size] == PACKET_SYNC_BYTE &&
+    /* find a sync byte; memchr() is vectorized (SSE2/NEON) by the C
+     * library, much faster than scanning byte by byte */
+    candidate = memchr (data + i, PACKET_SYNC_BYTE,
+        size - 2 * packet_size - i);
+    if (candidate == NULL) {
+      i = size - 2 * packet_size;
+      break;
+    }
+    i = candidate - data;
+
+    if (data[i + packet_size] == PACKET_SYNC_BYTE &&
         data[i + 2 * packet_size] == PACKET_SYNC_BYTE) {
       found = TRUE;
       break;
     }
+
+    i++;
   }
 
   packetizer->map_offset += i - sync_offset;
 
-  if (!found)
+  if (!found) {
     mpegts_packetizer_flush_bytes (packetizer, packetizer->map_offset);
+    /* We may have only looked at the currently mapped region, scan on
+     * through the rest of the queued data */
+    goto retry;
+  }
 
   return found;
 }
@@ -64,6 +64,11 @@ struct _MpegTSParsePad
 
   /* the return of the latest push */
   GstFlowReturn flow_return;
+
+  /* Packets accumulated for this pad since the last flush. Batching
+   * them in a buffer list means one pad push per input buffer and per
+   * program instead of one per 188 byte packet */
+  GstBufferList *queued;
 };
 
 static GstStaticPadTemplate src_template =
@@ -107,6 +112,7 @@ static MpegTSParsePad *mpegts_parse_create_tspad (MpegTSParse2 * parse,
     const gchar * name);
 static void mpegts_parse_destroy_tspad (MpegTSParse2 * parse,
     MpegTSParsePad * tspad);
+static GstFlowReturn mpegts_parse_flush_program_pads (MpegTSParse2 * parse);
 
 static void mpegts_parse_pad_removed (GstElement * element, GstPad * pad);
 static GstPad *mpegts_parse_request_new_pad (GstElement * element,
@@ -213,6 +219,7 @@ static void
 mpegts_parse_reset (MpegTSBase * base)
 {
   MpegTSParse2 *parse = (MpegTSParse2 *) base;
+  GList *tmp;
 
   /* Set the various know PIDs we are interested in */
 
@@ -244,6 +251,17 @@ mpegts_parse_reset (MpegTSBase * base)
   g_list_free_full (parse->pending_buffers, (GDestroyNotify) gst_buffer_unref);
   parse->pending_buffers = NULL;
 
+  /* Drop any packets still batched on the program pads */
+  for (tmp = parse->srcpads; tmp; tmp = tmp->next) {
+    MpegTSParsePad *tspad =
+        (MpegTSParsePad *) gst_pad_get_element_private ((GstPad *) tmp->data);
+
+    if (tspad && tspad->queued) {
+      gst_buffer_list_unref (tspad->queued);
+      tspad->queued = NULL;
+    }
+  }
+
   parse->current_pcr = GST_CLOCK_TIME_NONE;
   parse->previous_pcr = GST_CLOCK_TIME_NONE;
   parse->base_pcr = GST_CLOCK_TIME_NONE;
@@ -377,6 +395,9 @@ push_event (MpegTSBase * base, GstEvent * event)
   if (G_UNLIKELY (GST_EVENT_TYPE (event) == GST_EVENT_SEGMENT))
     parse->ts_offset = 0;
 
+  /* Flush out batched packets so they stay ordered with the event */
+  mpegts_parse_flush_program_pads (parse);
+
   for (tmp = parse->srcpads; tmp; tmp = tmp->next) {
     GstPad *pad = (GstPad *) tmp->data;
     if (pad) {
@@ -407,6 +428,7 @@ mpegts_parse_create_tspad (MpegTSParse2 * parse, const gchar * pad_name)
   tspad->program = NULL;
   tspad->pushed = FALSE;
   tspad->flow_return = GST_FLOW_NOT_LINKED;
+  tspad->queued = NULL;
   gst_pad_set_element_private (pad, tspad);
   gst_flow_combiner_add_pad (parse->flowcombiner, pad);
 
@@ -417,6 +439,8 @@ static void
 mpegts_parse_destroy_tspad (MpegTSParse2 * parse, MpegTSParsePad * tspad)
 {
   /* free the wrapper */
+  if (tspad->queued)
+    gst_buffer_list_unref (tspad->queued);
   g_free (tspad);
 }
 
@@ -558,8 +582,9 @@ mpegts_parse_tspad_push_section (MpegTSParse2 * parse, MpegTSParsePad * tspad,
         gst_buffer_new_and_alloc (packet->data_end - packet->data_start);
     gst_buffer_fill (buf, 0, packet->data_start,
         packet->data_end - packet->data_start);
-    ret = gst_pad_push (tspad->pad, buf);
-    ret = gst_flow_combiner_update_flow (parse->flowcombiner, ret);
+    if (tspad->queued == NULL)
+      tspad->queued = gst_buffer_list_new ();
+    gst_buffer_list_add (tspad->queued, buf);
   }
 
   GST_LOG_OBJECT (parse, "Returning %s", gst_flow_get_name (ret));
@@ -588,9 +613,10 @@ mpegts_parse_tspad_push (MpegTSParse2 * parse, MpegTSParsePad * tspad,
           gst_buffer_new_and_alloc (packet->data_end - packet->data_start);
       gst_buffer_fill (buf, 0, packet->data_start,
           packet->data_end - packet->data_start);
-      /* push if there's no filter or if the pid is in the filter */
-      ret = gst_pad_push (tspad->pad, buf);
-      ret = gst_flow_combiner_update_flow (parse->flowcombiner, ret);
+      /* queue if there's no filter or if the pid is in the filter */
+      if (tspad->queued == NULL)
+        tspad->queued = gst_buffer_list_new ();
+      gst_buffer_list_add (tspad->queued, buf);
     }
   }
   GST_DEBUG_OBJECT (parse, "Returning %s", gst_flow_get_name (ret));
@@ -598,6 +624,41 @@ mpegts_parse_tspad_push (MpegTSParse2 * parse, MpegTSParsePad * tspad,
   return ret;
 }
 
+/* Push out the packets batched on the program pads since the last
+ * flush. Called once per input buffer (and before forwarding events)
+ * so that each program branch gets one buffer list per input buffer
+ * instead of an individual push per 188 byte packet */
+static GstFlowReturn
+mpegts_parse_flush_program_pads (MpegTSParse2 * parse)
+{
+  GstFlowReturn ret = GST_FLOW_OK;
+  GList *tmp;
+
+  for (tmp = parse->srcpads; tmp; tmp = tmp->next) {
+    GstPad *pad = (GstPad *) tmp->data;
+    MpegTSParsePad *tspad =
+        (MpegTSParsePad *) gst_pad_get_element_private (pad);
+    GstBufferList *queued;
+    GstFlowReturn pret;
+
+    if (tspad == NULL || tspad->queued == NULL)
+      continue;
+
+    queued = tspad->queued;
+    tspad->queued = NULL;
+
+    GST_LOG_OBJECT (parse, "Pushing %u queued packets on %s:%s",
+        gst_buffer_list_length (queued), GST_DEBUG_PAD_NAME (pad));
+    pret = gst_pad_push_list (pad, queued);
+    tspad->flow_return = pret;
+    pret = gst_flow_combiner_update_flow (parse->flowcombiner, pret);
+    if (G_UNLIKELY (pret != GST_FLOW_OK && pret != GST_FLOW_NOT_LINKED))
+      ret = pret;
+  }
+
+  return ret;
+}
+
 static void
 pad_clear_for_push (GstPad * pad, MpegTSParse2 * parse)
 {
@@ -872,6 +933,12 @@ mpegts_parse_input_done (MpegTSBase * base, GstBuffer * buffer)
         GST_TIME_ARGS (parse->current_pcr));
   }
 
+  ret = mpegts_parse_flush_program_pads (parse);
+  if (G_UNLIKELY (ret != GST_FLOW_OK)) {
+    gst_buffer_unref (buffer);
+    return ret;
+  }
+
   if (parse->set_timestamps || parse->first) {
     parse->pending_buffers = g_list_prepend (parse->pending_buffers, buffer);
     parse->bytes_since_pcr += gst_buffer_get_size (buffer);
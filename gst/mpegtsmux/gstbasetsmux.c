@@ -112,6 +112,8 @@ gst_base_ts_mux_pad_reset (GstBaseTsMuxPad * pad)
 {
   pad->dts = GST_CLOCK_STIME_NONE;
   pad->prog_id = -1;
+  pad->next_ts = GST_CLOCK_TIME_NONE;
+  pad->next_ts_valid = FALSE;
 
   if (pad->free_func)
     pad->free_func (pad->prepare_data);
@@ -140,6 +142,9 @@ gst_base_ts_mux_pad_flush (GstAggregatorPad * agg_pad, GstAggregator * agg)
   GList *cur;
   GstBaseTsMux *mux = GST_BASE_TS_MUX (agg);
 
+  /* The queued buffer we cached a timestamp for is gone */
+  GST_BASE_TS_MUX_PAD (agg_pad)->next_ts_valid = FALSE;
+
   /* Send initial segments again after a flush-stop, and also resend the
    * header sections */
   mux->first = TRUE;
@@ -1534,21 +1539,30 @@ gst_base_ts_mux_find_best_pad (GstAggregator * aggregator)
   GstClockTime best_ts = GST_CLOCK_TIME_NONE;
 
   for (l = GST_ELEMENT_CAST (aggregator)->sinkpads; l; l = l->next) {
+    GstClockTime t;
+
     pad = GST_BASE_TS_MUX_PAD (l->data);
-    buffer = gst_aggregator_pad_peek_buffer (GST_AGGREGATOR_PAD (pad));
-    if (!buffer)
-      continue;
+
+    if (pad->next_ts_valid) {
+      /* The head buffer hasn't been popped since we last peeked it */
+      t = pad->next_ts;
+    } else {
+      buffer = gst_aggregator_pad_peek_buffer (GST_AGGREGATOR_PAD (pad));
+      if (!buffer)
+        continue;
+      t = GST_BUFFER_DTS_OR_PTS (buffer);
+      gst_buffer_unref (buffer);
+      pad->next_ts = t;
+      pad->next_ts_valid = TRUE;
+    }
+
     if (best_ts == GST_CLOCK_TIME_NONE) {
       best = pad;
-      best_ts = GST_BUFFER_DTS_OR_PTS (buffer);
-    } else if (GST_BUFFER_DTS_OR_PTS (buffer) != GST_CLOCK_TIME_NONE) {
-      GstClockTime t = GST_BUFFER_DTS_OR_PTS (buffer);
-      if (t < best_ts) {
-        best = pad;
-        best_ts = t;
-      }
+      best_ts = t;
+    } else if (t != GST_CLOCK_TIME_NONE && t < best_ts) {
+      best = pad;
+      best_ts = t;
     }
-    gst_buffer_unref (buffer);
   }
   GST_DEBUG_OBJECT (aggregator,
       "Best pad found with %" GST_TIME_FORMAT ": %" GST_PTR_FORMAT,
@@ -1583,6 +1597,7 @@ gst_base_ts_mux_aggregate (GstAggregator * agg, gboolean timeout)
     GstBuffer *buffer;
 
     buffer = gst_aggregator_pad_pop_buffer (GST_AGGREGATOR_PAD (best));
+    best->next_ts_valid = FALSE;
 
     ret =
         gst_base_ts_mux_aggregate_buffer (GST_BASE_TS_MUX (agg),
@@ -1643,6 +1658,11 @@ gst_base_ts_mux_dispose (GObject * object)
     g_hash_table_destroy (mux->programs);
     mux->programs = NULL;
   }
+  if (mux->packet_pool) {
+    gst_buffer_pool_set_active (mux->packet_pool, FALSE);
+    gst_object_unref (mux->packet_pool);
+    mux->packet_pool = NULL;
+  }
   GST_CALL_PARENT (G_OBJECT_CLASS, dispose, (object));
 }
 
@@ -1757,9 +1777,21 @@ static void
 gst_base_ts_mux_default_allocate_packet (GstBaseTsMux * mux,
     GstBuffer ** buffer)
 {
-  GstBuffer *buf;
+  GstBuffer *buf = NULL;
+
+  if (G_UNLIKELY (mux->packet_pool == NULL)) {
+    GstStructure *config;
+
+    mux->packet_pool = gst_buffer_pool_new ();
+    config = gst_buffer_pool_get_config (mux->packet_pool);
+    gst_buffer_pool_config_set_params (config, NULL, mux->packet_size, 0, 0);
+    gst_buffer_pool_set_config (mux->packet_pool, config);
+    gst_buffer_pool_set_active (mux->packet_pool, TRUE);
+  }
 
-  buf = gst_buffer_new_and_alloc (mux->packet_size);
+  if (G_UNLIKELY (gst_buffer_pool_acquire_buffer (mux->packet_pool, &buf,
+              NULL) != GST_FLOW_OK))
+    buf = gst_buffer_new_and_alloc (mux->packet_size);
 
   *buffer = buf;
 }
@@ -1778,7 +1810,18 @@ gst_base_ts_mux_default_output_packet (GstBaseTsMux * mux, GstBuffer * buffer,
 void
 gst_base_ts_mux_set_packet_size (GstBaseTsMux * mux, gsize size)
 {
+  if (mux->packet_size == size)
+    return;
+
   mux->packet_size = size;
+
+  /* The packet pool is sized for the old packet size, drop it and let
+   * allocate_packet create a new one on demand */
+  if (mux->packet_pool) {
+    gst_buffer_pool_set_active (mux->packet_pool, FALSE);
+    gst_object_unref (mux->packet_pool);
+    mux->packet_pool = NULL;
+  }
 }
 
 void
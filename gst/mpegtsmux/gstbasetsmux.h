@@ -127,6 +127,13 @@ struct _GstBaseTsMuxPad
   /* most recent DTS */
   gint64 dts;
 
+  /* cached timestamp of the buffer at the head of this pad's queue, so
+   * that selecting the next pad to mux does not have to peek (lock and
+   * ref) every sink pad again. Only valid while that buffer stays
+   * queued; invalidated when it is popped or the pad is flushed */
+  GstClockTime next_ts;
+  gboolean next_ts_valid;
+
   /* optional codec data available in the caps */
   GstBuffer *codec_data;
 
@@ -193,6 +200,10 @@ struct GstBaseTsMux {
   /* output buffer aggregation */
   GstAdapter *out_adapter;
   GstBuffer *out_buffer;
+
+  /* pool of packet_size buffers, so that the default allocate_packet
+   * implementation doesn't have to allocate for every single packet */
+  GstBufferPool *packet_pool;
 };
 
 /**
@@ -508,6 +508,12 @@ gst_mxf_demux_resolve_references (GstMXFDemux * demux)
 
   g_rw_lock_writer_lock (&demux->metadata_lock);
 
+  if (demux->metadata_resolved && !demux->update_metadata) {
+    GST_DEBUG_OBJECT (demux, "Metadata already resolved and unchanged");
+    g_rw_lock_writer_unlock (&demux->metadata_lock);
+    return GST_FLOW_OK;
+  }
+
   GST_DEBUG_OBJECT (demux, "Resolve metadata references");
   demux->update_metadata = FALSE;
 
@@ -1690,6 +1696,7 @@ gst_mxf_demux_handle_generic_container_essence_element (GstMXFDemux * demux,
   GstFlowReturn ret = GST_FLOW_OK;
   guint32 track_number;
   guint i;
+  guint pads_remaining;
   GstBuffer *inbuf = NULL;
   GstBuffer *outbuf = NULL;
   GstMXFDemuxEssenceTrack *etrack = NULL;
@@ -1886,12 +1893,24 @@ gst_mxf_demux_handle_generic_container_essence_element (GstMXFDemux * demux,
   inbuf = outbuf;
   outbuf = NULL;
 
+  /* Count the pads that use this essence track so the last one can take
+   * over our reference instead of copying the buffer once more */
+  pads_remaining = 0;
+  for (i = 0; i < demux->src->len; i++) {
+    GstMXFDemuxPad *pad = g_ptr_array_index (demux->src, i);
+
+    if (pad->current_essence_track == etrack)
+      pads_remaining++;
+  }
+
   for (i = 0; i < demux->src->len; i++) {
     GstMXFDemuxPad *pad = g_ptr_array_index (demux->src, i);
 
     if (pad->current_essence_track != etrack)
       continue;
 
+    pads_remaining--;
+
     if (pad->eos) {
       GST_DEBUG_OBJECT (demux, "Pad is already EOS");
       continue;
@@ -1912,10 +1931,17 @@ gst_mxf_demux_handle_generic_container_essence_element (GstMXFDemux * demux,
       }
     }
 
-    /* Create another subbuffer to have writable metadata */
-    outbuf =
-        gst_buffer_copy_region (inbuf, GST_BUFFER_COPY_ALL, 0,
-        gst_buffer_get_size (inbuf));
+    /* Create another subbuffer to have writable metadata, unless this is
+     * the last pad using this essence element and our own reference is
+     * writable already */
+    if (pads_remaining == 0 && gst_buffer_is_writable (inbuf)) {
+      outbuf = inbuf;
+      inbuf = NULL;
+    } else {
+      outbuf =
+          gst_buffer_copy_region (inbuf, GST_BUFFER_COPY_ALL, 0,
+          gst_buffer_get_size (inbuf));
+    }
 
     GST_BUFFER_DTS (outbuf) = pad->position;
     if (etrack->intra_only) {
@@ -2602,6 +2628,12 @@ next_try:
     goto next_try;
   }
 
+  /* The metadata from this partition supersedes the header partition's
+   * metadata, so don't parse the header metadata sets again just to
+   * discard them as older duplicates afterwards */
+  if (old_partition)
+    old_partition->parsed_metadata = TRUE;
+
 out:
   if (buffer)
     gst_buffer_unref (buffer);
@@ -115,13 +115,24 @@ static GstStaticPadTemplate src_templ = GST_STATIC_PAD_TEMPLATE ("src",
 
 enum
 {
-  PROP_0
+  PROP_0,
+  PROP_INDEX_TABLE_SEGMENT_SIZE
 };
 
+#define DEFAULT_INDEX_TABLE_SEGMENT_SIZE 0
+#define MAX_INDEX_TABLE_SEGMENT_SIZE (G_MAXUINT16 / 11)
+/* The temporal offset patching below reaches at most 127 edit units
+ * backwards, segments must be larger than that to be flushable */
+#define MIN_INDEX_TABLE_SEGMENT_SIZE 128
+
 #define gst_mxf_mux_parent_class parent_class
 G_DEFINE_TYPE (GstMXFMux, gst_mxf_mux, GST_TYPE_AGGREGATOR);
 
 static void gst_mxf_mux_finalize (GObject * object);
+static void gst_mxf_mux_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_mxf_mux_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
 
 static GstFlowReturn gst_mxf_mux_aggregate (GstAggregator * aggregator,
     gboolean timeout);
@@ -163,6 +174,28 @@ gst_mxf_mux_class_init (GstMXFMuxClass * klass)
   gstaggregator_class = (GstAggregatorClass *) klass;
 
   gobject_class->finalize = gst_mxf_mux_finalize;
+  gobject_class->set_property = gst_mxf_mux_set_property;
+  gobject_class->get_property = gst_mxf_mux_get_property;
+
+  /**
+   * GstMXFMux:index-table-segment-size:
+   *
+   * Number of edit units per index table segment. If non-zero, completed
+   * index table segments are written into body partitions as the file
+   * grows instead of being collected in memory until EOS, which keeps
+   * memory usage of long-duration recordings bounded.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class,
+      PROP_INDEX_TABLE_SEGMENT_SIZE,
+      g_param_spec_uint ("index-table-segment-size",
+          "Index table segment size",
+          "Number of edit units per index table segment. If non-zero, "
+          "completed index table segments are written into body partitions "
+          "instead of being kept in memory until EOS (0 = disabled)",
+          0, MAX_INDEX_TABLE_SEGMENT_SIZE, DEFAULT_INDEX_TABLE_SEGMENT_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gstaggregator_class->create_new_pad =
       GST_DEBUG_FUNCPTR (gst_mxf_mux_create_new_pad);
@@ -191,9 +224,44 @@ static void
 gst_mxf_mux_init (GstMXFMux * mux)
 {
   mux->index_table = g_array_new (FALSE, FALSE, sizeof (MXFIndexTableSegment));
+  mux->index_partitions =
+      g_array_new (FALSE, FALSE, sizeof (MXFRandomIndexPackEntry));
+  mux->index_table_segment_size = DEFAULT_INDEX_TABLE_SEGMENT_SIZE;
   gst_mxf_mux_reset (mux);
 }
 
+static void
+gst_mxf_mux_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstMXFMux *mux = GST_MXF_MUX (object);
+
+  switch (prop_id) {
+    case PROP_INDEX_TABLE_SEGMENT_SIZE:
+      mux->index_table_segment_size = g_value_get_uint (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_mxf_mux_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstMXFMux *mux = GST_MXF_MUX (object);
+
+  switch (prop_id) {
+    case PROP_INDEX_TABLE_SEGMENT_SIZE:
+      g_value_set_uint (value, mux->index_table_segment_size);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
 static void
 gst_mxf_mux_finalize (GObject * object)
 {
@@ -217,6 +285,11 @@ gst_mxf_mux_finalize (GObject * object)
     mux->index_table = NULL;
   }
 
+  if (mux->index_partitions) {
+    g_array_free (mux->index_partitions, TRUE);
+    mux->index_partitions = NULL;
+  }
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -268,6 +341,12 @@ gst_mxf_mux_reset (GstMXFMux * mux)
   g_array_set_size (mux->index_table, 0);
   mux->current_index_pos = 0;
   mux->last_keyframe_pos = 0;
+
+  if (mux->index_partitions)
+    g_array_set_size (mux->index_partitions, 0);
+  mux->flushed_index_pos = 0;
+  mux->body_partition_offset = 0;
+  mux->last_partition_offset = 0;
 }
 
 static gboolean
@@ -1205,6 +1284,87 @@ static const guint8 _gc_essence_element_ul[] = {
   0x0d, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00
 };
 
+/* Writes all not-yet-flushed index table segments before @end into a new
+ * body partition and frees their index entries. Essence continues in the
+ * new partition afterwards. */
+static GstFlowReturn
+gst_mxf_mux_flush_index_table_segments (GstMXFMux * mux, guint end)
+{
+  GstFlowReturn ret;
+  GstBuffer *buf;
+  GList *buffers = NULL;
+  GList *l;
+  guint64 index_byte_count = 0;
+  guint64 this_partition;
+  MXFRandomIndexPackEntry entry;
+  guint i;
+
+  for (i = mux->flushed_index_pos; i < end; i++) {
+    MXFIndexTableSegment *segment =
+        &g_array_index (mux->index_table, MXFIndexTableSegment, i);
+
+    buf = mxf_index_table_segment_to_buffer (segment);
+    index_byte_count += gst_buffer_get_size (buf);
+    buffers = g_list_prepend (buffers, buf);
+
+    g_free (segment->index_entries);
+    segment->index_entries = NULL;
+  }
+  buffers = g_list_reverse (buffers);
+
+  this_partition = mux->offset;
+
+  GST_DEBUG_OBJECT (mux,
+      "Flushing index table segments %u to %u into a body partition at offset %"
+      G_GUINT64_FORMAT, mux->flushed_index_pos, end - 1, this_partition);
+
+  mux->partition.type = MXF_PARTITION_PACK_BODY;
+  mux->partition.closed = TRUE;
+  mux->partition.complete = TRUE;
+  mux->partition.this_partition = this_partition;
+  mux->partition.prev_partition = mux->last_partition_offset;
+  mux->partition.footer_partition = 0;
+  mux->partition.header_byte_count = 0;
+  mux->partition.index_byte_count = index_byte_count;
+  mux->partition.index_sid =
+      mux->preface->content_storage->essence_container_data[0]->index_sid;
+  mux->partition.body_sid =
+      mux->preface->content_storage->essence_container_data[0]->body_sid;
+  /* body_offset is left alone, the essence container simply continues in
+   * this partition after the index table segments */
+
+  buf = mxf_partition_pack_to_buffer (&mux->partition);
+  if ((ret = gst_mxf_mux_push (mux, buf)) != GST_FLOW_OK) {
+    GST_ERROR_OBJECT (mux, "Failed pushing partition: %s",
+        gst_flow_get_name (ret));
+    g_list_foreach (buffers, (GFunc) gst_mini_object_unref, NULL);
+    g_list_free (buffers);
+    return ret;
+  }
+
+  for (l = buffers; l; l = l->next) {
+    buf = l->data;
+    l->data = NULL;
+    if ((ret = gst_mxf_mux_push (mux, buf)) != GST_FLOW_OK) {
+      GST_ERROR_OBJECT (mux, "Failed pushing index table segment: %s",
+          gst_flow_get_name (ret));
+      g_list_foreach (l, (GFunc) gst_mini_object_unref, NULL);
+      g_list_free (buffers);
+      return ret;
+    }
+  }
+  g_list_free (buffers);
+
+  entry.offset = this_partition;
+  entry.body_sid = mux->partition.body_sid;
+  g_array_append_val (mux->index_partitions, entry);
+
+  mux->last_partition_offset = this_partition;
+  mux->flushed_index_pos = end;
+
+  return GST_FLOW_OK;
+}
+
 static GstFlowReturn
 gst_mxf_mux_handle_buffer (GstMXFMux * mux, GstMXFMuxPad * pad)
 {
@@ -1268,7 +1428,11 @@ gst_mxf_mux_handle_buffer (GstMXFMux * mux, GstMXFMuxPad * pad)
   /* We currently only index the first essence stream */
   if (pad == (GstMXFMuxPad *) GST_ELEMENT_CAST (mux)->sinkpads->data) {
     MXFIndexTableSegment *segment;
-    const gint max_segment_size = G_MAXUINT16 / 11;
+    gint max_segment_size = MAX_INDEX_TABLE_SEGMENT_SIZE;
+
+    if (mux->index_table_segment_size > 0)
+      max_segment_size = CLAMP ((gint) mux->index_table_segment_size,
+          MIN_INDEX_TABLE_SEGMENT_SIZE, MAX_INDEX_TABLE_SEGMENT_SIZE);
 
     if (mux->index_table->len == 0 ||
         g_array_index (mux->index_table, MXFIndexTableSegment,
@@ -1379,8 +1543,10 @@ gst_mxf_mux_handle_buffer (GstMXFMux * mux, GstMXFMuxPad * pad)
         pts_segment =
             &g_array_index (mux->index_table, MXFIndexTableSegment,
             pts_index_pos);
-        pts_segment->index_entries[pts_segment_pos +
-            index_pos_diff].temporal_offset = -index_pos_diff;
+        /* Already flushed segments can't be patched anymore */
+        if (pts_segment->index_entries)
+          pts_segment->index_entries[pts_segment_pos +
+              index_pos_diff].temporal_offset = -index_pos_diff;
       }
     }
 
@@ -1396,6 +1562,18 @@ gst_mxf_mux_handle_buffer (GstMXFMux * mux, GstMXFMuxPad * pad)
 
     segment->n_index_entries++;
     segment->index_duration++;
+
+    /* Everything more than one segment behind the current position is out
+     * of reach of the temporal offset patching above (bounded to +/- 127
+     * edit units) and can be written out */
+    if (mux->index_table_segment_size > 0
+        && mux->current_index_pos > mux->flushed_index_pos + 1) {
+      ret =
+          gst_mxf_mux_flush_index_table_segments (mux,
+          mux->current_index_pos - 1);
+      if (ret != GST_FLOW_OK)
+        return ret;
+    }
   }
 
   buf_size = gst_buffer_get_size (buf);
@@ -1446,6 +1624,9 @@ gst_mxf_mux_write_body_partition (GstMXFMux * mux)
   mux->partition.body_sid =
       mux->preface->content_storage->essence_container_data[0]->body_sid;
 
+  mux->body_partition_offset = mux->partition.this_partition;
+  mux->last_partition_offset = mux->partition.this_partition;
+
   buf = mxf_partition_pack_to_buffer (&mux->partition);
   return gst_mxf_mux_push (mux, buf);
 }
@@ -1564,7 +1745,7 @@ gst_mxf_mux_handle_eos (GstMXFMux * mux)
   }
 
   {
-    guint64 body_partition = mux->partition.this_partition;
+    guint64 body_partition = mux->body_partition_offset;
     guint32 body_sid = mux->partition.body_sid;
     guint64 footer_partition = mux->offset;
     GArray *rip;
@@ -1576,7 +1757,7 @@ gst_mxf_mux_handle_eos (GstMXFMux * mux)
     guint i;
     GstBuffer *buf;
 
-    for (i = 0; i < mux->index_table->len; i++) {
+    for (i = mux->flushed_index_pos; i < mux->index_table->len; i++) {
       MXFIndexTableSegment *segment =
           &g_array_index (mux->index_table, MXFIndexTableSegment, i);
       GstBuffer *segment_buffer = mxf_index_table_segment_to_buffer (segment);
@@ -1589,7 +1770,7 @@ gst_mxf_mux_handle_eos (GstMXFMux * mux)
     mux->partition.closed = TRUE;
     mux->partition.complete = TRUE;
     mux->partition.this_partition = mux->offset;
-    mux->partition.prev_partition = body_partition;
+    mux->partition.prev_partition = mux->last_partition_offset;
     mux->partition.footer_partition = mux->offset;
     mux->partition.header_byte_count = 0;
     mux->partition.index_byte_count = index_byte_count;
@@ -1615,6 +1796,9 @@ gst_mxf_mux_handle_eos (GstMXFMux * mux)
     entry.offset = body_partition;
     entry.body_sid = body_sid;
     g_array_append_val (rip, entry);
+    if (mux->index_partitions->len > 0)
+      g_array_append_vals (rip, mux->index_partitions->data,
+          mux->index_partitions->len);
     entry.offset = footer_partition;
     entry.body_sid = 0;
     g_array_append_val (rip, entry);
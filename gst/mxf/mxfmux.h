@@ -72,6 +72,15 @@ typedef struct _GstMXFMux {
   GArray *index_table;
   guint current_index_pos;
   guint64 last_keyframe_pos;
+
+  /* Streaming index table segment flushing */
+  guint flushed_index_pos;
+  GArray *index_partitions;
+  guint64 body_partition_offset;
+  guint64 last_partition_offset;
+
+  /* properties */
+  guint index_table_segment_size;
 } GstMXFMux;
 
 typedef struct _GstMXFMuxClass {
@@ -98,8 +98,7 @@ static gboolean
 gst_net_sim_source_dispatch (GSource * source,
     GSourceFunc callback, gpointer user_data)
 {
-  callback (user_data);
-  return FALSE;
+  return callback (user_data);
 }
 
 GSourceFuncs gst_net_sim_source_funcs = {
@@ -109,6 +108,8 @@ GSourceFuncs gst_net_sim_source_funcs = {
   NULL                          /* finalize */
 };
 
+static gboolean gst_net_sim_process_delayed_queue (gpointer user_data);
+
 static void
 gst_net_sim_loop (GstNetSim * netsim)
 {
@@ -161,6 +162,14 @@ gst_net_sim_src_activatemode (GstPad * pad, GstObject * parent,
       netsim->main_loop = g_main_loop_new (main_context, FALSE);
       g_main_context_unref (main_context);
 
+      netsim->delay_source =
+          g_source_new (&gst_net_sim_source_funcs, sizeof (GSource));
+      g_source_set_ready_time (netsim->delay_source, -1);
+      g_source_set_callback (netsim->delay_source,
+          gst_net_sim_process_delayed_queue, netsim, NULL);
+      g_source_attach (netsim->delay_source,
+          g_main_loop_get_context (netsim->main_loop));
+
       GST_TRACE_OBJECT (netsim, "ACT: Starting task on srcpad");
       result = gst_pad_start_task (netsim->srcpad,
           (GstTaskFunction) gst_net_sim_loop, netsim, NULL);
@@ -198,6 +207,15 @@ gst_net_sim_src_activatemode (GstPad * pad, GstObject * parent,
       GST_TRACE_OBJECT (netsim, "DEACT: Stopping task on srcpad");
       result = gst_pad_stop_task (netsim->srcpad);
       GST_TRACE_OBJECT (netsim, "DEACT: Mainloop and GstTask stopped");
+
+      g_source_destroy (netsim->delay_source);
+      g_source_unref (netsim->delay_source);
+      netsim->delay_source = NULL;
+
+      /* drop whatever was still scheduled */
+      g_queue_foreach (&netsim->delayed_queue, (GFunc) push_buffer_ctx_free,
+          NULL);
+      g_queue_clear (&netsim->delayed_queue);
     }
   }
   g_mutex_unlock (&netsim->loop_mutex);
@@ -209,6 +227,7 @@ typedef struct
 {
   GstPad *pad;
   GstBuffer *buf;
+  gint64 ready_time;
 } PushBufferCtx;
 
 static inline PushBufferCtx *
@@ -238,6 +257,45 @@ push_buffer_ctx_push (PushBufferCtx * ctx)
   return FALSE;
 }
 
+static gint
+push_buffer_ctx_compare (gconstpointer a, gconstpointer b, gpointer user_data)
+{
+  const PushBufferCtx *ctx_a = a;
+  const PushBufferCtx *ctx_b = b;
+
+  /* equal ready times sort after, keeping arrival order stable */
+  return ctx_a->ready_time < ctx_b->ready_time ? -1 : 1;
+}
+
+/* Runs on the srcpad task, servicing all delayed buffers that came due from
+ * a single source instead of one source per buffer */
+static gboolean
+gst_net_sim_process_delayed_queue (gpointer user_data)
+{
+  GstNetSim *netsim = user_data;
+  GQueue due = G_QUEUE_INIT;
+  PushBufferCtx *ctx;
+  gint64 now_time = g_get_monotonic_time ();
+
+  g_mutex_lock (&netsim->loop_mutex);
+  while ((ctx = g_queue_peek_head (&netsim->delayed_queue)) != NULL &&
+      ctx->ready_time <= now_time)
+    g_queue_push_tail (&due, g_queue_pop_head (&netsim->delayed_queue));
+
+  ctx = g_queue_peek_head (&netsim->delayed_queue);
+  g_source_set_ready_time (netsim->delay_source,
+      ctx != NULL ? ctx->ready_time : -1);
+  g_mutex_unlock (&netsim->loop_mutex);
+
+  /* push without the lock, like the per-buffer sources used to */
+  while ((ctx = g_queue_pop_head (&due)) != NULL) {
+    push_buffer_ctx_push (ctx);
+    push_buffer_ctx_free (ctx);
+  }
+
+  return TRUE;
+}
+
 static gint
 get_random_value_uniform (GRand * rand_seed, gint32 min_value, gint32 max_value)
 {
@@ -336,7 +394,6 @@ gst_net_sim_delay_buffer (GstNetSim * netsim, GstBuffer * buf)
       g_rand_double (netsim->rand_seed) < netsim->delay_probability) {
     gint delay;
     PushBufferCtx *ctx;
-    GSource *source;
     gint64 ready_time, now_time;
 
     switch (netsim->delay_distribution) {
@@ -362,7 +419,6 @@ gst_net_sim_delay_buffer (GstNetSim * netsim, GstBuffer * buf)
 
     ctx = push_buffer_ctx_new (netsim->srcpad, buf);
 
-    source = g_source_new (&gst_net_sim_source_funcs, sizeof (GSource));
     now_time = g_get_monotonic_time ();
     ready_time = now_time + delay * 1000;
     if (!netsim->allow_reordering && ready_time < netsim->last_ready_time)
@@ -372,11 +428,21 @@ gst_net_sim_delay_buffer (GstNetSim * netsim, GstBuffer * buf)
     GST_DEBUG_OBJECT (netsim, "Delaying packet by %" G_GINT64_FORMAT "ms",
         (ready_time - now_time) / 1000);
 
-    g_source_set_ready_time (source, ready_time);
-    g_source_set_callback (source, (GSourceFunc) push_buffer_ctx_push,
-        ctx, (GDestroyNotify) push_buffer_ctx_free);
-    g_source_attach (source, g_main_loop_get_context (netsim->main_loop));
-    g_source_unref (source);
+    ctx->ready_time = ready_time;
+
+    /* the common case lands at the tail; only wake the service source up
+     * when the head of the queue changed */
+    if (g_queue_is_empty (&netsim->delayed_queue) ||
+        ready_time >= ((PushBufferCtx *)
+            g_queue_peek_tail (&netsim->delayed_queue))->ready_time) {
+      g_queue_push_tail (&netsim->delayed_queue, ctx);
+    } else {
+      g_queue_insert_sorted (&netsim->delayed_queue, ctx,
+          push_buffer_ctx_compare, NULL);
+    }
+
+    if (g_queue_peek_head (&netsim->delayed_queue) == ctx)
+      g_source_set_ready_time (netsim->delay_source, ready_time);
   } else {
     ret = gst_pad_push (netsim->srcpad, gst_buffer_ref (buf));
   }
@@ -605,6 +671,8 @@ gst_net_sim_init (GstNetSim * netsim)
   g_cond_init (&netsim->start_cond);
   netsim->rand_seed = g_rand_new ();
   netsim->main_loop = NULL;
+  g_queue_init (&netsim->delayed_queue);
+  netsim->delay_source = NULL;
   netsim->prev_time = GST_CLOCK_TIME_NONE;
 
   GST_OBJECT_FLAG_SET (netsim->sinkpad,
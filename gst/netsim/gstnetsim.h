@@ -71,6 +71,10 @@ struct _GstNetSim
   GCond start_cond;
   GMainLoop *main_loop;
   gboolean running;
+
+  /* delayed buffers ordered by ready time, serviced by one source */
+  GQueue delayed_queue;
+  GSource *delay_source;
   GRand *rand_seed;
   gsize bucket_size;
   GstClockTime prev_time;
@@ -502,19 +502,26 @@ handle_buffer (GstRtpOnvifTimestamp * self, GstBuffer * buf)
     return FALSE;
   }
 
-  if (!gst_rtp_buffer_set_extension_data (&rtp, EXTENSION_ID, EXTENSION_SIZE)) {
-    GST_ELEMENT_ERROR (self, STREAM, FAILED, ("Failed to set extension data"),
-        (NULL));
-    gst_rtp_buffer_unmap (&rtp);
-    return FALSE;
-  }
-
+  /* If the packet already carries our extension with the right size, e.g.
+   * when re-streaming recorded data, rewrite it in place. Only packets
+   * without it need the extension area to be (re)allocated. */
   if (!gst_rtp_buffer_get_extension_data (&rtp, &bits, (gpointer) & data,
-          &wordlen)) {
-    GST_ELEMENT_ERROR (self, STREAM, FAILED, ("Failed to get extension data"),
-        (NULL));
-    gst_rtp_buffer_unmap (&rtp);
-    return FALSE;
+          &wordlen) || bits != EXTENSION_ID || wordlen != EXTENSION_SIZE) {
+    if (!gst_rtp_buffer_set_extension_data (&rtp, EXTENSION_ID,
+            EXTENSION_SIZE)) {
+      GST_ELEMENT_ERROR (self, STREAM, FAILED, ("Failed to set extension data"),
+          (NULL));
+      gst_rtp_buffer_unmap (&rtp);
+      return FALSE;
+    }
+
+    if (!gst_rtp_buffer_get_extension_data (&rtp, &bits, (gpointer) & data,
+            &wordlen)) {
+      GST_ELEMENT_ERROR (self, STREAM, FAILED, ("Failed to get extension data"),
+          (NULL));
+      gst_rtp_buffer_unmap (&rtp);
+      return FALSE;
+    }
   }
 
   /* NTP timestamp */
@@ -453,6 +453,19 @@ gst_pcap_parse_scan_frame (GstPcapParse * self,
   src_port = GUINT16_FROM_BE (*((guint16 *) (buf_proto + 0)));
   dst_port = GUINT16_FROM_BE (*((guint16 *) (buf_proto + 2)));
 
+  /* filter as configured before bothering with the payload */
+  if (self->src_ip >= 0 && ip_src_addr != self->src_ip)
+    return FALSE;
+
+  if (self->dst_ip >= 0 && ip_dst_addr != self->dst_ip)
+    return FALSE;
+
+  if (self->src_port >= 0 && src_port != self->src_port)
+    return FALSE;
+
+  if (self->dst_port >= 0 && dst_port != self->dst_port)
+    return FALSE;
+
   /* extract some params and data according to protocol */
   if (ip_protocol == IP_PROTO_UDP) {
     len = GUINT16_FROM_BE (*((guint16 *) (buf_proto + 4)));
@@ -473,17 +486,83 @@ gst_pcap_parse_scan_frame (GstPcapParse * self,
     *payload_size = self->cur_packet_size - (buf_proto - buf) - len;
   }
 
-  /* but still filter as configured */
-  if (self->src_ip >= 0 && ip_src_addr != self->src_ip)
+  return TRUE;
+}
+
+/* maximum number of bytes the pre-filter below looks at: link header
+ * (largest is Ethernet + VLAN tag), maximum IPv4 header, both ports */
+#define PREFILTER_HEADERS_LEN \
+    (ETH_HEADER_LEN + ETH_VLAN_HEADER_LEN + 60 + 4)
+
+/* Cheap rejection test against the configured address/port filters that
+ * only needs the first PREFILTER_HEADERS_LEN bytes of a packet, so
+ * non-matching packets can be flushed from the adapter without mapping
+ * (and possibly assembling) the whole packet.  Returns FALSE if the packet
+ * definitely cannot match; anything the pre-filter cannot parse is left
+ * for gst_pcap_parse_scan_frame() to decide. */
+static gboolean
+gst_pcap_parse_prefilter (GstPcapParse * self, const guint8 * buf,
+    gint buf_size)
+{
+  const guint8 *buf_ip;
+  const guint8 *buf_proto;
+  guint16 eth_type;
+  guint8 ip_header_size;
+  guint8 b;
+
+  switch (self->linktype) {
+    case LINKTYPE_ETHER:
+      if (buf_size < ETH_HEADER_LEN + IP_HEADER_MIN_LEN + UDP_HEADER_LEN)
+        return TRUE;
+      eth_type = GUINT16_FROM_BE (*((guint16 *) (buf + ETH_MAC_ADDRESSES_LEN)));
+      if (eth_type == 0x8100) {
+        if (buf_size <
+            ETH_HEADER_LEN + ETH_VLAN_HEADER_LEN + IP_HEADER_MIN_LEN +
+            UDP_HEADER_LEN)
+          return TRUE;
+        buf_ip = buf + ETH_HEADER_LEN + ETH_VLAN_HEADER_LEN;
+      } else {
+        buf_ip = buf + ETH_HEADER_LEN;
+      }
+      break;
+    case LINKTYPE_SLL:
+      if (buf_size < SLL_HEADER_LEN + IP_HEADER_MIN_LEN + UDP_HEADER_LEN)
+        return TRUE;
+      buf_ip = buf + SLL_HEADER_LEN;
+      break;
+    case LINKTYPE_RAW:
+      if (buf_size < IP_HEADER_MIN_LEN + UDP_HEADER_LEN)
+        return TRUE;
+      buf_ip = buf;
+      break;
+    default:
+      return TRUE;
+  }
+
+  b = *buf_ip;
+  if (((b >> 4) & 0x0f) != 4)
+    return TRUE;
+
+  ip_header_size = (b & 0x0f) * 4;
+  if (buf_ip + ip_header_size + 4 > buf + buf_size)
+    return TRUE;
+
+  if (self->src_ip >= 0
+      && *((guint32 *) (buf_ip + 12)) != (guint32) self->src_ip)
     return FALSE;
 
-  if (self->dst_ip >= 0 && ip_dst_addr != self->dst_ip)
+  if (self->dst_ip >= 0
+      && *((guint32 *) (buf_ip + 16)) != (guint32) self->dst_ip)
     return FALSE;
 
-  if (self->src_port >= 0 && src_port != self->src_port)
+  buf_proto = buf_ip + ip_header_size;
+
+  if (self->src_port >= 0
+      && GUINT16_FROM_BE (*((guint16 *) (buf_proto + 0))) != self->src_port)
     return FALSE;
 
-  if (self->dst_port >= 0 && dst_port != self->dst_port)
+  if (self->dst_port >= 0
+      && GUINT16_FROM_BE (*((guint16 *) (buf_proto + 2))) != self->dst_port)
     return FALSE;
 
   return TRUE;
@@ -514,6 +593,24 @@ gst_pcap_parse_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
           const guint8 *payload_data;
           gint payload_size;
 
+          /* with filters configured, reject non-matching packets on the
+           * header bytes alone, without mapping the whole packet */
+          if (self->src_ip >= 0 || self->dst_ip >= 0 || self->src_port >= 0
+              || self->dst_port >= 0) {
+            gint pre_size = MIN (self->cur_packet_size,
+                (gint64) PREFILTER_HEADERS_LEN);
+
+            data = gst_adapter_map (self->adapter, pre_size);
+            if (!gst_pcap_parse_prefilter (self, data, pre_size)) {
+              GST_LOG_OBJECT (self, "packet rejected by pre-filter");
+              gst_adapter_unmap (self->adapter);
+              gst_adapter_flush (self->adapter, self->cur_packet_size);
+              self->cur_packet_size = -1;
+              continue;
+            }
+            gst_adapter_unmap (self->adapter);
+          }
+
           data = gst_adapter_map (self->adapter, self->cur_packet_size);
 
           GST_LOG_OBJECT (self, "examining packet size %" G_GINT64_FORMAT,
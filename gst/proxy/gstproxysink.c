@@ -48,6 +48,14 @@ static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_ALWAYS,
     GST_STATIC_CAPS_ANY);
 
+#define DEFAULT_BATCH_SIZE 1
+
+enum
+{
+  PROP_0,
+  PROP_BATCH_SIZE,
+};
+
 /* We're not subclassing from basesink because we don't want any of the special
  * handling it has for events/queries/etc. We just pass-through everything. */
 
@@ -71,13 +79,42 @@ static gboolean gst_proxy_sink_send_event (GstElement * element,
     GstEvent * event);
 static gboolean gst_proxy_sink_query (GstElement * element, GstQuery * query);
 
+static void gst_proxy_sink_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * spec);
+static void gst_proxy_sink_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * spec);
+static void gst_proxy_sink_finalize (GObject * object);
+
 static void
 gst_proxy_sink_class_init (GstProxySinkClass * klass)
 {
+  GObjectClass *gobject_class = (GObjectClass *) klass;
   GstElementClass *gstelement_class = (GstElementClass *) klass;
 
   GST_DEBUG_CATEGORY_INIT (gst_proxy_sink_debug, "proxysink", 0, "proxy sink");
 
+  gobject_class->set_property = gst_proxy_sink_set_property;
+  gobject_class->get_property = gst_proxy_sink_get_property;
+  gobject_class->finalize = gst_proxy_sink_finalize;
+
+  /**
+   * GstProxySink:batch-size:
+   *
+   * Number of buffers to accumulate into a buffer list before handing them
+   * to the matching proxysrc in one go. Batching reduces the number of
+   * cross-pipeline handoffs and queue wakeups at the cost of up to
+   * batch-size buffers of extra latency. A value of 1 hands over every
+   * buffer directly.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_BATCH_SIZE,
+      g_param_spec_uint ("batch-size", "Batch size",
+          "Number of buffers to accumulate before handing them to proxysrc "
+          "in one buffer list (1 = no batching)",
+          1, G_MAXUINT, DEFAULT_BATCH_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state = gst_proxy_sink_change_state;
   gstelement_class->send_event = gst_proxy_sink_send_event;
   gstelement_class->query = gst_proxy_sink_query;
@@ -104,9 +141,83 @@ gst_proxy_sink_init (GstProxySink * self)
       GST_DEBUG_FUNCPTR (gst_proxy_sink_sink_query));
   gst_element_add_pad (GST_ELEMENT (self), self->sinkpad);
 
+  self->batch_size = DEFAULT_BATCH_SIZE;
+  self->pending_list = NULL;
+
   GST_OBJECT_FLAG_SET (self, GST_ELEMENT_FLAG_SINK);
 }
 
+static void
+gst_proxy_sink_finalize (GObject * object)
+{
+  GstProxySink *self = GST_PROXY_SINK (object);
+
+  if (self->pending_list)
+    gst_buffer_list_unref (self->pending_list);
+
+  G_OBJECT_CLASS (gst_proxy_sink_parent_class)->finalize (object);
+}
+
+static void
+gst_proxy_sink_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * spec)
+{
+  GstProxySink *self = GST_PROXY_SINK (object);
+
+  switch (prop_id) {
+    case PROP_BATCH_SIZE:
+      GST_OBJECT_LOCK (self);
+      self->batch_size = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (self);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, spec);
+      break;
+  }
+}
+
+static void
+gst_proxy_sink_get_property (GObject * object, guint prop_id, GValue * value,
+    GParamSpec * spec)
+{
+  GstProxySink *self = GST_PROXY_SINK (object);
+
+  switch (prop_id) {
+    case PROP_BATCH_SIZE:
+      GST_OBJECT_LOCK (self);
+      g_value_set_uint (value, self->batch_size);
+      GST_OBJECT_UNLOCK (self);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, spec);
+      break;
+  }
+}
+
+/* Takes the buffers accumulated so far, if any, so they can be handed to
+ * proxysrc before anything that must stay ordered after them */
+static GstBufferList *
+gst_proxy_sink_take_pending_list (GstProxySink * self)
+{
+  GstBufferList *list;
+
+  GST_OBJECT_LOCK (self);
+  list = self->pending_list;
+  self->pending_list = NULL;
+  GST_OBJECT_UNLOCK (self);
+
+  return list;
+}
+
+static void
+gst_proxy_sink_drop_pending_list (GstProxySink * self)
+{
+  GstBufferList *list = gst_proxy_sink_take_pending_list (self);
+
+  if (list)
+    gst_buffer_list_unref (list);
+}
+
 static GstStateChangeReturn
 gst_proxy_sink_change_state (GstElement * element, GstStateChange transition)
 {
@@ -119,6 +230,9 @@ gst_proxy_sink_change_state (GstElement * element, GstStateChange transition)
     case GST_STATE_CHANGE_READY_TO_PAUSED:
       self->pending_sticky_events = FALSE;
       break;
+    case GST_STATE_CHANGE_PAUSED_TO_READY:
+      gst_proxy_sink_drop_pending_list (self);
+      break;
     default:
       break;
   }
@@ -203,6 +317,18 @@ gst_proxy_sink_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
 
   GST_LOG_OBJECT (pad, "Got %s event", GST_EVENT_TYPE_NAME (event));
 
+  if (GST_EVENT_TYPE (event) == GST_EVENT_FLUSH_START ||
+      GST_EVENT_TYPE (event) == GST_EVENT_FLUSH_STOP) {
+    /* flushing discards any batched buffers */
+    gst_proxy_sink_drop_pending_list (self);
+  } else if (GST_EVENT_IS_SERIALIZED (event)) {
+    /* hand over batched buffers first so the event stays ordered after them */
+    GstBufferList *list = gst_proxy_sink_take_pending_list (self);
+
+    if (list)
+      gst_proxy_sink_sink_chain_list (pad, parent, list);
+  }
+
   if (GST_EVENT_TYPE (event) == GST_EVENT_FLUSH_STOP)
     self->pending_sticky_events = FALSE;
 
@@ -241,6 +367,29 @@ gst_proxy_sink_sink_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
 
   GST_LOG_OBJECT (pad, "Chaining buffer %p", buffer);
 
+  GST_OBJECT_LOCK (self);
+  if (self->batch_size > 1) {
+    GstBufferList *list = NULL;
+
+    if (!self->pending_list)
+      self->pending_list = gst_buffer_list_new_sized (self->batch_size);
+    gst_buffer_list_add (self->pending_list, buffer);
+
+    if (gst_buffer_list_length (self->pending_list) >= self->batch_size) {
+      list = self->pending_list;
+      self->pending_list = NULL;
+    }
+    GST_OBJECT_UNLOCK (self);
+
+    /* hand over a complete batch in one go; incomplete batches are handed
+     * over when the next serialized event arrives */
+    if (list)
+      return gst_proxy_sink_sink_chain_list (pad, parent, list);
+
+    return GST_FLOW_OK;
+  }
+  GST_OBJECT_UNLOCK (self);
+
   src = g_weak_ref_get (&self->proxysrc);
   if (src) {
     GstPad *srcpad;
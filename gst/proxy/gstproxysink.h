@@ -48,6 +48,13 @@ struct _GstProxySink {
 
   /* Whether there are sticky events pending */
   gboolean pending_sticky_events;
+
+  /* Number of buffers to accumulate into a buffer list before handing
+   * them to proxysrc in one go; 1 means hand over each buffer directly */
+  guint batch_size;
+
+  /* Buffers accumulated so far, protected by the object lock */
+  GstBufferList *pending_list;
 };
 
 struct _GstProxySinkClass {
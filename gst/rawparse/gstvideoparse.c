@@ -395,10 +395,7 @@ error:
 static gchar *
 gst_video_parse_int_valarray_to_string (GValue * valarray)
 {
-  /* holds a 64-bit number as string, which can have max. 20 digits
-   * (with extra char for nullbyte) */
-  gchar stride_str[21];
-  gchar *str = NULL;
+  GString *str = g_string_new (NULL);
   guint i;
 
   for (i = 0; i < gst_value_array_get_size (valarray); i++) {
@@ -406,16 +403,13 @@ gst_video_parse_int_valarray_to_string (GValue * valarray)
     guint val;
 
     val = g_value_get_int (gvalue);
-    g_snprintf (stride_str, sizeof (stride_str), "%u", val);
-
-    if (str == NULL) {
-      str = g_strdup (stride_str);
-    } else {
-      gchar *new_str = g_strdup_printf ("%s,%s", str, stride_str);
-      g_free (str);
-      str = new_str;
-    }
+    if (i > 0)
+      g_string_append_c (str, ',');
+    g_string_append_printf (str, "%u", val);
   }
 
-  return str;
+  if (str->len == 0)
+    return g_string_free (str, TRUE);
+
+  return g_string_free (str, FALSE);
 }
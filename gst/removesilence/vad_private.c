@@ -117,32 +117,78 @@ vad_get_threshold_as_db (struct _vad_s *p)
 gint
 vad_update (struct _vad_s * p, gint16 * data, gint len)
 {
-  guint64 tail;
+  guint64 head, tail;
   gint frame_type;
-  gint16 sample;
-  gint i;
-
-  for (i = 0; i < len; i++) {
-    p->vad_power = VAD_POWER_ALPHA * ((data[i] * data[i] >> 14) & 0xFFFF) +
-        (0xFFFF - VAD_POWER_ALPHA) * (p->vad_power >> 16) +
-        ((0xFFFF - VAD_POWER_ALPHA) * (p->vad_power & 0xFFFF) >> 16);
-    /* Update VAD buffer */
-    p->cqueue.base.s[p->cqueue.head.a] = data[i];
-    p->cqueue.head.a = (p->cqueue.head.a + 1) & (p->cqueue.size - 1);
-    if (p->cqueue.head.a == p->cqueue.tail.a)
-      p->cqueue.tail.a = (p->cqueue.tail.a + 1) & (p->cqueue.size - 1);
+  gint occupancy;
+  gint off, i;
+  long zcr;
+
+  /* The power tracker is a per-sample IIR and stays sequential, but the
+   * squared-sample term is not; precompute it in vectorisable chunks */
+  off = 0;
+  while (off < len) {
+    guint32 sq[VAD_BUFFER_SIZE];
+    gint chunk = MIN (len - off, VAD_BUFFER_SIZE);
+
+    for (i = 0; i < chunk; i++) {
+      gint32 v = data[off + i];
+
+      sq[i] = (v * v >> 14) & 0xFFFF;
+    }
+    for (i = 0; i < chunk; i++) {
+      p->vad_power = VAD_POWER_ALPHA * (guint64) sq[i] +
+          (0xFFFF - VAD_POWER_ALPHA) * (p->vad_power >> 16) +
+          ((0xFFFF - VAD_POWER_ALPHA) * (p->vad_power & 0xFFFF) >> 16);
+    }
+    off += chunk;
   }
 
+  /* Update VAD buffer with the most recent samples in at most two
+   * linear spans instead of per-sample stores with wrap checks */
+  head = p->cqueue.head.a;
+  occupancy = (gint) ((head - p->cqueue.tail.a) & (p->cqueue.size - 1));
+  {
+    gint n = MIN (len, p->cqueue.size);
+    gint start = len - n;
+    guint64 pos = (head + start) & (p->cqueue.size - 1);
+    gint first = MIN (n, p->cqueue.size - (gint) pos);
+
+    memcpy (p->cqueue.base.s + pos, data + start, first * sizeof (gint16));
+    if (n > first)
+      memcpy (p->cqueue.base.s, data + start + first,
+          (n - first) * sizeof (gint16));
+  }
+  head = (head + len) & (p->cqueue.size - 1);
+  /* the queue keeps at most size - 1 samples, like the old tail chase */
+  occupancy = MIN (occupancy + len, p->cqueue.size - 1);
+  p->cqueue.head.a = head;
+  p->cqueue.tail.a = (head - occupancy) & (p->cqueue.size - 1);
+
+  /* zero crossings over adjacent pairs, walked per linear span so the
+   * inner loop carries no wraparound masking */
   tail = p->cqueue.tail.a;
-  p->vad_zcr = 0;
-  for (;;) {
-    sample = p->cqueue.base.s[tail];
-    tail = (tail + 1) & (p->cqueue.size - 1);
-    if (tail == p->cqueue.head.a)
-      break;
-    p->vad_zcr +=
-        ((sample & 0x8000) != (p->cqueue.base.s[tail] & 0x8000)) ? 1 : -1;
+  zcr = 0;
+  {
+    gint remaining = occupancy - 1;
+
+    while (remaining > 0) {
+      gint span = MIN (remaining, p->cqueue.size - 1 - (gint) tail);
+      const gint16 *s = p->cqueue.base.s + tail;
+
+      for (i = 0; i < span; i++)
+        zcr += ((s[i] & 0x8000) != (s[i + 1] & 0x8000)) ? 1 : -1;
+      tail = (tail + span) & (p->cqueue.size - 1);
+      remaining -= span;
+      if (remaining > 0) {
+        /* the one pair that crosses the end of the ring */
+        zcr += ((p->cqueue.base.s[p->cqueue.size - 1] & 0x8000) !=
+            (p->cqueue.base.s[0] & 0x8000)) ? 1 : -1;
+        tail = 0;
+        remaining--;
+      }
+    }
   }
+  p->vad_zcr = zcr;
 
   frame_type = (p->vad_power > p->threshold
       && p->vad_zcr < VAD_ZCR_THRESHOLD) ? VAD_VOICE : VAD_SILENCE;
@@ -127,34 +127,114 @@ typedef struct
 {
   guint16 seqnum;
   guint32 timestamp;
-  GstBuffer *buffer;
+  GstBuffer *buffer;            /* NULL when the slot is empty */
 } BufferQueueItem;
 
-static void
-buffer_queue_item_free (BufferQueueItem * item)
-{
-  gst_buffer_unref (item->buffer);
-  g_slice_free (BufferQueueItem, item);
-}
-
 typedef struct
 {
   guint32 rtx_ssrc;
   guint16 seqnum_base, next_seqnum;
   gint clock_rate;
 
-  /* history of rtp packets */
-  GSequence *queue;
+  /* history of rtp packets, a ring indexed directly by seqnum so lookups
+   * on rtx requests are O(1) and storing a packet never allocates */
+  BufferQueueItem *queue;
+  guint queue_mask;             /* ring size - 1, size is a power of two */
+  guint16 oldest_seqnum, latest_seqnum;
+  gboolean has_packets;
 } SSRCRtxData;
 
+static guint
+buffer_queue_size_for_packets (guint max_packets)
+{
+  guint size = 1;
+
+  /* cover the full 16 bit seqnum space when unlimited, so packets are only
+   * ever evicted by a full seqnum wrap-around or the time limit */
+  if (max_packets == 0)
+    return 65536;
+
+  while (size < max_packets)
+    size <<= 1;
+
+  return size;
+}
+
+static guint
+buffer_queue_length (SSRCRtxData * data)
+{
+  if (!data->has_packets)
+    return 0;
+
+  return (guint16) (data->latest_seqnum - data->oldest_seqnum) + 1;
+}
+
+static void
+buffer_queue_drop_oldest (SSRCRtxData * data)
+{
+  BufferQueueItem *item = &data->queue[data->oldest_seqnum & data->queue_mask];
+
+  /* the slot may already hold a newer packet that wrapped onto it, or be
+   * empty after a discontinuity, only drop what we came for */
+  if (item->buffer && item->seqnum == data->oldest_seqnum) {
+    gst_buffer_unref (item->buffer);
+    item->buffer = NULL;
+  }
+
+  if (data->oldest_seqnum == data->latest_seqnum) {
+    data->has_packets = FALSE;
+    return;
+  }
+
+  do {
+    data->oldest_seqnum++;
+    item = &data->queue[data->oldest_seqnum & data->queue_mask];
+  } while (data->oldest_seqnum != data->latest_seqnum &&
+      (item->buffer == NULL || item->seqnum != data->oldest_seqnum));
+}
+
+static void
+buffer_queue_clear (SSRCRtxData * data)
+{
+  guint i;
+
+  for (i = 0; i <= data->queue_mask; i++) {
+    if (data->queue[i].buffer) {
+      gst_buffer_unref (data->queue[i].buffer);
+      data->queue[i].buffer = NULL;
+    }
+  }
+
+  data->has_packets = FALSE;
+}
+
+static void
+buffer_queue_resize (SSRCRtxData * data, guint size)
+{
+  BufferQueueItem *queue = g_new0 (BufferQueueItem, size);
+  guint i;
+
+  for (i = 0; i <= data->queue_mask; i++) {
+    BufferQueueItem *item = &data->queue[i];
+
+    if (item->buffer)
+      queue[item->seqnum & (size - 1)] = *item;
+  }
+
+  g_free (data->queue);
+  data->queue = queue;
+  data->queue_mask = size - 1;
+}
+
 static SSRCRtxData *
-ssrc_rtx_data_new (guint32 rtx_ssrc)
+ssrc_rtx_data_new (guint32 rtx_ssrc, guint max_packets)
 {
   SSRCRtxData *data = g_slice_new0 (SSRCRtxData);
 
   data->rtx_ssrc = rtx_ssrc;
   data->next_seqnum = data->seqnum_base = g_random_int_range (0, G_MAXUINT16);
-  data->queue = g_sequence_new ((GDestroyNotify) buffer_queue_item_free);
+  data->queue_mask = buffer_queue_size_for_packets (max_packets) - 1;
+  data->queue = g_new0 (BufferQueueItem, data->queue_mask + 1);
 
   return data;
 }
@@ -162,7 +242,8 @@ ssrc_rtx_data_new (guint32 rtx_ssrc)
 static void
 ssrc_rtx_data_free (SSRCRtxData * data)
 {
-  g_sequence_free (data->queue);
+  buffer_queue_clear (data);
+  g_free (data->queue);
   g_slice_free (SSRCRtxData, data);
 }
 
@@ -332,7 +413,7 @@ gst_rist_rtx_send_get_ssrc_data (GstRistRtxSend * rtx, guint32 ssrc)
     /* See 5.3.2 Retransmitted Packets, orignal packet have SSRC LSB set to
      * 0, while RTX packet have LSB set to 1 */
     rtx_ssrc = ssrc + 1;
-    data = ssrc_rtx_data_new (rtx_ssrc);
+    data = ssrc_rtx_data_new (rtx_ssrc, rtx->max_size_packets);
     g_hash_table_insert (rtx->ssrc_data, GUINT_TO_POINTER (ssrc), data);
     g_hash_table_insert (rtx->rtx_ssrcs, GUINT_TO_POINTER (rtx_ssrc),
         GUINT_TO_POINTER (ssrc));
@@ -361,16 +442,6 @@ gst_rtp_rist_buffer_new (GstRistRtxSend * rtx, GstBuffer * buffer, guint32 ssrc)
   return buffer;
 }
 
-static gint
-buffer_queue_items_cmp (BufferQueueItem * a, BufferQueueItem * b,
-    gpointer user_data)
-{
-  /* gst_rtp_buffer_compare_seqnum returns the opposite of what we want,
-   * it returns negative when seqnum1 > seqnum2 and we want negative
-   * when b > a, i.e. a is smaller, so it comes first in the sequence */
-  return gst_rtp_buffer_compare_seqnum (b->seqnum, a->seqnum);
-}
-
 static gboolean
 gst_rist_rtx_send_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
 {
@@ -402,42 +473,33 @@ gst_rist_rtx_send_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
         /* check if request is for us */
         if (g_hash_table_contains (rtx->ssrc_data, GUINT_TO_POINTER (ssrc))) {
           SSRCRtxData *data;
-          GSequenceIter *iter;
-          BufferQueueItem search_item;
+          BufferQueueItem *item;
 
           /* update statistics */
           ++rtx->num_rtx_requests;
 
           data = gst_rist_rtx_send_get_ssrc_data (rtx, ssrc);
 
-          search_item.seqnum = seqnum;
-          iter = g_sequence_lookup (data->queue, &search_item,
-              (GCompareDataFunc) buffer_queue_items_cmp, NULL);
-          if (iter) {
-            BufferQueueItem *item = g_sequence_get (iter);
+          item = &data->queue[seqnum & data->queue_mask];
+          if (data->has_packets && item->buffer
+              && item->seqnum == (guint16) seqnum) {
             GST_LOG_OBJECT (rtx, "found %u", item->seqnum);
             rtx_buf = gst_rtp_rist_buffer_new (rtx, item->buffer, ssrc);
           }
 #ifndef GST_DISABLE_DEBUG
           else {
-            BufferQueueItem *item = NULL;
-
-            iter = g_sequence_get_begin_iter (data->queue);
-            if (!g_sequence_iter_is_end (iter))
-              item = g_sequence_get (iter);
-
-            if (item && seqnum < item->seqnum) {
+            if (data->has_packets && seqnum < data->oldest_seqnum) {
               GST_DEBUG_OBJECT (rtx, "requested seqnum %u has already been "
                   "removed from the rtx queue; the first available is %u",
-                  seqnum, item->seqnum);
+                  seqnum, data->oldest_seqnum);
             } else {
               GST_WARNING_OBJECT (rtx, "requested seqnum %u has not been "
                   "transmitted yet in the original stream; either the remote end "
                   "is not configured correctly, or the source is too slow",
                   seqnum);
             }
-#endif
           }
+#endif
         }
         GST_OBJECT_UNLOCK (rtx);
 
@@ -532,19 +594,13 @@ static guint32
 gst_rist_rtx_send_get_ts_diff (SSRCRtxData * data)
 {
   guint64 high_ts, low_ts;
-  BufferQueueItem *high_buf, *low_buf;
   guint32 result;
 
-  high_buf =
-      g_sequence_get (g_sequence_iter_prev (g_sequence_get_end_iter
-          (data->queue)));
-  low_buf = g_sequence_get (g_sequence_get_begin_iter (data->queue));
-
-  if (!high_buf || !low_buf || high_buf == low_buf)
+  if (!data->has_packets || data->oldest_seqnum == data->latest_seqnum)
     return 0;
 
-  high_ts = high_buf->timestamp;
-  low_ts = low_buf->timestamp;
+  high_ts = data->queue[data->latest_seqnum & data->queue_mask].timestamp;
+  low_ts = data->queue[data->oldest_seqnum & data->queue_mask].timestamp;
 
   /* it needs to work if ts wraps */
   if (high_ts >= low_ts) {
@@ -579,21 +635,42 @@ process_buffer (GstRistRtxSend * rtx, GstBuffer * buffer)
 
   data = gst_rist_rtx_send_get_ssrc_data (rtx, ssrc);
 
-  /* add current rtp buffer to queue history */
-  item = g_slice_new0 (BufferQueueItem);
+  /* the ring is sized from max-size-packets at creation, grow it in case
+   * the property was raised since then */
+  if (G_UNLIKELY (buffer_queue_size_for_packets (rtx->max_size_packets) >
+          data->queue_mask + 1))
+    buffer_queue_resize (data,
+        buffer_queue_size_for_packets (rtx->max_size_packets));
+
+  /* a jump further than the ring can track means the stream restarted or
+   * the seqnums got reset, start over */
+  if (data->has_packets &&
+      (guint16) (seqnum - data->latest_seqnum) > data->queue_mask)
+    buffer_queue_clear (data);
+
+  /* add current rtp buffer to queue history, evicting whatever packet the
+   * seqnum wrap-around may land on */
+  item = &data->queue[seqnum & data->queue_mask];
+  if (item->buffer)
+    gst_buffer_unref (item->buffer);
   item->seqnum = seqnum;
   item->timestamp = rtptime;
   item->buffer = gst_buffer_ref (buffer);
-  g_sequence_append (data->queue, item);
+
+  if (!data->has_packets) {
+    data->oldest_seqnum = seqnum;
+    data->has_packets = TRUE;
+  }
+  data->latest_seqnum = seqnum;
 
   /* remove oldest packets from history if they are too many */
   if (rtx->max_size_packets) {
-    while (g_sequence_get_length (data->queue) > rtx->max_size_packets)
-      g_sequence_remove (g_sequence_get_begin_iter (data->queue));
+    while (buffer_queue_length (data) > rtx->max_size_packets)
+      buffer_queue_drop_oldest (data);
   }
   if (rtx->max_size_time) {
     while (gst_rist_rtx_send_get_ts_diff (data) > rtx->max_size_time)
-      g_sequence_remove (g_sequence_get_begin_iter (data->queue));
+      buffer_queue_drop_oldest (data);
   }
 }
 
@@ -424,25 +424,28 @@ gst_timecodestamper_transform_ip (GstBaseTransform * vfilter,
 {
   GstTimeCodeStamper *timecodestamper = GST_TIME_CODE_STAMPER (vfilter);
   GstVideoTimeCodeMeta *tc_meta;
-  GstVideoTimeCode *tc;
+  GstVideoTimeCode *tc = NULL;
 
   GST_OBJECT_LOCK (timecodestamper);
   tc_meta = gst_buffer_get_video_time_code_meta (buffer);
   if (tc_meta && !timecodestamper->override_existing) {
     GST_OBJECT_UNLOCK (timecodestamper);
-    tc = gst_video_time_code_copy (&tc_meta->tc);
+    /* the copy is only needed for posting a message below */
+    if (timecodestamper->post_messages)
+      tc = gst_video_time_code_copy (&tc_meta->tc);
     goto beach;
   } else if (timecodestamper->override_existing) {
     gst_buffer_foreach_meta (buffer, remove_timecode_meta, NULL);
   }
 
   gst_buffer_add_video_time_code_meta (buffer, timecodestamper->current_tc);
-  tc = gst_video_time_code_copy (timecodestamper->current_tc);
+  if (timecodestamper->post_messages)
+    tc = gst_video_time_code_copy (timecodestamper->current_tc);
   gst_video_time_code_increment_frame (timecodestamper->current_tc);
   GST_OBJECT_UNLOCK (timecodestamper);
 
 beach:
-  if (timecodestamper->post_messages) {
+  if (tc != NULL) {
     GstClockTime stream_time, running_time, duration;
     GstStructure *s;
     GstMessage *msg;
@@ -462,7 +465,8 @@ beach:
         duration, "timecode", GST_TYPE_VIDEO_TIME_CODE, tc, NULL);
     msg = gst_message_new_element (GST_OBJECT (timecodestamper), s);
     gst_element_post_message (GST_ELEMENT (timecodestamper), msg);
+
+    gst_video_time_code_free (tc);
   }
-  gst_video_time_code_free (tc);
   return GST_FLOW_OK;
 }
@@ -63,6 +63,11 @@
  * positives or negatives, on the assumption that the badness of a 
  * false negative is the same as a false positive.
  *
+ * To keep the cost down at high resolutions, each frame is first
+ * reduced to per-block luma means and the difference is computed
+ * between those summaries rather than between full frames.  This also
+ * avoids keeping a reference to the previous frame.
+ *
  * This algorithm is pretty much at its limit for error rate.  I
  * recommend any future work in this area to increase the complexity
  * of detection, and then write an automatic tuning system as opposed
@@ -89,6 +94,7 @@ GST_DEBUG_CATEGORY_STATIC (gst_scene_change_debug_category);
 /* prototypes */
 
 
+static void gst_scene_change_finalize (GObject * object);
 static GstFlowReturn gst_scene_change_transform_frame_ip (GstVideoFilter *
     filter, GstVideoFrame * frame);
 
@@ -115,8 +121,11 @@ G_DEFINE_TYPE_WITH_CODE (GstSceneChange, gst_scene_change,
 static void
 gst_scene_change_class_init (GstSceneChangeClass * klass)
 {
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
   GstVideoFilterClass *video_filter_class = GST_VIDEO_FILTER_CLASS (klass);
 
+  gobject_class->finalize = gst_scene_change_finalize;
+
   gst_element_class_add_pad_template (GST_ELEMENT_CLASS (klass),
       gst_pad_template_new ("src", GST_PAD_SRC, GST_PAD_ALWAYS,
           gst_caps_from_string (VIDEO_CAPS)));
@@ -139,29 +148,65 @@ gst_scene_change_init (GstSceneChange * scenechange)
 {
 }
 
+static void
+gst_scene_change_finalize (GObject * object)
+{
+  GstSceneChange *scenechange = GST_SCENE_CHANGE (object);
+
+  g_free (scenechange->block_means);
+  g_free (scenechange->prev_block_means);
 
-static double
-get_frame_score (GstVideoFrame * f1, GstVideoFrame * f2)
+  G_OBJECT_CLASS (gst_scene_change_parent_class)->finalize (object);
+}
+
+/* Summarise the luma plane into per-block means, stored in 8.4 fixed
+ * point so that a fraction of a code value per block still registers
+ * in the score. */
+static void
+get_block_means (GstVideoFrame * frame, guint16 * means, int blocks_x,
+    int blocks_y)
 {
-  int i;
-  int j;
-  int score = 0;
-  int width, height;
-  guint8 *s1;
-  guint8 *s2;
-
-  width = f1->info.width;
-  height = f1->info.height;
-
-  for (j = 0; j < height; j++) {
-    s1 = (guint8 *) f1->data[0] + f1->info.stride[0] * j;
-    s2 = (guint8 *) f2->data[0] + f2->info.stride[0] * j;
-    for (i = 0; i < width; i++) {
-      score += ABS (s1[i] - s2[i]);
+  int width = frame->info.width;
+  int height = frame->info.height;
+  guint32 *acc;
+  int i, j, ib, jb;
+
+  acc = g_malloc (blocks_x * sizeof (guint32));
+
+  for (jb = 0; jb < blocks_y; jb++) {
+    int j0 = jb * SC_BLOCK_SIZE;
+    int j1 = MIN (j0 + SC_BLOCK_SIZE, height);
+
+    memset (acc, 0, blocks_x * sizeof (guint32));
+    for (j = j0; j < j1; j++) {
+      const guint8 *s = (guint8 *) frame->data[0] + frame->info.stride[0] * j;
+
+      for (i = 0; i < width; i++)
+        acc[i / SC_BLOCK_SIZE] += s[i];
+    }
+    for (ib = 0; ib < blocks_x; ib++) {
+      int i0 = ib * SC_BLOCK_SIZE;
+      int n_pixels = (j1 - j0) * (MIN (i0 + SC_BLOCK_SIZE, width) - i0);
+
+      means[jb * blocks_x + ib] = (acc[ib] * 16) / n_pixels;
     }
   }
 
-  return ((double) score) / (width * height);
+  g_free (acc);
+}
+
+static double
+get_frame_score (const guint16 * m1, const guint16 * m2, int n_blocks)
+{
+  guint32 score = 0;
+  int i;
+
+  for (i = 0; i < n_blocks; i++)
+    score += ABS ((int) m1[i] - (int) m2[i]);
+
+  /* back to mean-luma-difference units, same scale as the per-pixel SAD
+   * the thresholds below were tuned against */
+  return ((double) score) / (16.0 * n_blocks);
 }
 
 static GstFlowReturn
@@ -169,40 +214,50 @@ gst_scene_change_transform_frame_ip (GstVideoFilter * filter,
     GstVideoFrame * frame)
 {
   GstSceneChange *scenechange = GST_SCENE_CHANGE (filter);
-  GstVideoFrame oldframe;
   double score_min;
   double score_max;
   double threshold;
   double score;
   gboolean change;
-  gboolean ret;
+  int blocks_x, blocks_y;
+  guint16 *tmp;
   int i;
 
   GST_DEBUG_OBJECT (scenechange, "transform_frame_ip");
 
-  if (!scenechange->oldbuf) {
+  blocks_x = (frame->info.width + SC_BLOCK_SIZE - 1) / SC_BLOCK_SIZE;
+  blocks_y = (frame->info.height + SC_BLOCK_SIZE - 1) / SC_BLOCK_SIZE;
+
+  if (blocks_x != scenechange->blocks_x || blocks_y != scenechange->blocks_y) {
+    g_free (scenechange->block_means);
+    g_free (scenechange->prev_block_means);
+    scenechange->block_means = g_new (guint16, blocks_x * blocks_y);
+    scenechange->prev_block_means = g_new (guint16, blocks_x * blocks_y);
+    scenechange->blocks_x = blocks_x;
+    scenechange->blocks_y = blocks_y;
+    scenechange->have_prev = FALSE;
+  }
+
+  get_block_means (frame, scenechange->block_means, blocks_x, blocks_y);
+
+  if (!scenechange->have_prev) {
+    tmp = scenechange->prev_block_means;
+    scenechange->prev_block_means = scenechange->block_means;
+    scenechange->block_means = tmp;
+    scenechange->have_prev = TRUE;
     scenechange->n_diffs = 0;
     memset (scenechange->diffs, 0, sizeof (double) * SC_N_DIFFS);
-    scenechange->oldbuf = gst_buffer_ref (frame->buffer);
-    memcpy (&scenechange->oldinfo, &frame->info, sizeof (GstVideoInfo));
     return GST_FLOW_OK;
   }
 
-  ret =
-      gst_video_frame_map (&oldframe, &scenechange->oldinfo,
-      scenechange->oldbuf, GST_MAP_READ);
-  if (!ret) {
-    GST_ERROR_OBJECT (scenechange, "failed to map old video frame");
-    return GST_FLOW_ERROR;
-  }
-
-  score = get_frame_score (&oldframe, frame);
+  score = get_frame_score (scenechange->block_means,
+      scenechange->prev_block_means, blocks_x * blocks_y);
 
-  gst_video_frame_unmap (&oldframe);
-
-  gst_buffer_unref (scenechange->oldbuf);
-  scenechange->oldbuf = gst_buffer_ref (frame->buffer);
-  memcpy (&scenechange->oldinfo, &frame->info, sizeof (GstVideoInfo));
+  /* the block summary of the previous frame is all we compare against,
+   * so the frame itself does not need to be kept around */
+  tmp = scenechange->prev_block_means;
+  scenechange->prev_block_means = scenechange->block_means;
+  scenechange->block_means = tmp;
 
   memmove (scenechange->diffs, scenechange->diffs + 1,
       sizeof (double) * (SC_N_DIFFS - 1));
@@ -250,10 +305,23 @@ gst_scene_change_transform_frame_ip (GstVideoFilter * filter,
 
   if (change) {
     GstEvent *event;
+    GstMessage *message;
+    double confidence;
 
     GST_INFO_OBJECT (scenechange, "%d %g %g %g %d",
         scenechange->n_diffs, score / threshold, score, threshold, change);
 
+    /* 2.3 is the ratio at which the detector fires unconditionally */
+    confidence = CLAMP ((score / threshold) / 2.3, 0.0, 1.0);
+
+    message = gst_message_new_element (GST_OBJECT (scenechange),
+        gst_structure_new ("scenechange",
+            "timestamp", G_TYPE_UINT64, GST_BUFFER_PTS (frame->buffer),
+            "score", G_TYPE_DOUBLE, score,
+            "threshold", G_TYPE_DOUBLE, threshold,
+            "confidence", G_TYPE_DOUBLE, confidence, NULL));
+    gst_element_post_message (GST_ELEMENT (scenechange), message);
+
     event =
         gst_video_event_new_downstream_force_key_unit (GST_BUFFER_PTS
         (frame->buffer), GST_CLOCK_TIME_NONE, GST_CLOCK_TIME_NONE, FALSE,
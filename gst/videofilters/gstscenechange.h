@@ -35,6 +35,8 @@ typedef struct _GstSceneChange GstSceneChange;
 typedef struct _GstSceneChangeClass GstSceneChangeClass;
 
 #define SC_N_DIFFS 5
+/* size of the square luma blocks each frame is summarised into */
+#define SC_BLOCK_SIZE 16
 
 struct _GstSceneChange
 {
@@ -42,9 +44,14 @@ struct _GstSceneChange
 
   int n_diffs;
   double diffs[SC_N_DIFFS];
-  GstBuffer *oldbuf;
-  GstVideoInfo oldinfo;
   int count;
+
+  /* per-block luma means (8.4 fixed point) of the current and previous
+   * frames; the previous frame itself is not kept */
+  guint16 *block_means;
+  guint16 *prev_block_means;
+  int blocks_x, blocks_y;
+  gboolean have_prev;
 };
 
 struct _GstSceneChangeClass
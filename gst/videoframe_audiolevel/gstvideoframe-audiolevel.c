@@ -46,6 +46,7 @@
 
 #include "gstvideoframe-audiolevel.h"
 #include <math.h>
+#include <string.h>
 
 #define GST_CAT_DEFAULT gst_videoframe_audiolevel_debug
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
@@ -273,26 +274,31 @@ gst_videoframe_audiolevel_finalize (GObject * object)
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
+/* The calculators accumulate the square sums for all channels in a single
+ * pass over the interleaved data, so each input cache line is only read
+ * once instead of once per channel; the resulting loops also vectorize
+ * well.  NCS must point to an array of zero-initialized doubles, one per
+ * channel. */
 #define DEFINE_INT_LEVEL_CALCULATOR(TYPE, RESOLUTION)                         \
 static void inline                                                            \
 gst_videoframe_audiolevel_calculate_##TYPE (gpointer data, guint num, guint channels,        \
                             gdouble *NCS)                                     \
 {                                                                             \
   TYPE * in = (TYPE *)data;                                                   \
-  register guint j;                                                           \
-  gdouble squaresum = 0.0;           /* square sum of the input samples */    \
+  register guint j, c;                                                        \
   register gdouble square = 0.0;     /* Square */                             \
   gdouble normalizer;                /* divisor to get a [-1.0, 1.0] range */ \
                                                                               \
-  /* *NCS = 0.0; Normalized Cumulative Square */                              \
-                                                                              \
   for (j = 0; j < num; j += channels) {                                       \
-    square = ((gdouble) in[j]) * in[j];                                       \
-    squaresum += square;                                                      \
+    for (c = 0; c < channels; c++) {                                          \
+      square = ((gdouble) in[j + c]) * in[j + c];                             \
+      NCS[c] += square;                                                       \
+    }                                                                         \
   }                                                                           \
                                                                               \
   normalizer = (gdouble) (G_GINT64_CONSTANT(1) << (RESOLUTION * 2));          \
-  *NCS = squaresum / normalizer;                                              \
+  for (c = 0; c < channels; c++)                                              \
+    NCS[c] /= normalizer;                                                     \
 }
 
 DEFINE_INT_LEVEL_CALCULATOR (gint32, 31);
@@ -305,18 +311,15 @@ gst_videoframe_audiolevel_calculate_##TYPE (gpointer data, guint num, guint chan
                             gdouble *NCS)                                     \
 {                                                                             \
   TYPE * in = (TYPE *)data;                                                   \
-  register guint j;                                                           \
-  gdouble squaresum = 0.0;           /* square sum of the input samples */    \
+  register guint j, c;                                                        \
   register gdouble square = 0.0;     /* Square */                             \
                                                                               \
-  /* *NCS = 0.0; Normalized Cumulative Square */                              \
-                                                                              \
   for (j = 0; j < num; j += channels) {                                       \
-    square = ((gdouble) in[j]) * in[j];                                       \
-    squaresum += square;                                                      \
+    for (c = 0; c < channels; c++) {                                          \
+      square = ((gdouble) in[j + c]) * in[j + c];                             \
+      NCS[c] += square;                                                       \
+    }                                                                         \
   }                                                                           \
-                                                                              \
-  *NCS = squaresum;                                                           \
 }
 
 DEFINE_FLOAT_LEVEL_CALCULATOR (gfloat);
@@ -441,7 +444,7 @@ update_rms_from_buffer (GstVideoFrameAudioLevel * self, GstBuffer * inbuf)
   GstMapInfo map;
   guint8 *in_data;
   gsize in_size;
-  gdouble CS;
+  gdouble *NCS;
   guint i;
   guint num_frames, frames;
   guint num_int_samples = 0;    /* number of interleaved samples
@@ -473,12 +476,14 @@ update_rms_from_buffer (GstVideoFrameAudioLevel * self, GstBuffer * inbuf)
   frames = num_frames;
   duration = GST_FRAMES_TO_CLOCK_TIME (frames, rate);
   if (num_frames > 0) {
+    NCS = g_newa (gdouble, channels);
+    memset (NCS, 0, channels * sizeof (gdouble));
+    self->process (in_data, num_int_samples, channels, NCS);
     for (i = 0; i < channels; ++i) {
-      self->process (in_data + (bps * i), num_int_samples, channels, &CS);
       GST_LOG_OBJECT (self,
           "[%d]: cumulative squares %lf, over %d samples/%d channels",
-          i, CS, num_int_samples, channels);
-      self->CS[i] += CS;
+          i, NCS[i], num_int_samples, channels);
+      self->CS[i] += NCS[i];
     }
     in_data += num_frames * bps;
 
@@ -647,8 +652,8 @@ gst_videoframe_audiolevel_asink_chain (GstPad * pad, GstObject * parent,
             gst_adapter_available (self->adapter));
         if (buf != NULL) {
           GstMessage *msg;
-          msg = update_rms_from_buffer (self, buf);
           g_mutex_unlock (&self->mutex);
+          msg = update_rms_from_buffer (self, buf);
           gst_element_post_message (GST_ELEMENT (self), msg);
           gst_buffer_unref (buf);
           g_mutex_lock (&self->mutex);  /* we unlock again later */
@@ -728,8 +733,11 @@ gst_videoframe_audiolevel_asink_chain (GstPad * pad, GstObject * parent,
       /* Just an empty buffer */
       buf = gst_buffer_new ();
     }
-    msg = update_rms_from_buffer (self, buf);
+    /* The RMS computation only touches audio-thread state; drop the mutex
+     * while mapping the buffer and accumulating squares so the video chain
+     * is not blocked on us for the whole frame's worth of samples */
     g_mutex_unlock (&self->mutex);
+    msg = update_rms_from_buffer (self, buf);
     gst_element_post_message (GST_ELEMENT (self), msg);
     g_mutex_lock (&self->mutex);
 
@@ -41,7 +41,8 @@ GST_DEBUG_CATEGORY (h264_parse_debug);
 enum
 {
   PROP_0,
-  PROP_CONFIG_INTERVAL
+  PROP_CONFIG_INTERVAL,
+  PROP_INITIAL_CODEC_DATA
 };
 
 enum
@@ -114,6 +115,7 @@ static gboolean gst_h264_parse_src_event (GstBaseParse * parse,
     GstEvent * event);
 static void gst_h264_parse_update_src_caps (GstH264Parse * h264parse,
     GstCaps * caps);
+static void gst_h264_parse_apply_initial_codec_data (GstH264Parse * h264parse);
 
 static void
 gst_h264_parse_class_init (GstH264ParseClass * klass)
@@ -137,6 +139,23 @@ gst_h264_parse_class_init (GstH264ParseClass * klass)
           -1, 3600, DEFAULT_CONFIG_INTERVAL,
           G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstH264Parse:initial-codec-data:
+   *
+   * codec_data (avcC) blob to prime the parser with SPS and PPS before any
+   * appear in the stream, so that parsing of an already running stream can
+   * start at the next access unit instead of waiting for in-band parameter
+   * sets. Snapshot it from the codec_data caps field of another pipeline
+   * consuming the same stream. Applied when the element starts.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_INITIAL_CODEC_DATA,
+      g_param_spec_boxed ("initial-codec-data", "Initial codec data",
+          "codec_data (avcC) blob to prime the parser with SPS/PPS "
+          "before any appear in the stream (NULL = disabled)",
+          GST_TYPE_BUFFER, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /* Override BaseParse vfuncs */
   parse_class->start = GST_DEBUG_FUNCPTR (gst_h264_parse_start);
   parse_class->stop = GST_DEBUG_FUNCPTR (gst_h264_parse_stop);
@@ -175,6 +194,7 @@ gst_h264_parse_finalize (GObject * object)
 {
   GstH264Parse *h264parse = GST_H264_PARSE (object);
 
+  gst_buffer_replace (&h264parse->initial_codec_data, NULL);
   g_object_unref (h264parse->frame_out);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
@@ -269,6 +289,9 @@ gst_h264_parse_start (GstBaseParse * parse)
 
   h264parse->nalparser = gst_h264_nal_parser_new ();
 
+  if (h264parse->initial_codec_data)
+    gst_h264_parse_apply_initial_codec_data (h264parse);
+
   h264parse->state = 0;
   h264parse->dts = GST_CLOCK_TIME_NONE;
   h264parse->ts_trn_nb = GST_CLOCK_TIME_NONE;
@@ -948,8 +971,10 @@ gst_h264_parse_process_nal (GstH264Parse * h264parse, GstH264NalUnit * nalu)
       {
         GstH264SliceHdr slice;
 
-        pres = gst_h264_parser_parse_slice_hdr (nalparser, nalu, &slice,
-            FALSE, FALSE);
+        /* we only need the slice type and field flags here, so don't
+         * pay for decoding ref pic lists and the rest of the header */
+        pres = gst_h264_parser_parse_slice_hdr_minimal (nalparser, nalu,
+            &slice);
         GST_DEBUG_OBJECT (h264parse,
             "parse result %d, first MB: %u, slice type: %u",
             pres, slice.first_mb_in_slice, slice.type);
@@ -2744,6 +2769,69 @@ gst_h264_parse_pre_push_frame (GstBaseParse * parse, GstBaseParseFrame * frame)
   return GST_FLOW_OK;
 }
 
+/* Prime the parser with the SPS/PPS from an avcC blob provided out-of-band
+ * through the initial-codec-data property, so that a stream joined mid-GOP
+ * can be parsed before the next in-band parameter sets arrive */
+static void
+gst_h264_parse_apply_initial_codec_data (GstH264Parse * h264parse)
+{
+  GstMapInfo map;
+  guint8 *data;
+  gsize size;
+  guint num_sps, num_pps, off;
+  GstH264NalUnit nalu;
+  GstH264ParserResult parseres;
+  gint i;
+
+  gst_buffer_map (h264parse->initial_codec_data, &map, GST_MAP_READ);
+  data = map.data;
+  size = map.size;
+
+  /* same layout checks as for the codec_data caps field below */
+  if (size < 7 || data[0] != 1)
+    goto broken;
+
+  num_sps = data[5] & 0x1f;
+  off = 6;
+  for (i = 0; i < num_sps; i++) {
+    parseres = gst_h264_parser_identify_nalu_avc (h264parse->nalparser,
+        data, off, size, 2, &nalu);
+    if (parseres != GST_H264_PARSER_OK)
+      goto broken;
+
+    gst_h264_parse_process_nal (h264parse, &nalu);
+    off = nalu.offset + nalu.size;
+  }
+
+  if (off >= size)
+    goto broken;
+  num_pps = data[off];
+  off++;
+
+  for (i = 0; i < num_pps; i++) {
+    parseres = gst_h264_parser_identify_nalu_avc (h264parse->nalparser,
+        data, off, size, 2, &nalu);
+    if (parseres != GST_H264_PARSER_OK)
+      goto broken;
+
+    gst_h264_parse_process_nal (h264parse, &nalu);
+    off = nalu.offset + nalu.size;
+  }
+
+  GST_DEBUG_OBJECT (h264parse,
+      "primed with %u SPS and %u PPS from initial codec data", num_sps,
+      num_pps);
+  gst_buffer_unmap (h264parse->initial_codec_data, &map);
+
+  return;
+
+broken:
+  {
+    GST_WARNING_OBJECT (h264parse, "broken initial codec data, ignoring");
+    gst_buffer_unmap (h264parse->initial_codec_data, &map);
+  }
+}
+
 static gboolean
 gst_h264_parse_set_caps (GstBaseParse * parse, GstCaps * caps)
 {
@@ -3169,6 +3257,10 @@ gst_h264_parse_set_property (GObject * object, guint prop_id,
     case PROP_CONFIG_INTERVAL:
       parse->interval = g_value_get_int (value);
       break;
+    case PROP_INITIAL_CODEC_DATA:
+      gst_buffer_replace (&parse->initial_codec_data,
+          gst_value_get_buffer (value));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -3187,6 +3279,9 @@ gst_h264_parse_get_property (GObject * object, guint prop_id,
     case PROP_CONFIG_INTERVAL:
       g_value_set_int (value, parse->interval);
       break;
+    case PROP_INITIAL_CODEC_DATA:
+      gst_value_set_buffer (value, parse->initial_codec_data);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
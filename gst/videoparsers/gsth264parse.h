@@ -129,6 +129,7 @@ struct _GstH264Parse
 
   /* props */
   gint interval;
+  GstBuffer *initial_codec_data;
 
   GstClockTime pending_key_unit_ts;
   GstEvent *force_key_unit_event;
@@ -52,14 +52,16 @@ GST_STATIC_PAD_TEMPLATE ("sink", GST_PAD_SINK,
     );
 
 /* Properties */
-#define DEFAULT_PROP_DROP       TRUE
-#define DEFAULT_PROP_GOP_SPLIT  FALSE
+#define DEFAULT_PROP_DROP        TRUE
+#define DEFAULT_PROP_GOP_SPLIT   FALSE
+#define DEFAULT_PROP_SKIP_SLICES FALSE
 
 enum
 {
   PROP_0,
   PROP_DROP,
-  PROP_GOP_SPLIT
+  PROP_GOP_SPLIT,
+  PROP_SKIP_SLICES
 };
 
 #define parent_class gst_mpegv_parse_parent_class
@@ -97,6 +99,9 @@ gst_mpegv_parse_set_property (GObject * object, guint property_id,
     case PROP_GOP_SPLIT:
       parse->gop_split = g_value_get_boolean (value);
       break;
+    case PROP_SKIP_SLICES:
+      parse->skip_slices = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
   }
@@ -115,6 +120,9 @@ gst_mpegv_parse_get_property (GObject * object, guint property_id,
     case PROP_GOP_SPLIT:
       g_value_set_boolean (value, parse->gop_split);
       break;
+    case PROP_SKIP_SLICES:
+      g_value_set_boolean (value, parse->skip_slices);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
   }
@@ -146,6 +154,14 @@ gst_mpegv_parse_class_init (GstMpegvParseClass * klass)
           "Split frame when encountering GOP", DEFAULT_PROP_GOP_SPLIT,
           G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  g_object_class_install_property (gobject_class, PROP_SKIP_SLICES,
+      g_param_spec_boolean ("skip-slices", "skip-slices",
+          "Locate frame boundaries without processing slices; cheaper "
+          "when downstream only needs framing, but attached "
+          "GstMpegVideoMeta will carry no slice information",
+          DEFAULT_PROP_SKIP_SLICES,
+          G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_add_static_pad_template (element_class, &src_template);
   gst_element_class_add_static_pad_template (element_class, &sink_template);
 
@@ -758,9 +774,17 @@ next:
   *skipsize = 0;
   /* terminating start code may have been found in prev scan already */
   if (((gint) packet.size) >= 0) {
+    gboolean found;
+
     off = packet.offset + packet.size;
-    /* so now we have start code at start of data; locate next start code */
-    if (!gst_mpeg_video_parse (&packet, data, size, off)) {
+    /* so now we have start code at start of data; locate next start code.
+     * in skip-slices mode, jump directly to the next non-slice packet
+     * instead of stopping at every slice */
+    if (mpvparse->skip_slices)
+      found = gst_mpeg_video_parse_skip_slices (&packet, data, size, off);
+    else
+      found = gst_mpeg_video_parse (&packet, data, size, off);
+    if (!found) {
       off = -1;
     } else {
       g_assert (packet.offset >= 4);
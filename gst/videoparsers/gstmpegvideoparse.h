@@ -95,6 +95,7 @@ struct _GstMpegvParse {
   /* properties */
   gboolean drop;
   gboolean gop_split;
+  gboolean skip_slices;
 
   int fps_num;
   int fps_den;
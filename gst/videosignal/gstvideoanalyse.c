@@ -72,10 +72,12 @@ static GstFlowReturn gst_video_analyse_transform_frame_ip (GstVideoFilter *
 enum
 {
   PROP_0,
-  PROP_MESSAGE
+  PROP_MESSAGE,
+  PROP_ROW_STEP
 };
 
 #define DEFAULT_MESSAGE TRUE
+#define DEFAULT_ROW_STEP 1
 
 #define VIDEO_CAPS \
     GST_VIDEO_CAPS_MAKE("{ I420, YV12, Y444, Y42B, Y41B }")
@@ -116,6 +118,11 @@ gst_video_analyse_class_init (GstVideoAnalyseClass * klass)
           "Post statics messages",
           DEFAULT_MESSAGE,
           G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (G_OBJECT_CLASS (klass), PROP_ROW_STEP,
+      g_param_spec_uint ("row-step", "Row step",
+          "Only analyse every Nth row, for cheaper preview-grade statistics",
+          1, G_MAXUINT, DEFAULT_ROW_STEP,
+          G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
   //trans_class->passthrough_on_same_caps = TRUE;
 }
 
@@ -136,6 +143,9 @@ gst_video_analyse_set_property (GObject * object, guint property_id,
     case PROP_MESSAGE:
       videoanalyse->message = g_value_get_boolean (value);
       break;
+    case PROP_ROW_STEP:
+      videoanalyse->row_step = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -154,6 +164,9 @@ gst_video_analyse_get_property (GObject * object, guint property_id,
     case PROP_MESSAGE:
       g_value_set_boolean (value, videoanalyse->message);
       break;
+    case PROP_ROW_STEP:
+      g_value_set_uint (value, videoanalyse->row_step);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -205,39 +218,42 @@ gst_video_analyse_post_message (GstVideoAnalyse * videoanalyse,
 static void
 gst_video_analyse_planar (GstVideoAnalyse * videoanalyse, GstVideoFrame * frame)
 {
-  guint64 sum;
-  gint avg, diff;
+  guint64 sum, sumsq;
   gint i, j;
   guint8 *d;
   gint width = frame->info.width;
   gint height = frame->info.height;
-  gint stride;
+  gint stride = frame->info.stride[0];
+  gint step = MAX (videoanalyse->row_step, 1);
+  gdouble avg, n_pixels;
+  gint n_rows = 0;
 
   d = frame->data[0];
-  stride = frame->info.stride[0];
   sum = 0;
-  /* do brightness as average of pixel brightness in 0.0 to 1.0 */
-  for (i = 0; i < height; i++) {
-    for (j = 0; j < width; j++) {
-      sum += d[j];
-    }
-    d += stride;
-  }
-  avg = sum / (width * height);
-  videoanalyse->luma_average = sum / (255.0 * width * height);
+  sumsq = 0;
+  /* accumulate sum and sum of squares in a single pass; the 32-bit
+   * per-row accumulators keep the inner loop vectorisable and cannot
+   * overflow on a single row of 8-bit samples */
+  for (i = 0; i < height; i += step) {
+    const guint8 *row = d + (gsize) i * stride;
+    guint32 row_sum = 0, row_sumsq = 0;
 
-  d = frame->data[0];
-  stride = frame->info.stride[0];
-  sum = 0;
-  /* do variance */
-  for (i = 0; i < height; i++) {
     for (j = 0; j < width; j++) {
-      diff = (avg - d[j]);
-      sum += diff * diff;
+      row_sum += row[j];
+      row_sumsq += (guint32) row[j] * row[j];
     }
-    d += stride;
+    sum += row_sum;
+    sumsq += row_sumsq;
+    n_rows++;
   }
-  videoanalyse->luma_variance = sum / (255.0 * 255.0 * width * height);
+
+  n_pixels = (gdouble) n_rows * width;
+  /* brightness as average of pixel brightness in 0.0 to 1.0 */
+  avg = sum / n_pixels;
+  videoanalyse->luma_average = avg / 255.0;
+  /* variance from the raw moments, E[x^2] - E[x]^2 */
+  videoanalyse->luma_variance =
+      (sumsq / n_pixels - avg * avg) / (255.0 * 255.0);
 }
 
 static GstFlowReturn
@@ -40,6 +40,7 @@ struct _GstVideoAnalyse
 
   /* properties */
   gboolean message;
+  guint row_step;
   guint64 interval;
   gdouble luma_average;
   gdouble luma_variance;
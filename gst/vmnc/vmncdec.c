@@ -533,17 +533,38 @@ static void
 render_subrect (GstVMncDec * dec, int x, int y, int width,
     int height, guint32 colour)
 {
-  /* Crazy inefficient! */
   int i, j;
   guint8 *dst;
 
-  for (i = 0; i < height; i++) {
-    dst = dec->imagedata + dec->format.stride * (y + i) +
-        dec->format.bytes_per_pixel * x;
-    for (j = 0; j < width; j++) {
-      memcpy (dst, &colour, dec->format.bytes_per_pixel);
-      dst += dec->format.bytes_per_pixel;
-    }
+  dst = dec->imagedata + dec->format.stride * y +
+      dec->format.bytes_per_pixel * x;
+
+  /* one filler per depth, matching the typed reads in READ_PIXEL */
+  switch (dec->format.bytes_per_pixel) {
+    case 1:
+      for (i = 0; i < height; i++) {
+        memset (dst, (guint8) colour, width);
+        dst += dec->format.stride;
+      }
+      break;
+    case 2:
+      for (i = 0; i < height; i++) {
+        guint16 *d = (guint16 *) dst;
+
+        for (j = 0; j < width; j++)
+          d[j] = (guint16) colour;
+        dst += dec->format.stride;
+      }
+      break;
+    default:
+      for (i = 0; i < height; i++) {
+        guint32 *d = (guint32 *) dst;
+
+        for (j = 0; j < width; j++)
+          d[j] = colour;
+        dst += dec->format.stride;
+      }
+      break;
   }
 }
 
@@ -666,46 +666,46 @@ gst_y4m_dec_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
 
     gst_adapter_flush (y4mdec->adapter, len + 1);
 
-    buffer = gst_adapter_take_buffer (y4mdec->adapter, y4mdec->info.size);
-
-    GST_BUFFER_TIMESTAMP (buffer) =
-        gst_y4m_dec_frames_to_timestamp (y4mdec, y4mdec->frame_index);
-    GST_BUFFER_DURATION (buffer) =
-        gst_y4m_dec_frames_to_timestamp (y4mdec, y4mdec->frame_index + 1) -
-        GST_BUFFER_TIMESTAMP (buffer);
-
-    y4mdec->frame_index++;
-
-    if (y4mdec->video_meta) {
-      gst_buffer_add_video_meta_full (buffer, 0, y4mdec->info.finfo->format,
-          y4mdec->info.width, y4mdec->info.height, y4mdec->info.finfo->n_planes,
-          y4mdec->info.offset, y4mdec->info.stride);
-    } else if (memcmp (&y4mdec->info, &y4mdec->out_info,
-            sizeof (y4mdec->info)) != 0) {
+    if (y4mdec->video_meta || memcmp (&y4mdec->info, &y4mdec->out_info,
+            sizeof (y4mdec->info)) == 0) {
+      /* take_buffer hands out the input memory without copying when the
+       * whole frame sits in a single upstream buffer, so large input
+       * blocks pass through without the data being touched */
+      buffer = gst_adapter_take_buffer (y4mdec->adapter, y4mdec->info.size);
+
+      if (y4mdec->video_meta) {
+        gst_buffer_add_video_meta_full (buffer, 0, y4mdec->info.finfo->format,
+            y4mdec->info.width, y4mdec->info.height,
+            y4mdec->info.finfo->n_planes, y4mdec->info.offset,
+            y4mdec->info.stride);
+      }
+    } else {
       GstBuffer *outbuf;
-      GstVideoFrame iframe, oframe;
+      GstVideoFrame oframe;
+      const guint8 *frame_data;
       gint i, j;
       gint w, h, istride, ostride;
-      guint8 *src, *dest;
+      const guint8 *src;
+      guint8 *dest;
 
-      /* Allocate a new buffer and do stride conversion */
+      /* Stride conversion needed; convert straight out of the adapter map
+       * into the downstream buffer, instead of taking a contiguous copy of
+       * the frame first and copying again */
       g_assert (y4mdec->pool != NULL);
 
       flow_ret = gst_buffer_pool_acquire_buffer (y4mdec->pool, &outbuf, NULL);
-      if (flow_ret != GST_FLOW_OK) {
-        gst_buffer_unref (buffer);
+      if (flow_ret != GST_FLOW_OK)
         break;
-      }
 
-      gst_video_frame_map (&iframe, &y4mdec->info, buffer, GST_MAP_READ);
+      frame_data = gst_adapter_map (y4mdec->adapter, y4mdec->info.size);
       gst_video_frame_map (&oframe, &y4mdec->out_info, outbuf, GST_MAP_WRITE);
 
       for (i = 0; i < 3; i++) {
-        w = GST_VIDEO_FRAME_COMP_WIDTH (&iframe, i);
-        h = GST_VIDEO_FRAME_COMP_HEIGHT (&iframe, i);
-        istride = GST_VIDEO_FRAME_COMP_STRIDE (&iframe, i);
+        w = GST_VIDEO_FRAME_COMP_WIDTH (&oframe, i);
+        h = GST_VIDEO_FRAME_COMP_HEIGHT (&oframe, i);
+        istride = y4mdec->info.stride[i];
         ostride = GST_VIDEO_FRAME_COMP_STRIDE (&oframe, i);
-        src = GST_VIDEO_FRAME_COMP_DATA (&iframe, i);
+        src = frame_data + y4mdec->info.offset[i];
         dest = GST_VIDEO_FRAME_COMP_DATA (&oframe, i);
 
         for (j = 0; j < h; j++) {
@@ -716,13 +716,20 @@ gst_y4m_dec_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
         }
       }
 
-      gst_video_frame_unmap (&iframe);
       gst_video_frame_unmap (&oframe);
-      gst_buffer_copy_into (outbuf, buffer, GST_BUFFER_COPY_TIMESTAMPS, 0, -1);
-      gst_buffer_unref (buffer);
+      gst_adapter_unmap (y4mdec->adapter);
+      gst_adapter_flush (y4mdec->adapter, y4mdec->info.size);
       buffer = outbuf;
     }
 
+    GST_BUFFER_TIMESTAMP (buffer) =
+        gst_y4m_dec_frames_to_timestamp (y4mdec, y4mdec->frame_index);
+    GST_BUFFER_DURATION (buffer) =
+        gst_y4m_dec_frames_to_timestamp (y4mdec, y4mdec->frame_index + 1) -
+        GST_BUFFER_TIMESTAMP (buffer);
+
+    y4mdec->frame_index++;
+
     flow_ret = gst_pad_push (y4mdec->srcpad, buffer);
     if (flow_ret != GST_FLOW_OK)
       break;
@@ -162,9 +162,14 @@ gst_yadif_class_init (GstYadifClass * klass)
 
 }
 
+void yadif_threads_start (GstYadif * yadif);
+void yadif_threads_stop (GstYadif * yadif);
+
 static void
 gst_yadif_init (GstYadif * yadif)
 {
+  g_mutex_init (&yadif->task_lock);
+  g_cond_init (&yadif->task_cond);
 }
 
 void
@@ -212,9 +217,10 @@ gst_yadif_dispose (GObject * object)
 void
 gst_yadif_finalize (GObject * object)
 {
-  /* GstYadif *yadif = GST_YADIF (object); */
+  GstYadif *yadif = GST_YADIF (object);
 
-  /* clean up object here */
+  g_mutex_clear (&yadif->task_lock);
+  g_cond_clear (&yadif->task_cond);
 
   G_OBJECT_CLASS (gst_yadif_parent_class)->finalize (object);
 }
@@ -280,6 +286,7 @@ gst_yadif_get_unit_size (GstBaseTransform * trans, GstCaps * caps, gsize * size)
 static gboolean
 gst_yadif_start (GstBaseTransform * trans)
 {
+  yadif_threads_start (GST_YADIF (trans));
 
   return TRUE;
 }
@@ -287,6 +294,7 @@ gst_yadif_start (GstBaseTransform * trans)
 static gboolean
 gst_yadif_stop (GstBaseTransform * trans)
 {
+  yadif_threads_stop (GST_YADIF (trans));
 
   return TRUE;
 }
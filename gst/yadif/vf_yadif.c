@@ -116,57 +116,156 @@ FILTER}
 #endif
 
 void yadif_filter (GstYadif * yadif, int parity, int tff);
+void yadif_threads_start (GstYadif * yadif);
+void yadif_threads_stop (GstYadif * yadif);
 #ifdef HAVE_CPU_X86_64
 void filter_line_x86_64 (guint8 * dst,
     guint8 * prev, guint8 * cur, guint8 * next,
     int w, int prefs, int mrefs, int parity, int mode);
 #endif
 
-void
-yadif_filter (GstYadif * yadif, int parity, int tff)
+/* Each output row only reads rows y-2..y+2 of the (read-only) input frames
+ * and writes row y of the destination, so disjoint row ranges can be
+ * filtered concurrently without any overlap handling. */
+static void
+yadif_filter_rows (GstYadif * yadif, int parity, int tff, int i,
+    int y0, int y1)
 {
-  int y, i;
   const GstVideoInfo *vi = &yadif->video_info;
   const GstVideoFormatInfo *vfi = vi->finfo;
+  int w = GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (vfi, i, vi->width);
+  int h = GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (vfi, i, vi->height);
+  int refs = GST_VIDEO_INFO_COMP_STRIDE (vi, i);
+  int df = GST_VIDEO_INFO_COMP_PSTRIDE (vi, i);
+  guint8 *prev_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->prev_frame, i);
+  guint8 *cur_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->cur_frame, i);
+  guint8 *next_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->next_frame, i);
+  guint8 *dest_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->dest_frame, i);
+  int y;
 
-  for (i = 0; i < GST_VIDEO_FORMAT_INFO_N_COMPONENTS (vfi); i++) {
-    int w = GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (vfi, i, vi->width);
-    int h = GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (vfi, i, vi->height);
-    int refs = GST_VIDEO_INFO_COMP_STRIDE (vi, i);
-    int df = GST_VIDEO_INFO_COMP_PSTRIDE (vi, i);
-    guint8 *prev_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->prev_frame, i);
-    guint8 *cur_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->cur_frame, i);
-    guint8 *next_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->next_frame, i);
-    guint8 *dest_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->dest_frame, i);
-
-    for (y = 0; y < h; y++) {
-      if ((y ^ parity) & 1) {
-        guint8 *prev = prev_data + y * refs;
-        guint8 *cur = cur_data + y * refs;
-        guint8 *next = next_data + y * refs;
-        guint8 *dst = dest_data + y * refs;
-        int mode = ((y == 1) || (y + 2 == h)) ? 2 : yadif->mode;
+  for (y = y0; y < y1; y++) {
+    if ((y ^ parity) & 1) {
+      guint8 *prev = prev_data + y * refs;
+      guint8 *cur = cur_data + y * refs;
+      guint8 *next = next_data + y * refs;
+      guint8 *dst = dest_data + y * refs;
+      int mode = ((y == 1) || (y + 2 == h)) ? 2 : yadif->mode;
 #if HAVE_CPU_X86_64
-        if (0) {
-          filter_line_c (dst, prev, cur, next, w,
-              y + 1 < h ? refs : -refs, y ? -refs : refs, parity ^ tff, mode);
-        } else {
-          filter_line_x86_64 (dst, prev, cur, next, w,
-              y + 1 < h ? refs : -refs, y ? -refs : refs, parity ^ tff, mode);
-        }
-#else
+      if (0) {
         filter_line_c (dst, prev, cur, next, w,
             y + 1 < h ? refs : -refs, y ? -refs : refs, parity ^ tff, mode);
-#endif
       } else {
-        guint8 *dst = dest_data + y * refs;
-        guint8 *cur = cur_data + y * refs;
+        filter_line_x86_64 (dst, prev, cur, next, w,
+            y + 1 < h ? refs : -refs, y ? -refs : refs, parity ^ tff, mode);
+      }
+#else
+      filter_line_c (dst, prev, cur, next, w,
+          y + 1 < h ? refs : -refs, y ? -refs : refs, parity ^ tff, mode);
+#endif
+    } else {
+      guint8 *dst = dest_data + y * refs;
+      guint8 *cur = cur_data + y * refs;
+
+      memcpy (dst, cur, w * df);
+    }
+  }
+}
+
+/* don't bother spawning a slice for less than this many rows */
+#define MIN_ROWS_PER_SLICE 64
+#define MAX_WORKERS 8
+
+typedef struct
+{
+  GstYadif *yadif;
+  int parity, tff;
+  int component;
+  int y0, y1;
+} YadifSlice;
+
+static void
+yadif_slice_func (gpointer data, gpointer user_data)
+{
+  YadifSlice *slice = data;
+  GstYadif *yadif = slice->yadif;
+
+  yadif_filter_rows (yadif, slice->parity, slice->tff, slice->component,
+      slice->y0, slice->y1);
+
+  g_mutex_lock (&yadif->task_lock);
+  yadif->tasks_pending--;
+  if (yadif->tasks_pending == 0)
+    g_cond_signal (&yadif->task_cond);
+  g_mutex_unlock (&yadif->task_lock);
+
+  g_slice_free (YadifSlice, slice);
+}
 
-        memcpy (dst, cur, w * df);
+void
+yadif_threads_start (GstYadif * yadif)
+{
+  yadif->n_workers = CLAMP (g_get_num_processors (), 1, MAX_WORKERS);
+  if (yadif->n_workers > 1)
+    yadif->worker_pool = g_thread_pool_new (yadif_slice_func, yadif,
+        yadif->n_workers, TRUE, NULL);
+}
+
+void
+yadif_threads_stop (GstYadif * yadif)
+{
+  if (yadif->worker_pool) {
+    g_thread_pool_free (yadif->worker_pool, FALSE, TRUE);
+    yadif->worker_pool = NULL;
+  }
+}
+
+void
+yadif_filter (GstYadif * yadif, int parity, int tff)
+{
+  int i;
+  const GstVideoInfo *vi = &yadif->video_info;
+  const GstVideoFormatInfo *vfi = vi->finfo;
+
+  for (i = 0; i < GST_VIDEO_FORMAT_INFO_N_COMPONENTS (vfi); i++) {
+    int h = GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (vfi, i, vi->height);
+    int n_slices = 1;
+
+    if (yadif->worker_pool)
+      n_slices = CLAMP (h / MIN_ROWS_PER_SLICE, 1, (int) yadif->n_workers);
+
+    if (n_slices > 1) {
+      int rows = (h + n_slices - 1) / n_slices;
+      int s;
+
+      g_mutex_lock (&yadif->task_lock);
+      yadif->tasks_pending += n_slices;
+      g_mutex_unlock (&yadif->task_lock);
+
+      for (s = 0; s < n_slices; s++) {
+        YadifSlice *slice = g_slice_new (YadifSlice);
+
+        slice->yadif = yadif;
+        slice->parity = parity;
+        slice->tff = tff;
+        slice->component = i;
+        slice->y0 = s * rows;
+        slice->y1 = MIN ((s + 1) * rows, h);
+        g_thread_pool_push (yadif->worker_pool, slice, NULL);
       }
+    } else {
+      yadif_filter_rows (yadif, parity, tff, i, 0, h);
     }
   }
 
+  /* all planes were dispatched before waiting so the workers can overlap
+   * luma and chroma slices */
+  if (yadif->worker_pool) {
+    g_mutex_lock (&yadif->task_lock);
+    while (yadif->tasks_pending > 0)
+      g_cond_wait (&yadif->task_cond, &yadif->task_lock);
+    g_mutex_unlock (&yadif->task_lock);
+  }
+
 #if 0
   emms_c ();
 #endif
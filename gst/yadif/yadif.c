@@ -54,6 +54,10 @@ DECLARE_ASM_CONST (16, xmm_reg, pw_1) = {
 
 
 #define HAVE_SSE2_INLINE 1
+/* same template, only needs pabsw at runtime */
+#if defined(__GNUC__)
+#define HAVE_SSSE3_INLINE 1
+#endif
 
 #if HAVE_SSSE3_INLINE
 #define COMPILE_TEMPLATE_SSE2 1
@@ -87,19 +91,17 @@ filter_line_x86_64 (guint8 * dst,
     guint8 * prev, guint8 * cur, guint8 * next,
     int w, int prefs, int mrefs, int parity, int mode)
 {
-#if 0
-#if HAVE_MMXEXT_INLINE
-  if (cpu_flags & AV_CPU_FLAG_MMXEXT)
-    yadif->filter_line = yadif_filter_line_mmxext;
-#endif
-#if HAVE_SSE2_INLINE
-  if (cpu_flags & AV_CPU_FLAG_SSE2)
-    yadif->filter_line = yadif_filter_line_sse2;
-#endif
 #if HAVE_SSSE3_INLINE
-  if (cpu_flags & AV_CPU_FLAG_SSSE3)
-    yadif->filter_line = yadif_filter_line_ssse3;
-#endif
+  static int have_ssse3 = -1;
+
+  if (G_UNLIKELY (have_ssse3 < 0))
+    have_ssse3 = __builtin_cpu_supports ("ssse3");
+
+  if (have_ssse3) {
+    yadif_filter_line_ssse3 (dst, prev, cur, next, w, prefs, mrefs, parity,
+        mode);
+    return;
+  }
 #endif
   yadif_filter_line_sse2 (dst, prev, cur, next, w, prefs, mrefs, parity, mode);
 }
@@ -1316,6 +1316,45 @@ done:
   return ret;
 }
 
+/* Cheap validation key for the codec cache: the set of MediaCodec codecs
+ * on a device can only change with the system image, and every system
+ * image has a unique android.os.Build.FINGERPRINT */
+static gchar *
+get_build_fingerprint (void)
+{
+  JNIEnv *env = gst_amc_jni_get_env ();
+  GError *error = NULL;
+  jclass build_class = NULL;
+  jfieldID fingerprint_id;
+  jobject fingerprint = NULL;
+  gchar *ret = NULL;
+
+  build_class = gst_amc_jni_get_class (env, &error, "android/os/Build");
+  if (!build_class)
+    goto done;
+
+  fingerprint_id = gst_amc_jni_get_static_field_id (env, &error, build_class,
+      "FINGERPRINT", "Ljava/lang/String;");
+  if (!fingerprint_id)
+    goto done;
+
+  if (!gst_amc_jni_get_static_object_field (env, &error, build_class,
+          fingerprint_id, &fingerprint) || !fingerprint)
+    goto done;
+
+  ret = gst_amc_jni_string_to_gchar (env, fingerprint, TRUE);
+
+done:
+  if (error) {
+    GST_WARNING ("Failed to get build fingerprint: %s", error->message);
+    g_clear_error (&error);
+  }
+  if (build_class)
+    gst_amc_jni_object_local_unref (env, build_class);
+
+  return ret;
+}
+
 static gboolean
 scan_codecs (GstPlugin * plugin)
 {
@@ -1325,10 +1364,24 @@ scan_codecs (GstPlugin * plugin)
   jmethodID get_codec_count_id, get_codec_info_at_id;
   jint codec_count, i;
   const GstStructure *cache_data;
+  gchar *fingerprint;
 
   GST_DEBUG ("Scanning codecs");
 
-  if ((cache_data = gst_plugin_get_cache_data (plugin))) {
+  fingerprint = get_build_fingerprint ();
+
+  if ((cache_data = gst_plugin_get_cache_data (plugin)) && fingerprint) {
+    const gchar *cached_fingerprint =
+        gst_structure_get_string (cache_data, "build-fingerprint");
+
+    if (g_strcmp0 (cached_fingerprint, fingerprint) != 0) {
+      GST_INFO ("Codec cache was built on another system image (%s), "
+          "rescanning", GST_STR_NULL (cached_fingerprint));
+      cache_data = NULL;
+    }
+  }
+
+  if (cache_data) {
     const GValue *arr = gst_structure_get_value (cache_data, "codecs");
     guint i, n;
 
@@ -1402,6 +1455,7 @@ scan_codecs (GstPlugin * plugin)
       g_queue_push_tail (&codec_infos, gst_codec_info);
     }
 
+    g_free (fingerprint);
     return TRUE;
   }
 
@@ -2011,12 +2065,17 @@ scan_codecs (GstPlugin * plugin)
     gst_structure_set_value (new_cache_data, "codecs", &arr);
     g_value_unset (&arr);
 
+    if (fingerprint)
+      gst_structure_set (new_cache_data, "build-fingerprint", G_TYPE_STRING,
+          fingerprint, NULL);
+
     gst_plugin_set_cache_data (plugin, new_cache_data);
   }
 
 done:
   if (codec_list_class)
     (*env)->DeleteLocalRef (env, codec_list_class);
+  g_free (fingerprint);
 
   return ret;
 }
@@ -112,7 +112,7 @@ _gl_sync_result_unref (struct gl_sync_result *result)
 
   if (g_atomic_int_dec_and_test (&result->refcount)) {
     GST_TRACE ("freeing gl_sync result %p", result);
-    g_free (result);
+    g_slice_free (struct gl_sync_result, result);
   }
 }
 
@@ -156,7 +156,7 @@ _gl_sync_unref (struct gl_sync *sync)
     g_object_unref (sync->surface);
     gst_memory_unref ((GstMemory *) sync->oes_mem);
 
-    g_free (sync);
+    g_slice_free (struct gl_sync, sync);
   }
 }
 
@@ -1256,7 +1256,7 @@ _amc_gl_copy (GstGLSyncMeta * src, GstBuffer * sbuffer, GstGLSyncMeta * dest,
   struct gl_sync *sync = src->data;
   struct gl_sync *tmp;
 
-  tmp = g_new0 (struct gl_sync, 1);
+  tmp = g_slice_new0 (struct gl_sync);
 
   GST_TRACE ("copying gl_sync %p to %p", sync, tmp);
 
@@ -1462,7 +1462,7 @@ retry:
     gst_buffer_append_memory (outbuf,
         gst_memory_ref ((GstMemory *) self->oes_mem));
 
-    sync = g_new0 (struct gl_sync, 1);
+    sync = g_slice_new0 (struct gl_sync);
     sync->refcount = 1;
     sync->sink = self;
     sync->buffer = outbuf;
@@ -1470,7 +1470,7 @@ retry:
     sync->oes_mem =
         (GstGLMemory *) gst_memory_ref ((GstMemory *) self->oes_mem);
     sync->buffer_idx = idx;
-    sync->result = g_new0 (struct gl_sync_result, 1);
+    sync->result = g_slice_new0 (struct gl_sync_result);
     sync->result->refcount = 1;
     sync->result->updated = FALSE;
 
@@ -294,7 +294,8 @@ gst_vtdec_negotiate (GstVideoDecoder * decoder)
   }
   gst_caps_unref (caps);
 
-  if (!prevcaps || !gst_caps_is_equal (prevcaps, output_state->caps)) {
+  if (!vtdec->session || !prevcaps
+      || !gst_caps_is_equal (prevcaps, output_state->caps)) {
     gboolean renegotiating = vtdec->session != NULL;
 
     GST_INFO_OBJECT (vtdec,
@@ -397,6 +398,20 @@ gst_vtdec_set_format (GstVideoDecoder * decoder, GstVideoCodecState * state)
     CFRelease (vtdec->format_description);
   vtdec->format_description = format_description;
 
+  /* An existing session can survive format description changes within the
+   * same codec (new SPS/PPS after a seek, for instance); only tear it down
+   * when VideoToolbox says the new description is incompatible, negotiate
+   * below will then create a fresh one */
+  if (vtdec->session
+      && !VTDecompressionSessionCanAcceptFormatDescription (vtdec->session,
+          format_description)) {
+    GST_INFO_OBJECT (vtdec,
+        "existing session does not accept new format description, "
+        "invalidating");
+    gst_vtdec_push_frames_if_needed (vtdec, TRUE, FALSE);
+    gst_vtdec_invalidate_session (vtdec);
+  }
+
   if (vtdec->input_state)
     gst_video_codec_state_unref (vtdec->input_state);
   vtdec->input_state = gst_video_codec_state_ref (state);
@@ -493,6 +508,7 @@ gst_vtdec_create_session (GstVtdec * vtdec, GstVideoFormat format,
   CFMutableDictionaryRef output_image_buffer_attrs;
   VTDecompressionOutputCallbackRecord callback;
   CFMutableDictionaryRef videoDecoderSpecification;
+  CFDictionaryRef io_surface_props;
   OSStatus status;
   guint32 cv_format = 0;
 
@@ -537,6 +553,12 @@ gst_vtdec_create_session (GstVtdec * vtdec, GstVideoFormat format,
       vtdec->video_info.width);
   gst_vtutil_dict_set_i32 (output_image_buffer_attrs, kCVPixelBufferHeightKey,
       vtdec->video_info.height);
+  /* Request IOSurface-backed pixel buffers so the texture cache can wrap
+   * the decoder output without mapping and copying it */
+  io_surface_props = CFDictionaryCreate (NULL, NULL, NULL, 0,
+      &kCFTypeDictionaryKeyCallBacks, &kCFTypeDictionaryValueCallBacks);
+  gst_vtutil_dict_set_object (output_image_buffer_attrs,
+      kCVPixelBufferIOSurfacePropertiesKey, (CFTypeRef *) io_surface_props);
 
   callback.decompressionOutputCallback = gst_vtdec_session_output_callback;
   callback.decompressionOutputRefCon = vtdec;
@@ -31,6 +31,7 @@
 #include <unistd.h>
 #include <sys/un.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <fcntl.h>
 #include <netinet/in.h>
 
@@ -310,26 +311,53 @@ gst_avdtp_sink_render (GstBaseSink * basesink, GstBuffer * buffer)
 {
   GstFlowReturn flow_ret = GST_FLOW_OK;
   GstAvdtpSink *self = GST_AVDTP_SINK (basesink);
-  GstMapInfo map;
+  GstMapInfo maps[8];
+  struct iovec iov[8];
+  guint n_mem, i;
   ssize_t ret;
   int fd;
 
-  if (!gst_buffer_map (buffer, &map, GST_MAP_READ))
-    return GST_FLOW_ERROR;
-
   /* FIXME: temporary sanity check */
   g_assert (!(g_io_channel_get_flags (self->conn.stream) & G_IO_FLAG_NONBLOCK));
 
   /* FIXME: why not use g_io_channel_write_chars() instead? */
   fd = g_io_channel_unix_get_fd (self->conn.stream);
-  ret = write (fd, map.data, map.size);
+
+  n_mem = gst_buffer_n_memory (buffer);
+  if (n_mem > 0 && n_mem <= G_N_ELEMENTS (iov)) {
+    /* the payloader usually hands us packets made of separate header and
+     * payload memories; gather them into a single write instead of letting
+     * gst_buffer_map() merge them into a temporary copy first */
+    for (i = 0; i < n_mem; i++) {
+      if (!gst_buffer_map_range (buffer, i, 1, &maps[i], GST_MAP_READ)) {
+        while (i > 0)
+          gst_buffer_unmap (buffer, &maps[--i]);
+        return GST_FLOW_ERROR;
+      }
+      iov[i].iov_base = maps[i].data;
+      iov[i].iov_len = maps[i].size;
+    }
+
+    ret = writev (fd, iov, n_mem);
+
+    for (i = 0; i < n_mem; i++)
+      gst_buffer_unmap (buffer, &maps[i]);
+  } else {
+    GstMapInfo map;
+
+    if (!gst_buffer_map (buffer, &map, GST_MAP_READ))
+      return GST_FLOW_ERROR;
+
+    ret = write (fd, map.data, map.size);
+    gst_buffer_unmap (buffer, &map);
+  }
+
   if (ret < 0) {
     /* FIXME: since this is probably fatal, shouldn't we post an error here? */
     GST_ERROR_OBJECT (self, "Error writing to socket: %s", g_strerror (errno));
     flow_ret = GST_FLOW_ERROR;
   }
 
-  gst_buffer_unmap (buffer, &map);
   return flow_ret;
 }
 
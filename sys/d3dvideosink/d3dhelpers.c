@@ -379,9 +379,12 @@ gst_d3d_surface_memory_map (GstMemory * mem, gsize maxsize, GstMapFlags flags)
     parent = (GstD3DSurfaceMemory *) mem;
 
   g_mutex_lock (&parent->lock);
+  /* NOSYSLOCK so the streaming thread's CPU upload does not hold the
+   * global D3D critical section, which would block Present on the
+   * window thread for the duration of the copy */
   if (!parent->map_count
       && IDirect3DSurface9_LockRect (parent->surface, &parent->lr, NULL,
-          0) != D3D_OK) {
+          D3DLOCK_NOSYSLOCK) != D3D_OK) {
     ret = NULL;
     goto done;
   }
@@ -1730,6 +1733,7 @@ d3d_present_swap_chain (GstD3DVideoSink * sink)
   GstD3DVideoSinkClass *klass = GST_D3DVIDEOSINK_GET_CLASS (sink);
   LPDIRECT3DSURFACE9 back_buffer = NULL;
   gboolean ret = FALSE;
+  gboolean needs_clear = TRUE;
   HRESULT hr;
   RECT dstr, srcr, *pDestRect = NULL, *pSrcRect = NULL;
 
@@ -1753,9 +1757,32 @@ d3d_present_swap_chain (GstD3DVideoSink * sink)
       back_buffer);
   IDirect3DSurface9_Release (back_buffer);
 
-  /* Clear the target */
-  IDirect3DDevice9_Clear (klass->d3d.device.d3d_device, 0, NULL,
-      D3DCLEAR_TARGET, D3DCOLOR_XRGB (0, 0, 0), 1.0f, 0);
+  /* Clear the target only when the frame will leave part of it
+   * uncovered; the StretchRect below overwrites the covered area anyway
+   * and a full-target clear is measurable at large back buffer sizes */
+  if (sink->d3d.render_rect == NULL) {
+    if (!sink->force_aspect_ratio) {
+      needs_clear = FALSE;
+    } else {
+      gint window_width = 0, window_height = 0;
+      GstVideoRectangle src = { 0, }, dst = { 0, }, result;
+
+      d3d_get_hwnd_window_size (sink->d3d.window_handle, &window_width,
+          &window_height);
+      dst.w = window_width;
+      dst.h = window_height;
+      src.w = GST_VIDEO_SINK_WIDTH (sink);
+      src.h = GST_VIDEO_SINK_HEIGHT (sink);
+      gst_video_sink_center_rect (src, dst, &result, TRUE);
+      needs_clear = result.x != 0 || result.y != 0
+          || result.w != dst.w || result.h != dst.h;
+    }
+  }
+
+  if (needs_clear) {
+    IDirect3DDevice9_Clear (klass->d3d.device.d3d_device, 0, NULL,
+        D3DCLEAR_TARGET, D3DCOLOR_XRGB (0, 0, 0), 1.0f, 0);
+  }
 
   hr = IDirect3DDevice9_BeginScene (klass->d3d.device.d3d_device);
   ERROR_CHECK_HR (hr) {
@@ -66,7 +66,8 @@ enum
   PROP_DISCONT_WAIT,
   PROP_BUFFER_SIZE,
   PROP_CHANNELS,
-  PROP_HW_SERIAL_NUMBER
+  PROP_HW_SERIAL_NUMBER,
+  PROP_CLOCK_DRIFT
 };
 
 static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("src",
@@ -211,6 +212,13 @@ gst_decklink_audio_src_class_init (GstDecklinkAudioSrcClass * klass)
           "The serial number (hardware ID) of the Decklink card",
           NULL, (GParamFlags) (G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
 
+  g_object_class_install_property (gobject_class, PROP_CLOCK_DRIFT,
+      g_param_spec_int64 ("clock-drift", "Clock drift",
+          "Measured drift of the hardware clock against the outgoing "
+          "timestamps in nanoseconds since capture start (positive means "
+          "the hardware clock runs fast)", G_MININT64, G_MAXINT64, 0,
+          (GParamFlags) (G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
+
   gst_element_class_add_static_pad_template (element_class, &sink_template);
 
   gst_element_class_set_static_metadata (element_class, "Decklink Audio Source",
@@ -230,6 +238,8 @@ gst_decklink_audio_src_init (GstDecklinkAudioSrc * self)
   self->discont_wait = DEFAULT_DISCONT_WAIT;
   self->buffer_size = DEFAULT_BUFFER_SIZE;
   self->channels = DEFAULT_CHANNELS;
+  self->drift_base_hardware_time = GST_CLOCK_TIME_NONE;
+  self->drift_base_timestamp = GST_CLOCK_TIME_NONE;
 
   gst_base_src_set_live (GST_BASE_SRC (self), TRUE);
   gst_base_src_set_format (GST_BASE_SRC (self), GST_FORMAT_TIME);
@@ -305,6 +315,11 @@ gst_decklink_audio_src_get_property (GObject * object, guint property_id,
       else
         g_value_set_string (value, NULL);
       break;
+    case PROP_CLOCK_DRIFT:
+      g_mutex_lock (&self->lock);
+      g_value_set_int64 (value, self->clock_drift);
+      g_mutex_unlock (&self->lock);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -787,6 +802,23 @@ retry:
   }
   self->last_hardware_time = p.hardware_timestamp;
 
+  /* Track how far the hardware clock has run ahead of (or behind) the
+   * outgoing timestamps since capture start, so downstream can drive a
+   * drift-compensating resampler from the clock-drift property */
+  if (p.hardware_timestamp != GST_CLOCK_TIME_NONE) {
+    g_mutex_lock (&self->lock);
+    if (self->drift_base_hardware_time == GST_CLOCK_TIME_NONE) {
+      self->drift_base_hardware_time = p.hardware_timestamp;
+      self->drift_base_timestamp = timestamp;
+      self->clock_drift = 0;
+    } else {
+      self->clock_drift =
+          (gint64) (p.hardware_timestamp - self->drift_base_hardware_time) -
+          (gint64) (timestamp - self->drift_base_timestamp);
+    }
+    g_mutex_unlock (&self->lock);
+  }
+
   if (p.no_signal)
     GST_BUFFER_FLAG_SET (*buffer, GST_BUFFER_FLAG_GAP);
   GST_BUFFER_TIMESTAMP (*buffer) = timestamp;
@@ -1034,6 +1066,9 @@ gst_decklink_audio_src_change_state (GstElement * element,
 
       self->flushing = FALSE;
       self->next_offset = -1;
+      self->drift_base_hardware_time = GST_CLOCK_TIME_NONE;
+      self->drift_base_timestamp = GST_CLOCK_TIME_NONE;
+      self->clock_drift = 0;
       break;
     }
     default:
@@ -81,6 +81,12 @@ struct _GstDecklinkAudioSrc
   GstClockTime discont_time;
 
   guint buffer_size;
+
+  /* drift of the hardware clock against the outgoing timestamps,
+   * protected by lock */
+  GstClockTime drift_base_hardware_time;
+  GstClockTime drift_base_timestamp;
+  gint64 clock_drift;
 };
 
 struct _GstDecklinkAudioSrcClass
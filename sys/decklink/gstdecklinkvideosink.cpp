@@ -140,6 +140,10 @@
 GST_DEBUG_CATEGORY_STATIC (gst_decklink_video_sink_debug);
 #define GST_CAT_DEFAULT gst_decklink_video_sink_debug
 
+/* number of frames to pre-queue in the driver when pacing on frame
+ * completions instead of the pipeline clock (sync=false) */
+#define MAX_BUFFERED_VIDEO_FRAMES 4
+
 class GStreamerVideoOutputCallback:public IDeckLinkVideoOutputCallback
 {
 public:
@@ -205,6 +209,13 @@ public:
         break;
     }
 
+    /* wake up a prepare() that is waiting for room in the driver queue */
+    if (m_sink->output) {
+      g_mutex_lock (&m_sink->output->lock);
+      g_cond_signal (&m_sink->output->cond);
+      g_mutex_unlock (&m_sink->output->lock);
+    }
+
     return S_OK;
   }
 
@@ -1307,6 +1318,29 @@ gst_decklink_video_sink_prepare (GstBaseSink * bsink, GstBuffer * buffer)
   gst_decklink_video_sink_convert_to_internal_clock (self, &running_time,
       &running_time_duration);
 
+  /* When not syncing to the pipeline clock, pace on the driver's queue
+   * instead: wait for ScheduledFrameCompleted to drain the queue below the
+   * maximum number of pre-queued frames so the hardware reference clock does
+   * the timing and memory usage stays bounded */
+  if (!gst_base_sink_get_sync (bsink)) {
+    guint32 buffered;
+
+    g_mutex_lock (&self->output->lock);
+    while (self->output->started
+        && self->output->output->GetBufferedVideoFrameCount (&buffered) == S_OK
+        && buffered >= MAX_BUFFERED_VIDEO_FRAMES) {
+      gint64 end_time = g_get_monotonic_time () +
+          GST_TIME_AS_USECONDS (running_time_duration);
+
+      /* time out after one frame duration so that flushing and shutdown
+       * can't deadlock us; that is the pacing interval anyway */
+      if (!g_cond_wait_until (&self->output->cond, &self->output->lock,
+              end_time))
+        break;
+    }
+    g_mutex_unlock (&self->output->lock);
+  }
+
   GST_LOG_OBJECT (self, "Scheduling video frame %p at %" GST_TIME_FORMAT
       " with duration %" GST_TIME_FORMAT, frame, GST_TIME_ARGS (running_time),
       GST_TIME_ARGS (running_time_duration));
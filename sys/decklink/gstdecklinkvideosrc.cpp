@@ -1187,6 +1187,7 @@ gst_decklink_video_src_create (GstPushSrc * bsrc, GstBuffer ** buffer)
   GstFlowReturn flow_ret = GST_FLOW_OK;
   const guint8 *data;
   gsize data_size;
+  glong row_bytes;
   VideoFrame *vf;
   CaptureFrame f;
   GstCaps *caps;
@@ -1290,7 +1291,14 @@ gst_decklink_video_src_create (GstPushSrc * bsrc, GstBuffer ** buffer)
   }
 
   f.frame->GetBytes ((gpointer *) & data);
-  data_size = self->info.size;
+  row_bytes = f.frame->GetRowBytes ();
+  if (row_bytes != GST_VIDEO_INFO_PLANE_STRIDE (&self->info, 0)) {
+    /* the driver padded the rows; stay zero-copy and describe the real
+     * stride with a GstVideoMeta below */
+    data_size = row_bytes * self->info.height;
+  } else {
+    data_size = self->info.size;
+  }
 
   vf = (VideoFrame *) g_malloc0 (sizeof (VideoFrame));
 
@@ -1299,6 +1307,15 @@ gst_decklink_video_src_create (GstPushSrc * bsrc, GstBuffer ** buffer)
       (gpointer) data, data_size, 0, data_size, vf,
       (GDestroyNotify) video_frame_free);
 
+  if (row_bytes != GST_VIDEO_INFO_PLANE_STRIDE (&self->info, 0)) {
+    gsize offset = 0;
+    gint stride = row_bytes;
+
+    gst_buffer_add_video_meta_full (*buffer, GST_VIDEO_FRAME_FLAG_NONE,
+        GST_VIDEO_INFO_FORMAT (&self->info), self->info.width,
+        self->info.height, 1, &offset, &stride);
+  }
+
   vf->frame = f.frame;
   f.frame->AddRef ();
   vf->input = self->input->input;
@@ -98,6 +98,7 @@
 #include <gst/glib-compat-private.h>
 #include <sys/ioctl.h>
 #include <sys/poll.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <stdio.h>
@@ -563,6 +564,9 @@ static gboolean gst_dvbsrc_tune_fe (GstDvbSrc * object);
 
 static void gst_dvbsrc_set_pes_filters (GstDvbSrc * object);
 static void gst_dvbsrc_unset_pes_filters (GstDvbSrc * object);
+#ifdef DMX_REQBUFS
+static void gst_dvbsrc_ring_deactivate (GstDvbSrc * object);
+#endif
 static gboolean gst_dvbsrc_is_valid_modulation (guint delsys, guint mod);
 static gboolean gst_dvbsrc_is_valid_trans_mode (guint delsys, guint mode);
 static gboolean gst_dvbsrc_is_valid_bandwidth (guint delsys, guint bw);
@@ -1534,6 +1538,9 @@ gst_dvbsrc_close_devices (GstDvbSrc * object)
 {
   gst_dvbsrc_unset_pes_filters (object);
 
+#ifdef DMX_REQBUFS
+  gst_dvbsrc_ring_deactivate (object);
+#endif
   close (object->fd_dvr);
   object->fd_dvr = -1;
   close (object->fd_frontend);
@@ -1776,6 +1783,235 @@ delsys_detection_done:
   return TRUE;
 }
 
+#ifdef DMX_REQBUFS
+
+/* number of buffers requested from the demux streaming API; the kernel may
+ * grant fewer */
+#define DVB_RING_BUFFER_COUNT 8
+
+/* The ring outlives the element state: buffers wrapping mapped slices can
+ * still be held downstream after the source stopped, so the mappings and a
+ * dup of the dvr fd stay alive until the last slice is freed. */
+struct _GstDvbSrcRing
+{
+  gint refcount;
+  GMutex lock;
+  gboolean active;
+
+  int fd;
+  guint count;
+  gsize buf_size;
+  guint8 *maps[DVB_RING_BUFFER_COUNT];
+};
+
+typedef struct
+{
+  GstDvbSrcRing *ring;
+  guint index;
+} GstDvbSrcRingSlice;
+
+static GstDvbSrcRing *
+gst_dvbsrc_ring_ref (GstDvbSrcRing * ring)
+{
+  g_atomic_int_inc (&ring->refcount);
+  return ring;
+}
+
+static void
+gst_dvbsrc_ring_unref (GstDvbSrcRing * ring)
+{
+  guint i;
+
+  if (!g_atomic_int_dec_and_test (&ring->refcount))
+    return;
+
+  for (i = 0; i < ring->count; i++) {
+    if (ring->maps[i])
+      munmap (ring->maps[i], ring->buf_size);
+  }
+  if (ring->fd >= 0)
+    close (ring->fd);
+  g_mutex_clear (&ring->lock);
+  g_free (ring);
+}
+
+static GstDvbSrcRing *
+gst_dvbsrc_ring_new (GstDvbSrc * object)
+{
+  struct dmx_requestbuffers reqbufs;
+  GstDvbSrcRing *ring;
+  gint err;
+  guint i;
+
+  memset (&reqbufs, 0, sizeof (reqbufs));
+  reqbufs.count = DVB_RING_BUFFER_COUNT;
+  reqbufs.size = object->dvb_buffer_size / DVB_RING_BUFFER_COUNT;
+
+  LOOP_WHILE_EINTR (err, ioctl (object->fd_dvr, DMX_REQBUFS, &reqbufs));
+  if (err) {
+    GST_INFO_OBJECT (object, "ioctl DMX_REQBUFS failed (%d), "
+        "falling back to read()", errno);
+    return NULL;
+  }
+  if (reqbufs.count == 0 || reqbufs.count > DVB_RING_BUFFER_COUNT) {
+    GST_INFO_OBJECT (object, "unusable buffer count %u from DMX_REQBUFS, "
+        "falling back to read()", reqbufs.count);
+    return NULL;
+  }
+
+  ring = g_new0 (GstDvbSrcRing, 1);
+  ring->refcount = 1;
+  g_mutex_init (&ring->lock);
+  ring->fd = dup (object->fd_dvr);
+  ring->count = reqbufs.count;
+  ring->buf_size = reqbufs.size;
+
+  for (i = 0; i < ring->count; i++) {
+    struct dmx_buffer dbuf;
+
+    memset (&dbuf, 0, sizeof (dbuf));
+    dbuf.index = i;
+    LOOP_WHILE_EINTR (err, ioctl (ring->fd, DMX_QUERYBUF, &dbuf));
+    if (err)
+      goto failed;
+
+    ring->maps[i] = mmap (NULL, dbuf.length, PROT_READ, MAP_SHARED,
+        ring->fd, dbuf.offset);
+    if (ring->maps[i] == MAP_FAILED) {
+      ring->maps[i] = NULL;
+      goto failed;
+    }
+    ring->buf_size = dbuf.length;
+
+    LOOP_WHILE_EINTR (err, ioctl (ring->fd, DMX_QBUF, &dbuf));
+    if (err)
+      goto failed;
+  }
+
+  ring->active = TRUE;
+  GST_INFO_OBJECT (object, "using memory-mapped capture with %u buffers "
+      "of %" G_GSIZE_FORMAT " bytes", ring->count, ring->buf_size);
+  return ring;
+
+failed:
+  GST_INFO_OBJECT (object, "failed to map demux ring buffers (%d), "
+      "falling back to read()", errno);
+  gst_dvbsrc_ring_unref (ring);
+  return NULL;
+}
+
+static void
+gst_dvbsrc_ring_slice_free (GstDvbSrcRingSlice * slice)
+{
+  GstDvbSrcRing *ring = slice->ring;
+  struct dmx_buffer dbuf;
+  gint err;
+
+  /* hand the slice back to the driver unless capture was shut down */
+  g_mutex_lock (&ring->lock);
+  if (ring->active) {
+    memset (&dbuf, 0, sizeof (dbuf));
+    dbuf.index = slice->index;
+    LOOP_WHILE_EINTR (err, ioctl (ring->fd, DMX_QBUF, &dbuf));
+    if (err)
+      GST_WARNING ("failed to requeue demux buffer %u (%d)", slice->index,
+          errno);
+  }
+  g_mutex_unlock (&ring->lock);
+
+  gst_dvbsrc_ring_unref (ring);
+  g_free (slice);
+}
+
+static void
+gst_dvbsrc_ring_deactivate (GstDvbSrc * object)
+{
+  if (!object->ring)
+    return;
+
+  g_mutex_lock (&object->ring->lock);
+  object->ring->active = FALSE;
+  g_mutex_unlock (&object->ring->lock);
+
+  gst_dvbsrc_ring_unref (object->ring);
+  object->ring = NULL;
+}
+
+static GstFlowReturn
+gst_dvbsrc_read_device_mmap (GstDvbSrc * object, GstBuffer ** buffer)
+{
+  GstClockTime timeout = object->timeout * GST_USECOND;
+  GstDvbSrcRing *ring = object->ring;
+  gint ret_val;
+
+  while (TRUE) {
+    ret_val = gst_poll_wait (object->poll, timeout);
+    GST_LOG_OBJECT (object, "select returned %d", ret_val);
+    if (G_UNLIKELY (ret_val < 0)) {
+      if (errno == EBUSY)
+        goto stopped;
+      else if (errno == EINTR)
+        continue;
+      else
+        goto select_error;
+    } else if (G_UNLIKELY (!ret_val)) {
+      /* timeout, post element message */
+      gst_element_post_message (GST_ELEMENT_CAST (object),
+          gst_message_new_element (GST_OBJECT (object),
+              gst_structure_new_empty ("dvb-read-failure")));
+    } else {
+      struct dmx_buffer dbuf;
+      GstDvbSrcRingSlice *slice;
+      gint err;
+
+      memset (&dbuf, 0, sizeof (dbuf));
+      LOOP_WHILE_EINTR (err, ioctl (ring->fd, DMX_DQBUF, &dbuf));
+      if (G_UNLIKELY (err)) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+          continue;
+        GST_WARNING_OBJECT (object,
+            "Unable to dequeue from device: /dev/dvb/adapter%d/dvr%d (%d)",
+            object->adapter_number, object->frontend_number, errno);
+        gst_element_post_message (GST_ELEMENT_CAST (object),
+            gst_message_new_element (GST_OBJECT (object),
+                gst_structure_new_empty ("dvb-read-failure")));
+        continue;
+      }
+
+      if (G_UNLIKELY (dbuf.bytesused == 0)) {
+        LOOP_WHILE_EINTR (err, ioctl (ring->fd, DMX_QBUF, &dbuf));
+        continue;
+      }
+
+      slice = g_new (GstDvbSrcRingSlice, 1);
+      slice->ring = gst_dvbsrc_ring_ref (ring);
+      slice->index = dbuf.index;
+
+      /* the buffer wraps the mapped slice directly; freeing it requeues
+       * the slice to the driver */
+      *buffer = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+          ring->maps[dbuf.index], ring->buf_size, 0, dbuf.bytesused,
+          slice, (GDestroyNotify) gst_dvbsrc_ring_slice_free);
+
+      return GST_FLOW_OK;
+    }
+  }
+
+stopped:
+  {
+    GST_DEBUG_OBJECT (object, "stop called");
+    return GST_FLOW_FLUSHING;
+  }
+select_error:
+  {
+    GST_ELEMENT_ERROR (object, RESOURCE, READ, (NULL),
+        ("select error %d: %s (%d)", ret_val, g_strerror (errno), errno));
+    return GST_FLOW_ERROR;
+  }
+}
+
+#endif /* DMX_REQBUFS */
+
 static gboolean
 gst_dvbsrc_open_dvr (GstDvbSrc * object)
 {
@@ -1812,6 +2048,9 @@ gst_dvbsrc_open_dvr (GstDvbSrc * object)
     GST_INFO_OBJECT (object, "ioctl DMX_SET_BUFFER_SIZE failed (%d)", errno);
     return FALSE;
   }
+#ifdef DMX_REQBUFS
+  object->ring = gst_dvbsrc_ring_new (object);
+#endif
   return TRUE;
 }
 
@@ -1946,7 +2185,12 @@ gst_dvbsrc_create (GstPushSrc * element, GstBuffer ** buf)
   if (object->fd_dvr > -1) {
     /* --- Read TS from DVR device --- */
     GST_DEBUG_OBJECT (object, "Reading from DVR device");
-    retval = gst_dvbsrc_read_device (object, buffer_size, buf);
+#ifdef DMX_REQBUFS
+    if (object->ring)
+      retval = gst_dvbsrc_read_device_mmap (object, buf);
+    else
+#endif
+      retval = gst_dvbsrc_read_device (object, buffer_size, buf);
 
     if (object->stats_interval &&
         ++object->stats_counter == object->stats_interval) {
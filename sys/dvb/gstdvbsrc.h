@@ -56,6 +56,7 @@ G_BEGIN_DECLS
 typedef struct _GstDvbSrc GstDvbSrc;
 typedef struct _GstDvbSrcClass GstDvbSrcClass;
 typedef struct _GstDvbSrcParam GstDvbSrcParam;
+typedef struct _GstDvbSrcRing GstDvbSrcRing;
 
 struct _GstDvbSrc
 {
@@ -76,6 +77,9 @@ struct _GstDvbSrc
   GstPoll *poll;
   GstPollFD poll_fd_dvr;
 
+  /* memory-mapped ring capture state, NULL when falling back to read() */
+  GstDvbSrcRing *ring;
+
   guint16 pids[MAX_FILTERS];
   unsigned int freq;
   unsigned int sym_rate;
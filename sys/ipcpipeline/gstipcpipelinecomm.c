@@ -27,6 +27,7 @@
 #include <unistd.h>
 #include <errno.h>
 #include <string.h>
+#include <sys/uio.h>
 #include <gst/base/gstbytewriter.h>
 #include <gst/gstprotection.h>
 #include "gstipcpipelinecomm.h"
@@ -128,6 +129,54 @@ comm_request_free (CommRequest * req)
   g_free (req);
 }
 
+static gboolean set_field (GQuark field_id, const GValue * value,
+    gpointer user_data);
+
+/* Cached result of a query that was answered by the peer process.
+ * Kept until anything other than a buffer or a query crosses the fd
+ * in either direction, as that might change the peer's answer. */
+typedef struct
+{
+  gboolean ret;
+  GstStructure *structure;
+} CachedQueryResult;
+
+static void
+cached_query_result_free (CachedQueryResult * cached)
+{
+  if (cached->structure)
+    gst_structure_free (cached->structure);
+  g_free (cached);
+}
+
+static gboolean
+query_is_cacheable (GstQuery * query)
+{
+  /* Only negotiation related queries, whose answer is stable as long as
+   * nothing else (event, message, state change) crosses the fd. Position
+   * and duration queries change with dataflow, so they never qualify. */
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_CAPS:
+    case GST_QUERY_ACCEPT_CAPS:
+    case GST_QUERY_SCHEDULING:
+    case GST_QUERY_LATENCY:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+/* called with comm->mutex held */
+static void
+gst_ipc_pipeline_comm_invalidate_query_cache (GstIpcPipelineComm * comm)
+{
+  if (g_hash_table_size (comm->query_cache) > 0) {
+    GST_TRACE_OBJECT (comm->element, "Invalidating %u cached query results",
+        g_hash_table_size (comm->query_cache));
+    g_hash_table_remove_all (comm->query_cache);
+  }
+}
+
 static const gchar *
 comm_request_ret_get_name (CommRequestType type, guint32 ret)
 {
@@ -239,6 +288,45 @@ done:
   return ret;
 }
 
+static gboolean
+write_vectors_to_fd (GstIpcPipelineComm * comm, struct iovec *iov, guint n)
+{
+  gsize size = 0;
+  guint i;
+
+  for (i = 0; i < n; i++)
+    size += iov[i].iov_len;
+
+  GST_TRACE_OBJECT (comm->element,
+      "Writing %" G_GSIZE_FORMAT " bytes in %u vectors to fdout", size, n);
+  while (size) {
+    ssize_t written = writev (comm->fdout, iov, n);
+
+    if (written < 0) {
+      if (errno == EAGAIN || errno == EINTR)
+        continue;
+      GST_ERROR_OBJECT (comm->element, "Failed to write to fd: %s",
+          strerror (errno));
+      return FALSE;
+    }
+    size -= written;
+
+    /* skip the vectors that went out completely and trim the first
+     * partially written one */
+    while (n > 0 && (size_t) written >= iov->iov_len) {
+      written -= iov->iov_len;
+      iov++;
+      n--;
+    }
+    if (n > 0 && written > 0) {
+      iov->iov_base = (guint8 *) iov->iov_base + written;
+      iov->iov_len -= written;
+    }
+  }
+
+  return TRUE;
+}
+
 static gboolean
 write_byte_writer_to_fd (GstIpcPipelineComm * comm, GstByteWriter * bw)
 {
@@ -501,13 +589,17 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
     GstBuffer * buffer)
 {
   const unsigned char payload_type = GST_IPC_PIPELINE_COMM_DATA_TYPE_BUFFER;
-  GstMapInfo map;
   guint32 ret32 = GST_FLOW_OK;
   guint32 size, n;
   CommBufferMetadata meta;
   GstFlowReturn ret;
   MetaListRepresentation repr = { comm, 0, 4, NULL };   /* starts a 4 for n_meta */
   GstByteWriter bw;
+  guint8 *header = NULL, *trailer = NULL;
+  guint header_size, trailer_size;
+  GstMapInfo *maps = NULL;
+  struct iovec *iov = NULL;
+  guint n_mem = 0, n_mapped = 0;
 
   g_mutex_lock (&comm->mutex);
   ++comm->send_id;
@@ -541,14 +633,9 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
   size = gst_buffer_get_size (buffer);
   if (!gst_byte_writer_put_uint32_le (&bw, size))
     goto write_failed;
-  if (!write_byte_writer_to_fd (comm, &bw))
-    goto write_failed;
-
-  if (!gst_buffer_map (buffer, &map, GST_MAP_READ))
-    goto map_failed;
-  ret = write_to_fd_raw (comm, map.data, map.size);
-  gst_buffer_unmap (buffer, &map);
-  if (!ret)
+  header_size = gst_byte_writer_get_size (&bw);
+  header = gst_byte_writer_reset_and_get_data (&bw);
+  if (!header)
     goto write_failed;
 
   /* meta */
@@ -585,9 +672,39 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
         goto write_failed;
   }
 
-  if (!write_byte_writer_to_fd (comm, &bw))
+  trailer_size = gst_byte_writer_get_size (&bw);
+  trailer = gst_byte_writer_reset_and_get_data (&bw);
+  if (!trailer)
+    goto write_failed;
+
+  /* gather the framing, one vector per memory of the buffer and the meta
+   * trailer into a single writev, so the payload is neither flattened nor
+   * copied and the whole packet costs one syscall */
+  n_mem = gst_buffer_n_memory (buffer);
+  iov = g_new (struct iovec, n_mem + 2);
+  maps = g_new (GstMapInfo, n_mem);
+
+  iov[0].iov_base = header;
+  iov[0].iov_len = header_size;
+  for (n_mapped = 0; n_mapped < n_mem; n_mapped++) {
+    GstMemory *mem = gst_buffer_peek_memory (buffer, n_mapped);
+
+    if (!gst_memory_map (mem, &maps[n_mapped], GST_MAP_READ))
+      goto map_failed;
+    iov[1 + n_mapped].iov_base = maps[n_mapped].data;
+    iov[1 + n_mapped].iov_len = maps[n_mapped].size;
+  }
+  iov[n_mem + 1].iov_base = trailer;
+  iov[n_mem + 1].iov_len = trailer_size;
+
+  if (!write_vectors_to_fd (comm, iov, n_mem + 2))
     goto write_failed;
 
+  while (n_mapped > 0) {
+    n_mapped--;
+    gst_memory_unmap (maps[n_mapped].memory, &maps[n_mapped]);
+  }
+
   if (!gst_ipc_pipeline_comm_sync_fd (comm, comm->send_id, NULL, &ret32,
           ACK_TYPE_BLOCKING, COMM_REQUEST_TYPE_BUFFER))
     goto wait_failed;
@@ -596,6 +713,14 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
 done:
   g_mutex_unlock (&comm->mutex);
   gst_byte_writer_reset (&bw);
+  while (n_mapped > 0) {
+    n_mapped--;
+    gst_memory_unmap (maps[n_mapped].memory, &maps[n_mapped]);
+  }
+  g_free (maps);
+  g_free (iov);
+  g_free (header);
+  g_free (trailer);
   for (n = 0; n < repr.n_meta; ++n)
     g_free (repr.info[n].str);
   g_free (repr.info);
@@ -738,6 +863,7 @@ gst_ipc_pipeline_comm_write_sink_message_event_to_fd (GstIpcPipelineComm * comm,
       FALSE);
 
   g_mutex_lock (&comm->mutex);
+  gst_ipc_pipeline_comm_invalidate_query_cache (comm);
   ++comm->send_id;
 
   GST_TRACE_OBJECT (comm->element,
@@ -908,6 +1034,7 @@ gst_ipc_pipeline_comm_write_event_to_fd (GstIpcPipelineComm * comm,
     return gst_ipc_pipeline_comm_write_sink_message_event_to_fd (comm, event);
 
   g_mutex_lock (&comm->mutex);
+  gst_ipc_pipeline_comm_invalidate_query_cache (comm);
   ++comm->send_id;
 
   GST_TRACE_OBJECT (comm->element, "Writing event %u: %" GST_PTR_FORMAT,
@@ -1044,20 +1171,14 @@ gst_ipc_pipeline_comm_write_query_to_fd (GstIpcPipelineComm * comm,
   gboolean ret;
   guint32 type, size, ret32 = TRUE, slen;
   char *str = NULL;
+  gchar *cache_key = NULL;
+  CachedQueryResult *cached;
   const GstStructure *structure;
   GstByteWriter bw;
 
   g_mutex_lock (&comm->mutex);
-  ++comm->send_id;
-
-  GST_TRACE_OBJECT (comm->element, "Writing query %u: %" GST_PTR_FORMAT,
-      comm->send_id, query);
-
   gst_byte_writer_init (&bw);
-  if (!gst_byte_writer_put_uint8 (&bw, payload_type))
-    goto write_failed;
-  if (!gst_byte_writer_put_uint32_le (&bw, comm->send_id))
-    goto write_failed;
+
   structure = gst_query_get_structure (query);
   if (structure) {
     str = gst_structure_to_string (structure);
@@ -1066,6 +1187,37 @@ gst_ipc_pipeline_comm_write_query_to_fd (GstIpcPipelineComm * comm,
     str = NULL;
     slen = 0;
   }
+
+  /* negotiation queries tend to be repeated with identical contents;
+   * answer them from the cache when possible to avoid a blocking
+   * round-trip to the peer process */
+  if (query_is_cacheable (query)) {
+    cache_key = g_strdup_printf ("%d:%d:%s", (gint) GST_QUERY_TYPE (query),
+        upstream ? 1 : 0, str ? str : "");
+    cached = g_hash_table_lookup (comm->query_cache, cache_key);
+    if (cached) {
+      GST_TRACE_OBJECT (comm->element,
+          "Answering query from cache: %" GST_PTR_FORMAT, query);
+      if (cached->structure) {
+        GstStructure *s = gst_query_writable_structure (query);
+
+        gst_structure_remove_all_fields (s);
+        gst_structure_foreach (cached->structure, set_field, s);
+      }
+      ret = cached->ret;
+      goto done;
+    }
+  }
+
+  ++comm->send_id;
+
+  GST_TRACE_OBJECT (comm->element, "Writing query %u: %" GST_PTR_FORMAT,
+      comm->send_id, query);
+
+  if (!gst_byte_writer_put_uint8 (&bw, payload_type))
+    goto write_failed;
+  if (!gst_byte_writer_put_uint32_le (&bw, comm->send_id))
+    goto write_failed;
   size = sizeof (type) + 1 + slen + 1;
   if (!gst_byte_writer_put_uint32_le (&bw, size))
     goto write_failed;
@@ -1095,8 +1247,20 @@ gst_ipc_pipeline_comm_write_query_to_fd (GstIpcPipelineComm * comm,
 
   ret = ret32;
 
+  /* the reply has been folded into the query by reply_request; remember
+   * it for next time */
+  if (cache_key && ret) {
+    cached = g_new (CachedQueryResult, 1);
+    cached->ret = ret;
+    structure = gst_query_get_structure (query);
+    cached->structure = structure ? gst_structure_copy (structure) : NULL;
+    g_hash_table_replace (comm->query_cache, cache_key, cached);
+    cache_key = NULL;
+  }
+
 done:
   g_mutex_unlock (&comm->mutex);
+  g_free (cache_key);
   g_free (str);
   gst_byte_writer_reset (&bw);
   return ret;
@@ -1184,6 +1348,7 @@ gst_ipc_pipeline_comm_write_state_change_to_fd (GstIpcPipelineComm * comm,
   GstByteWriter bw;
 
   g_mutex_lock (&comm->mutex);
+  gst_ipc_pipeline_comm_invalidate_query_cache (comm);
   ++comm->send_id;
 
   GST_TRACE_OBJECT (comm->element, "Writing state change %u: %s -> %s",
@@ -1271,6 +1436,7 @@ gst_ipc_pipeline_comm_write_state_lost_to_fd (GstIpcPipelineComm * comm)
   GstByteWriter bw;
 
   g_mutex_lock (&comm->mutex);
+  gst_ipc_pipeline_comm_invalidate_query_cache (comm);
   ++comm->send_id;
 
   GST_TRACE_OBJECT (comm->element, "Writing state-lost %u", comm->send_id);
@@ -1320,6 +1486,7 @@ gst_ipc_pipeline_comm_write_gerror_message_to_fd (GstIpcPipelineComm * comm,
   GstByteWriter bw;
 
   g_mutex_lock (&comm->mutex);
+  gst_ipc_pipeline_comm_invalidate_query_cache (comm);
   ++comm->send_id;
 
   if (GST_MESSAGE_TYPE (message) == GST_MESSAGE_ERROR) {
@@ -1497,6 +1664,7 @@ gst_ipc_pipeline_comm_write_message_to_fd (GstIpcPipelineComm * comm,
     return gst_ipc_pipeline_comm_write_gerror_message_to_fd (comm, message);
 
   g_mutex_lock (&comm->mutex);
+  gst_ipc_pipeline_comm_invalidate_query_cache (comm);
   ++comm->send_id;
 
   GST_TRACE_OBJECT (comm->element, "Writing message %u: %" GST_PTR_FORMAT,
@@ -1604,6 +1772,9 @@ gst_ipc_pipeline_comm_init (GstIpcPipelineComm * comm, GstElement * element)
   comm->waiting_ids =
       g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL,
       (GDestroyNotify) comm_request_free);
+  comm->query_cache =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      (GDestroyNotify) cached_query_result_free);
   comm->adapter = gst_adapter_new ();
   comm->poll = gst_poll_new (TRUE);
   gst_poll_fd_init (&comm->pollFDin);
@@ -1613,6 +1784,7 @@ void
 gst_ipc_pipeline_comm_clear (GstIpcPipelineComm * comm)
 {
   g_hash_table_destroy (comm->waiting_ids);
+  g_hash_table_destroy (comm->query_cache);
   gst_object_unref (comm->adapter);
   gst_poll_free (comm->poll);
   g_mutex_clear (&comm->mutex);
@@ -1646,6 +1818,7 @@ void
 gst_ipc_pipeline_comm_cancel (GstIpcPipelineComm * comm, gboolean cleanup)
 {
   g_mutex_lock (&comm->mutex);
+  gst_ipc_pipeline_comm_invalidate_query_cache (comm);
   g_hash_table_foreach (comm->waiting_ids, cancel_request_error, comm);
   if (cleanup) {
     g_hash_table_unref (comm->waiting_ids);
@@ -1800,16 +1973,22 @@ read_many (GstIpcPipelineComm * comm)
         GST_TRACE_OBJECT (comm->element, "Got id %u, type %d, payload %u",
             comm->id, type, comm->payload_length);
         switch (type) {
-          case GST_IPC_PIPELINE_COMM_DATA_TYPE_ACK:
-          case GST_IPC_PIPELINE_COMM_DATA_TYPE_QUERY_RESULT:
-          case GST_IPC_PIPELINE_COMM_DATA_TYPE_BUFFER:
           case GST_IPC_PIPELINE_COMM_DATA_TYPE_EVENT:
           case GST_IPC_PIPELINE_COMM_DATA_TYPE_SINK_MESSAGE_EVENT:
-          case GST_IPC_PIPELINE_COMM_DATA_TYPE_QUERY:
           case GST_IPC_PIPELINE_COMM_DATA_TYPE_STATE_CHANGE:
           case GST_IPC_PIPELINE_COMM_DATA_TYPE_STATE_LOST:
           case GST_IPC_PIPELINE_COMM_DATA_TYPE_MESSAGE:
           case GST_IPC_PIPELINE_COMM_DATA_TYPE_GERROR_MESSAGE:
+            /* incoming traffic other than buffers and queries may change
+             * the answers the peer would give to our cached queries */
+            g_mutex_lock (&comm->mutex);
+            gst_ipc_pipeline_comm_invalidate_query_cache (comm);
+            g_mutex_unlock (&comm->mutex);
+            /* fall through */
+          case GST_IPC_PIPELINE_COMM_DATA_TYPE_ACK:
+          case GST_IPC_PIPELINE_COMM_DATA_TYPE_QUERY_RESULT:
+          case GST_IPC_PIPELINE_COMM_DATA_TYPE_BUFFER:
+          case GST_IPC_PIPELINE_COMM_DATA_TYPE_QUERY:
             GST_TRACE_OBJECT (comm->element, "switching to state %s",
                 gst_ipc_pipeline_comm_data_type_get_name (type));
             comm->state = type;
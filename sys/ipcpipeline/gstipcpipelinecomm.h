@@ -61,6 +61,7 @@ typedef struct
   int fdin;
   int fdout;
   GHashTable *waiting_ids;
+  GHashTable *query_cache;
 
   GThread *reader_thread;
   GstPoll *poll;
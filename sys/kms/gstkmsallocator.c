@@ -611,12 +611,23 @@ export_fd_failed:
   }
 }
 
+static GQuark
+gst_kms_memory_quark (void)
+{
+  static GQuark quark = 0;
+
+  if (!quark)
+    quark = g_quark_from_static_string ("kmsmem");
+
+  return quark;
+}
+
 /* FIXME, using gdata for caching on upstream memory is not tee safe */
 GstMemory *
 gst_kms_allocator_get_cached (GstMemory * mem)
 {
   return gst_mini_object_get_qdata (GST_MINI_OBJECT (mem),
-      g_quark_from_static_string ("kmsmem"));
+      gst_kms_memory_quark ());
 }
 
 static void
@@ -640,8 +651,7 @@ gst_kms_allocator_clear_cache (GstAllocator * allocator)
     GstMiniObject *obj = iter->data;
     gst_mini_object_weak_unref (obj,
         (GstMiniObjectNotify) cached_kmsmem_disposed_cb, alloc);
-    gst_mini_object_set_qdata (obj,
-        g_quark_from_static_string ("kmsmem"), NULL, NULL);
+    gst_mini_object_set_qdata (obj, gst_kms_memory_quark (), NULL, NULL);
     iter = iter->next;
   }
 
@@ -665,6 +675,5 @@ gst_kms_allocator_cache (GstAllocator * allocator, GstMemory * mem,
   GST_OBJECT_UNLOCK (alloc);
 
   gst_mini_object_set_qdata (GST_MINI_OBJECT (mem),
-      g_quark_from_static_string ("kmsmem"), kmsmem,
-      (GDestroyNotify) gst_memory_unref);
+      gst_kms_memory_quark (), kmsmem, (GDestroyNotify) gst_memory_unref);
 }
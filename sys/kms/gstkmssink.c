@@ -56,6 +56,9 @@
 #include <xf86drmMode.h>
 #include <drm_fourcc.h>
 
+#include <poll.h>
+#include <unistd.h>
+
 #include "gstkmssink.h"
 #include "gstkmsutils.h"
 #include "gstkmsbufferpool.h"
@@ -690,6 +693,169 @@ gst_kms_sink_update_plane_properties (GstKMSSink * self)
   gst_kms_sink_update_properties (&iter, self->plane_props);
 }
 
+static guint32
+find_drm_property_id (gint fd, guint32 object, guint32 object_type,
+    const gchar * prop_name)
+{
+  drmModeObjectPropertiesPtr properties;
+  guint32 prop_id = 0;
+  guint i;
+
+  properties = drmModeObjectGetProperties (fd, object, object_type);
+  if (!properties)
+    return 0;
+
+  for (i = 0; i < properties->count_props && !prop_id; i++) {
+    drmModePropertyPtr property;
+
+    property = drmModeGetProperty (fd, properties->props[i]);
+    if (!strcmp (property->name, prop_name))
+      prop_id = property->prop_id;
+    drmModeFreeProperty (property);
+  }
+  drmModeFreeObjectProperties (properties);
+
+  return prop_id;
+}
+
+static void
+gst_kms_sink_setup_atomic (GstKMSSink * self)
+{
+  self->has_atomic = FALSE;
+
+  /* the modesetting path flips with drmModePageFlip; don't mix legacy
+   * flips and atomic commits on the same crtc */
+  if (self->modesetting_enabled)
+    return;
+
+  if (drmSetClientCap (self->fd, DRM_CLIENT_CAP_ATOMIC, 1)) {
+    GST_DEBUG_OBJECT (self, "driver does not support atomic modesetting");
+    return;
+  }
+
+  self->plane_prop_fb_id = find_drm_property_id (self->fd, self->plane_id,
+      DRM_MODE_OBJECT_PLANE, "FB_ID");
+  self->plane_prop_crtc_id = find_drm_property_id (self->fd, self->plane_id,
+      DRM_MODE_OBJECT_PLANE, "CRTC_ID");
+  self->plane_prop_src_x = find_drm_property_id (self->fd, self->plane_id,
+      DRM_MODE_OBJECT_PLANE, "SRC_X");
+  self->plane_prop_src_y = find_drm_property_id (self->fd, self->plane_id,
+      DRM_MODE_OBJECT_PLANE, "SRC_Y");
+  self->plane_prop_src_w = find_drm_property_id (self->fd, self->plane_id,
+      DRM_MODE_OBJECT_PLANE, "SRC_W");
+  self->plane_prop_src_h = find_drm_property_id (self->fd, self->plane_id,
+      DRM_MODE_OBJECT_PLANE, "SRC_H");
+  self->plane_prop_crtc_x = find_drm_property_id (self->fd, self->plane_id,
+      DRM_MODE_OBJECT_PLANE, "CRTC_X");
+  self->plane_prop_crtc_y = find_drm_property_id (self->fd, self->plane_id,
+      DRM_MODE_OBJECT_PLANE, "CRTC_Y");
+  self->plane_prop_crtc_w = find_drm_property_id (self->fd, self->plane_id,
+      DRM_MODE_OBJECT_PLANE, "CRTC_W");
+  self->plane_prop_crtc_h = find_drm_property_id (self->fd, self->plane_id,
+      DRM_MODE_OBJECT_PLANE, "CRTC_H");
+  /* optional, only attached when an upstream buffer carries an explicit
+   * fence */
+  self->plane_prop_in_fence_fd = find_drm_property_id (self->fd,
+      self->plane_id, DRM_MODE_OBJECT_PLANE, "IN_FENCE_FD");
+  self->crtc_prop_out_fence_ptr = find_drm_property_id (self->fd,
+      self->crtc_id, DRM_MODE_OBJECT_CRTC, "OUT_FENCE_PTR");
+
+  if (!self->plane_prop_fb_id || !self->plane_prop_crtc_id
+      || !self->plane_prop_src_x || !self->plane_prop_src_y
+      || !self->plane_prop_src_w || !self->plane_prop_src_h
+      || !self->plane_prop_crtc_x || !self->plane_prop_crtc_y
+      || !self->plane_prop_crtc_w || !self->plane_prop_crtc_h
+      || !self->crtc_prop_out_fence_ptr) {
+    GST_DEBUG_OBJECT (self,
+        "plane/crtc properties for atomic commits are missing");
+    return;
+  }
+
+  self->has_atomic = TRUE;
+  GST_INFO_OBJECT (self, "using atomic commits with explicit fences");
+}
+
+/* wait until the atomic commit currently in flight has latched, which also
+ * means the buffer that was on the screen before it is no longer scanned
+ * out */
+static void
+gst_kms_sink_wait_commit_fence (GstKMSSink * self)
+{
+  struct pollfd pfd;
+  gint ret;
+
+  if (self->commit_fence_fd < 0)
+    return;
+
+  pfd.fd = self->commit_fence_fd;
+  pfd.events = POLLIN;
+  do {
+    ret = poll (&pfd, 1, 3000);
+  } while (ret == -1 && (errno == EAGAIN || errno == EINTR));
+
+  if (ret <= 0)
+    GST_WARNING_OBJECT (self, "timeout waiting for commit out-fence");
+
+  close (self->commit_fence_fd);
+  self->commit_fence_fd = -1;
+
+  gst_buffer_replace (&self->scanout_buffer, NULL);
+}
+
+static gboolean
+gst_kms_sink_atomic_commit (GstKMSSink * self, guint32 fb_id,
+    const GstVideoRectangle * src, const GstVideoRectangle * result)
+{
+  drmModeAtomicReq *req;
+  gint out_fence = -1;
+  gint ret;
+
+  /* double buffering: let the previous commit latch before queueing the
+   * next one; the kernel refuses concurrent non-blocking commits anyway */
+  gst_kms_sink_wait_commit_fence (self);
+
+  req = drmModeAtomicAlloc ();
+  if (!req)
+    return FALSE;
+
+  drmModeAtomicAddProperty (req, self->plane_id, self->plane_prop_fb_id,
+      fb_id);
+  drmModeAtomicAddProperty (req, self->plane_id, self->plane_prop_crtc_id,
+      self->crtc_id);
+  /* source/cropping coordinates are given in Q16 */
+  drmModeAtomicAddProperty (req, self->plane_id, self->plane_prop_src_x,
+      (guint64) src->x << 16);
+  drmModeAtomicAddProperty (req, self->plane_id, self->plane_prop_src_y,
+      (guint64) src->y << 16);
+  drmModeAtomicAddProperty (req, self->plane_id, self->plane_prop_src_w,
+      (guint64) src->w << 16);
+  drmModeAtomicAddProperty (req, self->plane_id, self->plane_prop_src_h,
+      (guint64) src->h << 16);
+  drmModeAtomicAddProperty (req, self->plane_id, self->plane_prop_crtc_x,
+      result->x);
+  drmModeAtomicAddProperty (req, self->plane_id, self->plane_prop_crtc_y,
+      result->y);
+  drmModeAtomicAddProperty (req, self->plane_id, self->plane_prop_crtc_w,
+      result->w);
+  drmModeAtomicAddProperty (req, self->plane_id, self->plane_prop_crtc_h,
+      result->h);
+  drmModeAtomicAddProperty (req, self->crtc_id, self->crtc_prop_out_fence_ptr,
+      (guint64) (guintptr) & out_fence);
+
+  ret = drmModeAtomicCommit (self->fd, req, DRM_MODE_ATOMIC_NONBLOCK, NULL);
+  drmModeAtomicFree (req);
+
+  if (ret) {
+    GST_WARNING_OBJECT (self, "atomic commit failed: %s (%d)",
+        g_strerror (errno), errno);
+    return FALSE;
+  }
+
+  self->commit_fence_fd = out_fence;
+
+  return TRUE;
+}
+
 static gboolean
 gst_kms_sink_start (GstBaseSink * bsink)
 {
@@ -773,6 +939,8 @@ retry_find_plane:
   GST_INFO_OBJECT (self, "connector id = %d / crtc id = %d / plane id = %d",
       self->conn_id, self->crtc_id, self->plane_id);
 
+  gst_kms_sink_setup_atomic (self);
+
   GST_OBJECT_LOCK (self);
   self->hdisplay = crtc->mode.hdisplay;
   self->vdisplay = crtc->mode.vdisplay;
@@ -904,6 +1072,9 @@ gst_kms_sink_stop (GstBaseSink * bsink)
   if (self->allocator)
     gst_kms_allocator_clear_cache (self->allocator);
 
+  /* let the last atomic commit latch before its buffers go away */
+  gst_kms_sink_wait_commit_fence (self);
+  gst_buffer_replace (&self->scanout_buffer, NULL);
   gst_buffer_replace (&self->last_buffer, NULL);
   gst_caps_replace (&self->allowed_caps, NULL);
   gst_object_replace ((GstObject **) & self->pool, NULL);
@@ -1540,6 +1711,7 @@ gst_kms_sink_show_frame (GstVideoSink * vsink, GstBuffer * buf)
   GstVideoRectangle dst = { 0, };
   GstVideoRectangle result;
   GstFlowReturn res;
+  gboolean atomic_committed = FALSE;
 
   self = GST_KMS_SINK (vsink);
 
@@ -1617,6 +1789,20 @@ retry_set_plane:
     src.h = result.h;
   }
 
+  if (self->has_atomic) {
+    GST_TRACE_OBJECT (self,
+        "atomic commit at (%i,%i) %ix%i sourcing at (%i,%i) %ix%i",
+        result.x, result.y, result.w, result.h, src.x, src.y, src.w, src.h);
+
+    if (gst_kms_sink_atomic_commit (self, fb_id, &src, &result)) {
+      atomic_committed = TRUE;
+      goto sync_frame;
+    }
+
+    /* fall back to the legacy path for this and all subsequent frames */
+    self->has_atomic = FALSE;
+  }
+
   GST_TRACE_OBJECT (self,
       "drmModeSetPlane at (%i,%i) %ix%i sourcing at (%i,%i) %ix%i",
       result.x, result.y, result.w, result.h, src.x, src.y, src.w, src.h);
@@ -1635,7 +1821,12 @@ retry_set_plane:
 
 sync_frame:
   /* Wait for the previous frame to complete redraw */
-  if (!gst_kms_sink_sync (self)) {
+  if (atomic_committed) {
+    /* the out-fence does the pacing on the next commit instead; just keep
+     * the buffer that may still be on the screen alive until the commit we
+     * queued has latched */
+    gst_buffer_replace (&self->scanout_buffer, self->last_buffer);
+  } else if (!gst_kms_sink_sync (self)) {
     GST_OBJECT_UNLOCK (self);
     goto bail;
   }
@@ -1852,6 +2043,7 @@ gst_kms_sink_init (GstKMSSink * sink)
   sink->conn_id = -1;
   sink->plane_id = -1;
   sink->can_scale = TRUE;
+  sink->commit_fence_fd = -1;
   gst_poll_fd_init (&sink->pollfd);
   sink->poll = gst_poll_new (TRUE);
   gst_video_info_init (&sink->vinfo);
@@ -69,6 +69,23 @@ struct _GstKMSSink {
   GstStructure *connector_props;
   GstStructure *plane_props;
 
+  /* atomic modesetting */
+  gboolean has_atomic;
+  guint32 plane_prop_fb_id;
+  guint32 plane_prop_crtc_id;
+  guint32 plane_prop_src_x;
+  guint32 plane_prop_src_y;
+  guint32 plane_prop_src_w;
+  guint32 plane_prop_src_h;
+  guint32 plane_prop_crtc_x;
+  guint32 plane_prop_crtc_y;
+  guint32 plane_prop_crtc_w;
+  guint32 plane_prop_crtc_h;
+  guint32 plane_prop_in_fence_fd;
+  guint32 crtc_prop_out_fence_ptr;
+  gint commit_fence_fd;
+  GstBuffer *scanout_buffer;
+
   GstVideoInfo vinfo;
   GstCaps *allowed_caps;
   GstBufferPool *pool;
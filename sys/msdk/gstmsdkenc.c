@@ -458,6 +458,12 @@ gst_msdkenc_init_encoder (GstMsdkEnc * thiz)
     request[0].NumFrameSuggested += thiz->num_vpp_surfaces + 1 - 4;
 
   if (thiz->use_video_memory) {
+    /* with a shared context, surfaces from this pool may also be held by
+     * neighbouring msdk elements while their async operations are in
+     * flight; account for their async depth like the decoder and the VPP
+     * path above already do */
+    request[0].NumFrameSuggested +=
+        gst_msdk_context_get_shared_async_depth (thiz->context);
     if (thiz->use_dmabuf && !thiz->has_vpp)
       request[0].Type |= MFX_MEMTYPE_EXPORT_FRAME;
     gst_msdk_frame_alloc (thiz->context, &(request[0]), &thiz->alloc_resp);
@@ -650,6 +650,7 @@ handle_pending_frames (GstNvDec * nvdec)
   CUgraphicsResource *resources;
   gpointer args[4];
   GstMemory *mem;
+  GList *ready_frames = NULL;
   GstFlowReturn ret = GST_FLOW_OK;
 
   /* find the oldest unused, unfinished frame */
@@ -918,10 +919,12 @@ handle_pending_frames (GstNvDec * nvdec)
           }
         }
 
+        /* don't push downstream yet; if the sink is slow, pushing here
+         * would leave later pictures sitting in the decoder's display
+         * queue with their decode surfaces occupied, stalling NVDEC.
+         * Copy everything out of the decoder first and push afterwards. */
         list = g_list_remove (list, pending_frame);
-        ret = gst_video_decoder_finish_frame (decoder, pending_frame);
-        if (ret != GST_FLOW_OK)
-          GST_INFO_OBJECT (nvdec, "failed to finish frame");
+        ready_frames = g_list_append (ready_frames, pending_frame);
 
         break;
 
@@ -933,6 +936,19 @@ handle_pending_frames (GstNvDec * nvdec)
     g_slice_free (GstNvDecQueueItem, item);
   }
 
+  while (ready_frames) {
+    GstFlowReturn finish_ret;
+
+    pending_frame = ready_frames->data;
+    finish_ret = gst_video_decoder_finish_frame (decoder, pending_frame);
+    if (finish_ret != GST_FLOW_OK) {
+      GST_INFO_OBJECT (nvdec, "failed to finish frame");
+      if (ret == GST_FLOW_OK)
+        ret = finish_ret;
+    }
+    ready_frames = g_list_delete_link (ready_frames, ready_frames);
+  }
+
   g_list_free_full (list, (GDestroyNotify) gst_video_codec_frame_unref);
 
   return ret;
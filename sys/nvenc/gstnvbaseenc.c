@@ -153,6 +153,7 @@ enum
   PROP_QP_MAX,
   PROP_QP_CONST,
   PROP_GOP_SIZE,
+  PROP_DEVICE_SESSIONS,
 };
 
 #define DEFAULT_PRESET GST_NV_PRESET_DEFAULT
@@ -287,6 +288,11 @@ gst_nv_base_enc_class_init (GstNvBaseEncClass * klass)
           DEFAULT_BITRATE,
           G_PARAM_READWRITE | GST_PARAM_MUTABLE_PLAYING |
           G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_DEVICE_SESSIONS,
+      g_param_spec_uint ("device-sessions", "Device Sessions",
+          "Number of encode sessions currently sharing this device's "
+          "CUDA context (0 = encoder not opened)",
+          0, G_MAXUINT, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 }
 
 static gboolean
@@ -401,7 +407,7 @@ gst_nv_base_enc_open (GstVideoEncoder * enc)
 {
   GstNvBaseEnc *nvenc = GST_NV_BASE_ENC (enc);
 
-  nvenc->cuda_ctx = gst_nvenc_create_cuda_context (nvenc->cuda_device_id);
+  nvenc->cuda_ctx = gst_nvenc_acquire_cuda_context (nvenc->cuda_device_id);
   if (nvenc->cuda_ctx == NULL) {
     GST_ELEMENT_ERROR (enc, LIBRARY, INIT, (NULL),
         ("Failed to create CUDA context, perhaps CUDA is not supported."));
@@ -419,7 +425,7 @@ gst_nv_base_enc_open (GstVideoEncoder * enc)
     nv_ret = NvEncOpenEncodeSessionEx (&params, &nvenc->encoder);
     if (nv_ret != NV_ENC_SUCCESS) {
       GST_ERROR ("Failed to create NVENC encoder session, ret=%d", nv_ret);
-      if (gst_nvenc_destroy_cuda_context (nvenc->cuda_ctx))
+      if (gst_nvenc_release_cuda_context (nvenc->cuda_ctx))
         nvenc->cuda_ctx = NULL;
       return FALSE;
     }
@@ -632,7 +638,7 @@ gst_nv_base_enc_close (GstVideoEncoder * enc)
   }
 
   if (nvenc->cuda_ctx) {
-    if (!gst_nvenc_destroy_cuda_context (nvenc->cuda_ctx))
+    if (!gst_nvenc_release_cuda_context (nvenc->cuda_ctx))
       return FALSE;
     nvenc->cuda_ctx = NULL;
   }
@@ -1502,6 +1508,72 @@ struct map_gl_input
   struct gl_input_resource *in_gl_resource;
 };
 
+/* cuda registration of an upstream GL PBO, cached on the GstMemory with
+ * qdata so that each buffer of a pool is only registered once; registering
+ * a GL buffer with cuda is far more expensive than mapping it.  Holds a
+ * reference on the shared per-device cuda context so unregistration at
+ * memory-destroy time always has a live context to run in. */
+struct cached_gl_registration
+{
+  CUcontext cuda_ctx;
+  CUgraphicsResource resource;
+};
+
+static GQuark
+_cuda_gl_registration_quark (void)
+{
+  static GQuark quark = 0;
+
+  if (!quark)
+    quark = g_quark_from_static_string ("GstNvBaseEncCudaGLRegistration");
+
+  return quark;
+}
+
+static void
+_free_cached_gl_registration (struct cached_gl_registration *reg)
+{
+  CUcontext old_ctx;
+
+  cuCtxPushCurrent (reg->cuda_ctx);
+  cuGraphicsUnregisterResource (reg->resource);
+  cuCtxPopCurrent (&old_ctx);
+  gst_nvenc_release_cuda_context (reg->cuda_ctx);
+
+  g_free (reg);
+}
+
+/* with the GL context current and nvenc->cuda_ctx pushed */
+static CUgraphicsResource
+_get_cached_gl_registration (GstNvBaseEnc * nvenc, GstGLBuffer * gl_buf_obj,
+    GstMemory * mem)
+{
+  struct cached_gl_registration *reg;
+  cudaError_t cuda_ret;
+
+  reg = gst_mini_object_get_qdata (GST_MINI_OBJECT_CAST (mem),
+      _cuda_gl_registration_quark ());
+  if (reg)
+    return reg->resource;
+
+  reg = g_new0 (struct cached_gl_registration, 1);
+  reg->cuda_ctx = gst_nvenc_acquire_cuda_context (nvenc->cuda_device_id);
+
+  cuda_ret = cuGraphicsGLRegisterBuffer (&reg->resource, gl_buf_obj->id,
+      cudaGraphicsRegisterFlagsReadOnly);
+  if (cuda_ret != cudaSuccess) {
+    gst_nvenc_release_cuda_context (reg->cuda_ctx);
+    g_free (reg);
+    return NULL;
+  }
+
+  gst_mini_object_set_qdata (GST_MINI_OBJECT_CAST (mem),
+      _cuda_gl_registration_quark (), reg,
+      (GDestroyNotify) _free_cached_gl_registration);
+
+  return reg->resource;
+}
+
 static void
 _map_gl_input_buffer (GstGLContext * context, struct map_gl_input *data)
 {
@@ -1535,12 +1607,12 @@ _map_gl_input_buffer (GstGLContext * context, struct map_gl_input *data)
     GST_LOG_OBJECT (data->nvenc, "attempting to copy texture %u into cuda",
         gl_mem->mem.tex_id);
 
-    cuda_ret =
-        cuGraphicsGLRegisterBuffer (&data->in_gl_resource->cuda_texture,
-        gl_buf_obj->id, cudaGraphicsRegisterFlagsReadOnly);
-    if (cuda_ret != cudaSuccess) {
-      GST_ERROR_OBJECT (data->nvenc, "failed to register GL texture %u to cuda "
-          "ret :%d", gl_mem->mem.tex_id, cuda_ret);
+    data->in_gl_resource->cuda_texture =
+        _get_cached_gl_registration (data->nvenc, gl_buf_obj,
+        (GstMemory *) gl_mem);
+    if (data->in_gl_resource->cuda_texture == NULL) {
+      GST_ERROR_OBJECT (data->nvenc, "failed to register GL texture %u to cuda",
+          gl_mem->mem.tex_id);
       g_assert_not_reached ();
     }
 
@@ -1595,13 +1667,8 @@ _map_gl_input_buffer (GstGLContext * context, struct map_gl_input *data)
       g_assert_not_reached ();
     }
 
-    cuda_ret =
-        cuGraphicsUnregisterResource (data->in_gl_resource->cuda_texture);
-    if (cuda_ret != cudaSuccess) {
-      GST_ERROR_OBJECT (data->nvenc, "failed to unregister GL texture %u from "
-          "cuda ret :%d", gl_mem->mem.tex_id, cuda_ret);
-      g_assert_not_reached ();
-    }
+    /* the registration stays cached on the GstMemory and is released when
+     * the upstream pool destroys the buffer */
 
     data_pointer =
         data_pointer +
@@ -2076,6 +2143,10 @@ gst_nv_base_enc_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_GOP_SIZE:
       g_value_set_int (value, nvenc->gop_size);
       break;
+    case PROP_DEVICE_SESSIONS:
+      g_value_set_uint (value, nvenc->cuda_ctx ?
+          gst_nvenc_cuda_context_n_users (nvenc->cuda_ctx) : 0);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
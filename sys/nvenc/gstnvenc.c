@@ -342,6 +342,106 @@ gst_nvenc_destroy_cuda_context (CUcontext ctx)
   return (cuCtxDestroy (ctx) == CUDA_SUCCESS);
 }
 
+/* Pool of shared per-device CUDA contexts.  Every encode session on the
+ * same GPU uses the same context, so the driver never has to switch
+ * contexts between submissions from different encoder elements. */
+typedef struct
+{
+  guint device_id;
+  CUcontext ctx;
+  guint ref_count;
+} GstNvEncCudaContext;
+
+static GMutex context_pool_lock;
+static GList *context_pool;
+
+CUcontext
+gst_nvenc_acquire_cuda_context (guint device_id)
+{
+  GstNvEncCudaContext *shared = NULL;
+  GList *l;
+
+  g_mutex_lock (&context_pool_lock);
+  for (l = context_pool; l; l = g_list_next (l)) {
+    GstNvEncCudaContext *c = l->data;
+
+    if (c->device_id == device_id) {
+      shared = c;
+      break;
+    }
+  }
+
+  if (!shared) {
+    CUcontext ctx = gst_nvenc_create_cuda_context (device_id);
+
+    if (ctx == NULL) {
+      g_mutex_unlock (&context_pool_lock);
+      return NULL;
+    }
+
+    shared = g_new0 (GstNvEncCudaContext, 1);
+    shared->device_id = device_id;
+    shared->ctx = ctx;
+    context_pool = g_list_prepend (context_pool, shared);
+  }
+
+  shared->ref_count++;
+  GST_INFO ("CUDA context %p for device %u now has %u user(s)", shared->ctx,
+      device_id, shared->ref_count);
+  g_mutex_unlock (&context_pool_lock);
+
+  return shared->ctx;
+}
+
+gboolean
+gst_nvenc_release_cuda_context (CUcontext ctx)
+{
+  GList *l;
+
+  g_mutex_lock (&context_pool_lock);
+  for (l = context_pool; l; l = g_list_next (l)) {
+    GstNvEncCudaContext *c = l->data;
+
+    if (c->ctx == ctx) {
+      gboolean ret = TRUE;
+
+      GST_INFO ("CUDA context %p for device %u now has %u user(s)", c->ctx,
+          c->device_id, c->ref_count - 1);
+      if (--c->ref_count == 0) {
+        context_pool = g_list_delete_link (context_pool, l);
+        ret = gst_nvenc_destroy_cuda_context (c->ctx);
+        g_free (c);
+      }
+      g_mutex_unlock (&context_pool_lock);
+      return ret;
+    }
+  }
+  g_mutex_unlock (&context_pool_lock);
+
+  GST_WARNING ("CUDA context %p was not acquired from the context pool", ctx);
+  return gst_nvenc_destroy_cuda_context (ctx);
+}
+
+guint
+gst_nvenc_cuda_context_n_users (CUcontext ctx)
+{
+  guint n = 0;
+  GList *l;
+
+  g_mutex_lock (&context_pool_lock);
+  for (l = context_pool; l; l = g_list_next (l)) {
+    GstNvEncCudaContext *c = l->data;
+
+    if (c->ctx == ctx) {
+      n = c->ref_count;
+      break;
+    }
+  }
+  g_mutex_unlock (&context_pool_lock);
+
+  return n;
+}
+
 static gboolean
 load_nvenc_library (void)
 {
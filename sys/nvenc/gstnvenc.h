@@ -32,6 +32,12 @@ CUcontext               gst_nvenc_create_cuda_context (guint device_id);
 
 gboolean                gst_nvenc_destroy_cuda_context (CUcontext ctx);
 
+CUcontext               gst_nvenc_acquire_cuda_context (guint device_id);
+
+gboolean                gst_nvenc_release_cuda_context (CUcontext ctx);
+
+guint                   gst_nvenc_cuda_context_n_users (CUcontext ctx);
+
 gboolean                gst_nvenc_cmp_guid (GUID g1, GUID g2);
 
 NV_ENC_BUFFER_FORMAT    gst_nvenc_get_nv_buffer_format (GstVideoFormat fmt);
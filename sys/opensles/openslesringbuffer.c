@@ -382,14 +382,15 @@ _opensles_player_acquire (GstAudioRingBuffer * rb,
 
   /* Configure audio source
    * 4 buffers is the "typical" size as optimized inside Android's
-   * OpenSL ES, see frameworks/wilhelm/src/itfstruct.h BUFFER_HEADER_TYPICAL
+   * OpenSL ES, see frameworks/wilhelm/src/itfstruct.h BUFFER_HEADER_TYPICAL,
+   * but a deeper queue can be requested to ride out scheduler jitter.
    *
    * Also only use half of our segment size to make sure that there's always
    * some more queued up in our ringbuffer and we don't start to read silence.
    */
   SLDataLocator_AndroidSimpleBufferQueue loc_bufq = {
-    SL_DATALOCATOR_ANDROIDSIMPLEBUFFERQUEUE, MIN (4, MAX (spec->segtotal >> 1,
-            1))
+    SL_DATALOCATOR_ANDROIDSIMPLEBUFFERQUEUE,
+    MIN (thiz->queue_depth, MAX (spec->segtotal >> 1, 1))
   };
   SLDataSource audioSrc = { &loc_bufq, &format };
 
@@ -542,6 +543,7 @@ _opensles_player_cb (SLAndroidSimpleBufferQueueItf bufferQueue, void *context)
   /* Get a segment form the GStreamer ringbuffer to read some samples */
   if (!gst_audio_ring_buffer_prepare_read (rb, &seg, &ptr, &len)) {
     GST_WARNING_OBJECT (rb, "No segment available");
+    g_atomic_int_inc (&thiz->underruns);
     return;
   }
 
@@ -1069,5 +1071,6 @@ gst_opensles_ringbuffer_init (GstOpenSLESRingBuffer * thiz)
   thiz->outputMixObject = NULL;
   thiz->playerObject = NULL;
   thiz->recorderObject = NULL;
+  thiz->queue_depth = 4;
   thiz->is_queue_callback_registered = FALSE;
 }
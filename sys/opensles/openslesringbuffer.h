@@ -90,11 +90,13 @@ struct _GstOpenSLESRingBuffer
 
   /* buffer queue */
   SLAndroidSimpleBufferQueueItf bufferQueue;
+  guint queue_depth;
   guint data_segtotal;
   guint8 * data;
   guint data_size;
   guint cursor;
   gint segqueued; /* ATOMIC */
+  gint underruns; /* ATOMIC */
   gboolean is_queue_callback_registered;
 
   /* vmethods */
@@ -47,6 +47,8 @@ enum
   PROP_VOLUME,
   PROP_MUTE,
   PROP_STREAM_TYPE,
+  PROP_QUEUE_DEPTH,
+  PROP_UNDERRUNS,
   PROP_LAST
 };
 
@@ -54,6 +56,7 @@ enum
 #define DEFAULT_MUTE   FALSE
 
 #define DEFAULT_STREAM_TYPE GST_OPENSLES_STREAM_TYPE_NONE
+#define DEFAULT_QUEUE_DEPTH 4
 
 
 /* According to Android's NDK doc the following are the supported rates */
@@ -89,6 +92,7 @@ gst_opensles_sink_create_ringbuffer (GstAudioBaseSink * base)
   gst_opensles_ringbuffer_set_mute (rb, sink->mute);
 
   GST_OPENSLES_RING_BUFFER (rb)->stream_type = sink->stream_type;
+  GST_OPENSLES_RING_BUFFER (rb)->queue_depth = sink->queue_depth;
 
   return rb;
 }
@@ -216,6 +220,9 @@ gst_opensles_sink_set_property (GObject * object, guint prop_id,
     case PROP_STREAM_TYPE:
       sink->stream_type = g_value_get_enum (value);
       break;
+    case PROP_QUEUE_DEPTH:
+      sink->queue_depth = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -227,6 +234,8 @@ gst_opensles_sink_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec)
 {
   GstOpenSLESSink *sink = GST_OPENSLES_SINK (object);
+  GstAudioRingBuffer *rb = GST_AUDIO_BASE_SINK (sink)->ringbuffer;
+
   switch (prop_id) {
     case PROP_VOLUME:
       g_value_set_double (value, sink->volume);
@@ -237,6 +246,17 @@ gst_opensles_sink_get_property (GObject * object, guint prop_id,
     case PROP_STREAM_TYPE:
       g_value_set_enum (value, sink->stream_type);
       break;
+    case PROP_QUEUE_DEPTH:
+      g_value_set_uint (value, sink->queue_depth);
+      break;
+    case PROP_UNDERRUNS:
+      if (rb && GST_IS_OPENSLES_RING_BUFFER (rb)) {
+        g_value_set_uint (value,
+            g_atomic_int_get (&GST_OPENSLES_RING_BUFFER (rb)->underruns));
+      } else {
+        g_value_set_uint (value, 0);
+      }
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -271,6 +291,33 @@ gst_opensles_sink_class_init (GstOpenSLESSinkClass * klass)
           GST_TYPE_OPENSLES_STREAM_TYPE, DEFAULT_STREAM_TYPE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstOpenSLESSink:queue-depth:
+   *
+   * Number of buffers in the OpenSL ES buffer queue. Larger values survive
+   * more scheduler jitter at the cost of additional latency. Only takes
+   * effect when the device is (re)opened.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_QUEUE_DEPTH,
+      g_param_spec_uint ("queue-depth", "Queue depth",
+          "Number of buffers in the OpenSL ES buffer queue", 2, 16,
+          DEFAULT_QUEUE_DEPTH, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstOpenSLESSink:underruns:
+   *
+   * Number of times the OpenSL ES callback found no segment ready in the
+   * ringbuffer and had to skip a refill.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class, PROP_UNDERRUNS,
+      g_param_spec_uint ("underruns", "Underruns",
+          "Number of times the buffer queue could not be refilled in time",
+          0, G_MAXUINT, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_add_static_pad_template (gstelement_class, &sink_factory);
 
   gst_element_class_set_static_metadata (gstelement_class, "OpenSL ES Sink",
@@ -288,6 +335,7 @@ gst_opensles_sink_init (GstOpenSLESSink * sink)
   sink->stream_type = DEFAULT_STREAM_TYPE;
   sink->volume = DEFAULT_VOLUME;
   sink->mute = DEFAULT_MUTE;
+  sink->queue_depth = DEFAULT_QUEUE_DEPTH;
 
   _opensles_query_capabilities (sink);
 
@@ -44,6 +44,7 @@ struct _GstOpenSLESSink
 
   gfloat volume;
   gboolean mute;
+  guint queue_depth;
 };
 
 struct _GstOpenSLESSinkClass
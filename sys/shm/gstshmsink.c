@@ -908,22 +908,29 @@ pollthread_func (gpointer data)
 
       if (gst_poll_fd_can_read (self->poll, &gclient->pollfd)) {
         int rv;
-        gpointer tag = NULL;
+        gpointer tag;
 
-        GST_OBJECT_LOCK (self);
-        rv = sp_writer_recv (self->pipe, gclient->client, &tag);
-        GST_OBJECT_UNLOCK (self);
+        /* drain all the commands that arrived in one burst before going
+         * back to poll, a busy client acking many buffers costs a single
+         * recv() this way */
+        do {
+          tag = NULL;
 
-        if (rv < 0) {
-          GST_WARNING_OBJECT (self, "One client has read error,"
-              " closing (retval: %d errno: %d)", rv, errno);
-          goto close_client;
-        }
+          GST_OBJECT_LOCK (self);
+          rv = sp_writer_recv (self->pipe, gclient->client, &tag);
+          GST_OBJECT_UNLOCK (self);
+
+          if (rv < 0) {
+            GST_WARNING_OBJECT (self, "One client has read error,"
+                " closing (retval: %d errno: %d)", rv, errno);
+            goto close_client;
+          }
 
-        g_assert (rv == 0 || tag == NULL);
+          g_assert (rv == 0 || tag == NULL);
 
-        if (rv == 0)
-          gst_buffer_unref (tag);
+          if (rv == 0)
+            gst_buffer_unref (tag);
+        } while (sp_writer_client_pending_commands (gclient->client));
       }
       continue;
     close_client:
@@ -147,6 +147,11 @@ struct _ShmClient
 {
   int fd;
 
+  /* collects a burst of commands from the client in one recv() so that
+   * each of them does not cost its own poll()/recv() round-trip */
+  char recvbuf[512];
+  size_t recvbuf_len;
+
   ShmClient *next;
 };
 
@@ -715,13 +720,43 @@ sp_client_recv (ShmPipe * self, char **buf)
   return 0;
 }
 
+static int
+recv_command_buffered (ShmClient * client, struct CommandBuffer *cb)
+{
+  if (client->recvbuf_len < sizeof (struct CommandBuffer)) {
+    int retval;
+
+    retval = recv (client->fd, client->recvbuf + client->recvbuf_len,
+        sizeof (client->recvbuf) - client->recvbuf_len, MSG_DONTWAIT);
+    if (retval <= 0)
+      return 0;
+    client->recvbuf_len += retval;
+
+    if (client->recvbuf_len < sizeof (struct CommandBuffer))
+      return 0;
+  }
+
+  memcpy (cb, client->recvbuf, sizeof (struct CommandBuffer));
+  client->recvbuf_len -= sizeof (struct CommandBuffer);
+  memmove (client->recvbuf, client->recvbuf + sizeof (struct CommandBuffer),
+      client->recvbuf_len);
+
+  return 1;
+}
+
+int
+sp_writer_client_pending_commands (ShmClient * client)
+{
+  return (client->recvbuf_len >= sizeof (struct CommandBuffer));
+}
+
 int
 sp_writer_recv (ShmPipe * self, ShmClient * client, void **tag)
 {
   ShmBuffer *buf = NULL, *prev_buf = NULL;
   struct CommandBuffer cb;
 
-  if (!recv_command (client->fd, &cb))
+  if (!recv_command_buffered (client, &cb))
     return -1;
 
   switch (cb.type) {
@@ -835,6 +870,7 @@ sp_writer_accept_client (ShmPipe * self)
 
   client = spalloc_new (ShmClient);
   client->fd = fd;
+  client->recvbuf_len = 0;
 
   /* Prepend ot linked list */
   client->next = self->clients;
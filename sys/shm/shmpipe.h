@@ -105,6 +105,7 @@ ShmClient * sp_writer_accept_client (ShmPipe * self);
 void sp_writer_close_client (ShmPipe *self, ShmClient * client,
     sp_buffer_free_callback callback, void * user_data);
 int sp_writer_recv (ShmPipe * self, ShmClient * client, void ** tag);
+int sp_writer_client_pending_commands (ShmClient * client);
 
 int sp_writer_pending_writes (ShmPipe * self);
 
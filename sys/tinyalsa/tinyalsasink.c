@@ -62,11 +62,15 @@ enum
   PROP_0,
   PROP_CARD,
   PROP_DEVICE,
+  PROP_USE_MMAP,
+  PROP_AVAIL_MIN,
   PROP_LAST
 };
 
 #define DEFAULT_CARD 0
 #define DEFAULT_DEVICE 0
+#define DEFAULT_USE_MMAP FALSE
+#define DEFAULT_AVAIL_MIN 0
 
 static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_SINK,
@@ -91,6 +95,14 @@ gst_tinyalsa_sink_get_property (GObject * object, guint prop_id,
       g_value_set_uint (value, sink->device);
       break;
 
+    case PROP_USE_MMAP:
+      g_value_set_boolean (value, sink->use_mmap);
+      break;
+
+    case PROP_AVAIL_MIN:
+      g_value_set_uint (value, sink->avail_min);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -112,6 +124,14 @@ gst_tinyalsa_sink_set_property (GObject * object, guint prop_id,
       sink->device = g_value_get_uint (value);
       break;
 
+    case PROP_USE_MMAP:
+      sink->use_mmap = g_value_get_boolean (value);
+      break;
+
+    case PROP_AVAIL_MIN:
+      sink->avail_min = g_value_get_uint (value);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -285,9 +305,16 @@ gst_tinyalsa_sink_prepare (GstAudioSink * asink, GstAudioRingBufferSpec * spec)
   struct pcm_params *params = NULL;
   int period_size_min, period_size_max;
   int periods_min, periods_max;
+  unsigned int flags = PCM_OUT | PCM_NORESTART;
 
   pcm_config_from_spec (&config, spec);
 
+  /* 0 leaves the tinyalsa default (one period) in place */
+  config.avail_min = sink->avail_min;
+
+  if (sink->use_mmap)
+    flags |= PCM_MMAP;
+
   GST_DEBUG_OBJECT (sink, "Requesting %u periods of %u frames",
       config.period_count, config.period_size);
 
@@ -310,8 +337,7 @@ gst_tinyalsa_sink_prepare (GstAudioSink * asink, GstAudioRingBufferSpec * spec)
   /* mutex with getcaps */
   GST_OBJECT_LOCK (sink);
 
-  sink->pcm = pcm_open (sink->card, sink->device, PCM_OUT | PCM_NORESTART,
-      &config);
+  sink->pcm = pcm_open (sink->card, sink->device, flags, &config);
 
   GST_OBJECT_UNLOCK (sink);
 
@@ -388,7 +414,10 @@ gst_tinyalsa_sink_write (GstAudioSink * asink, gpointer data, guint length)
 again:
   GST_DEBUG_OBJECT (sink, "Starting write");
 
-  ret = pcm_write (sink->pcm, data, length);
+  if (sink->use_mmap)
+    ret = pcm_mmap_write (sink->pcm, data, length);
+  else
+    ret = pcm_write (sink->pcm, data, length);
   if (ret == -EPIPE) {
     GST_WARNING_OBJECT (sink, "Got an underrun");
 
@@ -487,6 +516,37 @@ gst_tinyalsa_sink_class_init (GstTinyalsaSinkClass * klass)
           0, G_MAXUINT, DEFAULT_CARD,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTinyalsaSink:use-mmap:
+   *
+   * Use mmap access to the device instead of read/write transfers. Periods
+   * are copied straight into the kernel ring, which avoids the write
+   * syscall per period. Not all drivers support mmap access.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class,
+      PROP_USE_MMAP,
+      g_param_spec_boolean ("use-mmap", "Use mmap",
+          "Use mmap access to the device instead of read/write transfers",
+          DEFAULT_USE_MMAP, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTinyalsaSink:avail-min:
+   *
+   * Minimum number of frames that must be free in the device ring before a
+   * blocked write is woken up, in frames. 0 uses the device default of one
+   * period. Larger values batch wakeups at the cost of scheduling slack.
+   *
+   * Since: 1.18
+   */
+  g_object_class_install_property (gobject_class,
+      PROP_AVAIL_MIN,
+      g_param_spec_uint ("avail-min", "Avail min",
+          "Minimum available frames to wake up a blocked write "
+          "(0 = one period)", 0, G_MAXUINT, DEFAULT_AVAIL_MIN,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   GST_DEBUG_CATEGORY_INIT (tinyalsa_sink_debug, "tinyalsasink", 0,
       "tinyalsa Sink");
 }
@@ -496,6 +556,8 @@ gst_tinyalsa_sink_init (GstTinyalsaSink * sink)
 {
   sink->card = DEFAULT_CARD;
   sink->device = DEFAULT_DEVICE;
+  sink->use_mmap = DEFAULT_USE_MMAP;
+  sink->avail_min = DEFAULT_AVAIL_MIN;
 
   sink->cached_caps = NULL;
 }
@@ -43,6 +43,9 @@ struct _GstTinyalsaSink {
   int card;
   int device;
 
+  gboolean use_mmap;
+  guint avail_min;
+
   struct pcm *pcm;
 
   GstCaps *cached_caps; /* for queries made while the device is open */
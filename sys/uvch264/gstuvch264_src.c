@@ -625,6 +625,8 @@ gst_uvc_h264_src_set_property (GObject * object,
     case PROP_DEVICE:
       g_free (self->device);
       self->device = g_value_dup_string (value);
+      /* Cached PROBE negotiation is only valid for the previous device */
+      self->have_cached_probe = FALSE;
       if (self->v4l2_src)
         g_object_set_property (G_OBJECT (self->v4l2_src), "device", value);
       break;
@@ -2026,26 +2028,32 @@ configure_h264 (GstUvcH264Src * self, gint fd)
       return;
     }
   }
-  /* Print MIN/MAX/DEF probe values for debugging purposes */
-  if (!xu_query (self, UVCX_VIDEO_CONFIG_PROBE, UVC_GET_MIN,
-          (guchar *) & probe)) {
-    GST_WARNING_OBJECT (self, "PROBE GET_CUR error");
-    return;
-  }
-  GST_DEBUG_OBJECT (self, "PROBE GET_MIN : ");
-  print_probe_commit (self, &probe);
+  /* Print MIN/MAX probe values for debugging purposes. These are only
+   * informational, so don't waste USB control transactions on them unless
+   * someone is going to see the output */
+  if (gst_debug_category_get_threshold (GST_CAT_DEFAULT) >= GST_LEVEL_DEBUG) {
+    if (!xu_query (self, UVCX_VIDEO_CONFIG_PROBE, UVC_GET_MIN,
+            (guchar *) & probe)) {
+      GST_WARNING_OBJECT (self, "PROBE GET_MIN error");
+      return;
+    }
+    GST_DEBUG_OBJECT (self, "PROBE GET_MIN : ");
+    print_probe_commit (self, &probe);
 
-  if (!xu_query (self, UVCX_VIDEO_CONFIG_PROBE, UVC_GET_MAX,
-          (guchar *) & probe)) {
-    GST_WARNING_OBJECT (self, "PROBE GET_CUR error");
-    return;
+    if (!xu_query (self, UVCX_VIDEO_CONFIG_PROBE, UVC_GET_MAX,
+            (guchar *) & probe)) {
+      GST_WARNING_OBJECT (self, "PROBE GET_MAX error");
+      return;
+    }
+    GST_DEBUG_OBJECT (self, "PROBE GET_MAX : ");
+    print_probe_commit (self, &probe);
   }
-  GST_DEBUG_OBJECT (self, "PROBE GET_MAX : ");
-  print_probe_commit (self, &probe);
 
+  /* GET_DEF is the baseline for the fields that fill_probe_commit leaves
+   * untouched, so it cannot be skipped */
   if (!xu_query (self, UVCX_VIDEO_CONFIG_PROBE, UVC_GET_DEF,
           (guchar *) & probe)) {
-    GST_WARNING_OBJECT (self, "PROBE GET_CUR error");
+    GST_WARNING_OBJECT (self, "PROBE GET_DEF error");
     return;
   }
   GST_DEBUG_OBJECT (self, "PROBE GET_DEF : ");
@@ -2061,22 +2069,35 @@ configure_h264 (GstUvcH264Src * self, gint fd)
   probe.bmHints = UVC_H264_BMHINTS_RESOLUTION | UVC_H264_BMHINTS_PROFILE |
       UVC_H264_BMHINTS_FRAME_INTERVAL;
 
-  GST_DEBUG_OBJECT (self, "PROBE SET_CUR : ");
-  print_probe_commit (self, &probe);
+  /* If we already negotiated this exact configuration with the device,
+   * reuse the negotiated result and skip straight to the COMMIT */
+  if (self->have_cached_probe &&
+      memcmp (&probe, &self->cached_probe_req, sizeof (probe)) == 0) {
+    GST_DEBUG_OBJECT (self, "Reusing cached PROBE negotiation result");
+    probe = self->cached_probe_result;
+  } else {
+    self->cached_probe_req = probe;
 
-  if (!xu_query (self, UVCX_VIDEO_CONFIG_PROBE, UVC_SET_CUR,
-          (guchar *) & probe)) {
-    GST_WARNING_OBJECT (self, "PROBE SET_CUR error");
-    return;
-  }
+    GST_DEBUG_OBJECT (self, "PROBE SET_CUR : ");
+    print_probe_commit (self, &probe);
 
-  if (!xu_query (self, UVCX_VIDEO_CONFIG_PROBE, UVC_GET_CUR,
-          (guchar *) & probe)) {
-    GST_WARNING_OBJECT (self, "PROBE GET_CUR error");
-    return;
+    if (!xu_query (self, UVCX_VIDEO_CONFIG_PROBE, UVC_SET_CUR,
+            (guchar *) & probe)) {
+      GST_WARNING_OBJECT (self, "PROBE SET_CUR error");
+      return;
+    }
+
+    if (!xu_query (self, UVCX_VIDEO_CONFIG_PROBE, UVC_GET_CUR,
+            (guchar *) & probe)) {
+      GST_WARNING_OBJECT (self, "PROBE GET_CUR error");
+      return;
+    }
+    GST_DEBUG_OBJECT (self, "PROBE GET_CUR : ");
+    print_probe_commit (self, &probe);
+
+    self->cached_probe_result = probe;
+    self->have_cached_probe = TRUE;
   }
-  GST_DEBUG_OBJECT (self, "PROBE GET_CUR : ");
-  print_probe_commit (self, &probe);
 
   /* Must validate the settings accepted by the encoder */
   if (!xu_query (self, UVCX_VIDEO_CONFIG_COMMIT, UVC_SET_CUR,
@@ -147,6 +147,12 @@ struct _GstUvcH264Src
   gint8 max_qp[QP_FRAMES];
   guint8 ltr_buffer_size;
   guint8 ltr_encoder_control;
+
+  /* Cached PROBE negotiation, to skip redundant USB control round trips
+   * when restarting with the same configuration */
+  gboolean have_cached_probe;
+  uvcx_video_config_probe_commit_t cached_probe_req;
+  uvcx_video_config_probe_commit_t cached_probe_result;
 };
 
 
@@ -900,7 +900,10 @@ gst_vdp_sink_show_frame (GstBaseSink * bsink, GstBuffer * outbuf)
     vdp_sink->cur_image = gst_buffer_ref (outbuf);
   }
 
-  XSync (vdp_sink->device->display, FALSE);
+  /* Flush the display request without waiting for the server to process
+   * it; presentation queue display is asynchronous and a full XSync here
+   * blocked the streaming thread on the display for every frame */
+  XFlush (vdp_sink->device->display);
 
   g_mutex_unlock (vdp_sink->x_lock);
   g_mutex_unlock (vdp_sink->flow_lock);
@@ -106,20 +106,25 @@ ensure_data (GstVdpVideoMemory * vmem)
   if (g_atomic_int_add (&vmem->refcount, 1) > 1)
     return TRUE;
 
-  /* Allocate enough room to store data */
-  vmem->cache = g_malloc (GST_VIDEO_INFO_SIZE (info));
-  vmem->cached_data[0] = vmem->cache;
-  vmem->cached_data[1] = vmem->cache + GST_VIDEO_INFO_PLANE_OFFSET (info, 1);
-  vmem->cached_data[2] = vmem->cache + GST_VIDEO_INFO_PLANE_OFFSET (info, 2);
-  vmem->destination_pitches[0] = GST_VIDEO_INFO_PLANE_STRIDE (info, 0);
-  vmem->destination_pitches[1] = GST_VIDEO_INFO_PLANE_STRIDE (info, 1);
-  vmem->destination_pitches[2] = GST_VIDEO_INFO_PLANE_STRIDE (info, 2);
-
-  GST_DEBUG ("cached_data %p %p %p",
-      vmem->cached_data[0], vmem->cached_data[1], vmem->cached_data[2]);
-  GST_DEBUG ("pitches %d %d %d",
-      vmem->destination_pitches[0],
-      vmem->destination_pitches[1], vmem->destination_pitches[2]);
+  /* The cache allocation is kept across map cycles; the surface contents
+   * change when the buffer pool recycles this memory, but the first map of
+   * each cycle re-downloads them, so only the download has to be redone */
+  if (!vmem->cache) {
+    /* Allocate enough room to store data */
+    vmem->cache = g_malloc (GST_VIDEO_INFO_SIZE (info));
+    vmem->cached_data[0] = vmem->cache;
+    vmem->cached_data[1] = vmem->cache + GST_VIDEO_INFO_PLANE_OFFSET (info, 1);
+    vmem->cached_data[2] = vmem->cache + GST_VIDEO_INFO_PLANE_OFFSET (info, 2);
+    vmem->destination_pitches[0] = GST_VIDEO_INFO_PLANE_STRIDE (info, 0);
+    vmem->destination_pitches[1] = GST_VIDEO_INFO_PLANE_STRIDE (info, 1);
+    vmem->destination_pitches[2] = GST_VIDEO_INFO_PLANE_STRIDE (info, 2);
+
+    GST_DEBUG ("cached_data %p %p %p",
+        vmem->cached_data[0], vmem->cached_data[1], vmem->cached_data[2]);
+    GST_DEBUG ("pitches %d %d %d",
+        vmem->destination_pitches[0],
+        vmem->destination_pitches[1], vmem->destination_pitches[2]);
+  }
 
 #ifndef GST_DISABLE_GST_DEBUG
   before = gst_util_get_timestamp ();
@@ -150,9 +155,8 @@ release_data (GstVdpVideoMemory * vmem)
 {
   g_return_if_fail (vmem->refcount > 0);
 
-  if (g_atomic_int_dec_and_test (&vmem->refcount)) {
-    g_free (vmem->cache);
-  }
+  /* the cache is kept for the next map cycle and freed with the memory */
+  g_atomic_int_dec_and_test (&vmem->refcount);
 }
 
 static gpointer
@@ -484,8 +484,8 @@ gst_wasapi_sink_prepare (GstAudioSink * asink, GstAudioRingBufferSpec * spec)
       goto beach;
   } else {
     if (!gst_wasapi_util_initialize_audioclient (GST_ELEMENT (self), spec,
-            self->client, self->mix_format, self->sharemode, self->low_latency,
-            FALSE, &devicep_frames))
+            self->device, &self->client, self->mix_format, self->sharemode,
+            self->low_latency, FALSE, &devicep_frames))
       goto beach;
   }
 
@@ -453,8 +453,8 @@ gst_wasapi_src_prepare (GstAudioSrc * asrc, GstAudioRingBufferSpec * spec)
       goto beach;
   } else {
     if (!gst_wasapi_util_initialize_audioclient (GST_ELEMENT (self), spec,
-            self->client, self->mix_format, self->sharemode, self->low_latency,
-            self->loopback, &devicep_frames))
+            self->device, &self->client, self->mix_format, self->sharemode,
+            self->low_latency, self->loopback, &devicep_frames))
       goto beach;
   }
 
@@ -838,7 +838,7 @@ gst_wasapi_util_get_best_buffer_sizes (GstAudioRingBufferSpec * spec,
 
 gboolean
 gst_wasapi_util_initialize_audioclient (GstElement * self,
-    GstAudioRingBufferSpec * spec, IAudioClient * client,
+    GstAudioRingBufferSpec * spec, IMMDevice * device, IAudioClient ** client,
     WAVEFORMATEX * format, guint sharemode, gboolean low_latency,
     gboolean loopback, guint * ret_devicep_frames)
 {
@@ -848,7 +848,7 @@ gst_wasapi_util_initialize_audioclient (GstElement * self,
   guint32 n_frames;
   HRESULT hr;
 
-  hr = IAudioClient_GetDevicePeriod (client, &default_period, &min_period);
+  hr = IAudioClient_GetDevicePeriod (*client, &default_period, &min_period);
   HR_FAILED_RET (hr, IAudioClient::GetDevicePeriod, FALSE);
 
   GST_INFO_OBJECT (self, "wasapi default period: %" G_GINT64_FORMAT
@@ -875,7 +875,7 @@ gst_wasapi_util_initialize_audioclient (GstElement * self,
   if (loopback)
     stream_flags |= AUDCLNT_STREAMFLAGS_LOOPBACK;
 
-  hr = IAudioClient_Initialize (client, sharemode, stream_flags,
+  hr = IAudioClient_Initialize (*client, sharemode, stream_flags,
       device_buffer_duration,
       /* This must always be 0 in shared mode */
       sharemode == AUDCLNT_SHAREMODE_SHARED ? 0 : device_period, format, NULL);
@@ -886,15 +886,28 @@ gst_wasapi_util_initialize_audioclient (GstElement * self,
         (int) device_period);
 
     /* Calculate a new aligned period. First get the aligned buffer size. */
-    hr = IAudioClient_GetBufferSize (client, &n_frames);
+    hr = IAudioClient_GetBufferSize (*client, &n_frames);
     HR_FAILED_RET (hr, IAudioClient::GetBufferSize, FALSE);
 
     device_period = (GST_SECOND / 100) * n_frames / rate;
 
+    /* We need a fresh audio client; once Initialize has failed with
+     * BUFFER_SIZE_NOT_ALIGNED, calling it again on the same instance
+     * returns AUDCLNT_E_ALREADY_INITIALIZED on most drivers */
+    IUnknown_Release (*client);
+    *client = NULL;
+    if (gst_wasapi_util_have_audioclient3 ())
+      hr = IMMDevice_Activate (device, &IID_IAudioClient3, CLSCTX_ALL, NULL,
+          (void **) client);
+    else
+      hr = IMMDevice_Activate (device, &IID_IAudioClient, CLSCTX_ALL, NULL,
+          (void **) client);
+    HR_FAILED_RET (hr, IMMDevice::Activate (IID_IAudioClient), FALSE);
+
     GST_WARNING_OBJECT (self, "trying to re-initialize with period %i "
         "(%i frames, %i rate)", (int) device_period, n_frames, rate);
 
-    hr = IAudioClient_Initialize (client, sharemode, stream_flags,
+    hr = IAudioClient_Initialize (*client, sharemode, stream_flags,
         device_period, device_period, format, NULL);
   }
   HR_FAILED_RET (hr, IAudioClient::Initialize, FALSE);
@@ -902,7 +915,7 @@ gst_wasapi_util_initialize_audioclient (GstElement * self,
   if (sharemode == AUDCLNT_SHAREMODE_EXCLUSIVE) {
     /* We use the device period for the segment size and that needs to match
      * the buffer size exactly when we write into it */
-    hr = IAudioClient_GetBufferSize (client, &n_frames);
+    hr = IAudioClient_GetBufferSize (*client, &n_frames);
     HR_FAILED_RET (hr, IAudioClient::GetBufferSize, FALSE);
 
     *ret_devicep_frames = n_frames;
@@ -125,7 +125,7 @@ void gst_wasapi_util_get_best_buffer_sizes (GstAudioRingBufferSpec * spec,
     REFERENCE_TIME * ret_buffer_duration);
 
 gboolean gst_wasapi_util_initialize_audioclient (GstElement * element,
-    GstAudioRingBufferSpec * spec, IAudioClient * client,
+    GstAudioRingBufferSpec * spec, IMMDevice * device, IAudioClient ** client,
     WAVEFORMATEX * format, guint sharemode, gboolean low_latency,
     gboolean loopback, guint * ret_devicep_frames);
 
@@ -310,6 +310,9 @@ gst_dx9screencapsrc_set_caps (GstBaseSrc * bsrc, GstCaps * caps)
       (gint) (src->src_rect.bottom - src->src_rect.top),
       src->rate_numerator, src->rate_denominator);
 
+  /* capture size may have changed */
+  gst_buffer_replace (&src->last_buffer, NULL);
+
   return TRUE;
 }
 
@@ -429,6 +432,8 @@ gst_dx9screencapsrc_stop (GstBaseSrc * bsrc)
     src->surface = NULL;
   }
 
+  gst_buffer_replace (&src->last_buffer, NULL);
+
   return TRUE;
 }
 
@@ -599,17 +604,49 @@ gst_dx9screencapsrc_create (GstPushSrc * push_src, GstBuffer ** buf)
     return GST_FLOW_ERROR;
   }
 
-  new_buf = gst_buffer_new_and_alloc (new_buf_size);
-  gst_buffer_map (new_buf, &map, GST_MAP_WRITE);
-  p_dst = (LPBYTE) map.data;
-  p_src = (LPBYTE) locked_rect.pBits;
   stride = width * 4;
-  for (i = 0; i < height; ++i) {
-    memcpy (p_dst, p_src, stride);
-    p_dst += stride;
-    p_src += locked_rect.Pitch;
+
+  /* Compare the captured surface against the previous frame; on an idle
+   * desktop this saves the buffer allocation and the full-frame copy and
+   * lets downstream see the exact same memory again */
+  new_buf = NULL;
+  if (src->last_buffer
+      && gst_buffer_get_size (src->last_buffer) == new_buf_size) {
+    gboolean unchanged = TRUE;
+
+    gst_buffer_map (src->last_buffer, &map, GST_MAP_READ);
+    p_dst = (LPBYTE) map.data;
+    p_src = (LPBYTE) locked_rect.pBits;
+    for (i = 0; i < height; ++i) {
+      if (memcmp (p_dst, p_src, stride) != 0) {
+        unchanged = FALSE;
+        break;
+      }
+      p_dst += stride;
+      p_src += locked_rect.Pitch;
+    }
+    gst_buffer_unmap (src->last_buffer, &map);
+
+    if (unchanged) {
+      GST_LOG_OBJECT (src, "frame unchanged, reusing previous buffer");
+      new_buf = gst_buffer_copy (src->last_buffer);
+    }
+  }
+
+  if (!new_buf) {
+    new_buf = gst_buffer_new_and_alloc (new_buf_size);
+    gst_buffer_map (new_buf, &map, GST_MAP_WRITE);
+    p_dst = (LPBYTE) map.data;
+    p_src = (LPBYTE) locked_rect.pBits;
+    for (i = 0; i < height; ++i) {
+      memcpy (p_dst, p_src, stride);
+      p_dst += stride;
+      p_src += locked_rect.Pitch;
+    }
+    gst_buffer_unmap (new_buf, &map);
+
+    gst_buffer_replace (&src->last_buffer, new_buf);
   }
-  gst_buffer_unmap (new_buf, &map);
 
   /* Unlock copy of front buffer */
   IDirect3DSurface9_UnlockRect (src->surface);
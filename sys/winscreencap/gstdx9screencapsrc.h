@@ -71,6 +71,9 @@ struct _GstDX9ScreenCapSrc
   IDirect3DSurface9 *surface;
   IDirect3DDevice9 *d3d9_device;
   MONITORINFO monitor_info;
+
+  /* Previous frame, reused when the capture is unchanged */
+  GstBuffer *last_buffer;
 };
 
 struct _GstDX9ScreenCapSrcClass
@@ -0,0 +1,299 @@
+/* GStreamer codec parsers throughput benchmark
+ *
+ * Copyright (C) 2020 GStreamer developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Drives the H.264, H.265 and VP9 parsers over a user supplied corpus
+ * and reports units (NALs or frames) and bytes parsed per second, so
+ * parser changes can be gated on parse throughput:
+ *
+ *   codecparsers-bench h264 stream.h264 [loops]   (Annex-B bytestream)
+ *   codecparsers-bench h265 stream.h265 [loops]   (Annex-B bytestream)
+ *   codecparsers-bench vp9  stream.ivf  [loops]   (IVF container)
+ *
+ * Timing runs on a single pinned core when the platform supports it
+ * (BENCH_CPU selects the core, default 0).
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <gst/gst.h>
+#include <gst/base/gstbytereader.h>
+#include <gst/codecparsers/gsth264parser.h>
+#include <gst/codecparsers/gsth265parser.h>
+#include <gst/codecparsers/gstvp9parser.h>
+
+#define IVF_FILE_HDR_SIZE       32
+#define IVF_FRAME_HDR_SIZE      12
+
+typedef struct
+{
+  guint64 units;                /* NALs or frames */
+  guint64 bytes;
+} BenchStats;
+
+static void
+pin_to_core (void)
+{
+#ifdef __linux__
+  cpu_set_t set;
+  int cpu = 0;
+  const char *env = g_getenv ("BENCH_CPU");
+
+  if (env)
+    cpu = atoi (env);
+
+  CPU_ZERO (&set);
+  CPU_SET (cpu, &set);
+  if (sched_setaffinity (0, sizeof (set), &set) != 0)
+    g_printerr ("warning: could not pin to core %d\n", cpu);
+#else
+  g_printerr ("warning: core pinning not supported on this platform\n");
+#endif
+}
+
+static gboolean
+bench_h264 (const guint8 * data, gsize size, BenchStats * stats)
+{
+  GstH264NalParser *parser = gst_h264_nal_parser_new ();
+  GstH264NalUnit nalu;
+  GstH264ParserResult res;
+  guint offset = 0;
+
+  while (TRUE) {
+    res = gst_h264_parser_identify_nalu (parser, data, offset, size, &nalu);
+    if (res != GST_H264_PARSER_OK && res != GST_H264_PARSER_NO_NAL_END)
+      break;
+
+    if (nalu.type >= GST_H264_NAL_SLICE && nalu.type <= GST_H264_NAL_SLICE_IDR) {
+      GstH264SliceHdr slice;
+
+      if (gst_h264_parser_parse_slice_hdr (parser, &nalu, &slice, TRUE,
+              TRUE) != GST_H264_PARSER_OK)
+        goto parse_error;
+    } else {
+      if (gst_h264_parser_parse_nal (parser, &nalu) != GST_H264_PARSER_OK)
+        goto parse_error;
+    }
+
+    stats->units++;
+    stats->bytes += nalu.size;
+
+    if (res == GST_H264_PARSER_NO_NAL_END)
+      break;
+    offset = nalu.offset + nalu.size;
+  }
+
+  gst_h264_nal_parser_free (parser);
+  return TRUE;
+
+parse_error:
+  g_printerr ("h264: failed to parse NAL type %d at offset %u\n",
+      nalu.type, nalu.offset);
+  gst_h264_nal_parser_free (parser);
+  return FALSE;
+}
+
+static inline gboolean
+h265_nal_is_slice (guint8 type)
+{
+  return (type <= GST_H265_NAL_SLICE_RASL_R) ||
+      (type >= GST_H265_NAL_SLICE_BLA_W_LP && type <= GST_H265_NAL_SLICE_CRA_NUT);
+}
+
+static gboolean
+bench_h265 (const guint8 * data, gsize size, BenchStats * stats)
+{
+  GstH265Parser *parser = gst_h265_parser_new ();
+  GstH265NalUnit nalu;
+  GstH265ParserResult res;
+  guint offset = 0;
+
+  while (TRUE) {
+    res = gst_h265_parser_identify_nalu (parser, data, offset, size, &nalu);
+    if (res != GST_H265_PARSER_OK && res != GST_H265_PARSER_NO_NAL_END)
+      break;
+
+    if (h265_nal_is_slice (nalu.type)) {
+      GstH265SliceHdr slice;
+
+      if (gst_h265_parser_parse_slice_hdr (parser, &nalu,
+              &slice) != GST_H265_PARSER_OK)
+        goto parse_error;
+      gst_h265_slice_hdr_free (&slice);
+    } else {
+      if (gst_h265_parser_parse_nal (parser, &nalu) != GST_H265_PARSER_OK)
+        goto parse_error;
+    }
+
+    stats->units++;
+    stats->bytes += nalu.size;
+
+    if (res == GST_H265_PARSER_NO_NAL_END)
+      break;
+    offset = nalu.offset + nalu.size;
+  }
+
+  gst_h265_parser_free (parser);
+  return TRUE;
+
+parse_error:
+  g_printerr ("h265: failed to parse NAL type %d at offset %u\n",
+      nalu.type, nalu.offset);
+  gst_h265_parser_free (parser);
+  return FALSE;
+}
+
+static gboolean
+bench_vp9 (const guint8 * data, gsize size, BenchStats * stats)
+{
+  GstVp9Parser *parser;
+  GstByteReader br;
+  guint32 magic, frame_size;
+  guint16 hdr_size;
+
+  gst_byte_reader_init (&br, data, size);
+
+  if (!gst_byte_reader_get_uint32_le (&br, &magic) ||
+      magic != GST_MAKE_FOURCC ('D', 'K', 'I', 'F')) {
+    g_printerr ("vp9: not an IVF file\n");
+    return FALSE;
+  }
+  if (!gst_byte_reader_skip (&br, 2) ||
+      !gst_byte_reader_get_uint16_le (&br, &hdr_size) ||
+      hdr_size < IVF_FILE_HDR_SIZE ||
+      !gst_byte_reader_set_pos (&br, hdr_size)) {
+    g_printerr ("vp9: broken IVF file header\n");
+    return FALSE;
+  }
+
+  parser = gst_vp9_parser_new ();
+
+  while (gst_byte_reader_get_remaining (&br) >= IVF_FRAME_HDR_SIZE) {
+    const guint8 *frame;
+    GstVp9FrameHdr frame_hdr;
+
+    frame_size = gst_byte_reader_get_uint32_le_unchecked (&br);
+    gst_byte_reader_skip_unchecked (&br, 8);    /* pts */
+
+    if (!gst_byte_reader_get_data (&br, frame_size, &frame)) {
+      g_printerr ("vp9: truncated frame of %u bytes\n", frame_size);
+      gst_vp9_parser_free (parser);
+      return FALSE;
+    }
+
+    if (gst_vp9_parser_parse_frame_header (parser, &frame_hdr, frame,
+            frame_size) != GST_VP9_PARSER_OK) {
+      g_printerr ("vp9: failed to parse frame header\n");
+      gst_vp9_parser_free (parser);
+      return FALSE;
+    }
+
+    stats->units++;
+    stats->bytes += frame_size;
+  }
+
+  gst_vp9_parser_free (parser);
+  return TRUE;
+}
+
+int
+main (int argc, char **argv)
+{
+  const gchar *codec, *filename;
+  gchar *data = NULL;
+  gsize size = 0;
+  guint loops = 32, i;
+  gboolean (*bench) (const guint8 *, gsize, BenchStats *);
+  BenchStats stats = { 0, };
+  GError *error = NULL;
+  gint64 start, elapsed;
+  gdouble secs;
+
+  gst_init (&argc, &argv);
+
+  if (argc < 3) {
+    g_printerr ("usage: %s [h264|h265|vp9] FILE [loops]\n", argv[0]);
+    return 1;
+  }
+
+  codec = argv[1];
+  filename = argv[2];
+  if (argc > 3)
+    loops = atoi (argv[3]);
+  if (loops == 0)
+    loops = 1;
+
+  if (strcmp (codec, "h264") == 0)
+    bench = bench_h264;
+  else if (strcmp (codec, "h265") == 0)
+    bench = bench_h265;
+  else if (strcmp (codec, "vp9") == 0)
+    bench = bench_vp9;
+  else {
+    g_printerr ("unknown codec '%s'\n", codec);
+    return 1;
+  }
+
+  if (!g_file_get_contents (filename, &data, &size, &error)) {
+    g_printerr ("could not read %s: %s\n", filename, error->message);
+    g_error_free (error);
+    return 1;
+  }
+
+  pin_to_core ();
+
+  /* warm-up pass, also validates the corpus */
+  if (!bench ((const guint8 *) data, size, &stats)) {
+    g_free (data);
+    return 1;
+  }
+  memset (&stats, 0, sizeof (stats));
+
+  start = g_get_monotonic_time ();
+  for (i = 0; i < loops; i++) {
+    if (!bench ((const guint8 *) data, size, &stats)) {
+      g_free (data);
+      return 1;
+    }
+  }
+  elapsed = g_get_monotonic_time () - start;
+  secs = (gdouble) elapsed / G_USEC_PER_SEC;
+
+  g_print ("%s: %" G_GUINT64_FORMAT " units, %" G_GUINT64_FORMAT " bytes "
+      "in %.3f s => %.0f units/s, %.2f MB/s\n",
+      codec, stats.units, stats.bytes, secs,
+      (gdouble) stats.units / secs, (gdouble) stats.bytes / secs / 1e6);
+
+  g_free (data);
+  return 0;
+}
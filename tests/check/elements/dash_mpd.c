@@ -433,6 +433,7 @@ GST_START_TEST (dash_mpdparser_period_segmentBase)
       "  <Period>"
       "    <SegmentBase timescale=\"123456\""
       "                 presentationTimeOffset=\"123456789\""
+      "                 availabilityTimeOffset=\"4.5\""
       "                 indexRange=\"100-200\""
       "                 indexRangeExact=\"true\">"
       "    </SegmentBase></Period></MPD>";
@@ -447,6 +448,7 @@ GST_START_TEST (dash_mpdparser_period_segmentBase)
   segmentBase = periodNode->SegmentBase;
   assert_equals_uint64 (segmentBase->timescale, 123456);
   assert_equals_uint64 (segmentBase->presentationTimeOffset, 123456789);
+  assert_equals_float (segmentBase->availabilityTimeOffset, 4.5);
   assert_equals_uint64 (segmentBase->indexRange->first_byte_pos, 100);
   assert_equals_uint64 (segmentBase->indexRange->last_byte_pos, 200);
   assert_equals_int (segmentBase->indexRangeExact, 1);
@@ -5072,6 +5074,45 @@ GST_START_TEST (dash_mpdparser_multipleSegmentURL)
 
 GST_END_TEST;
 
+/*
+ * Test detection of unchanged manifest content
+ *
+ */
+GST_START_TEST (dash_mpdparser_unchanged_manifest)
+{
+  const gchar *xml =
+      "<?xml version=\"1.0\"?>"
+      "<MPD xmlns=\"urn:mpeg:dash:schema:mpd:2011\""
+      "     profiles=\"urn:mpeg:dash:profile:isoff-main:2011\"> </MPD>";
+  const gchar *other_xml =
+      "<?xml version=\"1.0\"?>"
+      "<MPD xmlns=\"urn:mpeg:dash:schema:mpd:2011\""
+      "     profiles=\"urn:mpeg:dash:profile:isoff-on-demand:2011\"> </MPD>";
+
+  gboolean ret;
+  GstMpdClient *mpdclient = gst_mpd_client_new ();
+
+  /* nothing parsed yet, nothing to compare against */
+  ret = gst_mpd_client_manifest_unchanged (mpdclient, xml,
+      (gint) strlen (xml));
+  assert_equals_int (ret, FALSE);
+
+  ret = gst_mpd_parse (mpdclient, xml, (gint) strlen (xml));
+  assert_equals_int (ret, TRUE);
+
+  ret = gst_mpd_client_manifest_unchanged (mpdclient, xml,
+      (gint) strlen (xml));
+  assert_equals_int (ret, TRUE);
+
+  ret = gst_mpd_client_manifest_unchanged (mpdclient, other_xml,
+      (gint) strlen (other_xml));
+  assert_equals_int (ret, FALSE);
+
+  gst_mpd_client_free (mpdclient);
+}
+
+GST_END_TEST;
+
 /*
  * Test parsing empty xml string
  *
@@ -6002,6 +6043,7 @@ dash_suite (void)
   tcase_add_test (tc_complexMPD, dash_mpdparser_segment_template);
   tcase_add_test (tc_complexMPD, dash_mpdparser_segment_timeline);
   tcase_add_test (tc_complexMPD, dash_mpdparser_multiple_inherited_segmentURL);
+  tcase_add_test (tc_complexMPD, dash_mpdparser_unchanged_manifest);
 
   /* tests checking the parsing of missing/incomplete attributes of xml */
   tcase_add_test (tc_negativeTests, dash_mpdparser_missing_xml);
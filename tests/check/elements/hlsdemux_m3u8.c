@@ -701,6 +701,41 @@ GST_START_TEST (test_update_playlist)
 
 GST_END_TEST;
 
+GST_START_TEST (test_update_playlist_delta)
+{
+  GstHLSMasterPlaylist *master;
+  GstM3U8 *pl;
+  GstM3U8MediaFile *file;
+  gchar *live_pl;
+  gboolean ret;
+
+  master = load_playlist (LIVE_PLAYLIST);
+  pl = master->default_variant->m3u8;
+  assert_equals_int (g_list_length (pl->files), 4);
+
+  /* An update that only appends entries should keep the already parsed
+   * segments and continue the media sequence for the new ones */
+  live_pl = g_strdup_printf ("%s\n%s\n%s\n%s\n%s", LIVE_PLAYLIST,
+      "#EXTINF:8,", "https://priv.example.com/fileSequence2684.ts",
+      "#EXTINF:8,", "https://priv.example.com/fileSequence2685.ts");
+  ret = gst_m3u8_update (pl, g_strdup (live_pl));
+  assert_equals_int (ret, TRUE);
+  assert_equals_int (g_list_length (pl->files), 6);
+  file = GST_M3U8_MEDIA_FILE (g_list_nth_data (pl->files, 4));
+  assert_equals_int (file->sequence, 2684);
+  file = GST_M3U8_MEDIA_FILE (g_list_nth_data (pl->files, 5));
+  assert_equals_int (file->sequence, 2685);
+
+  /* An identical refresh must be a no-op */
+  ret = gst_m3u8_update (pl, live_pl);
+  assert_equals_int (ret, TRUE);
+  assert_equals_int (g_list_length (pl->files), 6);
+
+  gst_hls_master_playlist_unref (master);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_playlist_media_files)
 {
   GstHLSMasterPlaylist *master;
@@ -1421,6 +1456,7 @@ hlsdemux_suite (void)
   tcase_add_test (tc_m3u8, test_playlist_with_encryption);
   tcase_add_test (tc_m3u8, test_update_invalid_playlist);
   tcase_add_test (tc_m3u8, test_update_playlist);
+  tcase_add_test (tc_m3u8, test_update_playlist_delta);
   tcase_add_test (tc_m3u8, test_playlist_media_files);
   tcase_add_test (tc_m3u8, test_playlist_byte_range_media_files);
   tcase_add_test (tc_m3u8, test_get_next_fragment);